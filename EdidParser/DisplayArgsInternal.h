@@ -4948,12 +4948,25 @@ typedef struct _DD_JOINT_TARGET_PROPERTIES_SINGLE
     DDU32 MaxRRCollageDisjoinedTimingModeIndex;
 } DD_JOINT_TARGET_PROPERTIES_SINGLE;
 
+// Caller owned scratch memory for EDID/Display ID parsing.
+// Allocated once, each parse call bump-allocates its temp buffers from it and resets it on entry.
+// Display ID block indexes outlive a parse call, so that caps and modes passes over a buffer walk each section once.
+typedef struct _DD_PARSER_CONTEXT
+{
+    DDU8* pArena;                                       // Scratch memory, allocated by DisplayInfoParserContextInit()
+    DDU32 ArenaSizeInBytes;                             // Total size of pArena
+    DDU32 ArenaUsedInBytes;                             // Bytes handed out since last reset
+    struct _DID_BLOCK_INDEX_CACHE* pDidBlockIndexCache; // Display ID block indexes of pDidIndexedBuf, allocated by DisplayInfoParserContextInit()
+    const DDU8* pDidIndexedBuf;                         // Buffer indexed in pDidBlockIndexCache, NULL after DisplayInfoParserContextReset()
+} DD_PARSER_CONTEXT;
+
 typedef struct _DD_GET_EDID_CAPS
 {
     DD_IN DDU8* pEdidOrDisplayIDBuf;    // EDID/Display ID Data (All EDID/Display Blocks are passed at once)
     DD_IN DDU32 BufSizeInBytes;         // EDID/Display ID Size (Total size, e.g. 1 block = 128bytes, 2 blocks = 256 bytes, etc...)
     DD_IN DDU8 NumEdidExtensionsParsed; // Number of extenblock successfully parsed
     DD_OUT DD_DISPLAY_CAPS* pData;      // Mode Table filled by parser with modes found in EDID
+    DD_IN DD_PARSER_CONTEXT* pParserContext; // Optional scratch memory for parser, NULL to allocate per call
 } DD_GET_EDID_CAPS;
 
 typedef struct _DD_SINK_EDID_DATA
@@ -5044,8 +5057,37 @@ typedef struct _DD_GET_EDID_MODES
     DD_OUT DD_TABLE* pModeTable;        // Mode Table filled by parser with modes found in EDID
     DD_TARGET_DESCRIPTOR TargetDesc;
     DD_IN DD_EDID_TYPE EdidType; // Type of Edid (BIOS/FAKE/Display/Virtual etc)
+    DD_IN DD_PARSER_CONTEXT* pParserContext; // Optional scratch memory for parser, NULL to allocate per call
 } DD_GET_EDID_MODES;
 
+typedef struct _DD_GET_EDID_CAPS_AND_MODES
+{
+    DD_IN DDU8* pEdidOrDisplayIDBuf;    // EDID/Display ID Data (All EDID/Display Blocks are passed at once)
+    DD_IN DDU32 BufSizeInBytes;         // EDID/Display ID Size (Total size, e.g. 1 block = 128bytes, 2 blocks = 256 bytes, etc...)
+    DD_IN DDU8 NumEdidExtensionsParsed; // Number of extenblock successfully parsed
+    DD_OUT DD_DISPLAY_CAPS* pData;      // Caps filled by parser, same as DD_GET_EDID_CAPS::pData
+    DD_OUT DD_TABLE* pModeTable;        // Mode Table filled by parser with modes found in EDID
+    DD_IN DD_PARSER_CONTEXT* pParserContext; // Optional scratch memory for parser, NULL to allocate per call
+} DD_GET_EDID_CAPS_AND_MODES;
+
+typedef struct _DD_EDID_BLOCK_STATUS
+{
+    DDU32 Offset;      // Offset of EDID block or Display ID section in buffer
+    DDU32 SizeInBytes; // EDID_BLOCK_SIZE, or header + data + checksum bytes of a Display ID section
+    DDU8 Tag;          // EDID_EXTN_TAG of EDID extensions, version and revision of EDID base block and Display ID sections
+    DDSTATUS Status;   // DDS_SUCCESS, DDS_INVALID_DATA if a check failed, DDS_BUFFER_TOO_SMALL if cut off by end of buffer
+} DD_EDID_BLOCK_STATUS;
+
+typedef struct _DD_VALIDATE_EDID_BLOCKS
+{
+    DD_IN DDU8* pEdidOrDisplayIDBuf; // EDID/Display ID Data (All EDID/Display Blocks are passed at once)
+    DD_IN DDU32 BufSizeInBytes;      // EDID/Display ID Size
+    DD_OUT DD_BOOL IsDisplayIdBaseBlock;
+    DD_OUT DDU32 NumBlocks;      // Entries filled in Blocks, stops at first block cut off by end of buffer
+    DD_OUT DDU32 NumValidBlocks; // Entries of Blocks with DDS_SUCCESS
+    DD_OUT DD_EDID_BLOCK_STATUS Blocks[MAX_EDID_BLOCKS + 1]; // EDID base block + up to 255 extensions, or up to 256 Display ID sections
+} DD_VALIDATE_EDID_BLOCKS;
+
 typedef struct _DD_INIT_DISPLAY_ARGS
 {
     DD_ENCODER_INITIALIZATION_DATA* pEncoderInitData;
@@ -41,8 +41,10 @@ static DDSTATUS AddYCbCr444SamplingMode(ADD_MODES* pAddModes, EDID_DATA* pEdidDa
 static DDSTATUS AddYCbCr422SamplingMode(ADD_MODES* pAddModes, EDID_DATA* pEdidData);
 
 // EDID parser related functions
-void EdidParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
+void EdidParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, EDID_DATA* pCapsEdidData);
 DDSTATUS EdidParserVerifyDataBlocks(DDU8* pEdidOrDisplayIDBuf, DDU32 BufSizeInBytes, DDU8 BlockNum);
+static DD_BOOL EdidParserIsValidExtnBlock(const DDU8* pExtnBlock);
+static DD_BOOL EdidParserIsSupportedEdidVersion(const EDID_BASE_BLOCK* pEdidBaseBlock);
 void EdidParserGetEdidCaps(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 void EdidParserGetBaseBlockMonitorDetails(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 void EdidParserUpdateMaxDotClockSupport(DDU64 EdidMaxPixelClockInMHz, EDID_DATA* pEdidData);
@@ -52,8 +54,8 @@ void EdidParserParseBaseStdModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pE
 void EdidParserParseEstTimingIIIBlock(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 static DDSTATUS EdidParserAddBaseBlockDTDsToModelist(EDID_DATA* pEdidData, DD_TIMING_INFO* pTimingInfo);
 void EdidParserParseBaseBlockDTDs(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
-void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
-void EdidParserParseDisplayIdExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
+void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, EDID_DATA* pCapsEdidData);
+void EdidParserParseDisplayIdExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, EDID_DATA* pCapsEdidData);
 void EdidGetSupportedBPCFromBaseBlock(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 void EdidParserMarkVfpdbTimingsAsPreferred(EDID_DATA* pEdidData);
 DDSTATUS DisplayInfoParserParseBaseBlockDTDsForeDP(DDU8* pEdidOrDisplayIDBuf, DDU32 BufSizeInBytes, DD_DTD_MODE_INFO* pDtDModeinfo);
@@ -69,8 +71,9 @@ void CeInfoParserUpdateCeModeList(EDID_DATA* pEdidData, CE_MODE_LIST* pCeModeDat
 DD_BOOL CeInfoParserIsModeAlreadyAdded(DD_TIMING_INFO* pTimingInfo, EDID_DATA* pEdidData, DDU8 VicId);
 DDSTATUS CeInfoParserAddPrModes(DD_TIMING_INFO* pTimingInfo, EDID_DATA* pEdidData);
 DDSTATUS CeInfoParserAddCeModesToList(EDID_DATA* pEdidData, CE_MODE_LIST* pCeModeList);
+static void CeInfoParserIndexDataBlocks(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs);
 static void CeInfoParserGetCeaExtnBlockByID(GET_BLOCK_BY_ID_ARGS* pGetBlockById);
-void CeInfoParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8 BlockIdOrTag, DDU8 CeaExtendedTag, DDU32 IEEERegNum, DDU8 InstanceOfBlock, DDU8* pInputBuf, DDU32 InputBlockLength);
+void CeInfoParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8 BlockIdOrTag, DDU8 CeaExtendedTag, DDU32 IEEERegNum, DDU8 InstanceOfBlock, PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs);
 static DDU8 CeInfoParserGetBlockCount(GET_BLOCK_BY_ID_ARGS* pGetBlockById);
 DD_BOOL CeInfoParserIsVicPresentInList(DDU32 VicCount, CE_MODE_LIST* pCeModeList, DDU32 VicID);
 DDSTATUS CeInfoParserParseDisplayIDTimings(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID_DATA* pEdidData);
@@ -101,9 +104,13 @@ void CeInfoParserGetSupportedBPCFromCeHFVSDBBlock(PARSE_EXTBLK_ARGS* pParseExtDa
 void CeInfoParserGetSupportedBPCFromCeHdmiVSDBBlock(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID_DATA* pEdidData);
 static DDU8 CeInfoParserGetExtensionCountFromHdmiEeodb(DDU8* pEdidData);
 // Common functions between DisplayID 1.3 & DisplayID 2.0
-void DisplayIdParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8* pEdidOrDisplayIDBuf, DDU8 BlockIdOrTag, DDU8 InstanceOfBlock);
+void DisplayIdParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8* pEdidOrDisplayIDBuf, DDU8 BlockIdOrTag, DDU8 InstanceOfBlock, EDID_DATA* pEdidData);
+static const DID_BLOCK_INDEX* DisplayIdParserGetBlockIndex(EDID_DATA* pEdidData, DDU8* pEdidOrDisplayIDBuf);
 DDSTATUS DisplayIdParserGetDisplayIDBlockByID(GET_BLOCK_BY_ID_ARGS* pGetBlockById);
 DDSTATUS DisplayIdParserVerifyDataBlocks(DDU8* pEdidOrDisplayIDBuf);
+static DD_BOOL DisplayIdParserIsSectionInBuffer(const DDU8* pSection, DDU32 BufSizeInBytes);
+static void DisplayIdParserGetSectionModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, DDU8 RevisionAndVersion);
+static void DisplayIdParserGetSectionCaps(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, DDU8 RevisionAndVersion);
 void DisplayIdParserParseTiledTopologyBlock(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, DDU8 TiledDisplayTag);
 DDSTATUS DisplayIdParserParseDTDTiming(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, DDU8 DTDTimingTag, DDU32 DotClockScale);
 void DisplayIdParserGetProductIDDetails(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, DDU8 ProductTag);
@@ -119,6 +126,7 @@ void DisplayIdParserGetMonitorDescriptorDetails(DD_GET_EDID_MODES* pGetEdidModes
 void DisplayIdParserParseType1Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 void DisplayIdParserParseType2Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 void DisplayIdParserParseType3Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
+static void DisplayIdParserAddType3Timings(CREATE_TIMING_ARGS* pCreateTimingArgs, DD_BOOL* pIsPreferred, DDU32 NumTimings, EDID_DATA* pEdidData);
 void DisplayIdParserParseType4Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 void DisplayIdParserParseStandardTiming(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
 void DisplayIdParserParseCeaTiming(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData);
@@ -158,6 +166,9 @@ static const ASPECT_RATIO DidAspectRatioTable[] = {
  };
  */
 
+// Alignment of scratch buffers handed out from DD_PARSER_CONTEXT arena
+#define DD_PARSER_ARENA_ALIGNMENT 8
+
 static const ASPECT_RATIO EdidAspectRatioTable[] = {
     { 16, 10 },
     { 4, 3 },
@@ -182,6 +193,27 @@ static const DDU16 MaxCLLFromPeakLuminanceIndex[DD_MAX_PEAK_LUMINANCE_INDEX] = {
 
 static const DDU16 MaxFALLFromFullFramePeakLuminanceIndexAndPeakLuminanceIndex[DD_MAX_PEAK_LUMINANCE_INDEX] = { 0, 20, 30, 40, 50, 60, 80, 100, 120, 150, 200, 250, 300, 400, 600, 800 };
 
+// Index into g_SupportedCeShortVideoModes for every SVD byte, generated at compile time from the byte itself.
+// Upto VIC 64 bit 7 is the native format flag, from VIC 65 the whole byte is the VIC (CTA-861-G Section 7.5.1).
+// Forbidden and unknown VICs map to entry 0, which has no timing.
+#define CE_SVD_VIC(Svd) ((((Svd)&CEA_SHORT_VIDEO_DESCRIPTOR_CODE_MASK) <= CEA_MAX_VIC_SUPPORTING_NATIVE_FORMAT) ? ((Svd)&CEA_SHORT_VIDEO_DESCRIPTOR_CODE_MASK) : (Svd))
+#define CE_SVD_VIC_TABLE_INDEX(Svd) ((IS_VIC_IN_FORBIDDEN_RANGE(CE_SVD_VIC(Svd)) || (CE_SVD_VIC(Svd) > MAX_CE_VICID)) ? 0 : CE_VIC_TABLE_INDEX(CE_SVD_VIC(Svd)))
+#define CE_SVD_MAP_4(Svd) CE_SVD_VIC_TABLE_INDEX(Svd), CE_SVD_VIC_TABLE_INDEX((Svd) + 1), CE_SVD_VIC_TABLE_INDEX((Svd) + 2), CE_SVD_VIC_TABLE_INDEX((Svd) + 3)
+#define CE_SVD_MAP_16(Svd) CE_SVD_MAP_4(Svd), CE_SVD_MAP_4((Svd) + 4), CE_SVD_MAP_4((Svd) + 8), CE_SVD_MAP_4((Svd) + 12)
+
+static const DDU8 CeSvdToVicTableIndex[256] = {
+    CE_SVD_MAP_16(0x00), CE_SVD_MAP_16(0x10), CE_SVD_MAP_16(0x20), CE_SVD_MAP_16(0x30), CE_SVD_MAP_16(0x40), CE_SVD_MAP_16(0x50), CE_SVD_MAP_16(0x60), CE_SVD_MAP_16(0x70),
+    CE_SVD_MAP_16(0x80), CE_SVD_MAP_16(0x90), CE_SVD_MAP_16(0xA0), CE_SVD_MAP_16(0xB0), CE_SVD_MAP_16(0xC0), CE_SVD_MAP_16(0xD0), CE_SVD_MAP_16(0xE0), CE_SVD_MAP_16(0xF0),
+};
+
+C_ASSERT(CE_SVD_VIC_TABLE_INDEX(0x81) == 1);   // Native VIC 1
+C_ASSERT(CE_SVD_VIC_TABLE_INDEX(0xC0) == 64);  // Native VIC 64
+C_ASSERT(CE_SVD_VIC_TABLE_INDEX(0x41) == 65);  // VIC 65
+C_ASSERT(CE_SVD_VIC_TABLE_INDEX(0x80) == 0);   // Reserved
+C_ASSERT(CE_SVD_VIC_TABLE_INDEX(0xC1) == 128); // VIC 193
+C_ASSERT(CE_SVD_VIC_TABLE_INDEX(MAX_CE_VICID) == CE_VIC_TABLE_SIZE - 1);
+C_ASSERT(CE_SVD_VIC_TABLE_INDEX(MAX_CE_VICID + 1) == 0);
+
 /***************************************************************
  *
  * Function implementation
@@ -194,6 +226,169 @@ static const DDU16 MaxFALLFromFullFramePeakLuminanceIndexAndPeakLuminanceIndex[D
   *
   ***************************************************************/
 
+/***************************************************************
+ * @brief Allocates scratch memory for parser from context arena.
+ *
+ *      Falls back to DD_ALLOC_MEM when no context is passed.
+ *      Memory from arena is not zeroed, callers zero what they use.
+ *
+ * @param pParserContext
+ * @param SizeInBytes
+ * @return void*
+ ***************************************************************/
+static void* DisplayInfoParserAllocScratch(DD_PARSER_CONTEXT* pParserContext, DDU32 SizeInBytes)
+{
+    void* pMem;
+
+    if (NULL == pParserContext)
+    {
+        return DD_ALLOC_MEM(SizeInBytes);
+    }
+
+    SizeInBytes = DD_ALIGN(SizeInBytes, DD_PARSER_ARENA_ALIGNMENT);
+    if ((NULL == pParserContext->pArena) || (SizeInBytes > (pParserContext->ArenaSizeInBytes - pParserContext->ArenaUsedInBytes)))
+    {
+        return NULL;
+    }
+
+    pMem = pParserContext->pArena + pParserContext->ArenaUsedInBytes;
+    pParserContext->ArenaUsedInBytes += SizeInBytes;
+
+    return pMem;
+}
+
+/***************************************************************
+ * @brief Releases scratch memory got from DisplayInfoParserAllocScratch().
+ *
+ *      Arena memory is given back only on context reset.
+ *
+ * @param pParserContext
+ * @param ppMem
+ * @return void
+ ***************************************************************/
+static void DisplayInfoParserFreeScratch(DD_PARSER_CONTEXT* pParserContext, void** ppMem)
+{
+    if (NULL == pParserContext)
+    {
+        DD_SAFE_FREE(*ppMem);
+    }
+    *ppMem = NULL;
+}
+
+/***************************************************************
+ * @brief Returns Display ID block index cache for a parse pass over a buffer.
+ *
+ *      With a context the cache of the context is returned, kept as is if it already
+ *      indexes pEdidOrDisplayIDBuf, so that a later pass over the buffer reuses the indexes.
+ *      Without a context a cache is allocated for the pass, *ppCacheToFree is set to it.
+ *
+ * @param pParserContext
+ * @param pEdidOrDisplayIDBuf
+ * @param ppCacheToFree Set to cache the caller has to free, NULL if there is none
+ * @return DID_BLOCK_INDEX_CACHE* NULL if allocation failed, lookups walk the sections then
+ ***************************************************************/
+static DID_BLOCK_INDEX_CACHE* DisplayInfoParserGetDidBlockIndexCache(DD_PARSER_CONTEXT* pParserContext, const DDU8* pEdidOrDisplayIDBuf, DID_BLOCK_INDEX_CACHE** ppCacheToFree)
+{
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCache;
+
+    *ppCacheToFree = NULL;
+
+    if (NULL == pParserContext)
+    {
+        pDidBlockIndexCache = (DID_BLOCK_INDEX_CACHE*)(DD_ALLOC_MEM(sizeof(DID_BLOCK_INDEX_CACHE)));
+        if (NULL != pDidBlockIndexCache)
+        {
+            pDidBlockIndexCache->NumSections = 0;
+        }
+        *ppCacheToFree = pDidBlockIndexCache;
+        return pDidBlockIndexCache;
+    }
+
+    pDidBlockIndexCache = pParserContext->pDidBlockIndexCache;
+    if ((NULL != pDidBlockIndexCache) && (pParserContext->pDidIndexedBuf != pEdidOrDisplayIDBuf))
+    {
+        pDidBlockIndexCache->NumSections = 0;
+        pParserContext->pDidIndexedBuf = pEdidOrDisplayIDBuf;
+    }
+
+    return pDidBlockIndexCache;
+}
+
+/***************************************************************
+ * @brief Allocates arena and Display ID block index cache for parser context.
+ *
+ *      Arena is sized for the scratch buffers of one parse call,
+ *      so that repeated parse calls with the context don't hit the heap.
+ *
+ * @param pParserContext
+ * @return DDSTATUS
+ ***************************************************************/
+DDSTATUS DisplayInfoParserContextInit(DD_PARSER_CONTEXT* pParserContext)
+{
+    DDU32 ArenaSizeInBytes;
+
+    DISP_FUNC_ENTRY();
+
+    DDASSERT(pParserContext);
+
+    // Internal caps + CE mode lists of modes and caps + temp modes list, see DisplayInfoParserGetEdidCapsAndModes()
+    ArenaSizeInBytes = DD_ALIGN((DDU32)sizeof(DD_DISPLAY_CAPS), DD_PARSER_ARENA_ALIGNMENT);
+    ArenaSizeInBytes += 2 * DD_ALIGN((DDU32)(sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED), DD_PARSER_ARENA_ALIGNMENT);
+    ArenaSizeInBytes += DD_ALIGN((DDU32)(sizeof(MODES_LIST) * MAX_MODES_DEFINED), DD_PARSER_ARENA_ALIGNMENT);
+
+    pParserContext->ArenaUsedInBytes = 0;
+    pParserContext->pDidIndexedBuf = NULL;
+    pParserContext->pArena = (DDU8*)DD_ALLOC_MEM(ArenaSizeInBytes);
+    pParserContext->pDidBlockIndexCache = (DID_BLOCK_INDEX_CACHE*)DD_ALLOC_MEM(sizeof(DID_BLOCK_INDEX_CACHE));
+    if ((NULL == pParserContext->pArena) || (NULL == pParserContext->pDidBlockIndexCache))
+    {
+        DD_SAFE_FREE(pParserContext->pArena);
+        DD_SAFE_FREE(pParserContext->pDidBlockIndexCache);
+        pParserContext->ArenaSizeInBytes = 0;
+        DISP_FUNC_EXIT_W_STATUS(DDS_NO_MEMORY);
+        return DDS_NO_MEMORY;
+    }
+    pParserContext->ArenaSizeInBytes = ArenaSizeInBytes;
+    pParserContext->pDidBlockIndexCache->NumSections = 0;
+
+    DISP_FUNC_EXIT_W_STATUS(DDS_SUCCESS);
+    return DDS_SUCCESS;
+}
+
+/***************************************************************
+ * @brief Gives back all scratch memory handed out from parser context and drops its Display ID block indexes.
+ *
+ *      Parse calls give back scratch memory on entry, but keep the block indexes of the buffer they parse.
+ *      Callers reset before parsing new data in a buffer parsed before with the context.
+ *
+ * @param pParserContext
+ * @return void
+ ***************************************************************/
+void DisplayInfoParserContextReset(DD_PARSER_CONTEXT* pParserContext)
+{
+    DDASSERT(pParserContext);
+
+    pParserContext->ArenaUsedInBytes = 0;
+    pParserContext->pDidIndexedBuf = NULL;
+}
+
+/***************************************************************
+ * @brief Frees arena of parser context.
+ *
+ * @param pParserContext
+ * @return void
+ ***************************************************************/
+void DisplayInfoParserContextFree(DD_PARSER_CONTEXT* pParserContext)
+{
+    DDASSERT(pParserContext);
+
+    DD_SAFE_FREE(pParserContext->pArena);
+    DD_SAFE_FREE(pParserContext->pDidBlockIndexCache);
+    pParserContext->ArenaSizeInBytes = 0;
+    pParserContext->ArenaUsedInBytes = 0;
+    pParserContext->pDidIndexedBuf = NULL;
+}
+
   /***************************************************************
    * @brief  This function parses entire EDID/DisplayID block and.
    *
@@ -214,8 +409,12 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
     DD_GET_EDID_MODES GetEdidModes;
     DDU8* pEdidOrDisplayIDBuf = NULL;
     DDU8 Count, Did2ExtensionCount, CeaBlockTag;
+    DDU32 RemainingSizeInBytes;
     GET_BLOCK_BY_ID_ARGS GetBlockById;
     MODES_LIST* pModes;
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCache;
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCacheToFree;
+    DD_PARSER_CONTEXT* pParserContext;
 
     DISP_FUNC_ENTRY();
 
@@ -223,7 +422,13 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
     DDASSERT(pGetEdidModes);
     DDASSERT(pGetEdidModes->pEdidOrDisplayIDBuf);
 
-    pData = (DD_DISPLAY_CAPS*)(DD_ALLOC_MEM(sizeof(DD_DISPLAY_CAPS)));
+    pParserContext = pGetEdidModes->pParserContext;
+    if (NULL != pParserContext)
+    {
+        pParserContext->ArenaUsedInBytes = 0;
+    }
+
+    pData = (DD_DISPLAY_CAPS*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(DD_DISPLAY_CAPS)));
 
     if (NULL == pData)
     {
@@ -231,28 +436,31 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
         return DDS_NO_MEMORY;
     }
 
-    pCeModeList = (CE_MODE_LIST*)(DD_ALLOC_MEM(sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED));
+    pCeModeList = (CE_MODE_LIST*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED));
     // pCeModeList (Ce Mode-list) is a temp array of all CE modes we get from EDID
     // This is mainly used to filter out same CE modes from various blocks of CE extension
     if (pCeModeList == NULL)
     {
-        DD_SAFE_FREE(pData);
+        DisplayInfoParserFreeScratch(pParserContext, (void**)&pData);
         DISP_FUNC_EXIT_W_STATUS(DDS_NO_MEMORY);
         return DDS_NO_MEMORY;
     }
 
-    pModes = (MODES_LIST*)(DD_ALLOC_MEM(sizeof(MODES_LIST) * MAX_MODES_DEFINED));
+    pModes = (MODES_LIST*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(MODES_LIST) * MAX_MODES_DEFINED));
     // pModes (Temp Timing Info List) is a temporary timing info list used to store all the DTDs information in order from Base block -> Extn block 1 -> Extn block 2 & so on
     // this will help in counting the DTDs as per there occurrence, to be marked as preferred (as per the VFPDB, CT 861-G/H)
 
     if (pModes == NULL)
     {
-        DD_SAFE_FREE(pData);
-        DD_SAFE_FREE(pCeModeList);
+        DisplayInfoParserFreeScratch(pParserContext, (void**)&pData);
+        DisplayInfoParserFreeScratch(pParserContext, (void**)&pCeModeList);
         DISP_FUNC_EXIT_W_STATUS(DDS_NO_MEMORY);
         return DDS_NO_MEMORY;
     }
 
+    // Display ID block indexes are only a speed up, lookups walk the sections if this fails
+    pDidBlockIndexCache = DisplayInfoParserGetDidBlockIndexCache(pParserContext, pGetEdidModes->pEdidOrDisplayIDBuf, &pDidBlockIndexCacheToFree);
+
     DD_ZERO_MEM(pData, sizeof(DD_DISPLAY_CAPS));
     DD_ZERO_MEM(pCeModeList, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED);
     DD_ZERO_MEM(pModes, sizeof(MODES_LIST) * MAX_MODES_DEFINED);
@@ -267,6 +475,7 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
     EdidData.pCeModeList = pCeModeList;
     EdidData.pData = pData;
     EdidData.pModes = pModes;
+    EdidData.pDidBlockIndexCache = pDidBlockIndexCache;
     EdidData.Vfpdb.DtdMask = 0;
     EdidData.Vfpdb.DtdCount = 0;
     EdidData.NumTimingInfo = 0;
@@ -275,15 +484,18 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
     EdidData.NumModesInEdidOrDID = 0;
     EdidData.IsPreferredModeAdded = FALSE;
 
-    if (0 == memcmp(BaseEdidHeader, pGetEdidModes->pEdidOrDisplayIDBuf, EDID_HEADER_SIZE))
+    if ((pGetEdidModes->BufSizeInBytes >= EDID_HEADER_SIZE) && (0 == memcmp(BaseEdidHeader, pGetEdidModes->pEdidOrDisplayIDBuf, EDID_HEADER_SIZE)))
     {
         // EDID
         pEdidBaseBlock = (EDID_BASE_BLOCK*)pGetEdidModes->pEdidOrDisplayIDBuf;
         EdidData.IsDisplayIdBaseBlock = FALSE;
         EdidData.EdidOrDidVerAndRev = (pEdidBaseBlock->Version << 4) | (pEdidBaseBlock->Revision);
 
-        // Parse and add modes to mode - list
-        EdidParserGetEdidModes(pGetEdidModes, &EdidData);
+        // Parse and add modes to mode - list, base block must be whole
+        if (pGetEdidModes->BufSizeInBytes >= EDID_BLOCK_SIZE)
+        {
+            EdidParserGetEdidModes(pGetEdidModes, &EdidData, NULL);
+        }
     }
     else
     {
@@ -302,14 +514,22 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
 
         // Parse and add modes to mode - list
         pEdidOrDisplayIDBuf = pGetEdidModes->pEdidOrDisplayIDBuf;
+        RemainingSizeInBytes = pGetEdidModes->BufSizeInBytes;
         DisplayIdExtnCount = 0;
 
         do
         {
+            if (FALSE == DisplayIdParserIsSectionInBuffer(pEdidOrDisplayIDBuf, RemainingSizeInBytes))
+            {
+                // Section count or size does not match the buffer passed in, drop this and later sections
+                DISP_DBG_MSG(GFXDBG_CRITICAL, "Display ID section runs past the buffer passed in by caller");
+                break;
+            }
+
             DidExtnBlockHeader.Value = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->Value;
 
             // Not checking for multiple instances of CE block yet. Will do on need basis
-            DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pEdidOrDisplayIDBuf, CeaBlockTag, 0);
+            DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pEdidOrDisplayIDBuf, CeaBlockTag, 0, &EdidData);
             Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
             if (IS_DDSTATUS_SUCCESS(Status))
             {
@@ -333,6 +553,7 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
 
             // Point to next block which starts at current block Start +  Header size + Data Size + 1 byte Checksum
             pEdidOrDisplayIDBuf = ((DDU8*)(pEdidOrDisplayIDBuf)+DidExtnBlockHeader.BytesInSection + sizeof(DISPLAYID_HEADER) + 1);
+            RemainingSizeInBytes -= DidExtnBlockHeader.BytesInSection + sizeof(DISPLAYID_HEADER) + 1;
         } while (++DisplayIdExtnCount <= Did2ExtensionCount);
     }
 
@@ -342,9 +563,10 @@ DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes)
     // modes are added, transfer them to mode table
     Status = DisplayInfoParserUpdateModeTable(pGetEdidModes, &EdidData);
 
-    DD_SAFE_FREE(pModes);
-    DD_SAFE_FREE(pCeModeList);
-    DD_SAFE_FREE(pData);
+    DD_SAFE_FREE(pDidBlockIndexCacheToFree);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pModes);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pCeModeList);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pData);
 
     DISP_FUNC_EXIT();
     return Status;
@@ -369,7 +591,11 @@ DDSTATUS DisplayInfoParserGetEdidCaps(DD_GET_EDID_CAPS* pGetEdidCaps)
     DDU8 DisplayIdExtnCount, Did2ExtensionCount;
     DDU8* pEdidOrDisplayIDBuf = NULL;
     DDU8 Count, CeaBlockTag;
+    DDU32 RemainingSizeInBytes;
     GET_BLOCK_BY_ID_ARGS GetBlockById;
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCache;
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCacheToFree;
+    DD_PARSER_CONTEXT* pParserContext;
 
     DISP_FUNC_ENTRY();
 
@@ -378,12 +604,22 @@ DDSTATUS DisplayInfoParserGetEdidCaps(DD_GET_EDID_CAPS* pGetEdidCaps)
     DDASSERT(pGetEdidCaps->pEdidOrDisplayIDBuf);
     DDASSERT(pGetEdidCaps->pData);
 
-    pCeModeList = (CE_MODE_LIST*)(DD_ALLOC_MEM(sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED));
+    pParserContext = pGetEdidCaps->pParserContext;
+    if (NULL != pParserContext)
+    {
+        pParserContext->ArenaUsedInBytes = 0;
+    }
+
+    pCeModeList = (CE_MODE_LIST*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED));
     if (pCeModeList == NULL)
     {
         DISP_FUNC_EXIT_W_STATUS(DDS_NO_MEMORY);
         return DDS_NO_MEMORY;
     }
+    DD_ZERO_MEM(pCeModeList, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED);
+
+    // Display ID block indexes are only a speed up, lookups walk the sections if this fails
+    pDidBlockIndexCache = DisplayInfoParserGetDidBlockIndexCache(pParserContext, pGetEdidCaps->pEdidOrDisplayIDBuf, &pDidBlockIndexCacheToFree);
 
     // Init all VICs as undefined
     for (Count = 0; Count < MAX_VIC_DEFINED; Count++)
@@ -399,12 +635,13 @@ DDSTATUS DisplayInfoParserGetEdidCaps(DD_GET_EDID_CAPS* pGetEdidCaps)
 
     EdidData.pCeModeList = pCeModeList;
     EdidData.pData = pGetEdidCaps->pData;
+    EdidData.pDidBlockIndexCache = pDidBlockIndexCache;
     EdidData.VicCount = 0;
     EdidData.NumModesInEdidOrDID = 0;
     EdidData.Vfpdb.DtdCount = 0;
     EdidData.Vfpdb.DtdMask = 0;
 
-    if (0 == memcmp(BaseEdidHeader, pGetEdidCaps->pEdidOrDisplayIDBuf, EDID_HEADER_SIZE))
+    if ((pGetEdidCaps->BufSizeInBytes >= EDID_HEADER_SIZE) && (0 == memcmp(BaseEdidHeader, pGetEdidCaps->pEdidOrDisplayIDBuf, EDID_HEADER_SIZE)))
     {
         // EDID
         pEdidBaseBlock = (EDID_BASE_BLOCK*)pGetEdidCaps->pEdidOrDisplayIDBuf;
@@ -412,8 +649,11 @@ DDSTATUS DisplayInfoParserGetEdidCaps(DD_GET_EDID_CAPS* pGetEdidCaps)
         EdidData.EdidOrDidVerAndRev = (pEdidBaseBlock->Version << 4) | pEdidBaseBlock->Revision;
         pGetEdidCaps->pData->FtrSupport.IsDisplayIDData = FALSE;
 
-        // Parse caps
-        EdidParserGetEdidCaps(&GetEdidModes, &EdidData);
+        // Parse caps, base block must be whole
+        if (pGetEdidCaps->BufSizeInBytes >= EDID_BLOCK_SIZE)
+        {
+            EdidParserGetEdidCaps(&GetEdidModes, &EdidData);
+        }
     }
     else
     {
@@ -433,13 +673,21 @@ DDSTATUS DisplayInfoParserGetEdidCaps(DD_GET_EDID_CAPS* pGetEdidCaps)
         pEdidOrDisplayIDBuf = pGetEdidCaps->pEdidOrDisplayIDBuf;
 
         // Parse caps
+        RemainingSizeInBytes = pGetEdidCaps->BufSizeInBytes;
         DisplayIdExtnCount = 0;
         do
         {
+            if (FALSE == DisplayIdParserIsSectionInBuffer(pEdidOrDisplayIDBuf, RemainingSizeInBytes))
+            {
+                // Section count or size does not match the buffer passed in, drop this and later sections
+                DISP_DBG_MSG(GFXDBG_CRITICAL, "Display ID section runs past the buffer passed in by caller");
+                break;
+            }
+
             DidExtnBlockHeader.Value = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->Value;
 
             // Not checking for multiple instances of CE block yet. Will do on need basis
-            DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pEdidOrDisplayIDBuf, CeaBlockTag, 0);
+            DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pEdidOrDisplayIDBuf, CeaBlockTag, 0, &EdidData);
             Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
             if (IS_DDSTATUS_SUCCESS(Status))
             {
@@ -465,15 +713,212 @@ DDSTATUS DisplayInfoParserGetEdidCaps(DD_GET_EDID_CAPS* pGetEdidCaps)
 
             // Point to next block which starts at current block Start +  Header size + Data Size + 1 byte Checksum
             pEdidOrDisplayIDBuf = ((DDU8*)(pEdidOrDisplayIDBuf)+DidExtnBlockHeader.BytesInSection + sizeof(DISPLAYID_HEADER) + 1);
+            RemainingSizeInBytes -= DidExtnBlockHeader.BytesInSection + sizeof(DISPLAYID_HEADER) + 1;
         } while (++DisplayIdExtnCount <= Did2ExtensionCount);
     }
 
-    DD_SAFE_FREE(pCeModeList);
+    DD_SAFE_FREE(pDidBlockIndexCacheToFree);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pCeModeList);
 
     DISP_FUNC_EXIT_W_STATUS(DDS_SUCCESS);
     return DDS_SUCCESS;
 }
 
+/***************************************************************
+ * @brief This function parses entire EDID/DisplayID block once for caps and modes.
+ *
+ *      Fills the same caps as DisplayInfoParserGetEdidCaps() and adds the same modes as
+ *      DisplayInfoParserGetEdidModes(), but decodes the header, walks the blocks/sections,
+ *      indexes CE data blocks and Display ID blocks only once for both.
+ *      Caps and modes keep their own EDID data, as the modes walk parses more blocks than a caps call.
+ *
+ * @param pGetEdidCapsAndModes
+ * @return DDSTATUS
+ ***************************************************************/
+DDSTATUS DisplayInfoParserGetEdidCapsAndModes(DD_GET_EDID_CAPS_AND_MODES* pGetEdidCapsAndModes)
+{
+    DDSTATUS Status;
+    DISPLAYID_HEADER DidExtnBlockHeader;
+    EDID_BASE_BLOCK* pEdidBaseBlock = NULL;
+    DDU8 DisplayIdExtnCount;
+    CE_MODE_LIST* pCeModeList = NULL;
+    CE_MODE_LIST* pCapsCeModeList = NULL;
+    EDID_DATA EdidData;
+    EDID_DATA CapsEdidData;
+    DD_DISPLAY_CAPS* pData;
+    DD_GET_EDID_MODES GetEdidModes;
+    DD_GET_EDID_MODES GetEdidCaps;
+    DDU8* pEdidOrDisplayIDBuf = NULL;
+    DDU8 Count, Did2ExtensionCount, CeaBlockTag;
+    DDU32 RemainingSizeInBytes;
+    GET_BLOCK_BY_ID_ARGS GetBlockById;
+    MODES_LIST* pModes;
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCache;
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCacheToFree;
+    DD_PARSER_CONTEXT* pParserContext;
+
+    DISP_FUNC_ENTRY();
+
+    // Arg validation
+    DDASSERT(pGetEdidCapsAndModes);
+    DDASSERT(pGetEdidCapsAndModes->pEdidOrDisplayIDBuf);
+    DDASSERT(pGetEdidCapsAndModes->pData);
+    DDASSERT(pGetEdidCapsAndModes->pModeTable);
+
+    pParserContext = pGetEdidCapsAndModes->pParserContext;
+    if (NULL != pParserContext)
+    {
+        pParserContext->ArenaUsedInBytes = 0;
+    }
+
+    pData = (DD_DISPLAY_CAPS*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(DD_DISPLAY_CAPS)));
+    pCeModeList = (CE_MODE_LIST*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED));
+    pCapsCeModeList = (CE_MODE_LIST*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED));
+    pModes = (MODES_LIST*)(DisplayInfoParserAllocScratch(pParserContext, sizeof(MODES_LIST) * MAX_MODES_DEFINED));
+
+    if ((NULL == pData) || (NULL == pCeModeList) || (NULL == pCapsCeModeList) || (NULL == pModes))
+    {
+        DisplayInfoParserFreeScratch(pParserContext, (void**)&pModes);
+        DisplayInfoParserFreeScratch(pParserContext, (void**)&pCapsCeModeList);
+        DisplayInfoParserFreeScratch(pParserContext, (void**)&pCeModeList);
+        DisplayInfoParserFreeScratch(pParserContext, (void**)&pData);
+        DISP_FUNC_EXIT_W_STATUS(DDS_NO_MEMORY);
+        return DDS_NO_MEMORY;
+    }
+
+    // Display ID block indexes are only a speed up, lookups walk the sections if this fails
+    pDidBlockIndexCache = DisplayInfoParserGetDidBlockIndexCache(pParserContext, pGetEdidCapsAndModes->pEdidOrDisplayIDBuf, &pDidBlockIndexCacheToFree);
+
+    DD_ZERO_MEM(pData, sizeof(DD_DISPLAY_CAPS));
+    DD_ZERO_MEM(pCeModeList, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED);
+    DD_ZERO_MEM(pCapsCeModeList, sizeof(CE_MODE_LIST) * MAX_VIC_DEFINED);
+    DD_ZERO_MEM(pModes, sizeof(MODES_LIST) * MAX_MODES_DEFINED);
+
+    // Init all VICs as undefined
+    for (Count = 0; Count < MAX_VIC_DEFINED; Count++)
+    {
+        pCeModeList[Count].VicId[0] = VIC_UNDEFINED;
+        pCeModeList[Count].VicId[1] = VIC_UNDEFINED;
+        pCapsCeModeList[Count].VicId[0] = VIC_UNDEFINED;
+        pCapsCeModeList[Count].VicId[1] = VIC_UNDEFINED;
+    }
+
+    GetEdidModes.pEdidOrDisplayIDBuf = pGetEdidCapsAndModes->pEdidOrDisplayIDBuf;
+    GetEdidModes.BufSizeInBytes = pGetEdidCapsAndModes->BufSizeInBytes;
+    GetEdidModes.NumEdidExtensionsParsed = pGetEdidCapsAndModes->NumEdidExtensionsParsed;
+    GetEdidModes.pModeTable = pGetEdidCapsAndModes->pModeTable;
+    GetEdidModes.pParserContext = pParserContext;
+
+    // Modes are parsed with internal caps, as DisplayInfoParserGetEdidModes() does
+    EdidData.pCeModeList = pCeModeList;
+    EdidData.pData = pData;
+    EdidData.pModes = pModes;
+    EdidData.pDidBlockIndexCache = pDidBlockIndexCache;
+    EdidData.Vfpdb.DtdMask = 0;
+    EdidData.Vfpdb.DtdCount = 0;
+    EdidData.NumTimingInfo = 0;
+    EdidData.NumBaseBlockDtds = 0;
+    EdidData.VicCount = 0;
+    EdidData.NumModesInEdidOrDID = 0;
+    EdidData.IsPreferredModeAdded = FALSE;
+
+    CapsEdidData = EdidData;
+    CapsEdidData.pCeModeList = pCapsCeModeList;
+    CapsEdidData.pData = pGetEdidCapsAndModes->pData;
+    CapsEdidData.pModes = NULL;
+
+    if ((pGetEdidCapsAndModes->BufSizeInBytes >= EDID_HEADER_SIZE) && (0 == memcmp(BaseEdidHeader, pGetEdidCapsAndModes->pEdidOrDisplayIDBuf, EDID_HEADER_SIZE)))
+    {
+        // EDID
+        pEdidBaseBlock = (EDID_BASE_BLOCK*)pGetEdidCapsAndModes->pEdidOrDisplayIDBuf;
+        EdidData.IsDisplayIdBaseBlock = FALSE;
+        EdidData.EdidOrDidVerAndRev = (pEdidBaseBlock->Version << 4) | (pEdidBaseBlock->Revision);
+        CapsEdidData.IsDisplayIdBaseBlock = FALSE;
+        CapsEdidData.EdidOrDidVerAndRev = EdidData.EdidOrDidVerAndRev;
+        pGetEdidCapsAndModes->pData->FtrSupport.IsDisplayIDData = FALSE;
+
+        // Parse caps and add modes to mode - list, base block must be whole
+        if (pGetEdidCapsAndModes->BufSizeInBytes >= EDID_BLOCK_SIZE)
+        {
+            EdidParserGetEdidModes(&GetEdidModes, &EdidData, &CapsEdidData);
+        }
+    }
+    else
+    {
+        // Display ID
+        DidExtnBlockHeader.Value = ((DISPLAYID_HEADER*)(pGetEdidCapsAndModes->pEdidOrDisplayIDBuf))->Value;
+        Did2ExtensionCount = DidExtnBlockHeader.ExtensionCount;
+        EdidData.IsDisplayIdBaseBlock = TRUE;
+        EdidData.EdidOrDidVerAndRev = DidExtnBlockHeader.RevisionAndVersion;
+        CapsEdidData.IsDisplayIdBaseBlock = TRUE;
+        CapsEdidData.EdidOrDidVerAndRev = EdidData.EdidOrDidVerAndRev;
+        pGetEdidCapsAndModes->pData->FtrSupport.IsDisplayIDData = TRUE;
+        CeaBlockTag = DID_DATA_BLOCK_CEA_SPECIFIC;
+        if ((DISPLAY_ID_VER_2_0 == EdidData.EdidOrDidVerAndRev) || (DISPLAY_ID_VER_2_1 == EdidData.EdidOrDidVerAndRev))
+        {
+            CeaBlockTag = DID2_DATA_BLOCK_CTA_DISPLAY_ID;
+        }
+
+        // Parse caps and add modes to mode - list
+        pEdidOrDisplayIDBuf = pGetEdidCapsAndModes->pEdidOrDisplayIDBuf;
+        RemainingSizeInBytes = pGetEdidCapsAndModes->BufSizeInBytes;
+        DisplayIdExtnCount = 0;
+
+        do
+        {
+            if (FALSE == DisplayIdParserIsSectionInBuffer(pEdidOrDisplayIDBuf, RemainingSizeInBytes))
+            {
+                // Section count or size does not match the buffer passed in, drop this and later sections
+                DISP_DBG_MSG(GFXDBG_CRITICAL, "Display ID section runs past the buffer passed in by caller");
+                break;
+            }
+
+            DidExtnBlockHeader.Value = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->Value;
+
+            // Not checking for multiple instances of CE block yet. Will do on need basis
+            DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pEdidOrDisplayIDBuf, CeaBlockTag, 0, &EdidData);
+            Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
+            if (IS_DDSTATUS_SUCCESS(Status))
+            {
+                // This data needed to know if its a CE extension display when we parse some of base block modes before CE block parsing
+                EdidData.pData->FtrSupport.IsCeExtnDisplay = TRUE;
+                CapsEdidData.pData->FtrSupport.IsCeExtnDisplay = TRUE;
+            }
+
+            GetEdidModes.pEdidOrDisplayIDBuf = pEdidOrDisplayIDBuf;
+            GetEdidModes.BufSizeInBytes = DidExtnBlockHeader.BytesInSection;
+            GetEdidCaps = GetEdidModes;
+            GetEdidCaps.pModeTable = NULL;
+
+            // Display ID Header starts from the next byte in the block
+            DisplayIdParserGetSectionCaps(&GetEdidCaps, &CapsEdidData, DidExtnBlockHeader.RevisionAndVersion);
+            DisplayIdParserGetSectionModes(&GetEdidModes, &EdidData, DidExtnBlockHeader.RevisionAndVersion);
+
+            // Point to next block which starts at current block Start +  Header size + Data Size + 1 byte Checksum
+            pEdidOrDisplayIDBuf = ((DDU8*)(pEdidOrDisplayIDBuf)+DidExtnBlockHeader.BytesInSection + sizeof(DISPLAYID_HEADER) + 1);
+            RemainingSizeInBytes -= DidExtnBlockHeader.BytesInSection + sizeof(DISPLAYID_HEADER) + 1;
+        } while (++DisplayIdExtnCount <= Did2ExtensionCount);
+
+        GetEdidModes.pEdidOrDisplayIDBuf = pGetEdidCapsAndModes->pEdidOrDisplayIDBuf;
+        GetEdidModes.BufSizeInBytes = pGetEdidCapsAndModes->BufSizeInBytes;
+    }
+
+    // Mark the preferred modes from Base/CE extn blocks
+    EdidParserMarkVfpdbTimingsAsPreferred(&EdidData);
+
+    // modes are added, transfer them to mode table
+    Status = DisplayInfoParserUpdateModeTable(&GetEdidModes, &EdidData);
+
+    DD_SAFE_FREE(pDidBlockIndexCacheToFree);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pModes);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pCapsCeModeList);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pCeModeList);
+    DisplayInfoParserFreeScratch(pParserContext, (void**)&pData);
+
+    DISP_FUNC_EXIT();
+    return Status;
+}
+
 /***************************************************************
  * @brief Display InfoParser ParseBase Block DTDs Fore DP.
  *
@@ -628,13 +1073,9 @@ DDSTATUS DisplayInfoParserAddEDIDModeToList(ADD_MODES* pAddModes, EDID_DATA* pEd
  ***************************************************************/
 static DDSTATUS GetVicIndexBasedOnCeIndex(DDU8 CeIndex, DDU8* pVicId)
 {
-    // As per CTA-861G, Upto VIC ID-64 Native format can be declared using 7th bit
-    // So, for VIC Id >64, the CeIndex are directly used as VicID
-    *pVicId = (CeIndex & CEA_SHORT_VIDEO_DESCRIPTOR_CODE_MASK);
-    *pVicId = (*pVicId <= CEA_MAX_VIC_SUPPORTING_NATIVE_FORMAT) ? (*pVicId) : (CeIndex);
-    // Index to the array is calculated by adjusting for forbidden or not supported CeIndex(es)
-    *pVicId = (*pVicId > 127) ? GET_VIC_INDEX(*pVicId) : (*pVicId);
-    if ((*pVicId > MAX_CE_VICID) || (g_SupportedCeShortVideoModes[*pVicId].pTimingInfo == NULL))
+    // Native format bit (upto VIC 64), forbidden VICs and adjustment of VICs from 193 are resolved at compile time in the map
+    *pVicId = CeSvdToVicTableIndex[CeIndex];
+    if (g_SupportedCeShortVideoModes[*pVicId].pTimingInfo == NULL)
     {
         DISP_FUNC_EXIT_W_STATUS(DDS_DPL_INVALID_VIC_ID);
         return DDS_DPL_INVALID_VIC_ID;
@@ -1065,8 +1506,8 @@ DDSTATUS DisplayInfoParserParseEnumTimings(SHORT_TIMING_4_REVID* pTiming4HdrOver
             {
                 CeVicData.SamplingMode = pEdidData->pData->BasicDisplayCaps.DidSamplingMode;
             }
-            // Since CEIndex here is <64, no need to convert it
-            CeVicData.VicId[0] = g_DisplayID_CeStandardTiming[VicId].CEIndex;
+            // CEIndex is a VIC, VICs from 193 on are packed in the CE table, convert as an SVD byte
+            CeVicData.VicId[0] = CeSvdToVicTableIndex[g_DisplayID_CeStandardTiming[VicId].CEIndex];
             CeInfoParserUpdateCeModeList(pEdidData, &CeVicData, CE_SVD);
         }
         break;
@@ -1305,6 +1746,55 @@ DDSTATUS DisplayInfoParserParseCtaType7Timing(CEA_EXT_FORMULA_TIMING_VII* pType7
   *
   */
 
+  /***************************************************************
+   * @brief Edid Parser Is Valid Extn Block.
+   *
+   *  Checks the tag of an EDID extension block. Checksum is not verified here.
+   * @param pExtnBlock
+   * @return DD_BOOL
+   ***************************************************************/
+static DD_BOOL EdidParserIsValidExtnBlock(const DDU8* pExtnBlock)
+{
+    switch (pExtnBlock[0])
+    {
+    case CEA_EXT_TAG:            // CEA 861 Series Extension
+    case VTB_EXT_TAG:            // Video Timing Block Extension
+    case EDID_2_0_EXT_TAG:       // EDID 2.0 Extension
+    case DI_EXT_TAG:             // Display Information Block Extension
+    case LS_EXT_TAG:             // Localized String Extension
+    case DPVL_EXT_TAG:           // Digital Packet Video Extension
+    case DID_EXT_TAG:            // DisplayID Extension to EDID
+    case BLOCK_MAP_EXT_TAG:      // Block Map Extension
+    case MANF_SPECIFIED_EXT_TAG: // Extensions Defined by Manufactures
+        return TRUE;
+    default:
+        // Some of the EDID might have base block that might advertize of extension block's presence, but may not have any extension block.
+        // If extension Tag and checksum is found to be 0, consider extension block to be absent, and do not fail. Consider base with any valid extension block for parsing.
+        return ((0 == pExtnBlock[0]) && (0 == pExtnBlock[EDID_BLOCK_SIZE - 1])) ? TRUE : FALSE;
+    }
+}
+
+  /***************************************************************
+   * @brief Edid Parser Is Supported Edid Version.
+   *
+   * @param pEdidBaseBlock
+   * @return DD_BOOL TRUE for EDID 1.2, 1.3 and 1.4
+   ***************************************************************/
+static DD_BOOL EdidParserIsSupportedEdidVersion(const EDID_BASE_BLOCK* pEdidBaseBlock)
+{
+    DDU8 EdidVerAndRev = (pEdidBaseBlock->Version << 4) | (pEdidBaseBlock->Revision);
+
+    switch (EdidVerAndRev)
+    {
+    case EDID_VERSION_1_2:
+    case EDID_VERSION_1_3:
+    case EDID_VERSION_1_4:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
   /***************************************************************
    * @brief Edid Parser Verify Data Blocks.
    *
@@ -1319,8 +1809,6 @@ DDSTATUS DisplayInfoParserParseCtaType7Timing(CEA_EXT_FORMULA_TIMING_VII* pType7
 DDSTATUS EdidParserVerifyDataBlocks(DDU8* pEdidOrDisplayIDBuf, DDU32 BufSizeInBytes, DDU8 BlockNum)
 {
     DDSTATUS Status;
-    EDID_BASE_BLOCK* pEdidBaseBlock;
-    DDU8 EdidVerAndRev;
 
     // Arg Validation
     DDASSERT(pEdidOrDisplayIDBuf);
@@ -1345,25 +1833,7 @@ DDSTATUS EdidParserVerifyDataBlocks(DDU8* pEdidOrDisplayIDBuf, DDU32 BufSizeInBy
     if (BlockNum > 0)
     {
         // Check if it is a valid Extn tag
-        switch (pEdidOrDisplayIDBuf[0])
-        {
-        case CEA_EXT_TAG:            // CEA 861 Series Extension
-        case VTB_EXT_TAG:            // Video Timing Block Extension
-        case EDID_2_0_EXT_TAG:       // EDID 2.0 Extension
-        case DI_EXT_TAG:             // Display Information Block Extension
-        case LS_EXT_TAG:             // Localized String Extension
-        case DPVL_EXT_TAG:           // Digital Packet Video Extension
-        case DID_EXT_TAG:            // DisplayID Extension to EDID
-        case BLOCK_MAP_EXT_TAG:      // Block Map Extension
-        case MANF_SPECIFIED_EXT_TAG: // Extensions Defined by Manufactures
-            Status = DDS_SUCCESS;
-            break;
-        default:
-            // Some of the EDID might have base block that might advertize of extension block's presence, but may not have any extension block.
-            // If extension Tag and checksum is found to be 0, consider extension block to be absent, and do not fail. Consider base with any valid extension block for parsing.
-            Status = ((0 == pEdidOrDisplayIDBuf[0]) && (0 == pEdidOrDisplayIDBuf[EDID_BLOCK_SIZE - 1])) ? DDS_SUCCESS : DDS_INVALID_DATA;
-            break;
-        }
+        Status = EdidParserIsValidExtnBlock(pEdidOrDisplayIDBuf) ? DDS_SUCCESS : DDS_INVALID_DATA;
 
         DISP_FUNC_EXIT();
         return Status;
@@ -1377,24 +1847,76 @@ DDSTATUS EdidParserVerifyDataBlocks(DDU8* pEdidOrDisplayIDBuf, DDU32 BufSizeInBy
     }
 
     // Check if EDID version read is Valid
-    pEdidBaseBlock = (EDID_BASE_BLOCK*)pEdidOrDisplayIDBuf;
-    EdidVerAndRev = (pEdidBaseBlock->Version << 4) | (pEdidBaseBlock->Revision);
+    Status = EdidParserIsSupportedEdidVersion((EDID_BASE_BLOCK*)pEdidOrDisplayIDBuf) ? DDS_SUCCESS : DDS_INVALID_DATA;
 
-    switch (EdidVerAndRev)
+    // There is no error, so return success
+    DISP_FUNC_EXIT();
+    return Status;
+}
+
+  /***************************************************************
+   * @brief Display Info Parser Validate Edid Blocks.
+   *
+   *  Validates a buffer of back to back EDID blocks, e.g. many EDIDs read from a corpus, without parsing them.
+   *  Checksums of all blocks are verified in bulk first, then each block is checked as
+   *       1. Base block: EDID header, EDID version 1.2 - 1.4 and extension count not running past end of buffer.
+   *       2. Extension block: within extension count of the last base block, base block valid and extension
+   *          tag valid, same as EdidParserVerifyDataBlocks().
+   *       3. Any other block is invalid.
+   * @param pBlocks NumBlocks * EDID_BLOCK_SIZE bytes
+   * @param NumBlocks
+   * @param SimdLevel highest SIMD level to use for checksums, see DisplayInfoRoutinesGetSimdLevel()
+   * @param pValidBitmap DD_BLOCK_BITMAP_WORDS(NumBlocks) words, bit set for every valid block
+   * @return DDSTATUS
+   ***************************************************************/
+DDSTATUS DisplayInfoParserValidateEdidBlocks(const DDU8* pBlocks, DDU32 NumBlocks, DD_SIMD_LEVEL SimdLevel, DDU64* pValidBitmap)
+{
+    const DDU8* pBlock;
+    DDU32 Block;
+    DDU32 NumExtnLeft = 0;
+    DD_BOOL IsBaseValid = FALSE;
+    DD_BOOL IsValid;
+
+    DISP_FUNC_ENTRY();
+
+    if ((NULL == pBlocks) || (NULL == pValidBitmap) || (0 == NumBlocks))
     {
-    case EDID_VERSION_1_2:
-    case EDID_VERSION_1_3:
-    case EDID_VERSION_1_4:
-        Status = DDS_SUCCESS;
-        break;
-    default:
-        Status = DDS_INVALID_DATA;
-        break;
+        DISP_FUNC_EXIT_W_STATUS(DDS_INVALID_PARAM);
+        return DDS_INVALID_PARAM;
+    }
+
+    DisplayInfoRoutinesCheckBlockChksums(pBlocks, NumBlocks, SimdLevel, pValidBitmap);
+
+    for (Block = 0; Block < NumBlocks; Block++)
+    {
+        pBlock = pBlocks + (DDU64)Block * EDID_BLOCK_SIZE;
+        IsValid = DD_IS_BLOCK_BIT_SET(pValidBitmap, Block);
+
+        if (0 == memcmp(BaseEdidHeader, pBlock, EDID_HEADER_SIZE))
+        {
+            // A new base block ends any extension run of the previous one
+            NumExtnLeft = ((EDID_BASE_BLOCK*)pBlock)->NumExtBlocks;
+            IsValid = IsValid && EdidParserIsSupportedEdidVersion((const EDID_BASE_BLOCK*)pBlock) && (NumExtnLeft < NumBlocks - Block);
+            IsBaseValid = IsValid;
+        }
+        else if (NumExtnLeft > 0)
+        {
+            NumExtnLeft--;
+            IsValid = IsValid && IsBaseValid && EdidParserIsValidExtnBlock(pBlock);
+        }
+        else
+        {
+            IsValid = FALSE;
+        }
+
+        if (FALSE == IsValid)
+        {
+            pValidBitmap[Block / 64] &= ~(1ULL << (Block % 64));
+        }
     }
 
-    // There is no error, so return success
     DISP_FUNC_EXIT();
-    return Status;
+    return DDS_SUCCESS;
 }
 
 /***************************************************************
@@ -1413,16 +1935,20 @@ DDSTATUS EdidParserVerifyDataBlocks(DDU8* pEdidOrDisplayIDBuf, DDU32 BufSizeInBy
  *          7. Parse and add DTDs if any
  *          8. Parse HDMI VSDB Block to add S3D and 4k2k Modes
  *          9. EdidParserParseHFVSDB to update HDMI caps.
+ *
+ *      With pCapsEdidData the caps of a caps only call are parsed in the same walk.
  * @param pGetEdidModes
  * @param pEdidData
+ * @param pCapsEdidData Optional, EDID data of a caps only call parsed along with modes, NULL if none
  * @return void
  ***************************************************************/
-void EdidParserParseDisplayIdExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData)
+void EdidParserParseDisplayIdExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, EDID_DATA* pCapsEdidData)
 {
     EDID_BASE_BLOCK* pEdidBaseBlock = NULL;
     DDU32 BlockNum;
     DDU32 NumExtBlocks;
     DD_GET_EDID_MODES GetEdidModes;
+    DD_GET_EDID_MODES GetEdidCaps;
     DISPLAYID_EDID_EXTN_HEADER* pDisplayIdHeader = NULL;
 
     DISP_FUNC_WO_STATUS_ENTRY();
@@ -1437,7 +1963,7 @@ void EdidParserParseDisplayIdExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DA
 
     for (BlockNum = 1; (BlockNum <= NumExtBlocks) && (BlockNum < MAX_EDID_EXTENSIONS_SUPPORTED); BlockNum++)
     {
-        if (pGetEdidModes->BufSizeInBytes < (BlockNum * EDID_BLOCK_SIZE))
+        if (pGetEdidModes->BufSizeInBytes < ((BlockNum + 1) * EDID_BLOCK_SIZE))
         {
             DISP_DBG_MSG(GFXDBG_CRITICAL, "Wrong length for buffer passed in by called. Hence failing ");
             break;
@@ -1450,6 +1976,13 @@ void EdidParserParseDisplayIdExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DA
             continue;
         }
 
+        // Section follows the extension tag and must end within the block
+        if (FALSE == DisplayIdParserIsSectionInBuffer((DDU8*)&pDisplayIdHeader->DisplayIdHeader, EDID_BLOCK_SIZE - 1))
+        {
+            DISP_DBG_MSG(GFXDBG_CRITICAL, "Display ID section runs past its EDID extension block");
+            continue;
+        }
+
         GetEdidModes.BufSizeInBytes = EDID_BLOCK_SIZE;
 
         // Display ID Header starts from the next byte in the block
@@ -1460,34 +1993,19 @@ void EdidParserParseDisplayIdExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DA
         {
             // Call only get caps function if pModeTable was NULL
             // DID2 can also be extension to EDID
-            switch (pDisplayIdHeader->DisplayIdHeader.RevisionAndVersion)
-            {
-            case DISPLAY_ID_VER_2_1:
-                DisplayIdV21ParserGetEdidCaps(&GetEdidModes, pEdidData);
-                break;
-            case DISPLAY_ID_VER_2_0:
-                DisplayIdV2ParserGetEdidCaps(&GetEdidModes, pEdidData);
-                break;
-            default:
-                DisplayIdParserGetEdidCaps(&GetEdidModes, pEdidData);
-                break;
-            }
+            DisplayIdParserGetSectionCaps(&GetEdidModes, pEdidData, pDisplayIdHeader->DisplayIdHeader.RevisionAndVersion);
         }
         else
         {
-            // DID2 can also be extension to EDID
-            switch (pDisplayIdHeader->DisplayIdHeader.RevisionAndVersion)
+            if (NULL != pCapsEdidData)
             {
-            case DISPLAY_ID_VER_2_1:
-            case DISPLAY_ID_VER_2_0:
-                // A new formula based timing block got added in DID 2.1. Separate functions will be
-                // required post formula based timing implementation. Reusing the same function for now.
-                DisplayIdV2ParserGetEdidModes(&GetEdidModes, pEdidData);
-                break;
-            default:
-                DisplayIdParserGetEdidModes(&GetEdidModes, pEdidData);
-                break;
+                GetEdidCaps = GetEdidModes;
+                GetEdidCaps.pModeTable = NULL;
+                DisplayIdParserGetSectionCaps(&GetEdidCaps, pCapsEdidData, pDisplayIdHeader->DisplayIdHeader.RevisionAndVersion);
             }
+
+            // DID2 can also be extension to EDID
+            DisplayIdParserGetSectionModes(&GetEdidModes, pEdidData, pDisplayIdHeader->DisplayIdHeader.RevisionAndVersion);
         }
     } // for loop for all EDID extension blocks
 
@@ -1596,12 +2114,18 @@ void EdidParserMarkVfpdbTimingsAsPreferred(EDID_DATA* pEdidData)
  *          5. EdidParserParseBaseEstablishedModes to parse Established modes
  *          6. EdidParserParseBaseStdModes to parse Standard modes
  *          7. EdidParserParseEstTimingIIIBlock to parse Established Timing III modes.
+ *
+ *      With pCapsEdidData steps 1 to 4 also fill the caps EdidParserGetEdidCaps() would,
+ *      so that caps and modes come from one walk over the blocks.
  * @param pGetEdidModes
  * @param pEdidData
+ * @param pCapsEdidData Optional, EDID data of a caps only call parsed along with modes, NULL if none
  * @return void
  ***************************************************************/
-void EdidParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData)
+void EdidParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, EDID_DATA* pCapsEdidData)
 {
+    DD_GET_EDID_MODES GetEdidCaps;
+
     DISP_FUNC_WO_STATUS_ENTRY();
 
     // Arg validation
@@ -1609,17 +2133,26 @@ void EdidParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidDa
     DDASSERT(pEdidData->pData);
     DDASSERT(pGetEdidModes->pEdidOrDisplayIDBuf);
 
+    GetEdidCaps = *pGetEdidModes;
+    GetEdidCaps.pModeTable = NULL;
+
     // 1. Get Supported BPC from base block. This is required for filling the Timing information.
     EdidGetSupportedBPCFromBaseBlock(pGetEdidModes, pEdidData);
 
     // 2. Get base block monitor details
     EdidParserGetBaseBlockMonitorDetails(pGetEdidModes, pEdidData);
 
+    if (NULL != pCapsEdidData)
+    {
+        EdidGetSupportedBPCFromBaseBlock(&GetEdidCaps, pCapsEdidData);
+        EdidParserGetBaseBlockMonitorDetails(&GetEdidCaps, pCapsEdidData);
+    }
+
     // 3. Parse CE extension block -- Will add any non-CE modes to mode-table
-    EdidParserParseCeExtension(pGetEdidModes, pEdidData);
+    EdidParserParseCeExtension(pGetEdidModes, pEdidData, pCapsEdidData);
 
     // 4. Parse DID extension -- Will add any non-CE modes to mode-table
-    EdidParserParseDisplayIdExtension(pGetEdidModes, pEdidData);
+    EdidParserParseDisplayIdExtension(pGetEdidModes, pEdidData, pCapsEdidData);
 
     // 5. Parse DTD section
     EdidParserParseBaseBlockDTDs(pGetEdidModes, pEdidData);
@@ -1667,10 +2200,10 @@ void EdidParserGetEdidCaps(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidDat
     EdidParserGetBaseBlockMonitorDetails(pGetEdidModes, pEdidData);
 
     // 3. Parse CE extension block for caps
-    EdidParserParseCeExtension(pGetEdidModes, pEdidData);
+    EdidParserParseCeExtension(pGetEdidModes, pEdidData, NULL);
 
     // 4. Parse DID extension for caps
-    EdidParserParseDisplayIdExtension(pGetEdidModes, pEdidData);
+    EdidParserParseDisplayIdExtension(pGetEdidModes, pEdidData, NULL);
 
     return;
 }
@@ -2032,28 +2565,72 @@ void EdidParserParseBaseEstablishedModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_
     return;
 }
 
+// Perfect hash of the DMT resolutions in STATIC_MODE_LIST. EdidParserGetStaticDmtTiming switches on it,
+// so a collision is a duplicate case label and fails the build; pick another multiplier if that happens.
+#define STATIC_DMT_HASH_KEY(XRes, YRes, RRate) ((((DDU32)(XRes)) << 19) | (((DDU32)(YRes)) << 7) | ((DDU32)(RRate)))
+#define STATIC_DMT_HASH_MULTIPLIER 0x9E377B97u
+#define STATIC_DMT_HASH(XRes, YRes, RRate) ((DDU32)(STATIC_DMT_HASH_KEY(XRes, YRes, RRate) * STATIC_DMT_HASH_MULTIPLIER) >> 25) // 128 slots
+#define STATIC_DMT_HASH_CASE(HActive, VActive, RoundedRR, Timing) \
+    case STATIC_DMT_HASH(HActive, VActive, RoundedRR):             \
+        pTimingInfo = &Timing;                                     \
+        break;
+#define STATIC_DMT_HASH_SKIP(XRes, YRes, RRate, pTiming)
+
+/***************************************************************
+ * @brief Edid Parser Get Static Dmt Timing.
+ *
+ *  Finds DMT timing of g_StaticModeTable for a standard timing resolution with a single probe. The switch on
+ *  the perfect hash compiles to a jump table, the slot found is then checked against the timing as resolutions
+ *  without DMT timing can hash to a used slot.
+ * @param XRes
+ * @param YRes
+ * @param RRate
+ * @return const DD_TIMING_INFO* NULL if resolution has no DMT timing
+ ***************************************************************/
+static const DD_TIMING_INFO* EdidParserGetStaticDmtTiming(DDU32 XRes, DDU32 YRes, DDU32 RRate)
+{
+    const DD_TIMING_INFO* pTimingInfo;
+
+    switch (STATIC_DMT_HASH(XRes, YRes, RRate))
+    {
+        STATIC_MODE_LIST(STATIC_DMT_HASH_CASE, STATIC_DMT_HASH_SKIP)
+    default:
+        return NULL;
+    }
+
+    if ((XRes != pTimingInfo->HActive) || (YRes != pTimingInfo->VActive) || (RRate != pTimingInfo->VRoundedRR))
+    {
+        return NULL;
+    }
+
+    return pTimingInfo;
+}
+
 /***************************************************************
  * @brief Edid Parser Parse Std Modes.
  *
  *  Method to parse and add Standard monitor modes in EDID
  *      This is a generic routine to parse STD modes from base block.
+ *      Timings without DMT timing are created with one DisplayInfoRoutinesCreateTimings() call,
+ *      then all modes are added in order of the standard timings.
  * @param pParseStdTiming
  * @param pEdidData
  * @return DDSTATUS
  ***************************************************************/
 DDSTATUS EdidParserParseStdModes(PARSE_STDTIMING_ARGS* pParseStdTiming, EDID_DATA* pEdidData)
 {
-    DDSTATUS Status;
     DDU32 Counter;
     EDID_STD_TIMING StdTiming;
     DDU16 AspectRatioX, AspectRatioY;
     DDU32 XRes, YRes, RRate;
     ADD_MODES AddModes;
-    DDU32 StaticModeCount;
-    DD_TIMING_INFO TimingInfo;
-    CREATE_GTF_TIMING_ARGS CreateGTFTimingArgs;
-    CREATE_CVT_TIMING_ARGS CreateCVTTimingArgs;
-    DD_BOOL Found = FALSE;
+    const DD_TIMING_INFO* pDmtTimingInfo;
+    DD_TIMING_INFO TimingInfo[NUM_STANDARD_TIMING];
+    DD_BOOL Found[NUM_STANDARD_TIMING];
+    CREATE_TIMING_ARGS CreateTimingArgs[NUM_STANDARD_TIMING];
+    DDU32 RequestOf[NUM_STANDARD_TIMING];
+    DDU32 NumRequests = 0;
+    DDU32 Request;
     DDU8 VicId;
 
     // Arg validation
@@ -2061,11 +2638,11 @@ DDSTATUS EdidParserParseStdModes(PARSE_STDTIMING_ARGS* pParseStdTiming, EDID_DAT
     DDASSERT(pEdidData->pData);
     DDASSERT(pParseStdTiming->pStdTiming);
 
+    DD_ZERO_MEM(TimingInfo, sizeof(TimingInfo));
+
     for (Counter = 0; Counter < NUM_STANDARD_TIMING; Counter++)
     {
-        DD_ZERO_MEM(&TimingInfo, sizeof(DD_TIMING_INFO));
-
-        Found = FALSE;
+        Found[Counter] = FALSE;
         StdTiming.StdTiming = pParseStdTiming->pStdTiming[Counter].StdTiming;
 
         // Check for unused fields, which are filled with 0x01 value as per EDID spec. Bug# 2439669
@@ -2088,75 +2665,71 @@ DDSTATUS EdidParserParseStdModes(PARSE_STDTIMING_ARGS* pParseStdTiming, EDID_DAT
         RRate = StdTiming.RefreshRate + 60;
 
         // Check for present DMTS timings.
-        for (StaticModeCount = 0; StaticModeCount < g_ulTotalStaticModes; StaticModeCount++)
-        {
-            if ((g_StaticModeTable[StaticModeCount].pTimingInfo) && (XRes == g_StaticModeTable[StaticModeCount].pTimingInfo->HActive) &&
-                (YRes == g_StaticModeTable[StaticModeCount].pTimingInfo->VActive) && (RRate == g_StaticModeTable[StaticModeCount].pTimingInfo->VRoundedRR))
-            {
-                Found = TRUE;
-
-                // Standard entries
-                TimingInfo = *g_StaticModeTable[StaticModeCount].pTimingInfo;
-                AddModes.pTimingInfo = &TimingInfo;
-                TimingInfo.SignalStandard = DD_VESA_DMT;
-                break;
-            }
+        pDmtTimingInfo = EdidParserGetStaticDmtTiming(XRes, YRes, RRate);
+        if (pDmtTimingInfo != NULL)
+        {
+            Found[Counter] = TRUE;
+
+            // Standard entries
+            TimingInfo[Counter] = *pDmtTimingInfo;
+            TimingInfo[Counter].SignalStandard = DD_VESA_DMT;
+            continue;
         }
 
         // if it doesn't match with DMTS timing. Send GTF timing.
-        if (Found == FALSE)
+        if (pEdidData->pData->FtrSupport.IsCVTSupported)
         {
-            if (pEdidData->pData->FtrSupport.IsCVTSupported)
-            {
-                CreateCVTTimingArgs.XRes = XRes;
-                CreateCVTTimingArgs.YRes = YRes;
-                CreateCVTTimingArgs.RRate = RRate;
-                CreateCVTTimingArgs.IsInterLaced = FALSE;
-                CreateCVTTimingArgs.IsMargin_Req = FALSE;
-                CreateCVTTimingArgs.IsRed_Blank_Req = pEdidData->pData->FtrSupport.IsCVTRedBlankSupported ? TRUE : FALSE;
-                CreateCVTTimingArgs.pTimingInfo = &TimingInfo;
-                Status = DisplayInfoRoutinesCreateCVTTiming(&CreateCVTTimingArgs);
-                TimingInfo.SignalStandard = DD_VESA_CVT;
-            }
-            else
-            {
-                // Send GTF timing if CVT not supported
-                // (For EDID 1.3 panels, CVT is assumed to be not supported)
-
-                CreateGTFTimingArgs.XRes = XRes;
-                CreateGTFTimingArgs.YRes = YRes;
-                CreateGTFTimingArgs.RRate = RRate;
-                CreateGTFTimingArgs.pTimingInfo = &TimingInfo;
-                CreateGTFTimingArgs.IsProgressiveMode = TRUE;
-
-                Status = DisplayInfoRoutinesCreateGTFTiming(&CreateGTFTimingArgs);
-                TimingInfo.SignalStandard = DD_VESA_GTF;
-            }
-
-            if (IS_DDSTATUS_SUCCESS(Status))
-            {
-                Found = TRUE;
-                AddModes.pTimingInfo = &TimingInfo;
-            }
+            CreateTimingArgs[NumRequests].Formula = DD_TIMING_FORMULA_CVT;
+            CreateTimingArgs[NumRequests].Cvt.XRes = XRes;
+            CreateTimingArgs[NumRequests].Cvt.YRes = YRes;
+            CreateTimingArgs[NumRequests].Cvt.RRate = RRate;
+            CreateTimingArgs[NumRequests].Cvt.IsInterLaced = FALSE;
+            CreateTimingArgs[NumRequests].Cvt.IsMargin_Req = FALSE;
+            CreateTimingArgs[NumRequests].Cvt.IsRed_Blank_Req = pEdidData->pData->FtrSupport.IsCVTRedBlankSupported ? TRUE : FALSE;
+            CreateTimingArgs[NumRequests].Cvt.pTimingInfo = &TimingInfo[Counter];
+        }
+        else
+        {
+            // Send GTF timing if CVT not supported
+            // (For EDID 1.3 panels, CVT is assumed to be not supported)
+            CreateTimingArgs[NumRequests].Formula = DD_TIMING_FORMULA_GTF;
+            CreateTimingArgs[NumRequests].Gtf.XRes = XRes;
+            CreateTimingArgs[NumRequests].Gtf.YRes = YRes;
+            CreateTimingArgs[NumRequests].Gtf.RRate = RRate;
+            CreateTimingArgs[NumRequests].Gtf.pTimingInfo = &TimingInfo[Counter];
+            CreateTimingArgs[NumRequests].Gtf.IsProgressiveMode = TRUE;
         }
+        RequestOf[NumRequests++] = Counter;
+    }
+
+    // Status of each request is checked below, a failed one only drops its mode
+    DisplayInfoRoutinesCreateTimings(CreateTimingArgs, NumRequests);
+    for (Request = 0; Request < NumRequests; Request++)
+    {
+        Found[RequestOf[Request]] = IS_DDSTATUS_SUCCESS(CreateTimingArgs[Request].Status) ? TRUE : FALSE;
+        TimingInfo[RequestOf[Request]].SignalStandard = (DD_TIMING_FORMULA_GTF == CreateTimingArgs[Request].Formula) ? DD_VESA_GTF : DD_VESA_CVT;
+    }
 
+    for (Counter = 0; Counter < NUM_STANDARD_TIMING; Counter++)
+    {
         // Add the mode timing info
-        if ((TRUE == Found) && (AddModes.pTimingInfo))
+        if (TRUE == Found[Counter])
         {
             // Any timing outside these limits may cause the monitor to enter a self - protection mode.
             // The host shall always verify that an intended timing is always less than or equal to MonitorRangeLimitsMaxPixelClk.
             // When MonitorRangeLimitsPixelClk is Valid(!=0) , Dotclk should be less than the MRLPixelClk otherwise prune the mode.
-            if ((0 != pEdidData->pData->BasicDisplayCaps.MonitorRangeLimitsMaxPixelClk) && (TimingInfo.DotClockInHz > pEdidData->pData->BasicDisplayCaps.MonitorRangeLimitsMaxPixelClk))
+            if ((0 != pEdidData->pData->BasicDisplayCaps.MonitorRangeLimitsMaxPixelClk) && (TimingInfo[Counter].DotClockInHz > pEdidData->pData->BasicDisplayCaps.MonitorRangeLimitsMaxPixelClk))
             {
                 continue;
             }
 
-            VicId = (pEdidData->pData->FtrSupport.IsCeExtnDisplay) ? CeInfoParserIsCeMode(&TimingInfo) : VIC_UNDEFINED;
+            VicId = (pEdidData->pData->FtrSupport.IsCeExtnDisplay) ? CeInfoParserIsCeMode(&TimingInfo[Counter]) : VIC_UNDEFINED;
 
-            TimingInfo.ModeSource = STD_TIMING;
-            TimingInfo.CeData.VicId[0] = VicId;
-            TimingInfo.CeData.Par[0].Value = 0; // AVI_PAR_NODATA;
+            TimingInfo[Counter].ModeSource = STD_TIMING;
+            TimingInfo[Counter].CeData.VicId[0] = VicId;
+            TimingInfo[Counter].CeData.Par[0].Value = 0; // AVI_PAR_NODATA;
 
+            AddModes.pTimingInfo = &TimingInfo[Counter];
             AddModes.ForceAdd = FALSE;
 
             DisplayInfoParserAddEDIDModeToList(&AddModes, pEdidData);
@@ -2569,8 +3142,11 @@ DDSTATUS EdidParserParseVTBExtCVTs(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID
     DDU32           RRCount;
     DD_BOOL         IsReducedBlanking = FALSE;
     ADD_MODES       AddModes;
-    CREATE_CVT_TIMING_ARGS  CreateCVTTimingArgs;
-    DD_TIMING_INFO  TimingInfo;
+    CREATE_TIMING_ARGS  CreateTimingArgs[VTB_MAX_RR];
+    CREATE_CVT_TIMING_ARGS* pCreateCVTTimingArgs;
+    DD_TIMING_INFO  TimingInfo[VTB_MAX_RR];
+    DDU32           NumTimings;
+    DDU32           TimingIndex;
 
     DISP_FUNC_ENTRY();
 
@@ -2579,7 +3155,7 @@ DDSTATUS EdidParserParseVTBExtCVTs(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    DD_ZERO_MEM(&TimingInfo, sizeof(DD_TIMING_INFO));
+    DD_ZERO_MEM(TimingInfo, sizeof(TimingInfo));
 
     NumCVT = (pParseExtDataBlkArgs->LenDataBlock / VTB_CVT_SIZE);
 
@@ -2614,12 +3190,7 @@ DDSTATUS EdidParserParseVTBExtCVTs(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID
             continue;
         }
 
-        CreateCVTTimingArgs.XRes = XRes;
-        CreateCVTTimingArgs.YRes = YRes;
-        CreateCVTTimingArgs.IsInterLaced = FALSE;
-        CreateCVTTimingArgs.IsMargin_Req = FALSE;
-
-        for (RRCount = 0, IsReducedBlanking = TRUE; RRCount < VTB_MAX_RR; RRCount++)
+        for (RRCount = 0, NumTimings = 0, IsReducedBlanking = TRUE; RRCount < VTB_MAX_RR; RRCount++)
         {
             if (RRCount != 0)
             {
@@ -2633,24 +3204,37 @@ DDSTATUS EdidParserParseVTBExtCVTs(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID
             }
 
             // VTB extension CVT support is set for this RR
-            CreateCVTTimingArgs.RRate = Available_RRs[RRCount];
-            CreateCVTTimingArgs.IsRed_Blank_Req = IsReducedBlanking;
-            CreateCVTTimingArgs.pTimingInfo = &TimingInfo;
-            Status = DisplayInfoRoutinesCreateCVTTiming(&CreateCVTTimingArgs);
-            if (IS_DDSTATUS_ERROR(Status))
+            CreateTimingArgs[NumTimings].Formula = DD_TIMING_FORMULA_CVT;
+            pCreateCVTTimingArgs = &CreateTimingArgs[NumTimings].Cvt;
+            pCreateCVTTimingArgs->XRes = XRes;
+            pCreateCVTTimingArgs->YRes = YRes;
+            pCreateCVTTimingArgs->RRate = Available_RRs[RRCount];
+            pCreateCVTTimingArgs->IsInterLaced = FALSE;
+            pCreateCVTTimingArgs->IsMargin_Req = FALSE;
+            pCreateCVTTimingArgs->IsRed_Blank_Req = IsReducedBlanking;
+            pCreateCVTTimingArgs->pTimingInfo = &TimingInfo[NumTimings];
+            NumTimings++;
+        }// end of RRcount for loop
+
+        // All RRs of the descriptor are created in one call, Status of each request tells which ones failed
+        DisplayInfoRoutinesCreateTimings(CreateTimingArgs, NumTimings);
+
+        for (TimingIndex = 0; TimingIndex < NumTimings; TimingIndex++)
+        {
+            if (IS_DDSTATUS_ERROR(CreateTimingArgs[TimingIndex].Status))
             {
                 // CVT timings could not be ceated
                 continue;
             }
 
-            TimingInfo.CeData.VicId[0] = VIC_UNDEFINED;
-            TimingInfo.CeData.Par[0].Value = 0;   // AVI_PAR_NODATA;
-            TimingInfo.SignalStandard = DD_VESA_CVT;
+            TimingInfo[TimingIndex].CeData.VicId[0] = VIC_UNDEFINED;
+            TimingInfo[TimingIndex].CeData.Par[0].Value = 0;   // AVI_PAR_NODATA;
+            TimingInfo[TimingIndex].SignalStandard = DD_VESA_CVT;
 
-            AddModes.pTimingInfo = &TimingInfo;
+            AddModes.pTimingInfo = &TimingInfo[TimingIndex];
             AddModes.ForceAdd = TRUE;
             Status = DisplayInfoParserAddEDIDModeToList(&AddModes, pEdidData);
-        }// end of RRcount for loop
+        }
     }// end of CVT count for loop
 
     Status = DDS_SUCCESS;
@@ -2697,6 +3281,12 @@ DDSTATUS EdidParserParseVTBExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
 
     for (BlockNum = 1; (BlockNum <= NumExtBlocks) && (BlockNum < MAX_EDID_EXTENSIONS_SUPPORTED); BlockNum++)
     {
+        if (pGetEdidModes->BufSizeInBytes < ((BlockNum + 1) * EDID_BLOCK_SIZE))
+        {
+            // Wrong length for buffer passed in by caller. Hence failing
+            break;
+        }
+
         pVTBExt = (VTB_EXT*)((DDU8*)pEdidBaseBlock + (BlockNum * EDID_BLOCK_SIZE));
         pTemp = (DDU8*)(pVTBExt);
 
@@ -2850,7 +3440,7 @@ void EdidGetSupportedBPCFromBaseBlock(DD_GET_EDID_MODES* pGetEdidModes, EDID_DAT
 DDU8 CeInfoParserIsCeMode(DD_TIMING_INFO* pTimingInfo)
 {
     DDU8 VicId = VIC_UNDEFINED; // Assume VIC undefined
-    CE_SHORT_VIDEO_MODE* pCeShortVideoDes = NULL;
+    const CE_SHORT_VIDEO_MODE* pCeShortVideoDes = NULL;
     DDU8 Counter;
     PIXELCLK_COMPARE_ARGS PixelCompareArgs;
 
@@ -2961,7 +3551,16 @@ void CeInfoParserUpdateCeModeList(EDID_DATA* pEdidData, CE_MODE_LIST* pCeModeDat
     pCeModeData->Par[0].Is_Avi_Par_4_3 = (g_SupportedCeShortVideoModes[VicId].AspectRatio == AVI_PAR_4_3) ? TRUE : FALSE;
     pCeModeData->Par[0].Is_Avi_Par_16_9 = (g_SupportedCeShortVideoModes[VicId].AspectRatio == AVI_PAR_16_9) ? TRUE : FALSE;
     pCeModeData->Par[0].Is_Avi_Par_64_27 = (g_SupportedCeShortVideoModes[VicId].AspectRatio == AVI_PAR_64_27) ? TRUE : FALSE;
-    pCeModeData->pTimingInfo->ModeSource = ModeSource;
+    pCeModeData->ModeSource = ModeSource;
+
+    // Global timings are shared by all parse calls, so mode source is kept in the VIC list entries using this timing
+    for (Count = 0; Count < pEdidData->VicCount; Count++)
+    {
+        if (pEdidData->pCeModeList[Count].pTimingInfo == pCeModeData->pTimingInfo)
+        {
+            pEdidData->pCeModeList[Count].ModeSource = ModeSource;
+        }
+    }
 
     DDASSERT(pCeModeData->pTimingInfo->S3DFormatMask == 0);
 
@@ -3020,6 +3619,7 @@ void CeInfoParserUpdateCeModeList(EDID_DATA* pEdidData, CE_MODE_LIST* pCeModeDat
     {
         // Update all data to the list and increment VIC Count
         pEdidData->pCeModeList[Count].pTimingInfo = pCeModeData->pTimingInfo;
+        pEdidData->pCeModeList[Count].ModeSource = pCeModeData->ModeSource;
         pEdidData->pCeModeList[Count].VicId[VicInstance] = pCeModeData->VicId[0];
         pEdidData->pCeModeList[Count].VicId4k2k = pCeModeData->VicId4k2k;
         pEdidData->pCeModeList[Count].IsPreferred = pCeModeData->IsPreferred;        // Update Preferred flag
@@ -3107,6 +3707,7 @@ DDSTATUS CeInfoParserAddPrModes(DD_TIMING_INFO* pTimingInfo, EDID_DATA* pEdidDat
     }
 
     PrTimingInfo = *g_SupportedCeShortVideoModes[VicId].pTimingInfo;
+    PrTimingInfo.ModeSource = pTimingInfo->ModeSource; // Not kept in global timing
 
     SupportedPrMask = g_SupportedCeShortVideoModes[VicId].PRMask;
 
@@ -3201,6 +3802,7 @@ DDSTATUS CeInfoParserAddCeModesToList(EDID_DATA* pEdidData, CE_MODE_LIST* pCeMod
     }
 
     TimingInfo = *(pCeModeList->pTimingInfo);
+    TimingInfo.ModeSource = pCeModeList->ModeSource;
     TimingInfo.Flags.PreferredMode = pCeModeList->IsPreferred;
     TimingInfo.CeData.SamplingMode.Value = pCeModeList->SamplingMode.Value;
     TimingInfo.SignalStandard = (DD_SIGNAL_STANDARD)pCeModeList->SignalStandard;
@@ -3220,87 +3822,156 @@ DDSTATUS CeInfoParserAddCeModesToList(EDID_DATA* pEdidData, CE_MODE_LIST* pCeMod
 }
 
 /***************************************************************
- * @brief Method to return pointer corresponding to input Display ID Block.
+ * @brief Method to index all data blocks of a CE data block collection.
+ *
+ *  Walks the collection once and records Tag, Extended Tag, IEEE registration ID, offset, length and instance of
+ *  every non empty block into pParseExtDataBlkArgs->CeBlockIndex. Block lookups of CE parsing are then served from
+ *  the index instead of rescanning the collection for every Tag.
+ *  Must be called whenever pDataBlock/LenDataBlock is set to a new collection.
+ *
+ * @param pParseExtDataBlkArgs
+ * @return void
+ ***************************************************************/
+static void CeInfoParserIndexDataBlocks(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs)
+{
+    CE_DATA_BLOCK_INDEX* pIndex;
+    CE_DATA_BLOCK_ENTRY* pEntry;
+    CE_EXT_BLK_HEADER CeDatablkHeader;
+    HDMI_VSDB* pHdmiVsdbBlock;
+    DDU8 LastOfTag[CEA_USE_EXTENDED_TAG + 1];
+    DDU8 LastOfExtendedTag[256];
+    DDU8* pLast;
+    DDU32 Offset;
+
+    // Arg validation
+    DDASSERT(pParseExtDataBlkArgs);
+    DDASSERT(pParseExtDataBlkArgs->pDataBlock);
+
+    pIndex = &pParseExtDataBlkArgs->CeBlockIndex;
+    pIndex->NumBlocks = 0;
+    memset(pIndex->FirstOfTag, CE_DATA_BLOCK_NONE, sizeof(pIndex->FirstOfTag));
+    DD_ZERO_MEM(pIndex->CountOfTag, sizeof(pIndex->CountOfTag));
+    memset(pIndex->FirstOfExtendedTag, CE_DATA_BLOCK_NONE, sizeof(pIndex->FirstOfExtendedTag));
+
+    // Next Block's offset is <current offset + 1 (for Tag byte) + Size of this block>
+    for (Offset = 0; (Offset < pParseExtDataBlkArgs->LenDataBlock) && (pIndex->NumBlocks < MAX_CE_DATA_BLOCKS); Offset += CeDatablkHeader.CeHdr.Length + 1)
+    {
+        CeDatablkHeader.Value = *((DDU16*)((pParseExtDataBlkArgs->pDataBlock + Offset)));
+
+        // Empty blocks are never returned by lookups
+        if (CeDatablkHeader.CeHdr.Length < 1)
+        {
+            continue;
+        }
+
+        pEntry = &pIndex->Entries[pIndex->NumBlocks];
+        pEntry->Tag = CeDatablkHeader.CeHdr.Tag;
+        pEntry->ExtendedTag = CeDatablkHeader.ExtendedTag;
+        pEntry->Offset = (DDU8)Offset;
+        pEntry->Length = CeDatablkHeader.CeHdr.Length;
+        pEntry->Instance = pIndex->CountOfTag[pEntry->Tag];
+        pEntry->NextSameTag = CE_DATA_BLOCK_NONE;
+        pEntry->IEEERegNum = 0;
+
+        if (CEA_VENDOR_DATABLOCK == pEntry->Tag)
+        {
+            pHdmiVsdbBlock = (HDMI_VSDB*)(pParseExtDataBlkArgs->pDataBlock + Offset);
+            pEntry->IEEERegNum = DisplayInfoParserConvertHexArrayToInt(pHdmiVsdbBlock->IEEERegID, 3);
+        }
+
+        // Extended blocks are chained per Extended Tag, others per Tag
+        if (CEA_USE_EXTENDED_TAG == pEntry->Tag)
+        {
+            pLast = &LastOfExtendedTag[pEntry->ExtendedTag];
+            if (CE_DATA_BLOCK_NONE == pIndex->FirstOfExtendedTag[pEntry->ExtendedTag])
+            {
+                pIndex->FirstOfExtendedTag[pEntry->ExtendedTag] = pIndex->NumBlocks;
+                *pLast = CE_DATA_BLOCK_NONE;
+            }
+        }
+        else
+        {
+            pLast = &LastOfTag[pEntry->Tag];
+            if (CE_DATA_BLOCK_NONE == pIndex->FirstOfTag[pEntry->Tag])
+            {
+                pIndex->FirstOfTag[pEntry->Tag] = pIndex->NumBlocks;
+                *pLast = CE_DATA_BLOCK_NONE;
+            }
+        }
+
+        if (CE_DATA_BLOCK_NONE != *pLast)
+        {
+            pIndex->Entries[*pLast].NextSameTag = pIndex->NumBlocks;
+        }
+        *pLast = pIndex->NumBlocks;
+
+        pIndex->CountOfTag[pEntry->Tag]++;
+        pIndex->NumBlocks++;
+    }
+}
+
+/***************************************************************
+ * @brief Method to fill args for a CE data block lookup in the collection of pParseExtDataBlkArgs.
  *
  * @param pGetBlockById
+ * @param BlockIdOrTag
+ * @param CeaExtendedTag
+ * @param IEEERegNum
+ * @param InstanceOfBlock
+ * @param pParseExtDataBlkArgs collection to search, indexed by CeInfoParserIndexDataBlocks()
  * @return void
  ***************************************************************/
-void CeInfoParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8 BlockIdOrTag, DDU8 CeaExtendedTag, DDU32 IEEERegNum, DDU8 InstanceOfBlock, DDU8* pInputBuf, DDU32 InputBlockLength)
+void CeInfoParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8 BlockIdOrTag, DDU8 CeaExtendedTag, DDU32 IEEERegNum, DDU8 InstanceOfBlock, PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs)
 {
     pGetBlockById->BlockIdOrTag = BlockIdOrTag;
     pGetBlockById->CeaExtendedTag = CeaExtendedTag;
     pGetBlockById->IEEERegNum = IEEERegNum;
     pGetBlockById->InstanceOfBlock = InstanceOfBlock; // Valid only for Display ID base block/extension block; helpful to search if there are multiple instances of timing blocks
-    pGetBlockById->pInputBuf = pInputBuf;
-    pGetBlockById->InputBlockLength = InputBlockLength;
+    pGetBlockById->pInputBuf = pParseExtDataBlkArgs->pDataBlock;
+    pGetBlockById->InputBlockLength = pParseExtDataBlkArgs->LenDataBlock;
+    pGetBlockById->pCeBlockIndex = &pParseExtDataBlkArgs->CeBlockIndex;
     pGetBlockById->pOutputBlock = NULL;
 }
 
 /***************************************************************
- * @brief Method to return Count of input Display ID Block
+ * @brief Method to return Count of input CE data Block
  *
  * @param pGetBlockById
  * @return DDU8
  ***************************************************************/
 static DDU8 CeInfoParserGetBlockCount(GET_BLOCK_BY_ID_ARGS* pGetBlockById)
 {
-    CE_EXT_BLK_HEADER CeDatablkHeader;
-    DDU8 Offset;
-    DDU8 Count;
-
     // Arg validation
     DDASSERT(pGetBlockById);
-    DDASSERT(pGetBlockById->pInputBuf);
+    DDASSERT(pGetBlockById->pCeBlockIndex);
 
     if (pGetBlockById->BlockIdOrTag > CEA_USE_EXTENDED_TAG)
     {
         // Invalid block ID found or block parsing not implemented yet
         return 0;
     }
-    Offset = 0;
-    Count = 0;
-    do
-    {
-        CeDatablkHeader.Value = *((DDU16*)((pGetBlockById->pInputBuf + Offset)));
-
-        if ((CeDatablkHeader.CeHdr.Tag != pGetBlockById->BlockIdOrTag) || (CeDatablkHeader.CeHdr.Length < 1))
-        {
-            // Requested data block was not found. So look into the next Block
-            // Next Block's offset is <current offset + 1 (for Tag byte) + Size of this block>
-            Offset += CeDatablkHeader.CeHdr.Length + 1;
-
-            // Continue searching for next block if Tags are not matching
-            continue;
-        }
-        else if (CeDatablkHeader.CeHdr.Tag == pGetBlockById->BlockIdOrTag)
-        {
-            // Increase the count if Tag or block id is found
-            Count++;
-        }
-        Offset += CeDatablkHeader.CeHdr.Length + 1;
-    } while (Offset < pGetBlockById->InputBlockLength);
 
-    return Count;
+    return pGetBlockById->pCeBlockIndex->CountOfTag[pGetBlockById->BlockIdOrTag];
 }
 
 /***************************************************************
- * @brief Method to return pointer corresponding to input Display ID Block.
+ * @brief Method to return pointer corresponding to input CE data Block.
+ *
+ *  Vendor blocks are matched by IEEE registration ID and extended blocks by Extended Tag, first match is returned.
+ *  Other blocks are matched by Tag and InstanceOfBlock.
  *
  * @param pGetBlockById
  * @return void
  ***************************************************************/
 static void CeInfoParserGetCeaExtnBlockByID(GET_BLOCK_BY_ID_ARGS* pGetBlockById)
 {
-    CE_EXT_BLK_HEADER CeDatablkHeader;
-    DDU8 Offset = 0;
-    HDMI_VSDB* pHdmiVsdbBlock = NULL;
-    DDU32 IEEERegNum = 0;
-    DDU8 BlockInstanceId = 0;
-    // DISP_FUNC_ENTRY();
+    const CE_DATA_BLOCK_INDEX* pIndex;
+    DDU8 EntryId;
 
     // Arg validation
     DDASSERT(pGetBlockById);
     DDASSERT(pGetBlockById->pInputBuf);
+    DDASSERT(pGetBlockById->pCeBlockIndex);
 
     if (pGetBlockById->BlockIdOrTag > CEA_USE_EXTENDED_TAG)
     {
@@ -3308,61 +3979,39 @@ static void CeInfoParserGetCeaExtnBlockByID(GET_BLOCK_BY_ID_ARGS* pGetBlockById)
         return;
     }
 
-    Offset = 0;
+    pIndex = pGetBlockById->pCeBlockIndex;
 
-    do
+    if (CEA_USE_EXTENDED_TAG == pGetBlockById->BlockIdOrTag)
     {
-        CeDatablkHeader.Value = *((DDU16*)((pGetBlockById->pInputBuf + Offset)));
-
-        if ((CeDatablkHeader.CeHdr.Tag != pGetBlockById->BlockIdOrTag) || (CeDatablkHeader.CeHdr.Length < 1))
-        {
-            // Requested data block was not found. So look into the next Block
-            // Next Block's offset is <current offset + 1 (for Tag byte) + Size of this block>
-            Offset += CeDatablkHeader.CeHdr.Length + 1;
-
-            // Continue searching for next block if Tags are not matching
-            continue;
-        }
+        EntryId = pIndex->FirstOfExtendedTag[pGetBlockById->CeaExtendedTag];
+    }
+    else
+    {
+        EntryId = pIndex->FirstOfTag[pGetBlockById->BlockIdOrTag];
+    }
 
-        // Match inout IEEE registration ID as well for vendor Data block
-        if (CeDatablkHeader.CeHdr.Tag == CEA_VENDOR_DATABLOCK)
+    for (; CE_DATA_BLOCK_NONE != EntryId; EntryId = pIndex->Entries[EntryId].NextSameTag)
+    {
+        // Match input IEEE registration ID as well for vendor Data block
+        if (CEA_VENDOR_DATABLOCK == pGetBlockById->BlockIdOrTag)
         {
-            pHdmiVsdbBlock = (HDMI_VSDB*)(pGetBlockById->pInputBuf + Offset);
-            IEEERegNum = DisplayInfoParserConvertHexArrayToInt(pHdmiVsdbBlock->IEEERegID, 3);
-            if (IEEERegNum == pGetBlockById->IEEERegNum)
+            if (pIndex->Entries[EntryId].IEEERegNum != pGetBlockById->IEEERegNum)
             {
-                pGetBlockById->pOutputBlock = pGetBlockById->pInputBuf + Offset;
-                break;
+                continue;
             }
         }
-        else
+        else if (CEA_USE_EXTENDED_TAG != pGetBlockById->BlockIdOrTag)
         {
-            if (CeDatablkHeader.CeHdr.Tag != CEA_USE_EXTENDED_TAG)
-            {
-                // Match Extended tag as well if CEA_USE_EXTENDED_TAG is specified
-                if (BlockInstanceId < pGetBlockById->InstanceOfBlock)
-                {
-                    // except Display ID block and Audio Data block the block id instance is always set to 0. Once we get multiple audio block internally we update it to new instance id
-                    Offset += CeDatablkHeader.CeHdr.Length + 1;
-                    BlockInstanceId += 1;
-                    continue;
-                }
-                // Return success if TagID matches for non Extended tag
-                pGetBlockById->pOutputBlock = pGetBlockById->pInputBuf + Offset;
-                break;
-            }
-            else if (CeDatablkHeader.ExtendedTag == pGetBlockById->CeaExtendedTag)
+            // except Display ID block and Audio Data block the block id instance is always set to 0. Once we get multiple audio block internally we update it to new instance id
+            if (pIndex->Entries[EntryId].Instance < pGetBlockById->InstanceOfBlock)
             {
-                // Return success if TagID matches for non Extended tag
-                pGetBlockById->pOutputBlock = pGetBlockById->pInputBuf + Offset;
-                break;
+                continue;
             }
         }
 
-        // Requested data block was not found. So look into the next Block
-        // Next Block's offset is <current offset + 1 (for Tag byte) + Size of this block>
-        Offset += CeDatablkHeader.CeHdr.Length + 1;
-    } while (Offset < pGetBlockById->InputBlockLength);
+        pGetBlockById->pOutputBlock = pGetBlockById->pInputBuf + pIndex->Entries[EntryId].Offset;
+        break;
+    }
 }
 
 /***************************************************************
@@ -3413,7 +4062,7 @@ DDSTATUS CeInfoParserParseVideoCapabilityDataBlock(PARSE_EXTBLK_ARGS* pParseExtD
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VIDEO_CAP_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VIDEO_CAP_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -3456,7 +4105,7 @@ void CeInfoParserParseVfpdbList(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID_DA
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VIDEO_FORMAT_PREFERENCE_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VIDEO_FORMAT_PREFERENCE_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -3506,7 +4155,7 @@ DDSTATUS CeInfoParserParseColorimetryDataBlock(PARSE_EXTBLK_ARGS* pParseExtDataB
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_COLORIMETRY_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_COLORIMETRY_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -3571,11 +4220,11 @@ DDSTATUS CeInfoParserParseAudioDataBlock(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs
     DDASSERT(pEdidData);
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_AUDIO_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_AUDIO_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_AUDIO_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs);
     AudioDataBlockCount = CeInfoParserGetBlockCount(&GetBlockById);
     for (DDU8 BlockInstanceId = 0; BlockInstanceId < AudioDataBlockCount; BlockInstanceId++)
     {
-        CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_AUDIO_DATABLOCK, 0xFF, 0, BlockInstanceId, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+        CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_AUDIO_DATABLOCK, 0xFF, 0, BlockInstanceId, pParseExtDataBlkArgs);
         CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
         if (GetBlockById.pOutputBlock == NULL)
         {
@@ -3670,7 +4319,7 @@ DDSTATUS CeInfoParserParseSpeakerAllocationDataBlock(PARSE_EXTBLK_ARGS* pParseEx
     DDASSERT(pEdidData);
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_SPEAKER_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_SPEAKER_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_SPEAKER_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -3705,7 +4354,7 @@ void CeInfoParserParseHdr10PlusVsVdb(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, ED
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VENDOR_SPECIFIC_VIDEO_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VENDOR_SPECIFIC_VIDEO_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -3860,7 +4509,7 @@ DDSTATUS CeInfoParserGetSvdListFromVideoDataBlock(PARSE_EXTBLK_ARGS* pParseExtDa
     DDASSERT(pEdidData);
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_VIDEO_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VIDEO_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VIDEO_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -3912,7 +4561,7 @@ DDSTATUS CeInfoParserAddModesFromVideoDataBlock(PARSE_EXTBLK_ARGS* pParseExtData
     DD_ZERO_MEM(&CeVicData, sizeof(CE_MODE_LIST));
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_VIDEO_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VIDEO_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VIDEO_DATABLOCK, 0xFF, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -3973,7 +4622,7 @@ DDSTATUS CeInfoParserIs420VideoDataBlockPresent(PARSE_EXTBLK_ARGS* pParseExtData
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_VIDEO_DATABLOCK, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_VIDEO_DATABLOCK, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs);
 
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
@@ -4014,7 +4663,7 @@ DDSTATUS CeInfoParserAddModesFrom420VideoDataBlock(PARSE_EXTBLK_ARGS* pParseExtD
 
     DD_ZERO_MEM(&CeVicData, sizeof(CE_MODE_LIST));
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_VIDEO_DATABLOCK, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_VIDEO_DATABLOCK, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs);
 
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
@@ -4077,7 +4726,7 @@ DDSTATUS CeInfoParserIs420CapabilityBlockPresent(PARSE_EXTBLK_ARGS* pParseExtDat
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_CAPABILITY_MAP_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_CAPABILITY_MAP_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -4127,7 +4776,7 @@ DDSTATUS CeInfoParserParse420CapabilityMapDataBlock(PARSE_EXTBLK_ARGS* pParseExt
 
     DD_ZERO_MEM(&CeVicData, sizeof(CE_MODE_LIST));
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_CAPABILITY_MAP_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_420_CAPABILITY_MAP_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -4244,7 +4893,7 @@ DDSTATUS CeInfoParserParseVicsFromVfpdb(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs,
     DD_ZERO_MEM(&CeVicData, sizeof(CE_MODE_LIST));
     DD_ZERO_MEM(&TimingInfo, sizeof(DD_TIMING_INFO));
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VIDEO_FORMAT_PREFERENCE_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_VIDEO_FORMAT_PREFERENCE_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -4329,7 +4978,7 @@ DDSTATUS CeInfoParserParseHdrCapDataBlock(PARSE_EXTBLK_ARGS* pParseExtDataBlkArg
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_HDR_STATIC_META_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_HDR_STATIC_META_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
     {
@@ -4911,7 +5560,7 @@ DDSTATUS CeInfoParserParseHFVSDB(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID_D
     DDASSERT(pEdidData);
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_VENDOR_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI2_IEEE_REG_ID, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI2_IEEE_REG_ID, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
 
     HfVsdbBlockFound = TRUE; // Assume HF-VSDB Block found
@@ -4919,7 +5568,7 @@ DDSTATUS CeInfoParserParseHFVSDB(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID_D
     {
         HfVsdbBlockFound = FALSE;
         // If HF-VSDB is not found, check for HF-SCDB as that has the same definition as this block
-        CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_HF_SCDB_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+        CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_HF_SCDB_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
         CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
         if (GetBlockById.pOutputBlock == NULL)
         {
@@ -5099,7 +5748,7 @@ DDSTATUS CeInfoParserParseHdmiVsdb(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs, EDID
     *pIsValidVicOffset = FALSE; // Init
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_VENDOR_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs);
 
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
@@ -5213,7 +5862,7 @@ DDSTATUS CeInfoParserAddModesFromHdmiVsdb(PARSE_EXTBLK_ARGS* pParseExtDataBlkArg
     DDASSERT(pEdidData);
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_VENDOR_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs);
 
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
@@ -5272,7 +5921,7 @@ DDSTATUS CeInfoParserParseDisplayIDTimings(PARSE_EXTBLK_ARGS* pParseExtDataBlkAr
     DDASSERT(pParseExtDataBlkArgs->pDataBlock);
     DDASSERT(pEdidData);
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_TYPE_VII_VIDEO_TIMING_DATA_BLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_TYPE_VII_VIDEO_TIMING_DATA_BLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
 
     if (GetBlockById.pOutputBlock)
@@ -5281,7 +5930,7 @@ DDSTATUS CeInfoParserParseDisplayIDTimings(PARSE_EXTBLK_ARGS* pParseExtDataBlkAr
         DisplayInfoParserParseCtaType7Timing(pFormula7, pEdidData);
     }
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_TYPE_VIII_VIDEO_TIMING_DATA_BLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_TYPE_VIII_VIDEO_TIMING_DATA_BLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
 
     if (GetBlockById.pOutputBlock)
@@ -5290,7 +5939,7 @@ DDSTATUS CeInfoParserParseDisplayIDTimings(PARSE_EXTBLK_ARGS* pParseExtDataBlkAr
         DisplayInfoParserParseCtaType8Timing(pFormula8, pEdidData);
     }
 
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_TYPE_X_VIDEO_TIMING_DATA_BLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_TYPE_X_VIDEO_TIMING_DATA_BLOCK, 0, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
 
     if (GetBlockById.pOutputBlock)
@@ -5436,11 +6085,15 @@ void CeInfoParserParseCeExtensionForCaps(PARSE_EXTBLK_ARGS* pParseExtDataBlkArgs
  *          7. Parse and add DTDs if any
  *          8. Parse HDMI VSDB Block to add S3D and 4k2k Modes
  *          9. EdidParserParseHFVSDB to update HDMI caps.
+ *
+ *      With pCapsEdidData the caps of a caps only call are parsed in the same walk,
+ *      from the data block index built for the modes.
  * @param pGetEdidModes
  * @param pEdidData
+ * @param pCapsEdidData Optional, EDID data of a caps only call parsed along with modes, NULL if none
  * @return void
  ***************************************************************/
-void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData)
+void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, EDID_DATA* pCapsEdidData)
 {
     CEA_EXT_CAPS CEAExtCaps;
     EDID_BASE_BLOCK* pEdidBaseBlock = NULL;
@@ -5461,7 +6114,7 @@ void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
 
     for (BlockNum = 1; (BlockNum <= NumExtBlocks) && (BlockNum < MAX_EDID_EXTENSIONS_SUPPORTED); BlockNum++)
     {
-        if (pGetEdidModes->BufSizeInBytes < (BlockNum * EDID_BLOCK_SIZE))
+        if (pGetEdidModes->BufSizeInBytes < ((BlockNum + 1) * EDID_BLOCK_SIZE))
         {
             // Wrong length for buffer passed in by caller. Hence failing
             break;
@@ -5475,6 +6128,10 @@ void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
         }
 
         pEdidData->pData->FtrSupport.IsCeExtnDisplay = TRUE;
+        if (NULL != pCapsEdidData)
+        {
+            pCapsEdidData->pData->FtrSupport.IsCeExtnDisplay = TRUE;
+        }
 
         // Get the Offset and check whether we have DTD's and Data Blocks
         // If Offset = 0, then we dont have DTD's and Data Blocks
@@ -5490,6 +6147,12 @@ void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
         pEdidData->pData->HdmiCaps.HdmiCeCaps.UnderscansITFormats = pCeEdidExtn->Capabilty.UnderscansITFormats;
         pEdidData->pData->FtrSupport.YCbCr422Supported = pCeEdidExtn->Capabilty.SupportsYCBCR422;
         pEdidData->pData->FtrSupport.YCbCr444Supported = pCeEdidExtn->Capabilty.SupportsYCBCR444;
+        if (NULL != pCapsEdidData)
+        {
+            pCapsEdidData->pData->HdmiCaps.HdmiCeCaps.UnderscansITFormats = pCeEdidExtn->Capabilty.UnderscansITFormats;
+            pCapsEdidData->pData->FtrSupport.YCbCr422Supported = pCeEdidExtn->Capabilty.SupportsYCBCR422;
+            pCapsEdidData->pData->FtrSupport.YCbCr444Supported = pCeEdidExtn->Capabilty.SupportsYCBCR444;
+        }
 
         // Process Data Block if exists:
         if (pGetEdidModes->pModeTable != NULL)
@@ -5518,6 +6181,7 @@ void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
         ParseExtDataBlkArgs.pDataBlock = pCeEdidExtn->CeBlockData;
         ParseExtDataBlkArgs.LenDataBlock = pCeEdidExtn->DTDOffset - CEA_EDID_HEADER_SIZE;
         ParseExtDataBlkArgs.pModeTable = pGetEdidModes->pModeTable;
+        CeInfoParserIndexDataBlocks(&ParseExtDataBlkArgs);
 
         CeInfoParserGetSupportedBPCFromCeExtBlock(&ParseExtDataBlkArgs, pEdidData);
 
@@ -5540,6 +6204,25 @@ void EdidParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
         if (NULL == pGetEdidModes->pModeTable)
             return;
 
+        if (NULL != pCapsEdidData)
+        {
+            // Caps only call stops at this block, parse its caps from the same data block index
+            ParseExtDataBlkArgs.pDataBlock = pCeEdidExtn->CeBlockData;
+            ParseExtDataBlkArgs.pModeTable = NULL;
+
+            CeInfoParserGetSupportedBPCFromCeExtBlock(&ParseExtDataBlkArgs, pCapsEdidData);
+
+            CeInfoParserParseCeExtensionForCaps(&ParseExtDataBlkArgs, pCapsEdidData);
+
+            if (pCapsEdidData->pData->BasicDisplayCaps.HdmiDisplayVersion >= HDMI_VERSION_1_4)
+            {
+                CEAExtCaps.Value = pCeEdidExtn->Capabilty.Value;
+
+                pCapsEdidData->pData->FtrSupport.IsAudioSupported = CEAExtCaps.SupportsBasicAudio;
+            }
+            pCapsEdidData = NULL;
+        }
+
     } // for loop for Block Num ends
 
     DISP_FUNC_WO_STATUS_EXIT();
@@ -5583,7 +6266,7 @@ void CeInfoParserGetSupportedBPCFromCeHdmiVSDBBlock(PARSE_EXTBLK_ARGS* pParseExt
     DDASSERT(pEdidData);
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_VENDOR_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI_IEEE_REG_ID, 0, pParseExtDataBlkArgs);
 
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
     if (GetBlockById.pOutputBlock == NULL)
@@ -5660,7 +6343,7 @@ void CeInfoParserGetSupportedBPCFromCeHFVSDBBlock(PARSE_EXTBLK_ARGS* pParseExtDa
     DDASSERT(pEdidData);
 
     // CeaExtendedTag is ignored as BlockIdOrTag is CEA_VENDOR_DATABLOCK
-    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI2_IEEE_REG_ID, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+    CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_VENDOR_DATABLOCK, 0xFF, CEA_HDMI2_IEEE_REG_ID, 0, pParseExtDataBlkArgs);
     CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
 
     HfVsdbBlockFound = TRUE; // Assume HF-VSDB Block found
@@ -5668,7 +6351,7 @@ void CeInfoParserGetSupportedBPCFromCeHFVSDBBlock(PARSE_EXTBLK_ARGS* pParseExtDa
     {
         HfVsdbBlockFound = FALSE;
         // If HF-VSDB is not found, check for HF-SCDB as that has the same definition as this block
-        CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_HF_SCDB_DATABLOCK, 0, 0, pParseExtDataBlkArgs->pDataBlock, pParseExtDataBlkArgs->LenDataBlock);
+        CeInfoParserFillGetBlockByIdArgs(&GetBlockById, CEA_USE_EXTENDED_TAG, CEA_HF_SCDB_DATABLOCK, 0, 0, pParseExtDataBlkArgs);
         CeInfoParserGetCeaExtnBlockByID(&GetBlockById);
         if (GetBlockById.pOutputBlock == NULL)
         {
@@ -5760,45 +6443,211 @@ static DDU8 CeInfoParserGetExtensionCountFromHdmiEeodb(DDU8* pEdidExtnBlock)
         // Nothing more to parse
         return INVALID_EDID_BLOCK_COUNT;
     }
-
-    return pHdmiEeodbBlock->EdidExtensionBlockCount;
+
+    return pHdmiEeodbBlock->EdidExtensionBlockCount;
+}
+
+/*
+ *
+ * CE Info parser related functions -- END
+ *
+ ***************************************************************/
+
+ /*
+  *
+  * Display ID parser related functions -- START
+  *
+  ***************************************************************/
+
+  /***************************************************************
+   * @brief Method to return pointer corresponding to input Display ID Block.
+   *
+   * @param pGetBlockById
+   * @param pEdidOrDisplayIDBuf Display ID header of section to search
+   * @param BlockIdOrTag
+   * @param InstanceOfBlock
+   * @param pEdidData optional, search uses the block index of section cached in it
+   * @return void
+   ***************************************************************/
+void DisplayIdParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8* pEdidOrDisplayIDBuf, DDU8 BlockIdOrTag, DDU8 InstanceOfBlock, EDID_DATA* pEdidData)
+{
+    DDU32 InputBlockLength = 0;
+    DDU8* pInputBuf = NULL;
+    if (pEdidOrDisplayIDBuf)
+    {
+        pInputBuf = (DDU8*)(pEdidOrDisplayIDBuf + sizeof(DISPLAYID_HEADER));    // 1st Display ID block
+        InputBlockLength = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->BytesInSection; // Exclude the last checksum byte
+
+        pGetBlockById->DisplayIdVerAndRev = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->RevisionAndVersion;
+        pGetBlockById->BlockIdOrTag = BlockIdOrTag;
+        pGetBlockById->CeaExtendedTag = 0; // Valid only for CE extension block search and when BlockIdOrTag == CEA_USE_EXTENDED_TAG
+        pGetBlockById->IEEERegNum = 0; // Valid only for CE extension block search and when BlockIdOrTag == CEA_VENDOR_DATABLOCK
+        pGetBlockById->InstanceOfBlock = InstanceOfBlock;
+        pGetBlockById->pInputBuf = pInputBuf;
+        pGetBlockById->InputBlockLength = InputBlockLength;
+        pGetBlockById->pCeBlockIndex = NULL;
+        pGetBlockById->pDidBlockIndex = (NULL != pEdidData) ? DisplayIdParserGetBlockIndex(pEdidData, pEdidOrDisplayIDBuf) : NULL;
+        pGetBlockById->pOutputBlock = NULL;
+    }
+}
+
+/***************************************************************
+ * @brief Method to return block index of a Display ID section.
+ *
+ *  Section is walked on its first lookup, the index is kept in pEdidData->pDidBlockIndexCache and serves
+ *  all later block lookups of the section, from the caps and modes passes when they share a parser context.
+ *
+ * @param pEdidData
+ * @param pEdidOrDisplayIDBuf Display ID header of section
+ * @return const DID_BLOCK_INDEX* NULL if pEdidData has no index cache
+ ***************************************************************/
+static const DID_BLOCK_INDEX* DisplayIdParserGetBlockIndex(EDID_DATA* pEdidData, DDU8* pEdidOrDisplayIDBuf)
+{
+    DID_BLOCK_INDEX_CACHE* pCache;
+    DID_BLOCK_INDEX* pIndex;
+    DISPLAYID_BLOCK* pDidBlockHeader;
+    DDU8 BlockTags[MAX_DID_BLOCKS_IN_SECTION];
+    DDU8 BlockOffsets[MAX_DID_BLOCKS_IN_SECTION];
+    DDU8 Placed[256];
+    DDU8* pInputBuf;
+    DDU32 InputBlockLength;
+    DDU32 DispIdBlockOffset;
+    DDU32 Count, Tag, Position;
+
+    DDASSERT(pEdidData);
+    DDASSERT(pEdidOrDisplayIDBuf);
+
+    pCache = pEdidData->pDidBlockIndexCache;
+    if (NULL == pCache)
+    {
+        return NULL;
+    }
+
+    for (Count = 0; (Count < pCache->NumSections) && (Count < MAX_DID_INDEXED_SECTIONS); Count++)
+    {
+        if (pCache->Sections[Count].pSection == pEdidOrDisplayIDBuf)
+        {
+            return &pCache->Sections[Count];
+        }
+    }
+
+    pIndex = &pCache->Sections[pCache->NumSections % MAX_DID_INDEXED_SECTIONS];
+    pCache->NumSections++;
+
+    pIndex->pSection = pEdidOrDisplayIDBuf;
+    pIndex->NumBlocks = 0;
+    DD_ZERO_MEM(pIndex->CountOfTag, sizeof(pIndex->CountOfTag));
+
+    pInputBuf = pEdidOrDisplayIDBuf + sizeof(DISPLAYID_HEADER);
+    InputBlockLength = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->BytesInSection;
+
+    // Same walk as DisplayIdParserGetDisplayIDBlockByID(), at least 3 bytes (for a possible DisplayID Data block header) must remain
+    DispIdBlockOffset = 0;
+    while ((InputBlockLength > sizeof(DISPLAYID_BLOCK)) && (DispIdBlockOffset < (InputBlockLength - sizeof(DISPLAYID_BLOCK))) && (pIndex->NumBlocks < MAX_DID_BLOCKS_IN_SECTION))
+    {
+        pDidBlockHeader = (DISPLAYID_BLOCK*)(pInputBuf + DispIdBlockOffset);
+
+        if ((pDidBlockHeader->BlockID == 0) && (pDidBlockHeader->RevAndOtherData == 0) && (pDidBlockHeader->NumberOfBytes == 0))
+        {
+            // This is the case of Padding when DisplayID is used as EDID extension, so no need to parse further
+            break;
+        }
+
+        if ((DispIdBlockOffset + sizeof(DISPLAYID_BLOCK) + pDidBlockHeader->NumberOfBytes) > InputBlockLength)
+        {
+            // Block runs past the section, it and anything after it are dropped
+            break;
+        }
+
+        BlockTags[pIndex->NumBlocks] = pDidBlockHeader->BlockID;
+        BlockOffsets[pIndex->NumBlocks] = (DDU8)DispIdBlockOffset;
+        pIndex->CountOfTag[pDidBlockHeader->BlockID]++;
+        pIndex->NumBlocks++;
+
+        DispIdBlockOffset += (pDidBlockHeader->NumberOfBytes + sizeof(DISPLAYID_BLOCK));
+    }
+
+    // Group offsets by tag, so that any (tag, instance) is a direct lookup
+    Position = 0;
+    for (Tag = 0; Tag < 256; Tag++)
+    {
+        pIndex->FirstOfTag[Tag] = (DDU8)Position;
+        Position += pIndex->CountOfTag[Tag];
+    }
+
+    DD_ZERO_MEM(Placed, sizeof(Placed));
+    for (Count = 0; Count < pIndex->NumBlocks; Count++)
+    {
+        Tag = BlockTags[Count];
+        pIndex->Offsets[pIndex->FirstOfTag[Tag] + Placed[Tag]] = BlockOffsets[Count];
+        Placed[Tag]++;
+    }
+
+    return pIndex;
+}
+
+/***************************************************************
+ * @brief Method to check that a Display ID section, header to checksum byte, lies within the buffer.
+ *
+ * @param pSection Display ID header of section
+ * @param BufSizeInBytes Bytes of buffer from pSection on
+ * @return DD_BOOL
+ ***************************************************************/
+static DD_BOOL DisplayIdParserIsSectionInBuffer(const DDU8* pSection, DDU32 BufSizeInBytes)
+{
+    if (BufSizeInBytes < sizeof(DISPLAYID_HEADER))
+    {
+        return FALSE;
+    }
+
+    return ((((const DISPLAYID_HEADER*)(pSection))->BytesInSection + sizeof(DISPLAYID_HEADER) + 1) <= BufSizeInBytes) ? TRUE : FALSE;
+}
+
+/***************************************************************
+ * @brief Method to add modes of one Display ID section with the parser of its version.
+ *
+ * @param pGetEdidModes Section to parse
+ * @param pEdidData
+ * @param RevisionAndVersion From Display ID header of section
+ * @return void
+ ***************************************************************/
+static void DisplayIdParserGetSectionModes(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, DDU8 RevisionAndVersion)
+{
+    switch (RevisionAndVersion)
+    {
+    case DISPLAY_ID_VER_2_1:
+    case DISPLAY_ID_VER_2_0:
+        // A new formula based timing block got added in DID 2.1. Separate functions will be
+        // required post formula based timing implementation. Reusing the same function for now.
+        DisplayIdV2ParserGetEdidModes(pGetEdidModes, pEdidData);
+        break;
+    default:
+        DisplayIdParserGetEdidModes(pGetEdidModes, pEdidData);
+        break;
+    }
 }
 
-/*
- *
- * CE Info parser related functions -- END
+/***************************************************************
+ * @brief Method to get caps of one Display ID section with the parser of its version.
  *
+ * @param pGetEdidModes Section to parse, pModeTable is NULL
+ * @param pEdidData
+ * @param RevisionAndVersion From Display ID header of section
+ * @return void
  ***************************************************************/
-
- /*
-  *
-  * Display ID parser related functions -- START
-  *
-  ***************************************************************/
-
-  /***************************************************************
-   * @brief Method to return pointer corresponding to input Display ID Block.
-   *
-   * @param pGetBlockById
-   * @return void
-   ***************************************************************/
-void DisplayIdParserFillGetBlockByIdArgs(GET_BLOCK_BY_ID_ARGS* pGetBlockById, DDU8* pEdidOrDisplayIDBuf, DDU8 BlockIdOrTag, DDU8 InstanceOfBlock)
+static void DisplayIdParserGetSectionCaps(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData, DDU8 RevisionAndVersion)
 {
-    DDU32 InputBlockLength = 0;
-    DDU8* pInputBuf = NULL;
-    if (pEdidOrDisplayIDBuf)
+    switch (RevisionAndVersion)
     {
-        pInputBuf = (DDU8*)(pEdidOrDisplayIDBuf + sizeof(DISPLAYID_HEADER));    // 1st Display ID block
-        InputBlockLength = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->BytesInSection; // Exclude the last checksum byte
-
-        pGetBlockById->DisplayIdVerAndRev = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf))->RevisionAndVersion;
-        pGetBlockById->BlockIdOrTag = BlockIdOrTag;
-        pGetBlockById->CeaExtendedTag = 0; // Valid only for CE extension block search and when BlockIdOrTag == CEA_USE_EXTENDED_TAG
-        pGetBlockById->IEEERegNum = 0; // Valid only for CE extension block search and when BlockIdOrTag == CEA_VENDOR_DATABLOCK
-        pGetBlockById->InstanceOfBlock = InstanceOfBlock;
-        pGetBlockById->pInputBuf = pInputBuf;
-        pGetBlockById->InputBlockLength = InputBlockLength;
-        pGetBlockById->pOutputBlock = NULL;
+    case DISPLAY_ID_VER_2_1:
+        DisplayIdV21ParserGetEdidCaps(pGetEdidModes, pEdidData);
+        break;
+    case DISPLAY_ID_VER_2_0:
+        DisplayIdV2ParserGetEdidCaps(pGetEdidModes, pEdidData);
+        break;
+    default:
+        DisplayIdParserGetEdidCaps(pGetEdidModes, pEdidData);
+        break;
     }
 }
 
@@ -5845,6 +6694,7 @@ DDSTATUS DisplayIdParserGetDisplayIDBlockByID(GET_BLOCK_BY_ID_ARGS* pGetBlockByI
 {
     DDSTATUS Status;
     DISPLAYID_BLOCK* pDidBlockHeader = NULL;
+    const DID_BLOCK_INDEX* pIndex;
     DDU32 DispIdBlockOffset;
     DDU8 InstanceOfBlock;
     DDU8 MaxValidBlockTag, CeaBlockTag;
@@ -5874,12 +6724,27 @@ DDSTATUS DisplayIdParserGetDisplayIDBlockByID(GET_BLOCK_BY_ID_ARGS* pGetBlockByI
 
     // pGetBlockById->pInputBuf points to 1st Block of display ID
 
+    if (NULL != pGetBlockById->pDidBlockIndex)
+    {
+        pIndex = pGetBlockById->pDidBlockIndex;
+        Status = DDS_UNSUCCESSFUL; // Assume block not found
+
+        if (pGetBlockById->InstanceOfBlock < pIndex->CountOfTag[pGetBlockById->BlockIdOrTag])
+        {
+            pGetBlockById->pOutputBlock = pGetBlockById->pInputBuf + pIndex->Offsets[pIndex->FirstOfTag[pGetBlockById->BlockIdOrTag] + pGetBlockById->InstanceOfBlock];
+            Status = DDS_SUCCESS;
+        }
+
+        DISP_FUNC_EXIT();
+        return Status;
+    }
+
     DispIdBlockOffset = 0;
     InstanceOfBlock = 0;
     Status = DDS_UNSUCCESSFUL; // Assume block not found
 
     // Make sure that there are at least 3 bytes (for a possible DisplayID Data block header) remaining, so that we have valid data block.
-    while (DispIdBlockOffset < (pGetBlockById->InputBlockLength - sizeof(DISPLAYID_BLOCK)))
+    while ((pGetBlockById->InputBlockLength > sizeof(DISPLAYID_BLOCK)) && (DispIdBlockOffset < (pGetBlockById->InputBlockLength - sizeof(DISPLAYID_BLOCK))))
     {
         pDidBlockHeader = (DISPLAYID_BLOCK*)(pGetBlockById->pInputBuf + DispIdBlockOffset);
 
@@ -5889,6 +6754,12 @@ DDSTATUS DisplayIdParserGetDisplayIDBlockByID(GET_BLOCK_BY_ID_ARGS* pGetBlockByI
             break;
         }
 
+        if ((DispIdBlockOffset + sizeof(DISPLAYID_BLOCK) + pDidBlockHeader->NumberOfBytes) > pGetBlockById->InputBlockLength)
+        {
+            // Block runs past the section, it and anything after it are dropped
+            break;
+        }
+
         // Is this the Display ID data block we are looking for?
         if (pDidBlockHeader->BlockID == pGetBlockById->BlockIdOrTag)
         {
@@ -6058,7 +6929,7 @@ void DisplayIdParserGetMonitorDetails(DD_GET_EDID_MODES* pGetEdidModes, EDID_DAT
     pEdidData->pData->BasicDisplayCaps.DisplayGamma = 0x78;
 
     // Not checking for multiple instances of CE block yet. Will do on need basis
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DISPLAY_PARAMS, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DISPLAY_PARAMS, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -6069,7 +6940,7 @@ void DisplayIdParserGetMonitorDetails(DD_GET_EDID_MODES* pGetEdidModes, EDID_DAT
         }
     }
     // Keeping this as base data and convert EDID data to this
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_COLOR_CHARACTERISTICS, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_COLOR_CHARACTERISTICS, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -6127,7 +6998,7 @@ void DisplayIdParserGetProductIDDetails(DD_GET_EDID_MODES* pGetEdidModes, EDID_D
     DISPLAYID_PNP_OUI_ID* pPnpOuiId = NULL;
     DDU8 MonNameLength;
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, ProductIDBlockTag, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, ProductIDBlockTag, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status))
         return;
@@ -6202,7 +7073,7 @@ void DisplayIdParserGetMonitorDescriptorDetails(DD_GET_EDID_MODES* pGetEdidModes
     // If multiple instances of below blocks occur, only the first one will be parsed
 
     // Other fields in all of the blocks below isn't parsed as there are no equivalant fields in EDID. Needed?
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_VIDEO_RANGE_LIMITS, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_VIDEO_RANGE_LIMITS, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -6250,7 +7121,7 @@ void DisplayIdParserParseTiledTopologyBlock(DD_GET_EDID_MODES* pGetEdidModes, ED
 
     // Note: Not checking for multiple instances of Tiled info block as they are assumed to be occurring only once.
     // If multiple instances of below blocks occur, only the first one will be parsed
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, TiledDisplayTag, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, TiledDisplayTag, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
     {
@@ -6352,7 +7223,7 @@ DDSTATUS DisplayIdParserParseDTDTiming(DD_GET_EDID_MODES* pGetEdidModes, EDID_DA
 
     for (DDU8 InstanceOfBlock = 0; InstanceOfBlock < MAX_DID_BLOCK_INSTANCES; InstanceOfBlock++)
     {
-        DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DTDTimingTag, InstanceOfBlock);
+        DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DTDTimingTag, InstanceOfBlock, pEdidData);
         Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
         if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
         {
@@ -6404,7 +7275,7 @@ void DisplayIdParserParseType2Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
 
     for (DDU8 InstanceOfBlock = 0; InstanceOfBlock < MAX_DID_BLOCK_INSTANCES; InstanceOfBlock++)
     {
-        DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DETAILED_TIMING_2, InstanceOfBlock);
+        DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DETAILED_TIMING_2, InstanceOfBlock, pEdidData);
         Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
         if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
         {
@@ -6516,11 +7387,53 @@ void DisplayIdParserParseType2Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
     return;
 }
 
+/***************************************************************
+ * @brief Method to create a batch of Type-III timings and add them to mode list, in order.
+ *
+ * @param  pCreateTimingArgs CVT requests, a failed one only drops its mode
+ * @param  pIsPreferred Preferred flag of each timing
+ * @param  NumTimings
+ * @param  pEdidData
+ * @return void
+ ***************************************************************/
+static void DisplayIdParserAddType3Timings(CREATE_TIMING_ARGS* pCreateTimingArgs, DD_BOOL* pIsPreferred, DDU32 NumTimings, EDID_DATA* pEdidData)
+{
+    ADD_MODES AddModes;
+    DD_TIMING_INFO* pTimingInfo;
+    DDU32 Index;
+    DDU8 VicId;
+
+    DisplayInfoRoutinesCreateTimings(pCreateTimingArgs, NumTimings);
+
+    for (Index = 0; Index < NumTimings; Index++)
+    {
+        if (IS_DDSTATUS_ERROR(pCreateTimingArgs[Index].Status))
+        {
+            continue;
+        }
+
+        pTimingInfo = pCreateTimingArgs[Index].Cvt.pTimingInfo;
+        VicId = (pEdidData->pData->FtrSupport.IsCeExtnDisplay) ? CeInfoParserIsCeMode(pTimingInfo) : VIC_UNDEFINED;
+
+        // Add mode to the list
+        AddModes.pTimingInfo = pTimingInfo;
+        pTimingInfo->ModeSource = DID_DTD;
+        pTimingInfo->CeData.VicId[0] = VicId;
+        pTimingInfo->CeData.Par[0].Value = 0; // AVI_PAR_NODATA;
+        pTimingInfo->Flags.PreferredMode = pIsPreferred[Index];
+        pTimingInfo->SignalStandard = DD_VESA_CVT;
+        AddModes.ForceAdd = FALSE;
+
+        DisplayInfoParserAddEDIDModeToList(&AddModes, pEdidData);
+    }
+}
+
 /***************************************************************
  * @brief Display Id Parser Parse Type3 Timing.
  *
  *  Method to parse and add modes from Short Timing Type-III
  *              Parses Display ID Timing Block DID_DATA_BLOCK_SHORT_TIMING_3.
+ *              CVT timings are created DID_TIMING_BATCH_SIZE at a time.
  * @param  pGetEdidModes
  * @param  pEdidData
  * @return void
@@ -6535,11 +7448,12 @@ void DisplayIdParserParseType3Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
     DDU16 AspectRatioY;
     DDU32 XRes, YRes, RRate;
     CREATE_CVT_TIMING_ARGS CreateCVTTimingArgs;
-    ADD_MODES AddModes;
-    DD_TIMING_INFO TimingInfo;
+    CREATE_TIMING_ARGS CreateTimingArgs[DID_TIMING_BATCH_SIZE];
+    DD_TIMING_INFO TimingInfo[DID_TIMING_BATCH_SIZE];
+    DD_BOOL IsPreferred[DID_TIMING_BATCH_SIZE];
+    DDU32 NumTimings;
     DISPLAYID_SHORT_TIMING_3* pDidTiming3 = NULL;
     DID_TIMINGINFO_3* pDidTimingInfo3 = NULL;
-    DDU8 VicId;
 
     DISP_FUNC_ENTRY();
 
@@ -6548,9 +7462,11 @@ void DisplayIdParserParseType3Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
     DDASSERT(pEdidData->pData);
     DDASSERT(pGetEdidModes->pEdidOrDisplayIDBuf);
 
+    DD_ZERO_MEM(&CreateCVTTimingArgs, sizeof(CreateCVTTimingArgs));
+
     for (DDU8 InstanceOfBlock = 0; InstanceOfBlock < MAX_DID_BLOCK_INSTANCES; InstanceOfBlock++)
     {
-        DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_SHORT_TIMING_3, InstanceOfBlock);
+        DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_SHORT_TIMING_3, InstanceOfBlock, pEdidData);
         Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
         if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
         {
@@ -6562,10 +7478,15 @@ void DisplayIdParserParseType3Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
 
         NumType3Descriptors = pDidTiming3->BlockHeader.NumberOfBytes / sizeof(DID_TIMINGINFO_3);
         pDidTimingInfo3 = &(pDidTiming3->DidTimingInfo3);
+        NumTimings = 0;
 
-        for (DescrCounter = 0; DescrCounter < NumType3Descriptors; DescrCounter++, pDidTiming3++)
+        for (DescrCounter = 0; DescrCounter < NumType3Descriptors; DescrCounter++, pDidTimingInfo3++)
         {
-            DD_ZERO_MEM(&TimingInfo, sizeof(DD_TIMING_INFO));
+            if (pDidTimingInfo3->AspectRatio >= (sizeof(DidAspectRatioTable) / sizeof(DidAspectRatioTable[0])))
+            {
+                // Reserved aspect ratio, resolution can't be derived
+                continue;
+            }
 
             AspectRatioX = DidAspectRatioTable[pDidTimingInfo3->AspectRatio].XRatio;
             AspectRatioY = DidAspectRatioTable[pDidTimingInfo3->AspectRatio].YRatio;
@@ -6579,34 +7500,24 @@ void DisplayIdParserParseType3Timing(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
             CreateCVTTimingArgs.RRate = RRate;
             CreateCVTTimingArgs.IsInterLaced = FALSE;
             CreateCVTTimingArgs.IsMargin_Req = FALSE;
+            CreateCVTTimingArgs.IsRed_Blank_Req = (pDidTimingInfo3->TimingFormula == 0) ? TRUE : FALSE;
 
-            if (pDidTimingInfo3->TimingFormula == 0)
-            {
-                CreateCVTTimingArgs.IsRed_Blank_Req = TRUE;
-            }
-
-            CreateCVTTimingArgs.pTimingInfo = &TimingInfo;
-            Status = DisplayInfoRoutinesCreateCVTTiming(&CreateCVTTimingArgs);
-
-            if (IS_DDSTATUS_ERROR(Status))
+            if (NumTimings == DID_TIMING_BATCH_SIZE)
             {
-                continue;
+                DisplayIdParserAddType3Timings(CreateTimingArgs, IsPreferred, NumTimings, pEdidData);
+                NumTimings = 0;
             }
 
-            VicId = (pEdidData->pData->FtrSupport.IsCeExtnDisplay) ? CeInfoParserIsCeMode(&TimingInfo) : VIC_UNDEFINED;
-
-            // Add mode to the list
-            AddModes.pTimingInfo = &TimingInfo;
-            TimingInfo.ModeSource = DID_DTD;
-            TimingInfo.CeData.VicId[0] = VicId;
-            TimingInfo.CeData.Par[0].Value = 0; // AVI_PAR_NODATA;
-            TimingInfo.Flags.PreferredMode = pDidTimingInfo3->Preferedflag ? TRUE : FALSE;
-            TimingInfo.SignalStandard = DD_VESA_CVT;
-            AddModes.ForceAdd = FALSE;
-
-            DisplayInfoParserAddEDIDModeToList(&AddModes, pEdidData);
+            DD_ZERO_MEM(&TimingInfo[NumTimings], sizeof(DD_TIMING_INFO));
+            CreateTimingArgs[NumTimings].Formula = DD_TIMING_FORMULA_CVT;
+            CreateTimingArgs[NumTimings].Cvt = CreateCVTTimingArgs;
+            CreateTimingArgs[NumTimings].Cvt.pTimingInfo = &TimingInfo[NumTimings];
+            IsPreferred[NumTimings] = pDidTimingInfo3->Preferedflag ? TRUE : FALSE;
+            NumTimings++;
         } // for loop for DescrCounter ends
-    }     // for loop for Instance of Block ends
+
+        DisplayIdParserAddType3Timings(CreateTimingArgs, IsPreferred, NumTimings, pEdidData);
+    } // for loop for Instance of Block ends
 
     DISP_FUNC_EXIT();
     return;
@@ -6656,7 +7567,7 @@ DDSTATUS DisplayIdParserParseEnumeratedTimingBlock(DD_GET_EDID_MODES* pGetEdidMo
     DDASSERT(pGetEdidModes->pEdidOrDisplayIDBuf);
 
     // Not checking for multiple instances of Type4 timing yet. Will do on need basis
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, EnumeratedTimingTag, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, EnumeratedTimingTag, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
     {
@@ -6706,7 +7617,7 @@ void DisplayIdParserParseStandardTiming(DD_GET_EDID_MODES* pGetEdidModes, EDID_D
     DDASSERT(pGetEdidModes->pEdidOrDisplayIDBuf);
 
     // Not checking for multiple instances of Standard timing yet. Will do on need basis
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_VESA_TIMING_STD, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_VESA_TIMING_STD, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
     {
@@ -6802,7 +7713,7 @@ void DisplayIdParserParseCeaTiming(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA*
     DD_ZERO_MEM(&CeVicData, sizeof(CE_MODE_LIST));
 
     // Not checking for multiple instances of Type4 timing yet. Will do on need basis
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_CEA_TIMING_STD, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_CEA_TIMING_STD, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
     {
@@ -6857,8 +7768,8 @@ void DisplayIdParserParseCeaTiming(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA*
             CeVicData.IsPreferred = FALSE;
             CeVicData.SignalStandard = DD_CEA_861B; // It is still monitor timings
             CeVicData.SamplingMode.Rgb = 1;
-            // Since CEIndex here is <64, no need to convert it
-            CeVicData.VicId[0] = g_DisplayID_CeStandardTiming[CeaIndex].CEIndex;
+            // CEIndex is a VIC, VICs from 193 on are packed in the CE table, convert as an SVD byte
+            CeVicData.VicId[0] = CeSvdToVicTableIndex[g_DisplayID_CeStandardTiming[CeaIndex].CEIndex];
             CeInfoParserUpdateCeModeList(pEdidData, &CeVicData, CE_SVD);
         }
     }
@@ -6894,7 +7805,7 @@ void DisplayIdParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
     pOriginalEdidBuf = pGetEdidModes->pEdidOrDisplayIDBuf; // Save original pointer
 
     // Not checking for multiple instances of CE block yet. Will do on need basis
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, CEAExtTag, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, CEAExtTag, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
     {
@@ -6910,6 +7821,7 @@ void DisplayIdParserParseCeExtension(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA
     ParseExtDataBlkArgs.LenDataBlock = (pCeaExtnBlock->BlockHeader.NumberOfBytes > 248) ? 248 : pCeaExtnBlock->BlockHeader.NumberOfBytes;
     ParseExtDataBlkArgs.pDataBlock = (DDU8*)(&((pCeaExtnBlock->CeaDataBlock)));
     ParseExtDataBlkArgs.pModeTable = pGetEdidModes->pModeTable;
+    CeInfoParserIndexDataBlocks(&ParseExtDataBlkArgs);
 
     // Getting caps always, this will be helpful if someone needs to build modes based on caps
     CeInfoParserParseCeExtensionForCaps(&ParseExtDataBlkArgs, pEdidData);
@@ -6946,7 +7858,7 @@ void DisplayIdGetSupportedBPC(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdid
 
     DisplayIdParserGetMonitorDescriptorDetails(pGetEdidModes, pEdidData);
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DISPLAY_DEVICE_DATA, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DISPLAY_DEVICE_DATA, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -6958,7 +7870,7 @@ void DisplayIdGetSupportedBPC(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdid
         }
     }
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DISPLAY_INTERFACE, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID_DATA_BLOCK_DISPLAY_INTERFACE, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -7003,13 +7915,13 @@ void DisplayIdParserRemoveSerialNumber(DD_BB_EDID_CONTAINER* pEdidDataBuffer, DD
         // This is DisplayID Extension Block
         if ((DISPLAY_ID_VER_2_0 == pDisplayIdExtHeader->DisplayIdHeader.RevisionAndVersion) || (DISPLAY_ID_VER_2_1 == pDisplayIdExtHeader->DisplayIdHeader.RevisionAndVersion))
         {
-            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID2_DATA_BLOCK_TILED_DISPLAY_TOPOLOGY, 0);
-            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID2_DATA_BLOCK_PRODUCTID, 0);
+            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID2_DATA_BLOCK_TILED_DISPLAY_TOPOLOGY, 0, NULL);
+            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID2_DATA_BLOCK_PRODUCTID, 0, NULL);
         }
         else
         {
-            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID_DATA_BLOCK_TILED_TOPOLOGY, 0);
-            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID_DATA_BLOCK_PRODUCT_ID, 0);
+            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID_DATA_BLOCK_TILED_TOPOLOGY, 0, NULL);
+            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)&pDisplayIdExtHeader->DisplayIdHeader, DID_DATA_BLOCK_PRODUCT_ID, 0, NULL);
         }
     }
     else if ((DISPLAY_ID_VER_2_1 == pDisplayIdExtHeader->DisplayIdHeader.RevisionAndVersion) || (DISPLAY_ID_VER_2_0 == pDisplayIdHeader->RevisionAndVersion) ||
@@ -7018,13 +7930,13 @@ void DisplayIdParserRemoveSerialNumber(DD_BB_EDID_CONTAINER* pEdidDataBuffer, DD
         // This is DisplayID Base Block, in DisplayID Base Block Serial Number may be present in ProductID Block and Tile Display Block
         if ((DISPLAY_ID_VER_2_0 == pDisplayIdHeader->RevisionAndVersion) || (DISPLAY_ID_VER_2_1 == pDisplayIdExtHeader->DisplayIdHeader.RevisionAndVersion))
         {
-            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)pDisplayIdHeader, DID2_DATA_BLOCK_TILED_DISPLAY_TOPOLOGY, 0);
-            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)pDisplayIdHeader, DID2_DATA_BLOCK_PRODUCTID, 0);
+            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)pDisplayIdHeader, DID2_DATA_BLOCK_TILED_DISPLAY_TOPOLOGY, 0, NULL);
+            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)pDisplayIdHeader, DID2_DATA_BLOCK_PRODUCTID, 0, NULL);
         }
         else
         {
-            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)pDisplayIdHeader, DID_DATA_BLOCK_TILED_TOPOLOGY, 0);
-            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)pDisplayIdHeader, DID_DATA_BLOCK_PRODUCT_ID, 0);
+            DisplayIdParserFillGetBlockByIdArgs(&GetTileDisplayBlock, (DDU8*)pDisplayIdHeader, DID_DATA_BLOCK_TILED_TOPOLOGY, 0, NULL);
+            DisplayIdParserFillGetBlockByIdArgs(&GetProductIdBlock, (DDU8*)pDisplayIdHeader, DID_DATA_BLOCK_PRODUCT_ID, 0, NULL);
         }
     }
     else
@@ -7130,6 +8042,160 @@ DDSTATUS DisplayInfoParserValidateEdidDidBlock(DDU8* pEdidOrDisplayIDBuf, DDU32
     }
 }
 
+/***************************************************************
+ * @brief Method to validate all blocks of an EDID/DID buffer without parsing it.
+ *
+ * Runs only the block checks of the parser, no mode table or timing table is used.
+ * For EDID, walks base block and extensions (count from base block, or HF-EEODB if present)
+ * with EdidParserVerifyDataBlocks(). Display ID extensions additionally get
+ * DisplayIdParserVerifyDataBlocks() on their section.
+ * For DID, walks base section and extension sections with DisplayIdParserVerifyDataBlocks().
+ * Walk stops at the first block that runs past end of buffer, or whose size can't be trusted.
+ *
+ * @param pValidateBlocks
+ * @return DDSTATUS DDS_SUCCESS if every block is valid, DDS_INVALID_DATA otherwise
+ ***************************************************************/
+DDSTATUS DisplayInfoParserValidateEdidOrDisplayId(DD_VALIDATE_EDID_BLOCKS* pValidateBlocks)
+{
+    DDU8* pEdidOrDisplayIDBuf;
+    DDU32 BufSizeInBytes;
+    DD_EDID_BLOCK_STATUS* pBlockStatus;
+    EDID_BASE_BLOCK* pEdidBaseBlock;
+    DISPLAYID_HEADER DidHeader;
+    DDU32 NumBlocks, BlockNum, Offset;
+    DDU8 EeodbExtnCount;
+    DDSTATUS Status;
+
+    DISP_FUNC_ENTRY();
+
+    if ((NULL == pValidateBlocks) || (NULL == pValidateBlocks->pEdidOrDisplayIDBuf))
+    {
+        DISP_FUNC_EXIT_W_STATUS(DDS_INVALID_PARAM);
+        return DDS_INVALID_PARAM;
+    }
+
+    pEdidOrDisplayIDBuf = pValidateBlocks->pEdidOrDisplayIDBuf;
+    BufSizeInBytes = pValidateBlocks->BufSizeInBytes;
+    pValidateBlocks->NumBlocks = 0;
+    pValidateBlocks->NumValidBlocks = 0;
+
+    if ((BufSizeInBytes >= EDID_HEADER_SIZE) && (0 == memcmp(BaseEdidHeader, pEdidOrDisplayIDBuf, EDID_HEADER_SIZE)))
+    {
+        // EDID
+        pValidateBlocks->IsDisplayIdBaseBlock = FALSE;
+        pEdidBaseBlock = (EDID_BASE_BLOCK*)pEdidOrDisplayIDBuf;
+
+        NumBlocks = 1;
+        if (BufSizeInBytes >= EDID_BLOCK_SIZE)
+        {
+            NumBlocks += pEdidBaseBlock->NumExtBlocks;
+        }
+
+        // Sources shall ignore the Extension Flag when an HF-EEODB is present in 1st extension
+        if ((NumBlocks > 1) && (BufSizeInBytes >= 2 * EDID_BLOCK_SIZE))
+        {
+            EeodbExtnCount = DisplayInfoParserGetHdmiOverrideExtensionBlockCount(pEdidOrDisplayIDBuf + EDID_BLOCK_SIZE);
+            if (INVALID_EDID_BLOCK_COUNT != EeodbExtnCount)
+            {
+                NumBlocks = 1 + EeodbExtnCount;
+            }
+        }
+
+        for (BlockNum = 0; BlockNum < NumBlocks; BlockNum++)
+        {
+            Offset = BlockNum * EDID_BLOCK_SIZE;
+            pBlockStatus = &pValidateBlocks->Blocks[pValidateBlocks->NumBlocks++];
+            pBlockStatus->Offset = Offset;
+            pBlockStatus->SizeInBytes = EDID_BLOCK_SIZE;
+
+            if (Offset + EDID_BLOCK_SIZE > BufSizeInBytes)
+            {
+                pBlockStatus->Tag = 0;
+                pBlockStatus->Status = DDS_BUFFER_TOO_SMALL;
+                break;
+            }
+
+            pBlockStatus->Tag = (0 == BlockNum) ? ((pEdidBaseBlock->Version << 4) | pEdidBaseBlock->Revision) : pEdidOrDisplayIDBuf[Offset];
+            Status = EdidParserVerifyDataBlocks(pEdidOrDisplayIDBuf + Offset, EDID_BLOCK_SIZE, (DDU8)BlockNum);
+
+            if (IS_DDSTATUS_SUCCESS(Status) && (BlockNum > 0) && (DID_EXT_TAG == pBlockStatus->Tag))
+            {
+                // Display ID section follows the extension tag and has to end before the EDID checksum
+                DidHeader.Value = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf + Offset + 1))->Value;
+                if ((1 + sizeof(DISPLAYID_HEADER) + DidHeader.BytesInSection + 1) >= EDID_BLOCK_SIZE)
+                {
+                    Status = DDS_INVALID_DATA;
+                }
+                else
+                {
+                    Status = DisplayIdParserVerifyDataBlocks(pEdidOrDisplayIDBuf + Offset + 1);
+                }
+            }
+
+            pBlockStatus->Status = Status;
+        }
+    }
+    else
+    {
+        // Display ID, extension count is taken from base section
+        pValidateBlocks->IsDisplayIdBaseBlock = TRUE;
+        NumBlocks = 1;
+        Offset = 0;
+
+        for (BlockNum = 0; BlockNum < NumBlocks; BlockNum++)
+        {
+            pBlockStatus = &pValidateBlocks->Blocks[pValidateBlocks->NumBlocks++];
+            pBlockStatus->Offset = Offset;
+            pBlockStatus->SizeInBytes = BufSizeInBytes - Offset;
+            pBlockStatus->Tag = 0;
+
+            if (BufSizeInBytes - Offset < sizeof(DISPLAYID_HEADER))
+            {
+                pBlockStatus->Status = DDS_BUFFER_TOO_SMALL;
+                break;
+            }
+
+            DidHeader.Value = ((DISPLAYID_HEADER*)(pEdidOrDisplayIDBuf + Offset))->Value;
+            if (0 == BlockNum)
+            {
+                NumBlocks += DidHeader.ExtensionCount;
+            }
+            pBlockStatus->Tag = DidHeader.RevisionAndVersion;
+
+            if (DidHeader.BytesInSection > MAX_SECTION_DATA_SIZE)
+            {
+                // Next section can't be located
+                pBlockStatus->Status = DDS_INVALID_DATA;
+                break;
+            }
+
+            pBlockStatus->SizeInBytes = sizeof(DISPLAYID_HEADER) + DidHeader.BytesInSection + 1;
+            if (pBlockStatus->SizeInBytes > BufSizeInBytes - Offset)
+            {
+                pBlockStatus->SizeInBytes = BufSizeInBytes - Offset;
+                pBlockStatus->Status = DDS_BUFFER_TOO_SMALL;
+                break;
+            }
+
+            pBlockStatus->Status = DisplayIdParserVerifyDataBlocks(pEdidOrDisplayIDBuf + Offset);
+            Offset += pBlockStatus->SizeInBytes;
+        }
+    }
+
+    for (BlockNum = 0; BlockNum < pValidateBlocks->NumBlocks; BlockNum++)
+    {
+        if (IS_DDSTATUS_SUCCESS(pValidateBlocks->Blocks[BlockNum].Status))
+        {
+            pValidateBlocks->NumValidBlocks++;
+        }
+    }
+
+    Status = (pValidateBlocks->NumValidBlocks == pValidateBlocks->NumBlocks) ? DDS_SUCCESS : DDS_INVALID_DATA;
+
+    DISP_FUNC_EXIT_W_STATUS(Status);
+    return Status;
+}
+
 //-----------------------------------------------------------------------------
 //
 // Display ID parser related functions -- END
@@ -7143,67 +8209,82 @@ DDSTATUS DisplayInfoParserValidateEdidDidBlock(DDU8* pEdidOrDisplayIDBuf, DDU32
 //-----------------------------------------------------------------------------
 
 /***************************************************************
- * @brief Display IdV2 generate timings and add to mode table
+ * @brief Display IdV2 fill timing request for Timing formula 9 & 10
  *
- *  Method to generate timings for Timing formula 9 & 10, Then add those timings to Mode table.
+ *  Method to set up the timing of a formula 9/10 request, whose Cvt args are filled already.
  *
- * @param  pCreateCVTTimingArgs
+ * @param  pCreateTimingArgs
+ * @param  pTimingInfo Timing to be generated
  * @param  TimingVersion
  * @param  pEdidData
- * @param  pModeTable
- * @return void
+ * @return DD_BOOL FALSE if timing formula is not supported
  ***************************************************************/
-void DisplayIdV2GenerateAndAddCvtTimings(CREATE_CVT_TIMING_ARGS* pCreateCVTTimingArgs, CVT_RB_TIMING_FORMULA_VERSION TimingVersion, EDID_DATA* pEdidData, DD_TABLE* pModeTable)
+static DD_BOOL DisplayIdV2FillCvtTimingRequest(CREATE_TIMING_ARGS* pCreateTimingArgs, DD_TIMING_INFO* pTimingInfo, CVT_RB_TIMING_FORMULA_VERSION TimingVersion, EDID_DATA* pEdidData)
 {
-    DDSTATUS Status;
-    DD_TIMING_INFO TimingInfo;
-    ADD_MODES AddModes;
+    switch (TimingVersion)
+    {
+    case VESA_CVT_VER2:
+    case VESA_CVT_REDUCED_BLANKING_VER1:
+        pCreateTimingArgs->Formula = DD_TIMING_FORMULA_CVT;
+        break;
+    case VESA_CVT_REDUCED_BLANKING_VER2:
+    case VESA_CVT_REDUCED_BLANKING_VER3:
+        pCreateTimingArgs->Formula = DD_TIMING_FORMULA_CVT2;
+        break;
+    default:
+        DDRLSASSERT_UNEXPECTED(0, "Unsupported Timing Formula!");
+        return FALSE;
+    }
 
-    DD_ZERO_MEM(&TimingInfo, sizeof(TimingInfo));
+    DD_ZERO_MEM(pTimingInfo, sizeof(DD_TIMING_INFO));
 
-    TimingInfo.SignalStandard = DD_VESA_CVT;
+    pTimingInfo->SignalStandard = DD_VESA_CVT;
 
-    pCreateCVTTimingArgs->pTimingInfo = &TimingInfo;
+    pCreateTimingArgs->Cvt.pTimingInfo = pTimingInfo;
 
     // If Display Interface Features data block is available, supported color sampling mode will be available.
-    TimingInfo.CeData.SamplingMode.Value = pEdidData->pData->BasicDisplayCaps.DidSamplingMode.Value;
+    pTimingInfo->CeData.SamplingMode.Value = pEdidData->pData->BasicDisplayCaps.DidSamplingMode.Value;
 
     // If, DI features data block is not present, RGB mode needs to be marked as default
-    if (TimingInfo.CeData.SamplingMode.Value == 0)
+    if (pTimingInfo->CeData.SamplingMode.Value == 0)
     {
-        TimingInfo.CeData.SamplingMode.Rgb = 1;
+        pTimingInfo->CeData.SamplingMode.Rgb = 1;
     }
 
     // Cache Yuv 420 Support (Byte 0, bit 6) for Type 10 timings (this is timing specific), for Type 9, this bit will be 0 and Sampling mode will be parsed as per EDID
-    TimingInfo.CeData.SamplingMode.Yuv420 |= pCreateCVTTimingArgs->IsYCbCr420Supported;
+    pTimingInfo->CeData.SamplingMode.Yuv420 |= pCreateTimingArgs->Cvt.IsYCbCr420Supported;
 
-    switch (TimingVersion)
-    {
-    case VESA_CVT_VER2:
-        Status = DisplayInfoRoutinesCreateCVTTiming(pCreateCVTTimingArgs);
-        break;
-    case VESA_CVT_REDUCED_BLANKING_VER1:
-        Status = DisplayInfoRoutinesCreateCVTTiming(pCreateCVTTimingArgs);
-        break;
-    case VESA_CVT_REDUCED_BLANKING_VER2:
-        Status = DisplayInfoRoutinesCreateCVT2Timing(pCreateCVTTimingArgs);
-        break;
-    case VESA_CVT_REDUCED_BLANKING_VER3:
-        Status = DisplayInfoRoutinesCreateCVT2Timing(pCreateCVTTimingArgs);
-        break;
-    default:
-        DDRLSASSERT_UNEXPECTED(0, "Unsupported Timing Formula!");
-        Status = DDS_INVALID_PARAM;
-        break;
-    }
+    return TRUE;
+}
 
-    if (IS_DDSTATUS_SUCCESS(Status))
+/***************************************************************
+ * @brief Display IdV2 generate timings and add to mode table
+ *
+ *  Method to generate a batch of timings for Timing formula 9 & 10, Then add those timings to Mode table, in order.
+ *
+ * @param  pCreateTimingArgs Requests set up by DisplayIdV2FillCvtTimingRequest(), a failed one only drops its mode
+ * @param  NumTimings
+ * @param  pEdidData
+ * @param  pModeTable
+ * @return void
+ ***************************************************************/
+void DisplayIdV2GenerateAndAddCvtTimings(CREATE_TIMING_ARGS* pCreateTimingArgs, DDU32 NumTimings, EDID_DATA* pEdidData, DD_TABLE* pModeTable)
+{
+    ADD_MODES AddModes;
+    DDU32 Index;
+
+    DisplayInfoRoutinesCreateTimings(pCreateTimingArgs, NumTimings);
+
+    for (Index = 0; Index < NumTimings; Index++)
     {
-        AddModes.pTimingInfo = &TimingInfo;
-        AddModes.ForceAdd = FALSE;
-        AddModes.pTargetModeTable = pModeTable;
+        if (IS_DDSTATUS_SUCCESS(pCreateTimingArgs[Index].Status))
+        {
+            AddModes.pTimingInfo = pCreateTimingArgs[Index].Cvt.pTimingInfo;
+            AddModes.ForceAdd = FALSE;
+            AddModes.pTargetModeTable = pModeTable;
 
-        Status = DisplayInfoParserAddEDIDModeToList(&AddModes, pEdidData);
+            DisplayInfoParserAddEDIDModeToList(&AddModes, pEdidData);
+        }
     }
 }
 
@@ -7306,7 +8387,9 @@ void DisplayInfoParserParseTypeXTiming(DISPLAYID_2_0_FORMULA_TIMING_X* pDidFormu
 {
     DD_BOOL ExtraByteSupported;
     DDU8 NoOfEntries, Count, SizePerEntry;
-    CREATE_CVT_TIMING_ARGS CreateCVTTimingArgs;
+    CREATE_TIMING_ARGS CreateTimingArgs[DID_TIMING_BATCH_SIZE];
+    DD_TIMING_INFO TimingInfo[DID_TIMING_BATCH_SIZE];
+    DDU32 NumTimings = 0;
     TIMINGINFO_TYPE_X_7BYTE* pXtimingFormula;
 
     // Addition of Display ID Type 10 timing through CTA Extension block & Display ID Extension has minor differences in meta data packing, this information needs to be parsed individually,
@@ -7346,10 +8429,19 @@ void DisplayInfoParserParseTypeXTiming(DISPLAYID_2_0_FORMULA_TIMING_X* pDidFormu
 
     for (Count = 0; Count < NoOfEntries; Count++)
     {
-        DD_ZERO_MEM(&CreateCVTTimingArgs, sizeof(CreateCVTTimingArgs));
+        if (NumTimings == DID_TIMING_BATCH_SIZE)
+        {
+            DisplayIdV2GenerateAndAddCvtTimings(CreateTimingArgs, NumTimings, pEdidData, pModeTable);
+            NumTimings = 0;
+        }
 
-        DisplayIdV2FillFormula10Inputs(&CreateCVTTimingArgs, pXtimingFormula, ExtraByteSupported);
-        DisplayIdV2GenerateAndAddCvtTimings(&CreateCVTTimingArgs, (CVT_RB_TIMING_FORMULA_VERSION)pXtimingFormula->TimingFormula, pEdidData, pModeTable);
+        DD_ZERO_MEM(&CreateTimingArgs[NumTimings], sizeof(CREATE_TIMING_ARGS));
+
+        DisplayIdV2FillFormula10Inputs(&CreateTimingArgs[NumTimings].Cvt, pXtimingFormula, ExtraByteSupported);
+        if (DisplayIdV2FillCvtTimingRequest(&CreateTimingArgs[NumTimings], &TimingInfo[NumTimings], (CVT_RB_TIMING_FORMULA_VERSION)pXtimingFormula->TimingFormula, pEdidData))
+        {
+            NumTimings++;
+        }
 
         if (ExtraByteSupported)
         {
@@ -7363,6 +8455,8 @@ void DisplayInfoParserParseTypeXTiming(DISPLAYID_2_0_FORMULA_TIMING_X* pDidFormu
             pXtimingFormula = (TIMINGINFO_TYPE_X_7BYTE*)++pTemp;
         }
     }
+
+    DisplayIdV2GenerateAndAddCvtTimings(CreateTimingArgs, NumTimings, pEdidData, pModeTable);
 }
 
 /***************************************************************
@@ -7384,10 +8478,12 @@ void DisplayIdV2ParserParseFormulaBasedTiming(DD_GET_EDID_MODES* pGetEdidModes,
     DDU8 NoOfEntries, Count;
 
     DISPLAYID_2_0_TIMINGINFO_IX* pTiming9;
-    CREATE_CVT_TIMING_ARGS CreateCVTTimingArgs;
+    CREATE_TIMING_ARGS CreateTimingArgs[DID_TIMING_BATCH_SIZE];
+    DD_TIMING_INFO TimingInfo[DID_TIMING_BATCH_SIZE];
+    DDU32 NumTimings = 0;
 
     // Parse Type 9 timing, if any
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_FORMULA_TIMING_IX, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_FORMULA_TIMING_IX, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
 
     if (IS_DDSTATUS_SUCCESS(Status))
@@ -7398,15 +8494,26 @@ void DisplayIdV2ParserParseFormulaBasedTiming(DD_GET_EDID_MODES* pGetEdidModes,
         pTiming9 = &pFormula9->DidV2Timing9;
         for (Count = 0; Count < NoOfEntries; Count++)
         {
-            DD_ZERO_MEM(&CreateCVTTimingArgs, sizeof(CreateCVTTimingArgs));
-            DisplayIdV2FillFormula9Inputs(&CreateCVTTimingArgs, pTiming9);
-            DisplayIdV2GenerateAndAddCvtTimings(&CreateCVTTimingArgs, (CVT_RB_TIMING_FORMULA_VERSION)pTiming9->TimingFormula, pEdidData, pGetEdidModes->pModeTable);
+            if (NumTimings == DID_TIMING_BATCH_SIZE)
+            {
+                DisplayIdV2GenerateAndAddCvtTimings(CreateTimingArgs, NumTimings, pEdidData, pGetEdidModes->pModeTable);
+                NumTimings = 0;
+            }
+
+            DD_ZERO_MEM(&CreateTimingArgs[NumTimings], sizeof(CREATE_TIMING_ARGS));
+            DisplayIdV2FillFormula9Inputs(&CreateTimingArgs[NumTimings].Cvt, pTiming9);
+            if (DisplayIdV2FillCvtTimingRequest(&CreateTimingArgs[NumTimings], &TimingInfo[NumTimings], (CVT_RB_TIMING_FORMULA_VERSION)pTiming9->TimingFormula, pEdidData))
+            {
+                NumTimings++;
+            }
             pTiming9++;
         }
+
+        DisplayIdV2GenerateAndAddCvtTimings(CreateTimingArgs, NumTimings, pEdidData, pGetEdidModes->pModeTable);
     }
 
     // Parse Type 10 timing, if any
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_FORMULA_TIMING_X, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_FORMULA_TIMING_X, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
 
     if (IS_DDSTATUS_SUCCESS(Status))
@@ -7545,7 +8652,7 @@ void DisplayIdV21ParserParseBrightnessLuminanceRangeDataBlock(DD_GET_EDID_MODES*
 
     DISP_FUNC_ENTRY();
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID21_DATA_BLOCK_BRIGHTNESS_LUMINANCE_RANGE, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID21_DATA_BLOCK_BRIGHTNESS_LUMINANCE_RANGE, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -7614,7 +8721,7 @@ void DisplayIdV2ParserGetMonitorDetails(DD_GET_EDID_MODES* pGetEdidModes, EDID_D
     pEdidData->pData->BasicDisplayCaps.DisplayGamma = 0x78;
 
     // Not checking for multiple instances of CE block yet. Will do on need basis
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_PARAMS, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_PARAMS, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status))
         return;
@@ -7685,7 +8792,7 @@ void DisplayIdV2ParserGetMonitorDescriptorDetails(DD_GET_EDID_MODES* pGetEdidMod
     // If multiple instances of below blocks occur, only the first one will be parsed
 
     // Other fields in all of the blocks below isn't parsed as there are no equivalant fields in EDID. Needed?
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DYNAMIC_VIDEO_TIMING, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DYNAMIC_VIDEO_TIMING, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -7749,7 +8856,7 @@ void DisplayIdV2ParserParseType8EnumeratedTiming(DD_GET_EDID_MODES* pGetEdidMode
     DDASSERT(pGetEdidModes->pEdidOrDisplayIDBuf);
 
     // Not checking for multiple instances of Type8 timing yet. Will do on need basis
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_ENUMERATED_TIMING_VIII, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_ENUMERATED_TIMING_VIII, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status) || (GetBlockById.pOutputBlock == NULL))
     {
@@ -7805,15 +8912,16 @@ static DD_BPC_SUPPORTED DisplayIDV2ParserGetSupportedBpcMaskFromColorDepth(DDU32
  * @brief  Method to extract Color Model for DID 2.0.
  *
  * @param  pGetEdidModes
+ * @param  pEdidData
  * @return DD_COLOR_MODEL
  ***************************************************************/
-static DD_COLOR_MODEL DisplayIDV2ConvertedColorModel(DD_GET_EDID_MODES* pGetEdidModes)
+static DD_COLOR_MODEL DisplayIDV2ConvertedColorModel(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEdidData)
 {
     DDSTATUS Status;
     GET_BLOCK_BY_ID_ARGS GetBlockById;
     DISPLAYID_2_0_DISPLAY_INTERFACE* pDid2DisplayInterface = NULL;
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_IF_FEATURES, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_IF_FEATURES, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -7867,7 +8975,7 @@ void DisplayIdV2GetSupportedBPC(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
 
     DisplayIdV2ParserGetMonitorDescriptorDetails(pGetEdidModes, pEdidData);
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_PARAMS, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_PARAMS, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -7879,7 +8987,7 @@ void DisplayIdV2GetSupportedBPC(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
         }
     }
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_IF_FEATURES, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_IF_FEATURES, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -7905,7 +9013,7 @@ void DisplayIdV2GetSupportedBPC(DD_GET_EDID_MODES* pGetEdidModes, EDID_DATA* pEd
             pEdidData->pData->BasicDisplayCaps.BpcsSupportedFor420Modes.Supports14BitsPerColor = pDisplayInterface->Support14bitPerPrimaryColorYCbCr420;
             pEdidData->pData->BasicDisplayCaps.BpcsSupportedFor420Modes.Supports16BitsPerColor = pDisplayInterface->Support16bitPerPrimaryColorYCbCr420;
         }
-        pEdidData->pData->BasicDisplayCaps.ColorModel = DisplayIDV2ConvertedColorModel(pGetEdidModes);
+        pEdidData->pData->BasicDisplayCaps.ColorModel = DisplayIDV2ConvertedColorModel(pGetEdidModes, pEdidData);
 
         // Update Sampling mode
         pEdidData->pData->BasicDisplayCaps.DidSamplingMode.Rgb = (pDisplayInterface->SupportedColorDepthRGBencoding & 0x3F) ? 1 : 0;
@@ -7980,7 +9088,7 @@ void DisplayIdV2ParserParseHdrCapDataBlock(DD_GET_EDID_MODES* pGetEdidModes, EDI
     DISP_FUNC_ENTRY();
 
     // Interface Params block for the EOTF and Gamut Caps
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_IF_FEATURES, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_IF_FEATURES, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -7991,7 +9099,7 @@ void DisplayIdV2ParserParseHdrCapDataBlock(DD_GET_EDID_MODES* pGetEdidModes, EDI
     }
 
     // Display Params block for the Luma Caps
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_PARAMS, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_DISPLAY_PARAMS, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_ERROR(Status))
     {
@@ -8033,7 +9141,7 @@ void DisplayIdV2ParserParseMsoCapsFromVSDBBlock(DD_GET_EDID_MODES* pGetEdidModes
     DDASSERT(pEdidData->pData);
     DDASSERT(pGetEdidModes->pEdidOrDisplayIDBuf);
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_VENDOR_SPECIFIC, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID2_DATA_BLOCK_VENDOR_SPECIFIC, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
@@ -8121,7 +9229,7 @@ void DisplayIdV21ParserGetAdaptiveSyncDetails(DD_GET_EDID_MODES* pGetEdidModes,
     // Note: Not checking for multiple instances of any of below blocks as they are assumed to be occurring only once.
     // If multiple instances of below blocks occur, only the first one will be parsed
 
-    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID21_DATA_BLOCK_ADAPTIVE_SYNC, 0);
+    DisplayIdParserFillGetBlockByIdArgs(&GetBlockById, pGetEdidModes->pEdidOrDisplayIDBuf, DID21_DATA_BLOCK_ADAPTIVE_SYNC, 0, pEdidData);
     Status = DisplayIdParserGetDisplayIDBlockByID(&GetBlockById);
     if (IS_DDSTATUS_SUCCESS(Status))
     {
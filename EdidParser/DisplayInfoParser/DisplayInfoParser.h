@@ -37,6 +37,7 @@
  //
  ///////////////////////////////////////////////////////////////////////////////
 #define MAX_DID_BLOCK_INSTANCES 5
+#define DID_TIMING_BATCH_SIZE 8 // Formula timings created per DisplayInfoRoutinesCreateTimings() call of the Display ID parsers
 
 #define DD_GET_ASPECT_RATIO(HActive, VActive) ((HActive * 1000) / (VActive))
 
@@ -95,7 +96,8 @@ typedef struct _CE_MODE_LIST
     DDU8 VicId[MAX_PARS_POSSIBLE_WITH_1_VIC]; // Valid VicID 1 - 127, 193-219 are adjusted as index to SVD struct. 0XFF - Vic not defined for mode
     DDU8 VicId4k2k;                           // Valid HDMI VIC = 1, 2, 3, 4 corresponding to Table-30 of HDMI 2.1a Specification.
     DDU32 S3DFormatMask;                      // Mask of DD_S3D_FORMAT
-    DD_TIMING_INFO* pTimingInfo;              // Pointer to CE timing Info from "g_SupportedCeShortVideoModes" table
+    const DD_TIMING_INFO* pTimingInfo;        // Pointer to CE timing Info from "g_SupportedCeShortVideoModes" table
+    MODE_SOURCE ModeSource;                   // Source of last VIC update using pTimingInfo, global timing itself is not written
 } CE_MODE_LIST;
 
 typedef struct _VFPDB_INFO
@@ -110,6 +112,29 @@ typedef struct _MODES_LIST // this is a structure used by a list for storing the
     DD_BOOL ForceAdd;
 } MODES_LIST;
 
+// A Display ID data block takes at least 3 header bytes and a section carries at most 255 data bytes
+#define MAX_DID_BLOCKS_IN_SECTION 85
+// Each Display ID EDID extension or Display ID section parsed takes one slot
+#define MAX_DID_INDEXED_SECTIONS MAX_EDID_EXTENSIONS_SUPPORTED
+
+// Index of the data blocks of one Display ID section, see DisplayIdParserGetBlockIndex()
+typedef struct _DID_BLOCK_INDEX
+{
+    DDU8* pSection;                          // Display ID header of indexed section, NULL if slot is unused
+    DDU8 NumBlocks;                          // Blocks found in section
+    DDU8 FirstOfTag[256];                    // Position in Offsets of 1st instance of each block tag
+    DDU8 CountOfTag[256];                    // Instances of each block tag
+    DDU8 Offsets[MAX_DID_BLOCKS_IN_SECTION]; // Block offsets from 1st block, grouped by tag and in section order within a tag
+} DID_BLOCK_INDEX;
+
+// Display ID block indexes of one EDID/Display ID buffer. Kept in DD_PARSER_CONTEXT across the caps and modes passes
+// over the buffer, or allocated per pass when parsing without a context.
+typedef struct _DID_BLOCK_INDEX_CACHE
+{
+    DDU32 NumSections; // Sections indexed so far, slots are reused round robin once all are taken
+    DID_BLOCK_INDEX Sections[MAX_DID_INDEXED_SECTIONS];
+} DID_BLOCK_INDEX_CACHE;
+
 typedef struct _EDID_DATA
 {
     DD_BOOL IsDisplayIdBaseBlock; // 0 - Base Block is EDID, 1 - Base Block is Display ID
@@ -125,6 +150,7 @@ typedef struct _EDID_DATA
     DDU8 NumTimingInfo;
     DDU8 NumBaseBlockDtds;
     MODES_LIST* pModes;
+    DID_BLOCK_INDEX_CACHE* pDidBlockIndexCache; // Optional, NULL to walk Display ID sections on every block lookup
 } EDID_DATA;
 
 typedef struct _ADD_MODES
@@ -134,11 +160,38 @@ typedef struct _ADD_MODES
     DD_BOOL ForceAdd;
 } ADD_MODES;
 
+// A non empty CE data block takes at least 2 bytes and a data block collection is at most 248 bytes (Display ID CTA block)
+#define MAX_CE_DATA_BLOCKS 124
+#define CE_DATA_BLOCK_NONE 0xFF
+
+// One CE data block of a data block collection, as found by CeInfoParserIndexDataBlocks()
+typedef struct _CE_DATA_BLOCK_ENTRY
+{
+    DDU8 Tag;         // CE block base Tag of type CEA_TAGCODE
+    DDU8 ExtendedTag; // Valid only when Tag is CEA_USE_EXTENDED_TAG
+    DDU8 Offset;      // Offset of the block header from start of the collection
+    DDU8 Length;      // Length from block header
+    DDU8 Instance;    // Number of blocks with same Tag before this one
+    DDU8 NextSameTag; // Next entry with same Tag (or same Extended Tag), CE_DATA_BLOCK_NONE if last
+    DDU32 IEEERegNum; // Valid only when Tag is CEA_VENDOR_DATABLOCK
+} CE_DATA_BLOCK_ENTRY;
+
+// Index of a CE data block collection, built once per collection so that block lookups don't rescan it
+typedef struct _CE_DATA_BLOCK_INDEX
+{
+    DDU8 NumBlocks;
+    DDU8 FirstOfTag[CEA_USE_EXTENDED_TAG + 1];  // First entry per Tag, CE_DATA_BLOCK_NONE if absent. Unused for CEA_USE_EXTENDED_TAG
+    DDU8 CountOfTag[CEA_USE_EXTENDED_TAG + 1];  // Number of entries per Tag
+    DDU8 FirstOfExtendedTag[256];               // First entry per Extended Tag, CE_DATA_BLOCK_NONE if absent
+    CE_DATA_BLOCK_ENTRY Entries[MAX_CE_DATA_BLOCKS];
+} CE_DATA_BLOCK_INDEX;
+
 typedef struct _PARSE_EXTBLK_ARGS
 {
     DDU8* pDataBlock;
     DDU8 LenDataBlock;
     DD_TABLE* pModeTable;
+    CE_DATA_BLOCK_INDEX CeBlockIndex; // Valid only for CE data block collections, see CeInfoParserIndexDataBlocks()
 } PARSE_EXTBLK_ARGS;
 
 typedef struct _PARSE_STDTIMING_ARGS
@@ -163,7 +216,19 @@ typedef struct _GET_BLOCK_BY_ID_ARGS
     IN DDU8 InstanceOfBlock;    // Valid only for Display ID base block/extension block; helpful to search if there are multiple instances of timing blocks
     IN DDU8* pInputBuf;         // Display ID buffer or CE block Data
     IN DDU32 InputBlockLength;  // Total size of Input buffer
+    IN const CE_DATA_BLOCK_INDEX* pCeBlockIndex; // Valid only for CE extension block search, index of data blocks in pInputBuf
+    IN const DID_BLOCK_INDEX* pDidBlockIndex;    // Valid only for Display ID block search, NULL to walk the section
     OUT DDU8* pOutputBlock;     // Pointer to output Display ID block or CE Bloc matching input ID/Tag
 
     // Variable size Actual Data.
 } GET_BLOCK_BY_ID_ARGS;
+
+// Entry points of the parser
+DDSTATUS DisplayInfoParserContextInit(DD_PARSER_CONTEXT* pParserContext);
+void DisplayInfoParserContextReset(DD_PARSER_CONTEXT* pParserContext);
+void DisplayInfoParserContextFree(DD_PARSER_CONTEXT* pParserContext);
+DDSTATUS DisplayInfoParserGetEdidModes(DD_GET_EDID_MODES* pGetEdidModes);
+DDSTATUS DisplayInfoParserGetEdidCaps(DD_GET_EDID_CAPS* pGetEdidCaps);
+DDSTATUS DisplayInfoParserGetEdidCapsAndModes(DD_GET_EDID_CAPS_AND_MODES* pGetEdidCapsAndModes);
+DDSTATUS DisplayInfoParserValidateEdidBlocks(const DDU8* pBlocks, DDU32 NumBlocks, DD_SIMD_LEVEL SimdLevel, DDU64* pValidBitmap);
+DDSTATUS DisplayInfoParserValidateEdidOrDisplayId(DD_VALIDATE_EDID_BLOCKS* pValidateBlocks);
@@ -32,7 +32,7 @@
 
 //
 //    Fake VGA mode 3 timings
-DD_TIMING_INFO g_TimingVGA_Mode3_640x480_60 = {
+const DD_TIMING_INFO g_TimingVGA_Mode3_640x480_60 = {
     25175000,  // Pixel clock in Hz
     800,       // H. total pixels
     640,       // H. active pixels
@@ -52,7 +52,7 @@ DD_TIMING_INFO g_TimingVGA_Mode3_640x480_60 = {
     1,         // Timing flags -- H-, V-
     1,         // Timing flags -- H-, V-
 };
-DD_TIMING_INFO g_TimingVGA_Mode3_720x400_60 = {
+const DD_TIMING_INFO g_TimingVGA_Mode3_720x400_60 = {
     28322000,  // Pixel clock in Hz
     800,       // H. total pixels
     640,       // H. active pixels
@@ -76,7 +76,7 @@ DD_TIMING_INFO g_TimingVGA_Mode3_720x400_60 = {
 //
 //    13.x timing 640x400@70
 //  Compaq Timing Requirements document, July 15 1999
-DD_TIMING_INFO g_Timing640x400_70 = {
+const DD_TIMING_INFO g_Timing640x400_70 = {
     25175000,  // Pixel clock in Hz
     800,       // H. total pixels
     640,       // H. active pixels
@@ -99,7 +99,7 @@ DD_TIMING_INFO g_Timing640x400_70 = {
 
 //
 //    VESA DMTS timing 640x350@85
-DD_TIMING_INFO g_Timing640x350_85 = {
+const DD_TIMING_INFO g_Timing640x350_85 = {
     31500000,  // Pixel clock in Hz
     832,       // H. total pixels
     640,       // H. active pixels
@@ -122,7 +122,7 @@ DD_TIMING_INFO g_Timing640x350_85 = {
 
 //
 //    VESA DMTS timing 640x400@85
-DD_TIMING_INFO g_Timing640x400_85 = {
+const DD_TIMING_INFO g_Timing640x400_85 = {
 
     31500000,  // Pixel clock in Hz
     832,       // H. total pixels
@@ -146,7 +146,7 @@ DD_TIMING_INFO g_Timing640x400_85 = {
 
 //
 //    VESA DMTS timing 640x480@60
-DD_TIMING_INFO g_Timing640x480_60 = {
+const DD_TIMING_INFO g_Timing640x480_60 = {
 
     25175000,  // Pixel clock in Hz
     800,       // H. total pixels
@@ -170,7 +170,7 @@ DD_TIMING_INFO g_Timing640x480_60 = {
 
 //
 //    VESA DMTS timing 640x480@72
-DD_TIMING_INFO g_Timing640x480_72 = {
+const DD_TIMING_INFO g_Timing640x480_72 = {
 
     31500000,  // Pixel clock in Hz
     832,       // H. total pixels
@@ -194,7 +194,7 @@ DD_TIMING_INFO g_Timing640x480_72 = {
 
 //
 //    VESA DMTS timing 640x480@75
-DD_TIMING_INFO g_Timing640x480_75 = {
+const DD_TIMING_INFO g_Timing640x480_75 = {
 
     31500000,  // Pixel clock in Hz
     840,       // H. total pixels
@@ -218,7 +218,7 @@ DD_TIMING_INFO g_Timing640x480_75 = {
 
 //
 //    VESA DMTS timing 640x480@85
-DD_TIMING_INFO g_Timing640x480_85 = {
+const DD_TIMING_INFO g_Timing640x480_85 = {
 
     36000000,  // Pixel clock in Hz
     832,       // H. total pixels
@@ -242,7 +242,7 @@ DD_TIMING_INFO g_Timing640x480_85 = {
 
 //
 //    VESA DMTS timing 720x400@85
-DD_TIMING_INFO g_Timing720x400_85 = {
+const DD_TIMING_INFO g_Timing720x400_85 = {
 
     35500000,  // Pixel clock in Hz
     936,       // H. total pixels
@@ -266,7 +266,7 @@ DD_TIMING_INFO g_Timing720x400_85 = {
 
 //
 //    VESA DMTS timing 800x600@56
-DD_TIMING_INFO g_Timing800x600_56 = {
+const DD_TIMING_INFO g_Timing800x600_56 = {
 
     36000000,  // Pixel clock in Hz
     1024,      // H. total pixels
@@ -290,7 +290,7 @@ DD_TIMING_INFO g_Timing800x600_56 = {
 
 //
 //    VESA DMTS timing 800x600@60
-DD_TIMING_INFO g_Timing800x600_60 = {
+const DD_TIMING_INFO g_Timing800x600_60 = {
 
     40000000,  // Pixel clock in Hz
     1056,      // H. total pixels
@@ -314,7 +314,7 @@ DD_TIMING_INFO g_Timing800x600_60 = {
 
 //
 //    VESA DMTS timing 800x600@72
-DD_TIMING_INFO g_Timing800x600_72 = {
+const DD_TIMING_INFO g_Timing800x600_72 = {
 
     50000000,  // Pixel clock in Hz
     1040,      // H. total pixels
@@ -338,7 +338,7 @@ DD_TIMING_INFO g_Timing800x600_72 = {
 
 //
 //    VESA DMTS timing 800x600@75
-DD_TIMING_INFO g_Timing800x600_75 = {
+const DD_TIMING_INFO g_Timing800x600_75 = {
 
     49500000,  // Pixel clock in Hz
     1056,      // H. total pixels
@@ -362,7 +362,7 @@ DD_TIMING_INFO g_Timing800x600_75 = {
 
 //
 //    VESA DMTS timing 800x600@85
-DD_TIMING_INFO g_Timing800x600_85 = {
+const DD_TIMING_INFO g_Timing800x600_85 = {
 
     56250000,  // Pixel clock in Hz
     1048,      // H. total pixels
@@ -386,7 +386,7 @@ DD_TIMING_INFO g_Timing800x600_85 = {
 
 //
 //    VESA DMTS timing 848x480@60
-DD_TIMING_INFO g_Timing848x480_60 = {
+const DD_TIMING_INFO g_Timing848x480_60 = {
 
     33750000,  // Pixel clock in Hz
     1088,      // H. total pixels
@@ -410,7 +410,7 @@ DD_TIMING_INFO g_Timing848x480_60 = {
 
 //
 //    VESA DMTS timing 1024x768@43i
-DD_TIMING_INFO g_Timing1024x768_43i = {
+const DD_TIMING_INFO g_Timing1024x768_43i = {
 
     22450000,   // Pixel clock in Hz
     1264,       // H. total pixels
@@ -435,7 +435,7 @@ DD_TIMING_INFO g_Timing1024x768_43i = {
 
 //
 //    VESA DMTS timing 1024x768@60
-DD_TIMING_INFO g_Timing1024x768_60 = {
+const DD_TIMING_INFO g_Timing1024x768_60 = {
 
     65000000,   // Pixel clock in Hz
     1344,       // H. total pixels
@@ -459,7 +459,7 @@ DD_TIMING_INFO g_Timing1024x768_60 = {
 
 //
 //    VESA DMTS timing 1024x768@70
-DD_TIMING_INFO g_Timing1024x768_70 = {
+const DD_TIMING_INFO g_Timing1024x768_70 = {
 
     75000000,   // Pixel clock in Hz
     1328,       // H. total pixels
@@ -483,7 +483,7 @@ DD_TIMING_INFO g_Timing1024x768_70 = {
 
 //
 //    VESA DMTS timing 1024x768@75
-DD_TIMING_INFO g_Timing1024x768_75 = {
+const DD_TIMING_INFO g_Timing1024x768_75 = {
 
     78750000,   // Pixel clock in Hz
     1312,       // H. total pixels
@@ -507,7 +507,7 @@ DD_TIMING_INFO g_Timing1024x768_75 = {
 
 //
 //    VESA DMTS timing 1024x768@85
-DD_TIMING_INFO g_Timing1024x768_85 = {
+const DD_TIMING_INFO g_Timing1024x768_85 = {
 
     94500000,   // Pixel clock in Hz
     1376,       // H. total pixels
@@ -531,7 +531,7 @@ DD_TIMING_INFO g_Timing1024x768_85 = {
 
 //
 //    VESA DMTS timing 1152x864@75
-DD_TIMING_INFO g_Timing1152x864_75 = {
+const DD_TIMING_INFO g_Timing1152x864_75 = {
 
     108000000,  // Pixel clock in Hz
     1600,       // H. total pixels
@@ -555,7 +555,7 @@ DD_TIMING_INFO g_Timing1152x864_75 = {
 
 //
 //    VESA DMTS timing 1280x960@60
-DD_TIMING_INFO g_Timing1280x960_60 = {
+const DD_TIMING_INFO g_Timing1280x960_60 = {
 
     108000000,  // Pixel clock in Hz
     1800,       // H. total pixels
@@ -579,7 +579,7 @@ DD_TIMING_INFO g_Timing1280x960_60 = {
 
 //
 //    VESA DMTS timing 1280x960@85
-DD_TIMING_INFO g_Timing1280x960_85 = {
+const DD_TIMING_INFO g_Timing1280x960_85 = {
 
     148500000,  // Pixel clock in Hz
     1728,       // H. total pixels
@@ -603,7 +603,7 @@ DD_TIMING_INFO g_Timing1280x960_85 = {
 
 //
 //    VESA DMTS timing 1280x1024@60
-DD_TIMING_INFO g_Timing1280x1024_60 = {
+const DD_TIMING_INFO g_Timing1280x1024_60 = {
 
     108000000,  // Pixel clock in Hz
     1688,       // H. total pixels
@@ -627,7 +627,7 @@ DD_TIMING_INFO g_Timing1280x1024_60 = {
 
 //
 //    VESA DMTS timing 1280x1024@75
-DD_TIMING_INFO g_Timing1280x1024_75 = {
+const DD_TIMING_INFO g_Timing1280x1024_75 = {
 
     135000000,  // Pixel clock in Hz
     1688,       // H. total pixels
@@ -651,7 +651,7 @@ DD_TIMING_INFO g_Timing1280x1024_75 = {
 
 //
 //    VESA DMTS timing 1280x1024@85
-DD_TIMING_INFO g_Timing1280x1024_85 = {
+const DD_TIMING_INFO g_Timing1280x1024_85 = {
 
     157500000,  // Pixel clock in Hz
     1728,       // H. total pixels
@@ -675,7 +675,7 @@ DD_TIMING_INFO g_Timing1280x1024_85 = {
 
 //
 //    VESA DMTS timing 1360x768@60
-DD_TIMING_INFO g_Timing1360x768_60 = {
+const DD_TIMING_INFO g_Timing1360x768_60 = {
 
     85500000,   // Pixel clock in Hz
     1792,       // H. total pixels
@@ -699,7 +699,7 @@ DD_TIMING_INFO g_Timing1360x768_60 = {
 
 //
 //    VESA DMTS timing 1366x768@60
-DD_TIMING_INFO g_Timing1366x768_60 = {
+const DD_TIMING_INFO g_Timing1366x768_60 = {
 
     85500000,   // Pixel clock in Hz
     1792,       // H. total pixels
@@ -723,7 +723,7 @@ DD_TIMING_INFO g_Timing1366x768_60 = {
 
 //
 //    VESA DMTS timing 1366x768@60rb
-DD_TIMING_INFO g_Timing1366x768_60rb = {
+const DD_TIMING_INFO g_Timing1366x768_60rb = {
 
     72000000,   // Pixel clock in Hz
     1500,       // H. total pixels
@@ -746,7 +746,7 @@ DD_TIMING_INFO g_Timing1366x768_60rb = {
 };
 
 //    VESA DMTS timing 1600x900@60rb
-DD_TIMING_INFO g_Timing1600x900_60rb = {
+const DD_TIMING_INFO g_Timing1600x900_60rb = {
 
     108000000,  // Pixel clock in Hz
     1800,       // H. total pixels
@@ -770,7 +770,7 @@ DD_TIMING_INFO g_Timing1600x900_60rb = {
 
 //
 //    VESA DMTS timing 1600x1200@60
-DD_TIMING_INFO g_Timing1600x1200_60 = {
+const DD_TIMING_INFO g_Timing1600x1200_60 = {
 
     162000000,  // Pixel clock in Hz
     2160,       // H. total pixels
@@ -794,7 +794,7 @@ DD_TIMING_INFO g_Timing1600x1200_60 = {
 
 //
 //    VESA DMTS timing 1600x1200@65
-DD_TIMING_INFO g_Timing1600x1200_65 = {
+const DD_TIMING_INFO g_Timing1600x1200_65 = {
 
     175500000,  // Pixel clock in Hz
     2160,       // H. total pixels
@@ -818,7 +818,7 @@ DD_TIMING_INFO g_Timing1600x1200_65 = {
 
 //
 //    VESA DMTS timing 1600x1200@70
-DD_TIMING_INFO g_Timing1600x1200_70 = {
+const DD_TIMING_INFO g_Timing1600x1200_70 = {
 
     189000000,  // Pixel clock in Hz
     2160,       // H. total pixels
@@ -842,7 +842,7 @@ DD_TIMING_INFO g_Timing1600x1200_70 = {
 
 //
 //    VESA DMTS timing 1600x1200@75
-DD_TIMING_INFO g_Timing1600x1200_75 = {
+const DD_TIMING_INFO g_Timing1600x1200_75 = {
 
     202500000,  // Pixel clock in Hz
     2160,       // H. total pixels
@@ -866,7 +866,7 @@ DD_TIMING_INFO g_Timing1600x1200_75 = {
 
 //
 //    VESA DMTS timing 1600x1200@85
-DD_TIMING_INFO g_Timing1600x1200_85 = {
+const DD_TIMING_INFO g_Timing1600x1200_85 = {
 
     229500000,  // Pixel clock in Hz
     2160,       // H. total pixels
@@ -890,7 +890,7 @@ DD_TIMING_INFO g_Timing1600x1200_85 = {
 
 //
 //    VESA DMTS timing 1792x1344@60
-DD_TIMING_INFO g_Timing1792x1344_60 = {
+const DD_TIMING_INFO g_Timing1792x1344_60 = {
 
     204750000,  // Pixel clock in Hz
     2448,       // H. total pixels
@@ -914,7 +914,7 @@ DD_TIMING_INFO g_Timing1792x1344_60 = {
 
 //
 //    VESA DMTS timing 1792x1344@75
-DD_TIMING_INFO g_Timing1792x1344_75 = {
+const DD_TIMING_INFO g_Timing1792x1344_75 = {
 
     261000000,  // Pixel clock in Hz
     2456,       // H. total pixels
@@ -938,7 +938,7 @@ DD_TIMING_INFO g_Timing1792x1344_75 = {
 
 //
 //    VESA DMTS timing 1856x1392@60
-DD_TIMING_INFO g_Timing1856x1392_60 = {
+const DD_TIMING_INFO g_Timing1856x1392_60 = {
 
     218250000,  // Pixel clock in Hz
     2528,       // H. total pixels
@@ -962,7 +962,7 @@ DD_TIMING_INFO g_Timing1856x1392_60 = {
 
 //
 //    VESA DMTS timing 1856x1392@75
-DD_TIMING_INFO g_Timing1856x1392_75 = {
+const DD_TIMING_INFO g_Timing1856x1392_75 = {
 
     288000000,  // Pixel clock in Hz
     2560,       // H. total pixels
@@ -986,7 +986,7 @@ DD_TIMING_INFO g_Timing1856x1392_75 = {
 
 //
 //    VESA DMTS timing 1920x1440@60
-DD_TIMING_INFO g_Timing1920x1440_60 = {
+const DD_TIMING_INFO g_Timing1920x1440_60 = {
 
     234000000,  // Pixel clock in Hz
     2600,       // H. total pixels
@@ -1010,7 +1010,7 @@ DD_TIMING_INFO g_Timing1920x1440_60 = {
 
 //
 //    VESA DMTS timing 1920x1440@75
-DD_TIMING_INFO g_Timing1920x1440_75 = {
+const DD_TIMING_INFO g_Timing1920x1440_75 = {
 
     297000000,  // Pixel clock in Hz
     2640,       // H. total pixels
@@ -1034,7 +1034,7 @@ DD_TIMING_INFO g_Timing1920x1440_75 = {
 
 //
 //    CVT reduced blanking timing for 2560x1600@60
-DD_TIMING_INFO g_Timing2560x1600_60 = {
+const DD_TIMING_INFO g_Timing2560x1600_60 = {
 
     268000000, // Pixel clock in Hz
     2720,      // H. total pixels
@@ -1058,7 +1058,7 @@ DD_TIMING_INFO g_Timing2560x1600_60 = {
 
 //
 //    CVT reduced blanking timing for 2560x1600@75
-DD_TIMING_INFO g_Timing2560x1600_75 = {
+const DD_TIMING_INFO g_Timing2560x1600_75 = {
 
     3388000000, // Pixel clock in Hz
     2720,       // H. total pixels
@@ -1088,7 +1088,7 @@ DD_TIMING_INFO g_Timing2560x1600_75 = {
 
 //
 //    CE 480p timing 640x480@60
-DD_TIMING_INFO g_Timing640x480p_60 = {
+const DD_TIMING_INFO g_Timing640x480p_60 = {
     25200000, // Pixel clock in Hz
     800,      // H. total
     640,      // H active
@@ -1111,7 +1111,7 @@ DD_TIMING_INFO g_Timing640x480p_60 = {
 
 //
 //    CE 861b timing 720x480@60 , 4:3 and 16:9
-DD_TIMING_INFO g_Timing720x480_60 = {
+const DD_TIMING_INFO g_Timing720x480_60 = {
 
     27000000, // Pixel clock in Hz
     858,      // H. total pixels
@@ -1135,7 +1135,7 @@ DD_TIMING_INFO g_Timing720x480_60 = {
 
 //
 //    CE 861b timing 1280x720x60  16:9
-DD_TIMING_INFO g_Timing1280x720_a_60 = {
+const DD_TIMING_INFO g_Timing1280x720_a_60 = {
 
     74250000, // Pixel clock in Hz
     1650,     // H. total pixels
@@ -1159,7 +1159,7 @@ DD_TIMING_INFO g_Timing1280x720_a_60 = {
 
 //
 //    VESA DMTS timing 1920X1080X60 INTERLACED 16:9
-DD_TIMING_INFO g_Timing1920x1080_i_a_60 = {
+const DD_TIMING_INFO g_Timing1920x1080_i_a_60 = {
 
     74250000, // Pixel clock in Hz
     2200,     // H. total pixels
@@ -1185,7 +1185,7 @@ DD_TIMING_INFO g_Timing1920x1080_i_a_60 = {
 
 //
 // VESA DMTS timing 720X576X50 /861 CE timing 720X576X50 16:9 and 4:30
-DD_TIMING_INFO g_Timing720x576_50 = {
+const DD_TIMING_INFO g_Timing720x576_50 = {
 
     27000000, // Pixel clock in Hz
     864,      // H. total pixels
@@ -1214,7 +1214,7 @@ DD_TIMING_INFO g_Timing720x576_50 = {
 // VESA DMTS 1920x1080@ 60 - Identical to 861 CE Timing
 
 // VESA DMT 2048x1152 @ 60 (Reduced blanking)
-DD_TIMING_INFO g_Timing2048x1152_60rb = {
+const DD_TIMING_INFO g_Timing2048x1152_60rb = {
 
     162000000,  // Pixel clock in Hz
     2250,       // H. total pixels
@@ -1238,7 +1238,7 @@ DD_TIMING_INFO g_Timing2048x1152_60rb = {
 
 //
 //    861 CE 1280x720x50
-DD_TIMING_INFO g_Timing1280x720_50 = {
+const DD_TIMING_INFO g_Timing1280x720_50 = {
 
     74250000, // Pixel clock in Hz
     1980,     // H. total pixels
@@ -1262,7 +1262,7 @@ DD_TIMING_INFO g_Timing1280x720_50 = {
 
 //
 //    861 CE 19x12x50  interlaced 16:9
-DD_TIMING_INFO g_Timing1920x1080_i_a_50 = {
+const DD_TIMING_INFO g_Timing1920x1080_i_a_50 = {
 
     74250000, // Pixel clock in Hz
     2640,     // H. total pixels
@@ -1286,7 +1286,7 @@ DD_TIMING_INFO g_Timing1920x1080_i_a_50 = {
 };
 
 //  VESA DMTS timing 1920x1080x50 16:9
-DD_TIMING_INFO g_Timing1920x1080_a_50 = {
+const DD_TIMING_INFO g_Timing1920x1080_a_50 = {
 
     148500000, // Pixel clock in Hz
     2640,      // H. total pixels
@@ -1310,7 +1310,7 @@ DD_TIMING_INFO g_Timing1920x1080_a_50 = {
 
 //
 //    861 CE 1920x1080x60 16:9
-DD_TIMING_INFO g_Timing1920x1080_a_60 = {
+const DD_TIMING_INFO g_Timing1920x1080_a_60 = {
 
     148500000, // Pixel clock in Hz
     2200,      // H. total pixels
@@ -1333,7 +1333,7 @@ DD_TIMING_INFO g_Timing1920x1080_a_60 = {
 };
 
 // Formats 6 and 7
-DD_TIMING_INFO g_Timing1440x480_i_60 = {
+const DD_TIMING_INFO g_Timing1440x480_i_60 = {
 
     27000000, // Pixel clock in Hz
     1716,     // H. total pixels
@@ -1356,7 +1356,7 @@ DD_TIMING_INFO g_Timing1440x480_i_60 = {
 };
 
 // Formats 8 & 9
-DD_TIMING_INFO g_Timing1440x240_60 = {
+const DD_TIMING_INFO g_Timing1440x240_60 = {
 
     27027000, // Pixel clock in Hz
     1716,     // H. total pixels
@@ -1379,7 +1379,7 @@ DD_TIMING_INFO g_Timing1440x240_60 = {
 };
 
 // Formats 10 and 11
-DD_TIMING_INFO g_Timing2880x480_i_60 = {
+const DD_TIMING_INFO g_Timing2880x480_i_60 = {
 
     54000000, // Pixel clock in Hz
     3432,     // H. total pixels
@@ -1402,7 +1402,7 @@ DD_TIMING_INFO g_Timing2880x480_i_60 = {
 };
 
 // Formats 12 and 13
-DD_TIMING_INFO g_Timing2880x240_60 = {
+const DD_TIMING_INFO g_Timing2880x240_60 = {
 
     54000000, // Pixel clock in Hz
     3432,     // H. total pixels
@@ -1425,7 +1425,7 @@ DD_TIMING_INFO g_Timing2880x240_60 = {
 };
 
 // Formats 14 and 15
-DD_TIMING_INFO g_Timing1440x480_60 = {
+const DD_TIMING_INFO g_Timing1440x480_60 = {
 
     54000000, // Pixel clock in Hz
     1716,     // H. total pixels
@@ -1448,7 +1448,7 @@ DD_TIMING_INFO g_Timing1440x480_60 = {
 };
 
 // Formats 21 & 22
-DD_TIMING_INFO g_Timing1440x576_i_50 = {
+const DD_TIMING_INFO g_Timing1440x576_i_50 = {
 
     27000000, // Pixel clock in Hz
     1728,     // H. total pixels
@@ -1471,7 +1471,7 @@ DD_TIMING_INFO g_Timing1440x576_i_50 = {
 };
 
 // Formats 23 and 24
-DD_TIMING_INFO g_Timing1440x288_50 = {
+const DD_TIMING_INFO g_Timing1440x288_50 = {
 
     27000000, // Pixel clock in Hz
     1728,     // H. total pixels
@@ -1494,7 +1494,7 @@ DD_TIMING_INFO g_Timing1440x288_50 = {
 };
 
 // Formats 25 and 26
-DD_TIMING_INFO g_Timing2880x576_i_50 = {
+const DD_TIMING_INFO g_Timing2880x576_i_50 = {
 
     54000000, // Pixel clock in Hz
     3456,     // H. total pixels
@@ -1517,7 +1517,7 @@ DD_TIMING_INFO g_Timing2880x576_i_50 = {
 };
 
 // Formats 27 and 28
-DD_TIMING_INFO g_Timing2880x288_50 = {
+const DD_TIMING_INFO g_Timing2880x288_50 = {
 
     54000000, // Pixel clock in Hz
     3456,     // H. total pixels
@@ -1540,7 +1540,7 @@ DD_TIMING_INFO g_Timing2880x288_50 = {
 };
 
 // Formats 29 and 30
-DD_TIMING_INFO g_Timing1440x576_50 = {
+const DD_TIMING_INFO g_Timing1440x576_50 = {
 
     54000000, // Pixel clock in Hz
     1728,     // H. total pixels
@@ -1563,7 +1563,7 @@ DD_TIMING_INFO g_Timing1440x576_50 = {
 };
 
 // Format 32 & 72
-DD_TIMING_INFO g_Timing1920x1080_24 = {
+const DD_TIMING_INFO g_Timing1920x1080_24 = {
 
     74250000, // Pixel clock in Hz
     2750,     // H. total pixels
@@ -1586,7 +1586,7 @@ DD_TIMING_INFO g_Timing1920x1080_24 = {
 };
 
 // Format 33 & 73
-DD_TIMING_INFO g_Timing1920x1080_25 = {
+const DD_TIMING_INFO g_Timing1920x1080_25 = {
 
     74250000, // Pixel clock in Hz
     2640,     // H. total pixels
@@ -1609,7 +1609,7 @@ DD_TIMING_INFO g_Timing1920x1080_25 = {
 };
 
 // Format 34 & 74
-DD_TIMING_INFO g_Timing1920x1080_30 = {
+const DD_TIMING_INFO g_Timing1920x1080_30 = {
 
     74250000, // Pixel clock in Hz
     2200,     // H. total pixels
@@ -1632,7 +1632,7 @@ DD_TIMING_INFO g_Timing1920x1080_30 = {
 };
 
 // Format 35 & 36
-DD_TIMING_INFO g_Timing2880x480_60 = {
+const DD_TIMING_INFO g_Timing2880x480_60 = {
 
     108000000, // Pixel clock in Hz
     3432,      // H. total pixels
@@ -1655,7 +1655,7 @@ DD_TIMING_INFO g_Timing2880x480_60 = {
 };
 
 // Format 37 & 38
-DD_TIMING_INFO g_Timing2880x576_50 = {
+const DD_TIMING_INFO g_Timing2880x576_50 = {
 
     108000000, // Pixel clock in Hz
     3456,      // H. total pixels
@@ -1678,7 +1678,7 @@ DD_TIMING_INFO g_Timing2880x576_50 = {
 };
 
 // Format 39
-DD_TIMING_INFO g_Timing1920x1080_i_50_Format39 = {
+const DD_TIMING_INFO g_Timing1920x1080_i_50_Format39 = {
 
     72000000, // Pixel clock in Hz
     2304,     // H. total pixels
@@ -1701,7 +1701,7 @@ DD_TIMING_INFO g_Timing1920x1080_i_50_Format39 = {
 };
 
 // Format 40
-DD_TIMING_INFO g_Timing1920x1080_i_100 = {
+const DD_TIMING_INFO g_Timing1920x1080_i_100 = {
 
     148500000, // Pixel clock in Hz
     2640,      // H. total pixels
@@ -1724,7 +1724,7 @@ DD_TIMING_INFO g_Timing1920x1080_i_100 = {
 };
 
 // Format 41 & 70
-DD_TIMING_INFO g_Timing1280x720_100 = {
+const DD_TIMING_INFO g_Timing1280x720_100 = {
 
     148500000, // Pixel clock in Hz
     1980,      // H. total pixels
@@ -1747,7 +1747,7 @@ DD_TIMING_INFO g_Timing1280x720_100 = {
 };
 
 // Format 42 & 43
-DD_TIMING_INFO g_Timing720x576_100 = {
+const DD_TIMING_INFO g_Timing720x576_100 = {
 
     54000000, // Pixel clock in Hz
     864,      // H. total pixels
@@ -1770,7 +1770,7 @@ DD_TIMING_INFO g_Timing720x576_100 = {
 };
 
 // Formats 44 & 45
-DD_TIMING_INFO g_Timing1440x576_i_100 = {
+const DD_TIMING_INFO g_Timing1440x576_i_100 = {
 
     54000000, // Pixel clock in Hz
     1728,     // H. total pixels
@@ -1793,7 +1793,7 @@ DD_TIMING_INFO g_Timing1440x576_i_100 = {
 };
 
 // Format 46
-DD_TIMING_INFO g_Timing1920x1080_i_120 = {
+const DD_TIMING_INFO g_Timing1920x1080_i_120 = {
 
     148500000, // Pixel clock in Hz
     2200,      // H. total pixels
@@ -1816,7 +1816,7 @@ DD_TIMING_INFO g_Timing1920x1080_i_120 = {
 };
 
 // Format 47 & 71
-DD_TIMING_INFO g_Timing1280x720_120 = {
+const DD_TIMING_INFO g_Timing1280x720_120 = {
 
     148500000, // Pixel clock in Hz
     1650,      // H. total pixels
@@ -1839,7 +1839,7 @@ DD_TIMING_INFO g_Timing1280x720_120 = {
 };
 
 // Formats 48 & 49
-DD_TIMING_INFO g_Timing720x480_120 = {
+const DD_TIMING_INFO g_Timing720x480_120 = {
 
     54054000, // Pixel clock in Hz
     858,      // H. total pixels
@@ -1862,7 +1862,7 @@ DD_TIMING_INFO g_Timing720x480_120 = {
 };
 
 // Formats 50 and 51
-DD_TIMING_INFO g_Timing1440x480_i_120 = {
+const DD_TIMING_INFO g_Timing1440x480_i_120 = {
 
     54054000, // Pixel clock in Hz
     1716,     // H. total pixels
@@ -1885,7 +1885,7 @@ DD_TIMING_INFO g_Timing1440x480_i_120 = {
 };
 
 // Format 52 &53
-DD_TIMING_INFO g_Timing720x576_200 = {
+const DD_TIMING_INFO g_Timing720x576_200 = {
 
     108000000, // Pixel clock in Hz
     864,       // H. total pixels
@@ -1908,7 +1908,7 @@ DD_TIMING_INFO g_Timing720x576_200 = {
 };
 
 // Formats 54 & 55
-DD_TIMING_INFO g_Timing1440x576_i_200 = {
+const DD_TIMING_INFO g_Timing1440x576_i_200 = {
 
     108000000, // Pixel clock in Hz
     1728,      // H. total pixels
@@ -1931,7 +1931,7 @@ DD_TIMING_INFO g_Timing1440x576_i_200 = {
 };
 
 // Formats 56 & 57
-DD_TIMING_INFO g_Timing720x480_240 = {
+const DD_TIMING_INFO g_Timing720x480_240 = {
 
     108108000, // Pixel clock in Hz
     858,       // H. total pixels
@@ -1954,7 +1954,7 @@ DD_TIMING_INFO g_Timing720x480_240 = {
 };
 
 // Formats 58 and 59
-DD_TIMING_INFO g_Timing1440x480_i_240 = {
+const DD_TIMING_INFO g_Timing1440x480_i_240 = {
 
     108108000, // Pixel clock in Hz
     1716,      // H. total pixels
@@ -1977,7 +1977,7 @@ DD_TIMING_INFO g_Timing1440x480_i_240 = {
 };
 
 // Format 60 & 65
-DD_TIMING_INFO g_Timing1280x720_p_24 = {
+const DD_TIMING_INFO g_Timing1280x720_p_24 = {
 
     59400000, // Pixel clock in Hz
     3300,     // H. total pixels
@@ -2000,7 +2000,7 @@ DD_TIMING_INFO g_Timing1280x720_p_24 = {
 };
 
 // Format 61 & 66
-DD_TIMING_INFO g_Timing1280x720_p_25 = {
+const DD_TIMING_INFO g_Timing1280x720_p_25 = {
 
     74250000, // Pixel clock in Hz
     3960,     // H. total pixels
@@ -2023,7 +2023,7 @@ DD_TIMING_INFO g_Timing1280x720_p_25 = {
 };
 
 // Format 62 & 67
-DD_TIMING_INFO g_Timing1280x720_p_30 = {
+const DD_TIMING_INFO g_Timing1280x720_p_30 = {
 
     74250000, // Pixel clock in Hz
     3300,     // H. total pixels
@@ -2046,7 +2046,7 @@ DD_TIMING_INFO g_Timing1280x720_p_30 = {
 };
 
 // Format 63 & 78
-DD_TIMING_INFO g_Timing1920x1080_p_120 = {
+const DD_TIMING_INFO g_Timing1920x1080_p_120 = {
 
     297000000, // Pixel clock in Hz
     2200,      // H. total pixels
@@ -2069,7 +2069,7 @@ DD_TIMING_INFO g_Timing1920x1080_p_120 = {
 };
 
 // Format 64 & 77
-DD_TIMING_INFO g_Timing1920x1080_p_100 = {
+const DD_TIMING_INFO g_Timing1920x1080_p_100 = {
 
     297000000, // Pixel clock in Hz
     2640,      // H. total pixels
@@ -2092,7 +2092,7 @@ DD_TIMING_INFO g_Timing1920x1080_p_100 = {
 };
 
 // Format 79
-DD_TIMING_INFO g_Timing1680x720_p_24 = {
+const DD_TIMING_INFO g_Timing1680x720_p_24 = {
 
     59400000, // Pixel clock in Hz
     3300,     // H. total pixels
@@ -2114,7 +2114,7 @@ DD_TIMING_INFO g_Timing1680x720_p_24 = {
     0,        // Timing flags -- H+, V+
 };
 // Format 80
-DD_TIMING_INFO g_Timing1680x720_p_25 = {
+const DD_TIMING_INFO g_Timing1680x720_p_25 = {
 
     59400000, // Pixel clock in Hz
     3168,     // H. total pixels
@@ -2136,7 +2136,7 @@ DD_TIMING_INFO g_Timing1680x720_p_25 = {
     0,        // Timing flags -- H+, V+
 };
 // Format 81
-DD_TIMING_INFO g_Timing1680x720_p_30 = {
+const DD_TIMING_INFO g_Timing1680x720_p_30 = {
 
     59400000, // Pixel clock in Hz
     2640,     // H. total pixels
@@ -2158,7 +2158,7 @@ DD_TIMING_INFO g_Timing1680x720_p_30 = {
     0,        // Timing flags -- H+, V+
 };
 // Format 82
-DD_TIMING_INFO g_Timing1680x720_p_50 = {
+const DD_TIMING_INFO g_Timing1680x720_p_50 = {
 
     82500000, // Pixel clock in Hz
     2200,     // H. total pixels
@@ -2180,7 +2180,7 @@ DD_TIMING_INFO g_Timing1680x720_p_50 = {
     0,        // Timing flags -- H+, V+
 };
 // Format 83
-DD_TIMING_INFO g_Timing1680x720_p_60 = {
+const DD_TIMING_INFO g_Timing1680x720_p_60 = {
 
     99000000, // Pixel clock in Hz
     2200,     // H. total pixels
@@ -2203,7 +2203,7 @@ DD_TIMING_INFO g_Timing1680x720_p_60 = {
 };
 
 // Format 84
-DD_TIMING_INFO g_Timing1680x720_p_100 = {
+const DD_TIMING_INFO g_Timing1680x720_p_100 = {
 
     165000000, // Pixel clock in Hz
     2000,      // H. total pixels
@@ -2226,7 +2226,7 @@ DD_TIMING_INFO g_Timing1680x720_p_100 = {
 };
 
 // Format 85
-DD_TIMING_INFO g_Timing1680x720_p_120 = {
+const DD_TIMING_INFO g_Timing1680x720_p_120 = {
 
     198000000, // Pixel clock in Hz
     2000,      // H. total pixels
@@ -2249,7 +2249,7 @@ DD_TIMING_INFO g_Timing1680x720_p_120 = {
 };
 
 // Format 86
-DD_TIMING_INFO g_Timing2560x1080_p_24 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_24 = {
 
     99000000, // Pixel clock in Hz
     3750,     // H. total pixels
@@ -2272,7 +2272,7 @@ DD_TIMING_INFO g_Timing2560x1080_p_24 = {
 };
 
 // Format 87
-DD_TIMING_INFO g_Timing2560x1080_p_25 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_25 = {
 
     90000000, // Pixel clock in Hz
     3200,     // H. total pixels
@@ -2295,7 +2295,7 @@ DD_TIMING_INFO g_Timing2560x1080_p_25 = {
 };
 
 // Format 88
-DD_TIMING_INFO g_Timing2560x1080_p_30 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_30 = {
 
     118800000, // Pixel clock in Hz
     3520,      // H. total pixels
@@ -2318,7 +2318,7 @@ DD_TIMING_INFO g_Timing2560x1080_p_30 = {
 };
 
 // Format 89
-DD_TIMING_INFO g_Timing2560x1080_p_50 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_50 = {
 
     185625000, // Pixel clock in Hz
     3300,      // H. total pixels
@@ -2341,7 +2341,7 @@ DD_TIMING_INFO g_Timing2560x1080_p_50 = {
 };
 
 // Format 90
-DD_TIMING_INFO g_Timing2560x1080_p_60 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_60 = {
 
     198000000, // Pixel clock in Hz
     3000,      // H. total pixels
@@ -2364,7 +2364,7 @@ DD_TIMING_INFO g_Timing2560x1080_p_60 = {
 };
 
 // Format 91
-DD_TIMING_INFO g_Timing2560x1080_p_100 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_100 = {
 
     371250000, // Pixel clock in Hz
     2970,      // H. total pixels
@@ -2387,7 +2387,7 @@ DD_TIMING_INFO g_Timing2560x1080_p_100 = {
 };
 
 // Format 92
-DD_TIMING_INFO g_Timing2560x1080_p_120 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_120 = {
 
     495000000, // Pixel clock in Hz
     3300,      // H. total pixels
@@ -2480,7 +2480,7 @@ sizeof(DD_TIMING_INFO),    // Size of the DD_TIMING_INFO structure
 };*/
 
 // Format 96,106 <MIGHT CONTAIN ERROR, REVIEW THE DD_TIMING_INFO>
-DD_TIMING_INFO g_Timing3840x2160_p_50 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_50 = {
 
     594000000, // Pixel clock in Hz
     5280,      // H. total pixels
@@ -2503,7 +2503,7 @@ DD_TIMING_INFO g_Timing3840x2160_p_50 = {
 };
 
 // Format 97,107 <MIGHT CONTAIN ERROR, REVIEW THE DD_TIMING_INFO>
-DD_TIMING_INFO g_Timing3840x2160_p_60 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_60 = {
 
     594000000, // Pixel clock in Hz
     4400,      // H. total pixels
@@ -2549,7 +2549,7 @@ sizeof(DD_TIMING_INFO),    // Size of the DD_TIMING_INFO structure
 };*/
 
 // Format 99
-DD_TIMING_INFO g_Timing4096x2160_p_25 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_25 = {
 
     297000000, // Pixel clock in Hz
     5280,      // H. total pixels
@@ -2572,7 +2572,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_25 = {
 };
 
 // Format 100
-DD_TIMING_INFO g_Timing4096x2160_p_30 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_30 = {
 
     297000000, // Pixel clock in Hz
     4400,      // H. total pixels
@@ -2595,7 +2595,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_30 = {
 };
 
 // Format 101 <MIGHT CONTAIN ERROR, REVIEW THE DD_TIMING_INFO>
-DD_TIMING_INFO g_Timing4096x2160_p_50 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_50 = {
 
     594000000, // Pixel clock in Hz
     5280,      // H. total pixels
@@ -2618,7 +2618,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_50 = {
 };
 
 // Format 102 <MIGHT CONTAIN ERROR, REVIEW THE DD_TIMING_INFO>
-DD_TIMING_INFO g_Timing4096x2160_p_60 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_60 = {
 
     594000000, // Pixel clock in Hz
     4400,      // H. total pixels
@@ -2642,7 +2642,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_60 = {
 
 // CE-861G New Supported Modes Starts Here
 // Format 108 and 109 1280x720x48
-DD_TIMING_INFO g_Timing1280x720_p_48 = {
+const DD_TIMING_INFO g_Timing1280x720_p_48 = {
     90000000, // Pixel clock in Hz
     2500,     // H. total pixels
     1280,     // H. active pixels
@@ -2664,7 +2664,7 @@ DD_TIMING_INFO g_Timing1280x720_p_48 = {
 };
 
 // Format 110
-DD_TIMING_INFO g_Timing1680x720_p_48 = {
+const DD_TIMING_INFO g_Timing1680x720_p_48 = {
     99000000, // Pixel clock in Hz
     2750,     // H. total pixels
     1680,     // H. active pixels
@@ -2686,7 +2686,7 @@ DD_TIMING_INFO g_Timing1680x720_p_48 = {
 };
 
 // Format 111 and 112
-DD_TIMING_INFO g_Timing1920x1080_p_48 = {
+const DD_TIMING_INFO g_Timing1920x1080_p_48 = {
     148500000, // Pixel clock in Hz
     2750,      // H. total pixels
     1920,      // H. active pixels
@@ -2708,7 +2708,7 @@ DD_TIMING_INFO g_Timing1920x1080_p_48 = {
 };
 
 // Format 113
-DD_TIMING_INFO g_Timing2560x1080_p_48 = {
+const DD_TIMING_INFO g_Timing2560x1080_p_48 = {
     198000000, // Pixel clock in Hz
     3750,      // H. total pixels
     2560,      // H. active pixels
@@ -2730,7 +2730,7 @@ DD_TIMING_INFO g_Timing2560x1080_p_48 = {
 };
 
 // Format 114 and 116
-DD_TIMING_INFO g_Timing3840x2160_p_48 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_48 = {
     594000000, // Pixel clock in Hz
     5500,      // H. total pixels
     3840,      // H. active pixels
@@ -2752,7 +2752,7 @@ DD_TIMING_INFO g_Timing3840x2160_p_48 = {
 };
 
 // Format 115
-DD_TIMING_INFO g_Timing4096x2160_p_48 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_48 = {
     594000000, // Pixel clock in Hz
     5500,      // H. total pixels
     4096,      // H. active pixels
@@ -2774,7 +2774,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_48 = {
 };
 
 // Format 117 & 119
-DD_TIMING_INFO g_Timing3840x2160_p_100 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_100 = {
     1188000000, // Pixel clock in Hz
     5280,       // H. total pixels
     3840,       // H. active pixels
@@ -2796,7 +2796,7 @@ DD_TIMING_INFO g_Timing3840x2160_p_100 = {
 };
 
 // Format 118 & 120
-DD_TIMING_INFO g_Timing3840x2160_p_120 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_120 = {
     1188000000, // Pixel clock in Hz
     4400,       // H. total pixels
     3840,       // H. active pixels
@@ -2818,7 +2818,7 @@ DD_TIMING_INFO g_Timing3840x2160_p_120 = {
 };
 
 // Format 121
-DD_TIMING_INFO g_Timing5120x2160_p_24 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_24 = {
     396000000, // Pixel clock in Hz
     7500,      // H. total pixels
     5120,      // H. active pixels
@@ -2840,7 +2840,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_24 = {
 };
 
 // Format 122
-DD_TIMING_INFO g_Timing5120x2160_p_25 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_25 = {
     396000000, // Pixel clock in Hz
     7200,      // H. total pixels
     5120,      // H. active pixels
@@ -2862,7 +2862,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_25 = {
 };
 
 // Format 123
-DD_TIMING_INFO g_Timing5120x2160_p_30 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_30 = {
     396000000, // Pixel clock in Hz
     6000,      // H. total pixels
     5120,      // H. active pixels
@@ -2884,7 +2884,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_30 = {
 };
 
 // Format 124
-DD_TIMING_INFO g_Timing5120x2160_p_48 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_48 = {
     742500000, // Pixel clock in Hz
     6250,      // H. total pixels
     5120,      // H. active pixels
@@ -2906,7 +2906,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_48 = {
 };
 
 // Format 125
-DD_TIMING_INFO g_Timing5120x2160_p_50 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_50 = {
     742500000, // Pixel clock in Hz
     6600,      // H. total pixels
     5120,      // H. active pixels
@@ -2928,7 +2928,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_50 = {
 };
 
 // Format 126
-DD_TIMING_INFO g_Timing5120x2160_p_60 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_60 = {
     742500000, // Pixel clock in Hz
     5500,      // H. total pixels
     5120,      // H. active pixels
@@ -2950,7 +2950,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_60 = {
 };
 
 // Format 127
-DD_TIMING_INFO g_Timing5120x2160_p_100 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_100 = {
     1485000000, // Pixel clock in Hz
     6600,       // H. total pixels
     5120,       // H. active pixels
@@ -2974,7 +2974,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_100 = {
 // Formats 128-192 are Forbidden as per CE 861-G standard
 
 // Format 193
-DD_TIMING_INFO g_Timing5120x2160_p_120 = {
+const DD_TIMING_INFO g_Timing5120x2160_p_120 = {
     1485000000, // Pixel clock in Hz
     5500,       // H. total pixels
     5120,       // H. active pixels
@@ -2996,7 +2996,7 @@ DD_TIMING_INFO g_Timing5120x2160_p_120 = {
 };
 
 // Format 194 and 202
-DD_TIMING_INFO g_Timing7680x4320_p_24 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_24 = {
     1188000000, // Pixel clock in Hz
     11000,      // H. total pixels
     7680,       // H. active pixels
@@ -3018,7 +3018,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_24 = {
 };
 
 // Format 195 and 203
-DD_TIMING_INFO g_Timing7680x4320_p_25 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_25 = {
     1188000000, // Pixel clock in Hz
     10800,      // H. total pixels
     7680,       // H. active pixels
@@ -3040,7 +3040,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_25 = {
 };
 
 // Format 196 and 204
-DD_TIMING_INFO g_Timing7680x4320_p_30 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_30 = {
     1188000000, // Pixel clock in Hz
     9000,       // H. total pixels
     7680,       // H. active pixels
@@ -3062,7 +3062,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_30 = {
 };
 
 // Format 197 and 205
-DD_TIMING_INFO g_Timing7680x4320_p_48 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_48 = {
     2376000000, // Pixel clock in Hz
     11000,      // H. total pixels
     7680,       // H. active pixels
@@ -3084,7 +3084,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_48 = {
 };
 
 // Format 198 and 206
-DD_TIMING_INFO g_Timing7680x4320_p_50 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_50 = {
     2376000000, // Pixel clock in Hz
     10800,      // H. total pixels
     7680,       // H. active pixels
@@ -3106,7 +3106,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_50 = {
 };
 
 // Format 199 and 207
-DD_TIMING_INFO g_Timing7680x4320_p_60 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_60 = {
     2376000000, // Pixel clock in Hz
     9000,       // H. total pixels
     7680,       // H. active pixels
@@ -3128,7 +3128,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_60 = {
 };
 
 // Format 210
-DD_TIMING_INFO g_Timing10240x4320_p_24 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_24 = {
     1485000000, // Pixel clock in Hz
     12500,      // H. total pixels
     10240,      // H. active pixels
@@ -3150,7 +3150,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_24 = {
 };
 
 // Format 211
-DD_TIMING_INFO g_Timing10240x4320_p_25 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_25 = {
     1485000000, // Pixel clock in Hz
     13500,      // H. total pixels
     10240,      // H. active pixels
@@ -3172,7 +3172,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_25 = {
 };
 
 // Format 212
-DD_TIMING_INFO g_Timing10240x4320_p_30 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_30 = {
     1485000000, // Pixel clock in Hz
     11000,      // H. total pixels
     10240,      // H. active pixels
@@ -3194,7 +3194,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_30 = {
 };
 
 // Format 213
-DD_TIMING_INFO g_Timing10240x4320_p_48 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_48 = {
     2970000000, // Pixel clock in Hz
     12500,      // H. total pixels
     10240,      // H. active pixels
@@ -3216,7 +3216,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_48 = {
 };
 
 // Format 214
-DD_TIMING_INFO g_Timing10240x4320_p_50 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_50 = {
     2970000000, // Pixel clock in Hz
     13500,      // H. total pixels
     10240,      // H. active pixels
@@ -3238,7 +3238,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_50 = {
 };
 
 // Format 215
-DD_TIMING_INFO g_Timing10240x4320_p_60 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_60 = {
     2970000000, // Pixel clock in Hz
     11000,      // H. total pixels
     10240,      // H. active pixels
@@ -3260,7 +3260,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_60 = {
 };
 
 // Format 200 and 208
-DD_TIMING_INFO g_Timing7680x4320_p_100 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_100 = {
     4752000000, // Pixel clock in Hz
     10560,      // H. total pixels
     7680,       // H. active pixels
@@ -3282,7 +3282,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_100 = {
 };
 
 // Format 201 and 209
-DD_TIMING_INFO g_Timing7680x4320_p_120 = {
+const DD_TIMING_INFO g_Timing7680x4320_p_120 = {
     4752000000, // Pixel clock in Hz
     8800,       // H. total pixels
     7680,       // H. active pixels
@@ -3304,7 +3304,7 @@ DD_TIMING_INFO g_Timing7680x4320_p_120 = {
 };
 
 // Format 216
-DD_TIMING_INFO g_Timing10240x4320_p_100 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_100 = {
     5940000000, // Pixel clock in Hz
     13200,      // H. total pixels
     10240,      // H. active pixels
@@ -3326,7 +3326,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_100 = {
 };
 
 // Format 217
-DD_TIMING_INFO g_Timing10240x4320_p_120 = {
+const DD_TIMING_INFO g_Timing10240x4320_p_120 = {
     5940000000, // Pixel clock in Hz
     11000,      // H. total pixels
     10240,      // H. active pixels
@@ -3348,7 +3348,7 @@ DD_TIMING_INFO g_Timing10240x4320_p_120 = {
 };
 
 // Format 218
-DD_TIMING_INFO g_Timing4096x2160_p_100 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_100 = {
     1188000000, // Pixel clock in Hz
     5280,       // H. total pixels
     4096,       // H. active pixels
@@ -3370,7 +3370,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_100 = {
 };
 
 // Format 219
-DD_TIMING_INFO g_Timing4096x2160_p_120 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_120 = {
     1188000000, // Pixel clock in Hz
     4400,       // H. total pixels
     4096,       // H. active pixels
@@ -3392,7 +3392,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_120 = {
 };
 
 // HDMI_VIC 1
-DD_TIMING_INFO g_Timing3840x2160_p_30 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_30 = {
 
     297000000, // Pixel clock in Hz
     4400,      // H. total pixels
@@ -3415,7 +3415,7 @@ DD_TIMING_INFO g_Timing3840x2160_p_30 = {
 };
 
 // HDMI_VIC 2
-DD_TIMING_INFO g_Timing3840x2160_p_25 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_25 = {
 
     297000000, // Pixel clock in Hz
     5280,      // H. total pixels
@@ -3438,7 +3438,7 @@ DD_TIMING_INFO g_Timing3840x2160_p_25 = {
 };
 
 // HDMI_VIC 3
-DD_TIMING_INFO g_Timing3840x2160_p_24 = {
+const DD_TIMING_INFO g_Timing3840x2160_p_24 = {
 
     297000000, // Pixel clock in Hz
     5500,      // H. total pixels
@@ -3461,7 +3461,7 @@ DD_TIMING_INFO g_Timing3840x2160_p_24 = {
 };
 
 // HDMI_VIC 4
-DD_TIMING_INFO g_Timing4096x2160_p_24 = {
+const DD_TIMING_INFO g_Timing4096x2160_p_24 = {
 
     297000000, // Pixel clock in Hz
     5500,      // H. total pixels
@@ -3485,7 +3485,7 @@ DD_TIMING_INFO g_Timing4096x2160_p_24 = {
 
 //
 //    Timing 1366x768_120_S3D_CPT - 33.7% VBI
-DD_TIMING_INFO g_Timing1366x768_120_S3D_CPT = {
+const DD_TIMING_INFO g_Timing1366x768_120_S3D_CPT = {
 
     200000000, // Pixel clock in Hz
     1438,      // H. total pixels
@@ -3509,7 +3509,7 @@ DD_TIMING_INFO g_Timing1366x768_120_S3D_CPT = {
 
 //
 //    Timing 1600x900_120_S3D_CPT - 39.5% VBI
-DD_TIMING_INFO g_Timing1600x900_120_S3D_CPT = {
+const DD_TIMING_INFO g_Timing1600x900_120_S3D_CPT = {
 
     360000000, // Pixel clock in Hz
     2016,      // H. total pixels
@@ -3533,7 +3533,7 @@ DD_TIMING_INFO g_Timing1600x900_120_S3D_CPT = {
 
 //
 //    Timing 1920x1080_120_S3D (CMI+MSTAR timing with HBlank restriction of 80) // Mstar said 70, but using 80 as it's divisible by 8. Gives 28% VBI
-DD_TIMING_INFO g_Timing1920x1080_120_S3D = {
+const DD_TIMING_INFO g_Timing1920x1080_120_S3D = {
 
     360000000, // Pixel clock in Hz
     2000,      // H. total pixels
@@ -3558,7 +3558,7 @@ DD_TIMING_INFO g_Timing1920x1080_120_S3D = {
 //
 //    Timing 1920x1080_100_S3D (CMI+MSTAR timing with HBlank restriction of 80) // Mstar said 70, but using 80 as it's divisible by 8. Gives 40% VBI with 100Hz
 // Lot of flicker was observed with this on CMI
-DD_TIMING_INFO g_Timing1920x1080_100_S3D = {
+const DD_TIMING_INFO g_Timing1920x1080_100_S3D = {
 
     360000000, // Pixel clock in Hz
     2000,      // H. total pixels
@@ -3580,7 +3580,7 @@ DD_TIMING_INFO g_Timing1920x1080_100_S3D = {
     0,         // Timing flags -- H-, V+
 };
 
-DD_TIMING_INFO g_Timing1280x768_60 = {
+const DD_TIMING_INFO g_Timing1280x768_60 = {
     79500000,   // Pixel clock in Hz
     1664,       // H. total pixels
     1280,       // H. active pixels
@@ -3601,7 +3601,7 @@ DD_TIMING_INFO g_Timing1280x768_60 = {
     0,          // Timing flags -- H-, V+
 };
 
-DD_TIMING_INFO g_Timing1280x800_60 = {
+const DD_TIMING_INFO g_Timing1280x800_60 = {
 
     83500000,   // Pixel clock in Hz
     1680,       // H. total pixels
@@ -3623,7 +3623,7 @@ DD_TIMING_INFO g_Timing1280x800_60 = {
     0,          // Timing flags -- H-, V+
 };
 
-DD_TIMING_INFO g_Timing1440x900_60 = {
+const DD_TIMING_INFO g_Timing1440x900_60 = {
 
     106500000,  // Pixel clock in Hz
     1904,       // H. total pixels
@@ -3645,7 +3645,7 @@ DD_TIMING_INFO g_Timing1440x900_60 = {
     0,          // Timing flags -- H-, V+
 };
 
-DD_TIMING_INFO g_Timing1400x1050_60 = {
+const DD_TIMING_INFO g_Timing1400x1050_60 = {
 
     121750000,  // Pixel clock in Hz
     1864,       // H. total pixels
@@ -3667,7 +3667,7 @@ DD_TIMING_INFO g_Timing1400x1050_60 = {
     0,          // Timing flags -- H-, V+
 };
 
-DD_TIMING_INFO g_Timing1680x1050_60 = {
+const DD_TIMING_INFO g_Timing1680x1050_60 = {
 
     146250000, // Pixel clock in Hz
     2240,      // H. total pixels
@@ -3700,7 +3700,7 @@ DD_TIMING_INFO g_Timing1680x1050_60 = {
 // entry of NULL.
 //
 //////////////////////////////////////////
-ESTABLISHED_MODE_TABLE g_EstablishedModeTable[] = {
+const ESTABLISHED_MODE_TABLE g_EstablishedModeTable[] = {
     { &g_Timing800x600_60 },
     { NULL }, //{&g_Timing800x600_56},
     { &g_Timing640x480_75 },
@@ -3726,7 +3726,7 @@ ESTABLISHED_MODE_TABLE g_EstablishedModeTable[] = {
     { NULL },
     { NULL } //&g_Timing1152x870_75}
 };
-DDU32 g_ulTotalEstablishedModes = sizeof(g_EstablishedModeTable) / sizeof(g_EstablishedModeTable[0]);
+const DDU32 g_ulTotalEstablishedModes = sizeof(g_EstablishedModeTable) / sizeof(g_EstablishedModeTable[0]);
 
 //////////////////////////////////////////
 //
@@ -3741,7 +3741,7 @@ DDU32 g_ulTotalEstablishedModes = sizeof(g_EstablishedModeTable) / sizeof(g_Esta
 // between.
 //
 //////////////////////////////////////////
-ESTABLISHED_MODE_TABLE g_EstTiming3ModeTable[] = {
+const ESTABLISHED_MODE_TABLE g_EstTiming3ModeTable[] = {
     { NULL }, // No Timing for DMT ID 0, added so that it helps to get
     // required Timing just using it as table index
     { &g_Timing1152x864_75 }, // 1152 x 864 @ 75 Hz
@@ -3799,21 +3799,21 @@ ESTABLISHED_MODE_TABLE g_EstTiming3ModeTable[] = {
     { NULL },                  // No Timing this DMT ID, added so that it helps to get
 };
 
-DDU32 g_ulTotalEstTiming3modes = sizeof(g_EstTiming3ModeTable) / sizeof(g_EstTiming3ModeTable[0]);
+const DDU32 g_ulTotalEstTiming3modes = sizeof(g_EstTiming3ModeTable) / sizeof(g_EstTiming3ModeTable[0]);
 
 /////////////////////////////////////////////////////////////////////////
 //  CE-861b Supported Short Video Descriptors Table
 //    <Index of the entry into the Table><Aspect Ratio><PR Mask><Timing Info >
 //    Ref : CE-Extension Spec
 /////////////////////////////////////////////////////////////////////////
-CE_SHORT_VIDEO_MODE g_SDVOHDMISupportedCeShortVideoModes[] = {
+const CE_SHORT_VIDEO_MODE g_SDVOHDMISupportedCeShortVideoModes[] = {
     { 1, AVI_PAR_4_3, PR_1X, &g_Timing640x480p_60 }, // No Timing for DMT ID 0, added so that it helps to get   required Timing just using it as table index
     { 2, AVI_PAR_4_3, PR_1X, &g_Timing720x480_60 },        { 3, AVI_PAR_16_9, PR_1X, &g_Timing720x480_60 },      { 4, AVI_PAR_16_9, PR_1X, &g_Timing1280x720_a_60 },
     { 5, AVI_PAR_16_9, PR_1X, &g_Timing1920x1080_i_a_60 }, { 16, AVI_PAR_16_9, PR_1X, &g_Timing1920x1080_a_60 }, { 17, AVI_PAR_4_3, PR_1X, &g_Timing720x576_50 },
     { 18, AVI_PAR_16_9, PR_1X, &g_Timing720x576_50 },      { 19, AVI_PAR_16_9, PR_1X, &g_Timing1280x720_50 },    { 20, AVI_PAR_16_9, PR_1X, &g_Timing1920x1080_i_a_50 },
     { 31, AVI_PAR_16_9, PR_1X, &g_Timing1920x1080_a_50 },
 };
-DDU32 g_ulSDVOHDMINumSupportedCEModes = sizeof(g_SDVOHDMISupportedCeShortVideoModes) / sizeof(g_SDVOHDMISupportedCeShortVideoModes[0]);
+const DDU32 g_ulSDVOHDMINumSupportedCEModes = sizeof(g_SDVOHDMISupportedCeShortVideoModes) / sizeof(g_SDVOHDMISupportedCeShortVideoModes[0]);
 
 /////////////////////////////////////////////////////////////////////////
 //  CE-861G Supported Short Video Descriptors Table
@@ -3821,7 +3821,7 @@ DDU32 g_ulSDVOHDMINumSupportedCEModes = sizeof(g_SDVOHDMISupportedCeShortVideoMo
 //    Ref : CE-Extension Spec
 /////////////////////////////////////////////////////////////////////////
 
-CE_SHORT_VIDEO_MODE g_SupportedCeShortVideoModes[] = {
+const CE_SHORT_VIDEO_MODE g_SupportedCeShortVideoModes[] = {
     { 0, AVI_PAR_NODATA, PR_1X, NULL }, // No Timing for DMT ID 0, added so that it helps to get  required Timing just using it as table index
     { 1, AVI_PAR_4_3, PR_1X, &g_Timing640x480p_60 },
     { 2, AVI_PAR_4_3, PR_1X, &g_Timing720x480_60 },
@@ -3980,7 +3980,11 @@ CE_SHORT_VIDEO_MODE g_SupportedCeShortVideoModes[] = {
     { 219, AVI_PAR_NODATA, PR_1X, &g_Timing4096x2160_p_120 },
 
 };
-DDU32 g_ulNumSupportedCEModes = sizeof(g_SupportedCeShortVideoModes) / sizeof(g_SupportedCeShortVideoModes[0]);
+const DDU32 g_ulNumSupportedCEModes = sizeof(g_SupportedCeShortVideoModes) / sizeof(g_SupportedCeShortVideoModes[0]);
+
+// One row per VIC upto MAX_CE_VICID in VIC order, so every VIC is reachable with a byte index (see g_CeSvdToVicTableIndex)
+C_ASSERT((sizeof(g_SupportedCeShortVideoModes) / sizeof(g_SupportedCeShortVideoModes[0])) == CE_VIC_TABLE_SIZE);
+C_ASSERT(CE_VIC_TABLE_SIZE <= 256);
 
 /////////////////////////////////////////////////////////////////////////
 // HDMI VIC table
@@ -3990,7 +3994,7 @@ DDU32 g_ulNumSupportedCEModes = sizeof(g_SupportedCeShortVideoModes) / sizeof(g_
 // Since there is no VIC ID defined for these, making the VIC IDs of these timings same as SVD VICs.
 // This is used to skip adding these modes as SVD modes are of higher priority and don't want to override those here
 /////////////////////////////////////////////////////////////////////////
-CE_SHORT_VIDEO_MODE g_4kx2kModes[] = {
+const CE_SHORT_VIDEO_MODE g_4kx2kModes[] = {
     { 0, AVI_PAR_NODATA, PR_1X, NULL }, // No Timing for DMT ID 0, added so that it helps to get   required Timing just using it as table index
     { 95, AVI_PAR_16_9, PR_1X, &g_Timing3840x2160_p_30 },
     { 94, AVI_PAR_16_9, PR_1X, &g_Timing3840x2160_p_25 },
@@ -3998,7 +4002,7 @@ CE_SHORT_VIDEO_MODE g_4kx2kModes[] = {
     { 98, AVI_PAR_16_9, PR_1X, &g_Timing4096x2160_p_24 },
 };
 
-DDU32 g_ulNum4kx2kModes = sizeof(g_4kx2kModes) / sizeof(g_4kx2kModes[0]);
+const DDU32 g_ulNum4kx2kModes = sizeof(g_4kx2kModes) / sizeof(g_4kx2kModes[0]);
 /////////////////////////////////////////////////////////////////////////
 //
 // Underscan mode support array
@@ -4006,11 +4010,11 @@ DDU32 g_ulNum4kx2kModes = sizeof(g_4kx2kModes) / sizeof(g_4kx2kModes[0]);
 // the underscan mode which need to be enumerated.
 //
 /////////////////////////////////////////////////////////////////////////
-UNDER_SCAN_MODE g_UnderScanModes[] = {
+const UNDER_SCAN_MODE g_UnderScanModes[] = {
     { 1280, 720, 1184, 666 },  // 1280 x 720 mode
     { 1920, 1080, 1776, 1000 } // 1920 x 1080 mode
 };
-DDU32 g_ulNumUnderScanModes = sizeof(g_UnderScanModes) / sizeof(g_UnderScanModes[0]);
+const DDU32 g_ulNumUnderScanModes = sizeof(g_UnderScanModes) / sizeof(g_UnderScanModes[0]);
 
 //////////////////////////////////////////
 //
@@ -4019,172 +4023,10 @@ DDU32 g_ulNumUnderScanModes = sizeof(g_UnderScanModes) / sizeof(g_UnderScanModes
 //////////////////////////////////////////
 // #define ALLCOLOR_BPP_MASK 0x1F  // Should be same as in modeentry.h
 #define WINDOWS_COLOR_MASK 0x1E // doesn't have 4bpp
-STATIC_MODE_TABLE g_StaticModeTable[] = {
-    //{640,480, 0, ALLCOLOR_BPP_MASK, &g_TimingVGA_Mode3_640x480_60,0xFF},
-    { 320, 200, 0, WINDOWS_COLOR_MASK, &g_Timing640x400_70, 0xFF },
-    { 320, 240, 70, WINDOWS_COLOR_MASK, &g_Timing640x400_70, 0xFF },
-    { 400, 300, 70, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 512, 384, 70, WINDOWS_COLOR_MASK, &g_Timing1024x768_70, 0xFF },
-    //{640,350, 0, WINDOWS_COLOR_MASK, &g_Timing640x350_85,0xFF},
-    { 640, 400, 70, WINDOWS_COLOR_MASK, &g_Timing640x400_70, 0xFF },
-    //{640,400, 0, WINDOWS_COLOR_MASK, &g_Timing640x400_85,0xFF},
-    //{720,400, 0, WINDOWS_COLOR_MASK, &g_Timing720x400_85,0xFF},
-
-    { 640, 480, 60, WINDOWS_COLOR_MASK, &g_Timing640x480_60, 0xFF },
-    { 640, 480, 70, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 640, 480, 72, WINDOWS_COLOR_MASK, &g_Timing640x480_72, 0xFF },
-    { 640, 480, 75, WINDOWS_COLOR_MASK, &g_Timing640x480_75, 0xFF },
-    { 640, 480, 85, WINDOWS_COLOR_MASK, &g_Timing640x480_85, 0xFF },
-    { 640, 480, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 640, 480, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    //{ 800,600, 0, WINDOWS_COLOR_MASK, &g_Timing800x600_56,0xFF},
-    { 800, 600, 60, WINDOWS_COLOR_MASK, &g_Timing800x600_60, 0xFF },
-    //{ 800,600, 70, WINDOWS_COLOR_MASK, NULL,0xFF},
-    { 800, 600, 72, WINDOWS_COLOR_MASK, &g_Timing800x600_72, 0xFF },
-    { 800, 600, 75, WINDOWS_COLOR_MASK, &g_Timing800x600_75, 0xFF },
-    { 800, 600, 85, WINDOWS_COLOR_MASK, &g_Timing800x600_85, 0xFF },
-    { 800, 600, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 800, 600, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    //{ 848,480, 0, WINDOWS_COLOR_MASK, &g_Timing848x480_60,0xFF},
-
-    //{1024,768, 0, WINDOWS_COLOR_MASK, &g_Timing1024x768_43i,0xFF},
-    { 1024, 768, 60, WINDOWS_COLOR_MASK, &g_Timing1024x768_60, 0xFF },
-    { 1024, 768, 70, WINDOWS_COLOR_MASK, &g_Timing1024x768_70, 0xFF },
-    { 1024, 768, 75, WINDOWS_COLOR_MASK, &g_Timing1024x768_75, 0xFF },
-    { 1024, 768, 85, WINDOWS_COLOR_MASK, &g_Timing1024x768_85, 0xFF },
-    { 1024, 768, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1024, 768, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1152, 864, 60, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    //{1152,864, 70, WINDOWS_COLOR_MASK, NULL,0xFF},
-    //{1152,864, 72, WINDOWS_COLOR_MASK, NULL,0xFF},
-    { 1152, 864, 75, WINDOWS_COLOR_MASK, &g_Timing1152x864_75, 0xFF },
-    { 1152, 864, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1152, 864, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1280, 600, 60, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1280, 720, 60, WINDOWS_COLOR_MASK, &g_Timing1280x720_a_60, 0xFF },
-    { 1280, 720, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 720, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 720, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1280, 768, 60, WINDOWS_COLOR_MASK, &g_Timing1280x768_60, 0xFF }, //???? should this be enumerated as GTF/CVT mode
-    { 1280, 768, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 768, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 768, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1280, 800, 60, WINDOWS_COLOR_MASK, &g_Timing1280x800_60, 0xFF },
-    { 1280, 800, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 800, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 800, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1280, 960, 60, WINDOWS_COLOR_MASK, &g_Timing1280x960_60, 0xFF },
-    { 1280, 960, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 960, 85, WINDOWS_COLOR_MASK, &g_Timing1280x960_85, 0xFF },
-    { 1280, 960, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1280, 1024, 60, WINDOWS_COLOR_MASK, &g_Timing1280x1024_60, 0xFF },
-    //{1280,1024, 70, WINDOWS_COLOR_MASK, NULL,0xFF},
-    //{1280,1024, 72, WINDOWS_COLOR_MASK, NULL,0xFF},
-    { 1280, 1024, 75, WINDOWS_COLOR_MASK, &g_Timing1280x1024_75, 0xFF },
-    { 1280, 1024, 85, WINDOWS_COLOR_MASK, &g_Timing1280x1024_85, 0xFF },
-    { 1280, 1024, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1280, 1024, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1360, 768, 60, WINDOWS_COLOR_MASK, &g_Timing1360x768_60, 0xFF },
-    { 1360, 768, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1366, 768, 60, WINDOWS_COLOR_MASK, &g_Timing1366x768_60, 0xFF },
-    { 1366, 768, 60, WINDOWS_COLOR_MASK, &g_Timing1366x768_60rb, 0xFF },
-
-    { 1400, 1050, 60, WINDOWS_COLOR_MASK, &g_Timing1400x1050_60, 0xFF },
-    { 1400, 1050, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1400, 1050, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1400, 1050, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1440, 900, 60, WINDOWS_COLOR_MASK, &g_Timing1440x900_60, 0xFF },
-    { 1440, 900, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1440, 900, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1440, 900, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1600, 900, 60, WINDOWS_COLOR_MASK, &g_Timing1600x900_60rb, 0xFF },
-    { 1600, 900, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1600, 900, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1600, 900, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1600, 900, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1600, 1200, 60, WINDOWS_COLOR_MASK, &g_Timing1600x1200_60, 0xFF },
-    //{1600,1200, 0, WINDOWS_COLOR_MASK, &g_Timing1600x1200_65,0xFF},
-    { 1600, 1200, 70, WINDOWS_COLOR_MASK, &g_Timing1600x1200_70, 0xFF },
-    //{1600,1200, 72, WINDOWS_COLOR_MASK, NULL,0xFF},
-    { 1600, 1200, 75, WINDOWS_COLOR_MASK, &g_Timing1600x1200_75, 0xFF },
-    { 1600, 1200, 85, WINDOWS_COLOR_MASK, &g_Timing1600x1200_85, 0xFF },
-    { 1600, 1200, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1600, 1200, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    // New mode added as part of the DCN 634024
-    { 1680, 1050, 60, WINDOWS_COLOR_MASK, &g_Timing1680x1050_60, 0xFF },
-
-    { 1680, 1050, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1680, 1050, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1680, 1050, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    // Uncommented as part of DCN 634024. To keep in sync with OMP BML
-    { 1792, 1344, 60, WINDOWS_COLOR_MASK, &g_Timing1792x1344_60, 0xFF },
-    { 1792, 1344, 75, WINDOWS_COLOR_MASK, &g_Timing1792x1344_75, 0xFF },
-
-    { 1792, 1344, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1856, 1392, 60, WINDOWS_COLOR_MASK, &g_Timing1856x1392_60, 0xFF },
-    { 1856, 1392, 75, WINDOWS_COLOR_MASK, &g_Timing1856x1392_75, 0xFF },
-
-    { 1856, 1392, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1920, 1080, 60, WINDOWS_COLOR_MASK, &g_Timing1920x1080_a_60, 0xFF },
-    { 1920, 1080, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1920, 1080, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1920, 1080, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1920, 1200, 60, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1920, 1200, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1920, 1200, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1920, 1200, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 1920, 1440, 60, WINDOWS_COLOR_MASK, &g_Timing1920x1440_60, 0xFF },
-    { 1920, 1440, 75, WINDOWS_COLOR_MASK, &g_Timing1920x1440_75, 0xFF },
-    { 1920, 1440, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 1920, 1440, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    // Added as part of DCN 634024. To keep in sync with OMP BML
-    { 1920, 1440, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 2048, 1152, 60, WINDOWS_COLOR_MASK, &g_Timing2048x1152_60rb, 0xFF },
-
-    { 2048, 1536, 60, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 2048, 1536, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    // Following modes are added as part of DCN 634024.
-    // To keep static list in sync with OMP BML
-    // The timings for the modes below will be generated as
-    // part of Standard GTF formula.
-    { 2048, 1536, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 2048, 1536, 100, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 2560, 1600, 60, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 2560, 1600, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 2560, 1600, 85, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 2560, 1600, 120, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    { 2560, 1920, 60, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 2560, 1920, 75, WINDOWS_COLOR_MASK, NULL, 0xFF },
-
-    // Enabled from Ironlake onwards.
-    { 2560, 2048, 60, WINDOWS_COLOR_MASK, NULL, 0xFF },
-    { 2560, 2048, 75, WINDOWS_COLOR_MASK, NULL, 0xFF }
-};
-DDU32 g_ulTotalStaticModes = sizeof(g_StaticModeTable) / sizeof(g_StaticModeTable[0]);
+#define STATIC_MODE_ENTRY(XRes, YRes, RRate, pTiming) { XRes, YRes, RRate, WINDOWS_COLOR_MASK, pTiming, 0xFF },
+#define STATIC_DMT_MODE_ENTRY(XRes, YRes, RRate, Timing) STATIC_MODE_ENTRY(XRes, YRes, RRate, &Timing)
+const STATIC_MODE_TABLE g_StaticModeTable[] = { STATIC_MODE_LIST(STATIC_DMT_MODE_ENTRY, STATIC_MODE_ENTRY) };
+const DDU32 g_ulTotalStaticModes = sizeof(g_StaticModeTable) / sizeof(g_StaticModeTable[0]);
 
 // RCR 1023191 : Support for VESA DisplayID
 
@@ -4205,7 +4047,7 @@ DDU32 g_ulTotalStaticModes = sizeof(g_StaticModeTable) / sizeof(g_StaticModeTabl
 // between.
 //
 //////////////////////////////////////////
-DISPLAYID_DMTID_STANDARD_TIMING g_DisplayID_VESA_DMTModeTable[] = {
+const DISPLAYID_DMTID_STANDARD_TIMING g_DisplayID_VESA_DMTModeTable[] = {
     { 0x00, NULL }, // No Timing for DMT ID 0, added so that it helps to get
     // required Timing just using it as table index
 
@@ -4321,14 +4163,14 @@ DISPLAYID_DMTID_STANDARD_TIMING g_DisplayID_VESA_DMTModeTable[] = {
     { 0x58, NULL },                    // 4096 x 2160 @ 59.94 Hz (RB)
 };
 
-DDU32 g_ulTotalDisplayID_VESA_DMTmodes = sizeof(g_DisplayID_VESA_DMTModeTable) / sizeof(g_DisplayID_VESA_DMTModeTable[0]);
+const DDU32 g_ulTotalDisplayID_VESA_DMTmodes = sizeof(g_DisplayID_VESA_DMTModeTable) / sizeof(g_DisplayID_VESA_DMTModeTable[0]);
 
 /////////////////////////////////////////////////////////////////////////
 //  CE-861D Supported Short Video Descriptors Table
 //    <Index of the entry into the Table><Aspect Ratio><PR Mask><Timing Info >
 //    Ref : CE-Extension Spec
 /////////////////////////////////////////////////////////////////////////
-DISPLAYID_CE_STANDARD_TIMING g_DisplayID_CeStandardTiming[] = {
+const DISPLAYID_CE_STANDARD_TIMING g_DisplayID_CeStandardTiming[] = {
 
     { 0, AVI_PAR_NODATA, NULL }, // No Timing for CEA VIC ID 0, added so that it helps to get
     // required Timing just using it as table index
@@ -4489,7 +4331,7 @@ DISPLAYID_CE_STANDARD_TIMING g_DisplayID_CeStandardTiming[] = {
 { 219, AVI_PAR_NODATA, &g_Timing4096x2160_p_120 },
 
 };
-DDU32 g_ulTotalDisplayID_CEA_modes = sizeof(g_DisplayID_CeStandardTiming) / sizeof(g_DisplayID_CeStandardTiming[0]);
+const DDU32 g_ulTotalDisplayID_CEA_modes = sizeof(g_DisplayID_CeStandardTiming) / sizeof(g_DisplayID_CeStandardTiming[0]);
 
 /////////////////////////////////////////////////////////////////////////
 //
@@ -51,36 +51,36 @@
 //////////////////////////////////////////////
 typedef struct _ESTABLISHED_MODE_TABLE
 {
-    DD_TIMING_INFO* pTimingInfo;
+    const DD_TIMING_INFO* pTimingInfo;
 } ESTABLISHED_MODE_TABLE;
-extern ESTABLISHED_MODE_TABLE g_EstablishedModeTable[];
-extern DDU32 g_ulTotalEstablishedModes;
+extern const ESTABLISHED_MODE_TABLE g_EstablishedModeTable[];
+extern const DDU32 g_ulTotalEstablishedModes;
 
 // Added for ESTABLISHED TIMINGS III BLOCK for EDID 1.4
-extern ESTABLISHED_MODE_TABLE g_EstTiming3ModeTable[];
-extern DDU32 g_ulTotalEstTiming3modes;
+extern const ESTABLISHED_MODE_TABLE g_EstTiming3ModeTable[];
+extern const DDU32 g_ulTotalEstTiming3modes;
 
 // RCR 1023191 : Support for VESA DisplayID
 // Added for DisplayID VESA Standard timings
 typedef struct _DISPLAYID_DMTID_STANDARD_TIMING
 {
     DDU8 DmtIdIndex;
-    DD_TIMING_INFO* pTimingInfo;
+    const DD_TIMING_INFO* pTimingInfo;
 } DISPLAYID_DMTID_STANDARD_TIMING;
 
-extern DISPLAYID_DMTID_STANDARD_TIMING g_DisplayID_VESA_DMTModeTable[];
-extern DDU32 g_ulTotalDisplayID_VESA_DMTmodes;
+extern const DISPLAYID_DMTID_STANDARD_TIMING g_DisplayID_VESA_DMTModeTable[];
+extern const DDU32 g_ulTotalDisplayID_VESA_DMTmodes;
 
 typedef struct _DISPLAYID_CE_STANDARD_TIMING
 {
     DDU8 CEIndex;
     DDU8 AspectRatio;
-    DD_TIMING_INFO* pTimingInfo; // Pointer to mode timing data
+    const DD_TIMING_INFO* pTimingInfo; // Pointer to mode timing data
 } DISPLAYID_CE_STANDARD_TIMING;
 
 #define MAX_DISPLAYID_VICID 62
-extern DISPLAYID_CE_STANDARD_TIMING g_DisplayID_CeStandardTiming[];
-extern DDU32 g_ulTotalDisplayID_CEA_modes;
+extern const DISPLAYID_CE_STANDARD_TIMING g_DisplayID_CeStandardTiming[];
+extern const DDU32 g_ulTotalDisplayID_CEA_modes;
 
 /////////////////////////////////////////////////////
 //
@@ -91,18 +91,22 @@ typedef struct _CE_SHORT_VIDEO_MODE
 {
     DDU8 CEIndex;
     DDU8 AspectRatio;
-    DDU32 PRMask;                // Mask for supported pixel repetition,  ulPRMask = 1 for no-repeated modes
-    DD_TIMING_INFO* pTimingInfo; // Pointer to mode timing data
+    DDU32 PRMask;                      // Mask for supported pixel repetition,  ulPRMask = 1 for no-repeated modes
+    const DD_TIMING_INFO* pTimingInfo; // Pointer to mode timing data
 } CE_SHORT_VIDEO_MODE;
 
-extern CE_SHORT_VIDEO_MODE g_SupportedCeShortVideoModes[];
-extern DDU32 g_ulNumSupportedCEModes;
+// VICs 128 to 192 are forbidden and have no entries, so entries of VIC 193 onwards are at VIC - 65
+#define CE_VIC_TABLE_INDEX(Vic) (((Vic) < 193) ? (Vic) : ((Vic)-65))
+#define CE_VIC_TABLE_SIZE (CE_VIC_TABLE_INDEX(MAX_CE_VICID) + 1)
 
-extern CE_SHORT_VIDEO_MODE g_SDVOHDMISupportedCeShortVideoModes[];
-extern DDU32 g_ulSDVOHDMINumSupportedCEModes;
+extern const CE_SHORT_VIDEO_MODE g_SupportedCeShortVideoModes[CE_VIC_TABLE_SIZE];
+extern const DDU32 g_ulNumSupportedCEModes;
 
-extern CE_SHORT_VIDEO_MODE g_4kx2kModes[];
-extern DDU32 g_ulNum4kx2kModes;
+extern const CE_SHORT_VIDEO_MODE g_SDVOHDMISupportedCeShortVideoModes[];
+extern const DDU32 g_ulSDVOHDMINumSupportedCEModes;
+
+extern const CE_SHORT_VIDEO_MODE g_4kx2kModes[];
+extern const DDU32 g_ulNum4kx2kModes;
 
 /////////////////////////////////////////////////////////////////////////
 //
@@ -118,8 +122,8 @@ typedef struct _UNDER_SCAN_MODE
     DDU32 XUnderScanRes;
     DDU32 YUnderScanRes;
 } UNDER_SCAN_MODE;
-extern UNDER_SCAN_MODE g_UnderScanModes[];
-extern DDU32 g_ulNumUnderScanModes;
+extern const UNDER_SCAN_MODE g_UnderScanModes[];
+extern const DDU32 g_ulNumUnderScanModes;
 //////////////////////////////////////////////
 //
 // Static mode table
@@ -134,12 +138,186 @@ typedef struct _STATIC_MODE_TABLE
     DDU16 YResolution;
     DDU16 RefreshRate; // Note: Will be used only if pTimingInfo is NULL
     DDU8 SupportedColorBPP_Mask;
-    DD_TIMING_INFO* pTimingInfo; // If NULL, ModesManager will create CVT/GTF timings
-    DDU8 AddModeMask;            // RCR 294233: AddModeMask updated based on OEM mode list.
+    const DD_TIMING_INFO* pTimingInfo; // If NULL, ModesManager will create CVT/GTF timings
+    DDU8 AddModeMask;                  // RCR 294233: AddModeMask updated based on OEM mode list.
     // In future this could be used as DisplayMask.
 } STATIC_MODE_TABLE;
-extern STATIC_MODE_TABLE g_StaticModeTable[];
-extern DDU32 g_ulTotalStaticModes;
+extern const STATIC_MODE_TABLE g_StaticModeTable[];
+extern const DDU32 g_ulTotalStaticModes;
+
+//////////////////////////////////////////////
+//
+// Entries of g_StaticModeTable, in order, as
+// DMT(XRes, YRes, RRate, Timing) for the first
+// entry of a resolution that has its own DMT
+// timing, or MODE(XRes, YRes, RRate, pTiming).
+// Standard timings look up DMT entries only.
+//
+//////////////////////////////////////////////
+#define STATIC_MODE_LIST(DMT, MODE) \
+    /* {640,480, 0, ALLCOLOR_BPP_MASK, &g_TimingVGA_Mode3_640x480_60,0xFF}, */                   \
+    MODE(320, 200, 0, &g_Timing640x400_70)                                                       \
+    MODE(320, 240, 70, &g_Timing640x400_70)                                                      \
+    MODE(400, 300, 70, NULL)                                                                     \
+    MODE(512, 384, 70, &g_Timing1024x768_70)                                                     \
+    /* {640,350, 0, WINDOWS_COLOR_MASK, &g_Timing640x350_85,0xFF}, */                            \
+    DMT(640, 400, 70, g_Timing640x400_70)                                                        \
+    /* {640,400, 0, WINDOWS_COLOR_MASK, &g_Timing640x400_85,0xFF}, */                            \
+    /* {720,400, 0, WINDOWS_COLOR_MASK, &g_Timing720x400_85,0xFF}, */                            \
+                                                                                                 \
+    DMT(640, 480, 60, g_Timing640x480_60)                                                        \
+    MODE(640, 480, 70, NULL)                                                                     \
+    DMT(640, 480, 72, g_Timing640x480_72)                                                        \
+    DMT(640, 480, 75, g_Timing640x480_75)                                                        \
+    DMT(640, 480, 85, g_Timing640x480_85)                                                        \
+    MODE(640, 480, 100, NULL)                                                                    \
+    MODE(640, 480, 120, NULL)                                                                    \
+                                                                                                 \
+    /* { 800,600, 0, WINDOWS_COLOR_MASK, &g_Timing800x600_56,0xFF}, */                           \
+    DMT(800, 600, 60, g_Timing800x600_60)                                                        \
+    /* { 800,600, 70, WINDOWS_COLOR_MASK, NULL,0xFF}, */                                         \
+    DMT(800, 600, 72, g_Timing800x600_72)                                                        \
+    DMT(800, 600, 75, g_Timing800x600_75)                                                        \
+    DMT(800, 600, 85, g_Timing800x600_85)                                                        \
+    MODE(800, 600, 100, NULL)                                                                    \
+    MODE(800, 600, 120, NULL)                                                                    \
+    /* { 848,480, 0, WINDOWS_COLOR_MASK, &g_Timing848x480_60,0xFF}, */                           \
+                                                                                                 \
+    /* {1024,768, 0, WINDOWS_COLOR_MASK, &g_Timing1024x768_43i,0xFF}, */                         \
+    DMT(1024, 768, 60, g_Timing1024x768_60)                                                      \
+    DMT(1024, 768, 70, g_Timing1024x768_70)                                                      \
+    DMT(1024, 768, 75, g_Timing1024x768_75)                                                      \
+    DMT(1024, 768, 85, g_Timing1024x768_85)                                                      \
+    MODE(1024, 768, 100, NULL)                                                                   \
+    MODE(1024, 768, 120, NULL)                                                                   \
+                                                                                                 \
+    MODE(1152, 864, 60, NULL)                                                                    \
+    /* {1152,864, 70, WINDOWS_COLOR_MASK, NULL,0xFF}, */                                         \
+    /* {1152,864, 72, WINDOWS_COLOR_MASK, NULL,0xFF}, */                                         \
+    DMT(1152, 864, 75, g_Timing1152x864_75)                                                      \
+    MODE(1152, 864, 85, NULL)                                                                    \
+    MODE(1152, 864, 100, NULL)                                                                   \
+                                                                                                 \
+    MODE(1280, 600, 60, NULL)                                                                    \
+                                                                                                 \
+    DMT(1280, 720, 60, g_Timing1280x720_a_60)                                                    \
+    MODE(1280, 720, 75, NULL)                                                                    \
+    MODE(1280, 720, 85, NULL)                                                                    \
+    MODE(1280, 720, 100, NULL)                                                                   \
+                                                                                                 \
+    DMT(1280, 768, 60, g_Timing1280x768_60) /* ???? should this be enumerated as GTF/CVT mode */ \
+    MODE(1280, 768, 75, NULL)                                                                    \
+    MODE(1280, 768, 85, NULL)                                                                    \
+    MODE(1280, 768, 120, NULL)                                                                   \
+                                                                                                 \
+    DMT(1280, 800, 60, g_Timing1280x800_60)                                                      \
+    MODE(1280, 800, 75, NULL)                                                                    \
+    MODE(1280, 800, 85, NULL)                                                                    \
+    MODE(1280, 800, 120, NULL)                                                                   \
+                                                                                                 \
+    DMT(1280, 960, 60, g_Timing1280x960_60)                                                      \
+    MODE(1280, 960, 75, NULL)                                                                    \
+    DMT(1280, 960, 85, g_Timing1280x960_85)                                                      \
+    MODE(1280, 960, 120, NULL)                                                                   \
+                                                                                                 \
+    DMT(1280, 1024, 60, g_Timing1280x1024_60)                                                    \
+    /* {1280,1024, 70, WINDOWS_COLOR_MASK, NULL,0xFF}, */                                        \
+    /* {1280,1024, 72, WINDOWS_COLOR_MASK, NULL,0xFF}, */                                        \
+    DMT(1280, 1024, 75, g_Timing1280x1024_75)                                                    \
+    DMT(1280, 1024, 85, g_Timing1280x1024_85)                                                    \
+    MODE(1280, 1024, 100, NULL)                                                                  \
+    MODE(1280, 1024, 120, NULL)                                                                  \
+                                                                                                 \
+    DMT(1360, 768, 60, g_Timing1360x768_60)                                                      \
+    MODE(1360, 768, 120, NULL)                                                                   \
+                                                                                                 \
+    DMT(1366, 768, 60, g_Timing1366x768_60)                                                      \
+    MODE(1366, 768, 60, &g_Timing1366x768_60rb)                                                  \
+                                                                                                 \
+    DMT(1400, 1050, 60, g_Timing1400x1050_60)                                                    \
+    MODE(1400, 1050, 75, NULL)                                                                   \
+    MODE(1400, 1050, 85, NULL)                                                                   \
+    MODE(1400, 1050, 120, NULL)                                                                  \
+                                                                                                 \
+    DMT(1440, 900, 60, g_Timing1440x900_60)                                                      \
+    MODE(1440, 900, 75, NULL)                                                                    \
+    MODE(1440, 900, 85, NULL)                                                                    \
+    MODE(1440, 900, 120, NULL)                                                                   \
+                                                                                                 \
+    DMT(1600, 900, 60, g_Timing1600x900_60rb)                                                    \
+    MODE(1600, 900, 75, NULL)                                                                    \
+    MODE(1600, 900, 85, NULL)                                                                    \
+    MODE(1600, 900, 100, NULL)                                                                   \
+    MODE(1600, 900, 120, NULL)                                                                   \
+                                                                                                 \
+    DMT(1600, 1200, 60, g_Timing1600x1200_60)                                                    \
+    /* {1600,1200, 0, WINDOWS_COLOR_MASK, &g_Timing1600x1200_65,0xFF}, */                        \
+    DMT(1600, 1200, 70, g_Timing1600x1200_70)                                                    \
+    /* {1600,1200, 72, WINDOWS_COLOR_MASK, NULL,0xFF}, */                                        \
+    DMT(1600, 1200, 75, g_Timing1600x1200_75)                                                    \
+    DMT(1600, 1200, 85, g_Timing1600x1200_85)                                                    \
+    MODE(1600, 1200, 100, NULL)                                                                  \
+    MODE(1600, 1200, 120, NULL)                                                                  \
+                                                                                                 \
+    /* New mode added as part of the DCN 634024 */                                               \
+    DMT(1680, 1050, 60, g_Timing1680x1050_60)                                                    \
+                                                                                                 \
+    MODE(1680, 1050, 75, NULL)                                                                   \
+    MODE(1680, 1050, 85, NULL)                                                                   \
+    MODE(1680, 1050, 120, NULL)                                                                  \
+                                                                                                 \
+    /* Uncommented as part of DCN 634024. To keep in sync with OMP BML */                        \
+    DMT(1792, 1344, 60, g_Timing1792x1344_60)                                                    \
+    DMT(1792, 1344, 75, g_Timing1792x1344_75)                                                    \
+                                                                                                 \
+    MODE(1792, 1344, 120, NULL)                                                                  \
+                                                                                                 \
+    DMT(1856, 1392, 60, g_Timing1856x1392_60)                                                    \
+    DMT(1856, 1392, 75, g_Timing1856x1392_75)                                                    \
+                                                                                                 \
+    MODE(1856, 1392, 120, NULL)                                                                  \
+                                                                                                 \
+    DMT(1920, 1080, 60, g_Timing1920x1080_a_60)                                                  \
+    MODE(1920, 1080, 75, NULL)                                                                   \
+    MODE(1920, 1080, 85, NULL)                                                                   \
+    MODE(1920, 1080, 100, NULL)                                                                  \
+                                                                                                 \
+    MODE(1920, 1200, 60, NULL)                                                                   \
+    MODE(1920, 1200, 75, NULL)                                                                   \
+    MODE(1920, 1200, 85, NULL)                                                                   \
+    MODE(1920, 1200, 120, NULL)                                                                  \
+                                                                                                 \
+    DMT(1920, 1440, 60, g_Timing1920x1440_60)                                                    \
+    DMT(1920, 1440, 75, g_Timing1920x1440_75)                                                    \
+    MODE(1920, 1440, 85, NULL)                                                                   \
+    MODE(1920, 1440, 120, NULL)                                                                  \
+                                                                                                 \
+    /* Added as part of DCN 634024. To keep in sync with OMP BML */                              \
+    MODE(1920, 1440, 100, NULL)                                                                  \
+                                                                                                 \
+    DMT(2048, 1152, 60, g_Timing2048x1152_60rb)                                                  \
+                                                                                                 \
+    MODE(2048, 1536, 60, NULL)                                                                   \
+    MODE(2048, 1536, 75, NULL)                                                                   \
+                                                                                                 \
+    /* Following modes are added as part of DCN 634024. */                                       \
+    /* To keep static list in sync with OMP BML */                                               \
+    /* The timings for the modes below will be generated as */                                   \
+    /* part of Standard GTF formula. */                                                          \
+    MODE(2048, 1536, 85, NULL)                                                                   \
+    MODE(2048, 1536, 100, NULL)                                                                  \
+                                                                                                 \
+    MODE(2560, 1600, 60, NULL)                                                                   \
+    MODE(2560, 1600, 75, NULL)                                                                   \
+    MODE(2560, 1600, 85, NULL)                                                                   \
+    MODE(2560, 1600, 120, NULL)                                                                  \
+                                                                                                 \
+    MODE(2560, 1920, 60, NULL)                                                                   \
+    MODE(2560, 1920, 75, NULL)                                                                   \
+                                                                                                 \
+    /* Enabled from Ironlake onwards. */                                                         \
+    MODE(2560, 2048, 60, NULL)                                                                   \
+    MODE(2560, 2048, 75, NULL)
 
 //////////////////////////////////////////////
 //
@@ -148,59 +326,64 @@ extern DDU32 g_ulTotalStaticModes;
 // formulae
 //
 //////////////////////////////////////////////
-extern DD_TIMING_INFO g_TimingVGA_Mode3_640x480_60;
-extern DD_TIMING_INFO g_TimingVGA_Mode3_720x400_60;
-extern DD_TIMING_INFO g_Timing640x350_85;
-extern DD_TIMING_INFO g_Timing640x400_70;
-extern DD_TIMING_INFO g_Timing640x400_85;
-extern DD_TIMING_INFO g_Timing640x480_60;
-extern DD_TIMING_INFO g_Timing640x480_72;
-extern DD_TIMING_INFO g_Timing640x480_75;
-extern DD_TIMING_INFO g_Timing640x480_85;
-extern DD_TIMING_INFO g_Timing720x400_85;
-extern DD_TIMING_INFO g_Timing800x600_56;
-extern DD_TIMING_INFO g_Timing800x600_60;
-extern DD_TIMING_INFO g_Timing800x600_72;
-extern DD_TIMING_INFO g_Timing800x600_75;
-extern DD_TIMING_INFO g_Timing800x600_85;
-extern DD_TIMING_INFO g_Timing848x480_60;
-extern DD_TIMING_INFO g_Timing1024x768_60;
-extern DD_TIMING_INFO g_Timing1024x768_70;
-extern DD_TIMING_INFO g_Timing1024x768_75;
-extern DD_TIMING_INFO g_Timing1024x768_85;
-extern DD_TIMING_INFO g_Timing1152x864_75;
-extern DD_TIMING_INFO g_Timing1280x960_60;
-extern DD_TIMING_INFO g_Timing1280x960_85;
-extern DD_TIMING_INFO g_Timing1280x1024_60;
-extern DD_TIMING_INFO g_Timing1280x1024_75;
-extern DD_TIMING_INFO g_Timing1280x1024_85;
-extern DD_TIMING_INFO g_Timing1360x768_60;
-extern DD_TIMING_INFO g_Timing1366x768_60;
-extern DD_TIMING_INFO g_Timing1366x768_60rb;
-extern DD_TIMING_INFO g_Timing1600x900_60rb;
-extern DD_TIMING_INFO g_Timing1600x1200_60;
-extern DD_TIMING_INFO g_Timing1600x1200_65;
-extern DD_TIMING_INFO g_Timing1600x1200_70;
-extern DD_TIMING_INFO g_Timing1600x1200_75;
-extern DD_TIMING_INFO g_Timing1600x1200_85;
-extern DD_TIMING_INFO g_Timing1792x1344_60;
-extern DD_TIMING_INFO g_Timing1792x1344_75;
-extern DD_TIMING_INFO g_Timing1856x1392_60;
-extern DD_TIMING_INFO g_Timing1856x1392_75;
-extern DD_TIMING_INFO g_Timing1920x1440_60;
-extern DD_TIMING_INFO g_Timing1920x1440_75;
-extern DD_TIMING_INFO g_Timing2560x1600_60;
-extern DD_TIMING_INFO g_Timing2560x1600_75;
-
-extern DD_TIMING_INFO g_Timing720x480_60;
-extern DD_TIMING_INFO g_Timing720x480_a_60;
-extern DD_TIMING_INFO g_Timing1024x768_43i;
-extern DD_TIMING_INFO g_Timing1280x720_a_60;
-extern DD_TIMING_INFO g_Timing1920x1080_i_a_60;
-extern DD_TIMING_INFO g_Timing720x576_50;
-extern DD_TIMING_INFO g_Timing720x576_a_50;
-extern DD_TIMING_INFO g_Timing1280x720_50;
-extern DD_TIMING_INFO g_Timing1920x1080_i_a_50;
-extern DD_TIMING_INFO g_Timing1920x1080_a_50;
-extern DD_TIMING_INFO g_Timing1920x1080_a_60;
-extern DD_TIMING_INFO g_Timing2048x1152_60rb;
+extern const DD_TIMING_INFO g_TimingVGA_Mode3_640x480_60;
+extern const DD_TIMING_INFO g_TimingVGA_Mode3_720x400_60;
+extern const DD_TIMING_INFO g_Timing640x350_85;
+extern const DD_TIMING_INFO g_Timing640x400_70;
+extern const DD_TIMING_INFO g_Timing640x400_85;
+extern const DD_TIMING_INFO g_Timing640x480_60;
+extern const DD_TIMING_INFO g_Timing640x480_72;
+extern const DD_TIMING_INFO g_Timing640x480_75;
+extern const DD_TIMING_INFO g_Timing640x480_85;
+extern const DD_TIMING_INFO g_Timing720x400_85;
+extern const DD_TIMING_INFO g_Timing800x600_56;
+extern const DD_TIMING_INFO g_Timing800x600_60;
+extern const DD_TIMING_INFO g_Timing800x600_72;
+extern const DD_TIMING_INFO g_Timing800x600_75;
+extern const DD_TIMING_INFO g_Timing800x600_85;
+extern const DD_TIMING_INFO g_Timing848x480_60;
+extern const DD_TIMING_INFO g_Timing1024x768_60;
+extern const DD_TIMING_INFO g_Timing1024x768_70;
+extern const DD_TIMING_INFO g_Timing1024x768_75;
+extern const DD_TIMING_INFO g_Timing1024x768_85;
+extern const DD_TIMING_INFO g_Timing1152x864_75;
+extern const DD_TIMING_INFO g_Timing1280x768_60;
+extern const DD_TIMING_INFO g_Timing1280x800_60;
+extern const DD_TIMING_INFO g_Timing1280x960_60;
+extern const DD_TIMING_INFO g_Timing1280x960_85;
+extern const DD_TIMING_INFO g_Timing1280x1024_60;
+extern const DD_TIMING_INFO g_Timing1280x1024_75;
+extern const DD_TIMING_INFO g_Timing1280x1024_85;
+extern const DD_TIMING_INFO g_Timing1360x768_60;
+extern const DD_TIMING_INFO g_Timing1366x768_60;
+extern const DD_TIMING_INFO g_Timing1366x768_60rb;
+extern const DD_TIMING_INFO g_Timing1400x1050_60;
+extern const DD_TIMING_INFO g_Timing1440x900_60;
+extern const DD_TIMING_INFO g_Timing1600x900_60rb;
+extern const DD_TIMING_INFO g_Timing1600x1200_60;
+extern const DD_TIMING_INFO g_Timing1600x1200_65;
+extern const DD_TIMING_INFO g_Timing1600x1200_70;
+extern const DD_TIMING_INFO g_Timing1600x1200_75;
+extern const DD_TIMING_INFO g_Timing1600x1200_85;
+extern const DD_TIMING_INFO g_Timing1680x1050_60;
+extern const DD_TIMING_INFO g_Timing1792x1344_60;
+extern const DD_TIMING_INFO g_Timing1792x1344_75;
+extern const DD_TIMING_INFO g_Timing1856x1392_60;
+extern const DD_TIMING_INFO g_Timing1856x1392_75;
+extern const DD_TIMING_INFO g_Timing1920x1440_60;
+extern const DD_TIMING_INFO g_Timing1920x1440_75;
+extern const DD_TIMING_INFO g_Timing2560x1600_60;
+extern const DD_TIMING_INFO g_Timing2560x1600_75;
+
+extern const DD_TIMING_INFO g_Timing720x480_60;
+extern const DD_TIMING_INFO g_Timing720x480_a_60;
+extern const DD_TIMING_INFO g_Timing1024x768_43i;
+extern const DD_TIMING_INFO g_Timing1280x720_a_60;
+extern const DD_TIMING_INFO g_Timing1920x1080_i_a_60;
+extern const DD_TIMING_INFO g_Timing720x576_50;
+extern const DD_TIMING_INFO g_Timing720x576_a_50;
+extern const DD_TIMING_INFO g_Timing1280x720_50;
+extern const DD_TIMING_INFO g_Timing1920x1080_i_a_50;
+extern const DD_TIMING_INFO g_Timing1920x1080_a_50;
+extern const DD_TIMING_INFO g_Timing1920x1080_a_60;
+extern const DD_TIMING_INFO g_Timing2048x1152_60rb;
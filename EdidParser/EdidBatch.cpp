@@ -0,0 +1,593 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+#include "EdidBatch.h"
+#include "EdidLinkPlanners.h"
+#include "EdidOutputWriters.h"
+
+// Worker threads used without --threads. Stays at 1 until --bench-batch-scaling has been run on multi-core hardware,
+// see README.md.
+#define BATCH_DEFAULT_THREADS 1
+
+/**
+ * @brief Splits a file of packed EDIDs into records.
+ *
+ *  Each record is a base block followed by the number of extension blocks given in its byte 126.
+ *  Blocks not starting with the EDID header are skipped until the next base block. A last record cut short of the
+ *  blocks its extension count asks for is dropped and counted as skipped.
+ * @param  pData
+ * @param  SizeInBytes
+ * @param  FileIndex
+ * @param  Records
+ * @return size_t number of bytes skipped
+ */
+size_t splitEdidRecords(const DDU8* pData, size_t SizeInBytes, uint32_t FileIndex, std::vector<EDID_RECORD>& Records)
+{
+    size_t Offset = 0;
+    size_t RecordSize;
+    size_t Skipped = 0;
+    uint32_t RecordInFile = 0;
+
+    while (Offset + EDID_BLOCK_SIZE <= SizeInBytes)
+    {
+        if (0 != memcmp(BaseEdidHeader, pData + Offset, EDID_HEADER_SIZE))
+        {
+            Offset += EDID_BLOCK_SIZE;
+            Skipped += EDID_BLOCK_SIZE;
+            continue;
+        }
+
+        RecordSize = (static_cast<size_t>(pData[Offset + 126]) + 1) * EDID_BLOCK_SIZE;
+        if (RecordSize > SizeInBytes - Offset)
+        {
+            break;
+        }
+        Records.push_back({ FileIndex, RecordInFile++, Offset, RecordSize });
+        Offset += RecordSize;
+    }
+
+    return Skipped + (SizeInBytes - Offset);
+}
+
+/**
+ * @brief File name extension of per input outputs.
+ *
+ * @param  Format
+ * @return const char*
+ */
+static const char* outputExtension(OUTPUT_FORMAT Format)
+{
+    switch (Format)
+    {
+    case OUTPUT_FORMAT_BIN:
+        return ".edidbin";
+    case OUTPUT_FORMAT_NDJSON:
+        return ".json";
+    case OUTPUT_FORMAT_VALIDATE:
+        return ".txt";
+    case OUTPUT_FORMAT_XML:
+    default:
+        return ".xml";
+    }
+}
+
+/**
+ * @brief Takes next chunk for a worker, from its own queue or else stolen from another worker.
+ *
+ *  Both owner and thief take the lowest chunk in a queue, so chunks finish close to input order
+ *  and only a few chunks wait in PendingOutput.
+ * @param  pRun
+ * @param  WorkerIndex
+ * @param  pChunk
+ * @return bool false if no work is left
+ */
+static bool batchGetChunk(BATCH_RUN* pRun, uint32_t WorkerIndex, uint32_t* pChunk)
+{
+    for (uint32_t Count = 0; Count < pRun->NumWorkers; Count++)
+    {
+        BATCH_WORK_QUEUE* pQueue = &pRun->pQueues[(WorkerIndex + Count) % pRun->NumWorkers];
+        std::lock_guard<std::mutex> Guard(pQueue->Lock);
+
+        if (!pQueue->Chunks.empty())
+        {
+            *pChunk = pQueue->Chunks.front();
+            pQueue->Chunks.pop_front();
+            if (Count != 0)
+            {
+                pRun->NumSteals++;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Writes concat output of a chunk, or holds it until all earlier chunks are written.
+ *
+ * @param  pRun
+ * @param  Chunk
+ * @param  Output
+ * @return void
+ */
+static void batchCommitChunk(BATCH_RUN* pRun, uint32_t Chunk, std::string&& Output)
+{
+    std::lock_guard<std::mutex> Guard(pRun->OutputLock);
+
+    if (Chunk != pRun->NextChunkToWrite)
+    {
+        pRun->PendingOutput.emplace(Chunk, std::move(Output));
+        return;
+    }
+
+    *pRun->pConcatFile << Output;
+    pRun->NextChunkToWrite++;
+
+    for (auto Pending = pRun->PendingOutput.find(pRun->NextChunkToWrite); Pending != pRun->PendingOutput.end();
+         Pending = pRun->PendingOutput.find(pRun->NextChunkToWrite))
+    {
+        *pRun->pConcatFile << Pending->second;
+        pRun->PendingOutput.erase(Pending);
+        pRun->NextChunkToWrite++;
+    }
+
+    // Hand completed chunks to readers of a pipe right away instead of when the stream buffer fills up
+    pRun->pConcatFile->flush();
+}
+
+/**
+ * @brief Batch worker thread, parses chunks with its own parse session until no work is left.
+ *
+ * @param  pRun
+ * @param  WorkerIndex
+ * @return void
+ */
+static void batchWorker(BATCH_RUN* pRun, uint32_t WorkerIndex)
+{
+    namespace fs = std::filesystem;
+    const std::vector<std::string>& Files = *pRun->pFiles;
+    EDID_PARSE_SESSION* pSession = nullptr;
+    std::unique_ptr<DD_VALIDATE_EDID_BLOCKS> pValidateBlocks;
+    EDID_MAPPED_FILE MappedFile;
+    OUTPUT_WRITER Writer;
+    std::vector<HDMI_LINK_BUDGET_RESULT> HdmiBudgets;
+    std::string Source;
+    uint32_t Chunk;
+
+    // Validation only runs the block checks, no mode table is needed
+    if (OUTPUT_FORMAT_VALIDATE == pRun->Format)
+    {
+        pValidateBlocks.reset(new DD_VALIDATE_EDID_BLOCKS);
+    }
+    else
+    {
+        pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+        if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+        {
+            // Chunks of this worker are stolen by others
+            DD_SAFE_FREE(pSession);
+            return;
+        }
+    }
+    Writer.Buffer.reserve(OUTPUT_WRITER_RESERVE_SIZE);
+
+    while (batchGetChunk(pRun, WorkerIndex, &Chunk))
+    {
+        uint32_t First = Chunk * BATCH_CHUNK_SIZE;
+        uint32_t Last = std::min<uint32_t>(First + BATCH_CHUNK_SIZE, static_cast<uint32_t>(pRun->Records.size()));
+
+        // With --concat the writer collects the whole chunk
+        Writer.Buffer.clear();
+        for (uint32_t Index = First; Index < Last; Index++)
+        {
+            const EDID_RECORD& Record = pRun->Records[Index];
+            DD_BOOL IsValid = TRUE;
+            DDSTATUS Status;
+
+            if (pRun->MappedFiles.empty())
+            {
+                if (!mapEdidFile(Files[Record.FileIndex], &MappedFile))
+                {
+                    continue;
+                }
+                Source = Files[Record.FileIndex];
+            }
+            else
+            {
+                MappedFile.pData = pRun->MappedFiles[Record.FileIndex].pData + Record.Offset;
+                MappedFile.SizeInBytes = Record.SizeInBytes;
+                Source = Files[Record.FileIndex] + "#" + std::to_string(Record.RecordInFile);
+            }
+
+            if (NULL == pRun->pConcatFile)
+            {
+                Writer.Buffer.clear();
+            }
+
+            if (OUTPUT_FORMAT_VALIDATE == pRun->Format)
+            {
+                pValidateBlocks->pEdidOrDisplayIDBuf = MappedFile.pData;
+                pValidateBlocks->BufSizeInBytes = static_cast<DDU32>(std::min<size_t>(MappedFile.SizeInBytes, UINT32_MAX));
+                Status = DisplayInfoParserValidateEdidOrDisplayId(pValidateBlocks.get());
+                if (DDS_INVALID_PARAM != Status)
+                {
+                    // Report of an invalid EDID is written as well, the EDID only counts as failed
+                    writeValidateReport(pValidateBlocks.get(), Status, pRun->pConcatFile ? Source.c_str() : nullptr, &Writer);
+                    IsValid = IS_DDSTATUS_SUCCESS(Status) ? TRUE : FALSE;
+                    Status = DDS_SUCCESS;
+                }
+            }
+            else
+            {
+                if (NULL != pRun->pCache)
+                {
+                    Status = parseEdidCached(pRun->pCache, pSession, MappedFile.pData, MappedFile.SizeInBytes);
+                }
+                else
+                {
+                    Status = parseEdid(pSession, MappedFile.pData, MappedFile.SizeInBytes);
+                }
+
+                if (IS_DDSTATUS_SUCCESS(Status) && pRun->IsHdmiBudget)
+                {
+                    computeHdmiLinkBudgets(pSession, HdmiBudgets);
+                }
+
+                if (IS_DDSTATUS_SUCCESS(Status))
+                {
+                    const HDMI_LINK_BUDGET_RESULT* pHdmiBudgets = pRun->IsHdmiBudget ? HdmiBudgets.data() : nullptr;
+                    DDU32 NumHdmiBudgets = pRun->IsHdmiBudget ? static_cast<DDU32>(HdmiBudgets.size()) : 0;
+
+                    switch (pRun->Format)
+                    {
+                    case OUTPUT_FORMAT_BIN:
+                        writeBinEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, &Writer.Buffer);
+                        break;
+                    case OUTPUT_FORMAT_NDJSON:
+                        writeJsonEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, pHdmiBudgets, NumHdmiBudgets, pRun->pConcatFile ? Source.c_str() : nullptr, &Writer);
+                        break;
+                    default:
+                        if (NULL == pRun->pConcatFile)
+                        {
+                            writerPut(&Writer, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n\n");
+                        }
+                        writeXmlEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, pHdmiBudgets, NumHdmiBudgets, pRun->pConcatFile ? Source.c_str() : nullptr, &Writer);
+                        break;
+                    }
+                }
+            }
+            if (pRun->MappedFiles.empty())
+            {
+                unmapEdidFile(&MappedFile);
+            }
+            if (IS_DDSTATUS_ERROR(Status))
+            {
+                continue;
+            }
+
+            if (NULL == pRun->pConcatFile)
+            {
+                std::string OutName = pRun->OutNames[Record.FileIndex];
+
+                if (!pRun->MappedFiles.empty())
+                {
+                    OutName += "." + std::to_string(Record.RecordInFile);
+                }
+                if (!writeOutputFile((fs::path(pRun->OutDir) / (OutName + outputExtension(pRun->Format))).string(), Writer.Buffer))
+                {
+                    continue;
+                }
+            }
+            pRun->IsParsed[Index] = IsValid;
+        }
+
+        if (pRun->pConcatFile)
+        {
+            batchCommitChunk(pRun, Chunk, std::move(Writer.Buffer));
+            // Buffer is only taken over if the chunk has to wait for earlier ones
+            if (Writer.Buffer.capacity() < OUTPUT_WRITER_RESERVE_SIZE)
+            {
+                Writer.Buffer.reserve(OUTPUT_WRITER_RESERVE_SIZE);
+            }
+        }
+    }
+
+    if (NULL != pSession)
+    {
+        parseSessionFree(pSession);
+        DD_SAFE_FREE(pSession);
+    }
+}
+
+/**
+ * @brief Parses all records of a batch run on worker threads and waits for them.
+ *
+ *  Fewer workers than asked for are started if there are not enough chunks, NumWorkers of the run is the count used.
+ * @param  pRun records, inputs and outputs set up by caller
+ * @param  NumThreads
+ * @return double seconds taken by the workers
+ */
+double runBatchWorkers(BATCH_RUN* pRun, uint32_t NumThreads)
+{
+    std::vector<std::thread> Workers;
+    uint32_t NumChunks;
+
+    // Deal chunks round robin, so each worker starts with inputs spread over the whole list
+    NumChunks = static_cast<uint32_t>((pRun->Records.size() + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE);
+    NumThreads = std::min(NumThreads, std::max(1u, NumChunks));
+    pRun->NumWorkers = NumThreads;
+    pRun->pQueues.reset(new BATCH_WORK_QUEUE[NumThreads]);
+    for (uint32_t Chunk = 0; Chunk < NumChunks; Chunk++)
+    {
+        pRun->pQueues[Chunk % NumThreads].Chunks.push_back(Chunk);
+    }
+    pRun->IsParsed.assign(pRun->Records.size(), FALSE);
+    pRun->NumSteals = 0;
+    pRun->NextChunkToWrite = 0;
+    pRun->PendingOutput.clear();
+
+    auto StartTime = std::chrono::steady_clock::now();
+
+    for (uint32_t WorkerIndex = 0; WorkerIndex < NumThreads; WorkerIndex++)
+    {
+        Workers.emplace_back(batchWorker, pRun, WorkerIndex);
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+/**
+ * @brief Batch mode, parses every EDID of the input in this process.
+ *
+ *  EdidParser --batch <dir|glob|manifest> [--out-dir <dir> | --concat <file>] [--threads <n>] [--packed]
+ *              [--format <xml|bin|ndjson> | --validate] [--hdmi-budget] [--cache <entries>] [--cache-dir <dir>]
+ *  Writes <out-dir>/<input file name>.xml per EDID (current directory by default), or with --concat a single
+ *  <EDIDS> document holding the <EDID> element of every input in input order. Inputs are parsed by n worker
+ *  threads (1 by default, see BATCH_DEFAULT_THREADS), each with its own parse session. Throughput is reported at the end.
+ *  With --packed every input is a dump of back to back EDIDs, split using the extension count of each base block.
+ *  Outputs are then named <input file name>.<record>.xml and Source is <input>#<record>.
+ *  Inputs sharing a file name get their input index appended, e.g. <input file name>.<index>.xml.
+ *  With --format bin outputs are binary records (EdidBinaryFormat.h) named <input file name>.edidbin, --concat
+ *  then writes the records back to back in input order.
+ *  With --format ndjson outputs are one line JSON objects named <input file name>.json, --concat then writes one
+ *  line per EDID in input order. "--concat -" writes to stdout, as soon as chunks complete, so that large batches
+ *  can be piped. The summary then goes to stderr.
+ *  With --hdmi-budget XML and NDJSON outputs also hold the HDMI link budget of every mode, as --hdmi-budget computes
+ *  it with its defaults: an <HdmiLinkBudget> element after the modes, or an HdmiLinkBudget array.
+ *  With --validate EDIDs are not parsed, only their blocks are checked (DisplayInfoParserValidateEdidOrDisplayId)
+ *  and a block status report (see writeValidateReport) is written per input as <input file name>.txt, or with
+ *  --concat for all inputs in input order. Invalid EDIDs count as failed.
+ *  With --cache results are kept in memory, up to the given number of EDIDs (least recently used are evicted), and
+ *  an EDID seen before is not parsed again. --cache-dir adds an on-disk tier with one file per EDID in the directory,
+ *  kept across runs. Cache counters are reported with the summary.
+ * @param  argc
+ * @param  argv
+ * @return int 0 if all EDIDs were parsed
+ */
+int runBatch(int argc, char* argv[])
+{
+    BATCH_RUN Run;
+    PARSE_CACHE Cache;
+    bool IsCached = false;
+    std::vector<std::string> Files;
+    std::ofstream concatFile;
+    std::string Input;
+    std::string ConcatPath;
+    bool IsPacked = false;
+    uint32_t NumThreads = BATCH_DEFAULT_THREADS;
+    uint32_t NumParsed = 0;
+    uint32_t NumFailed = 0;
+
+    Run.OutDir = ".";
+    Run.Format = OUTPUT_FORMAT_XML;
+    Run.IsHdmiBudget = false;
+    Cache.MaxEntries = PARSE_CACHE_DEFAULT_ENTRIES;
+    Cache.NumHits = 0;
+    Cache.NumDiskHits = 0;
+    Cache.NumMisses = 0;
+    Cache.NumEvictions = 0;
+    for (int Arg = 1; Arg < argc; Arg++)
+    {
+        std::string Option = argv[Arg];
+
+        if ((Option == "--batch") && (Arg + 1 < argc))
+        {
+            Input = argv[++Arg];
+        }
+        else if ((Option == "--out-dir") && (Arg + 1 < argc))
+        {
+            Run.OutDir = argv[++Arg];
+        }
+        else if ((Option == "--concat") && (Arg + 1 < argc))
+        {
+            ConcatPath = argv[++Arg];
+        }
+        else if ((Option == "--threads") && (Arg + 1 < argc) && (atoi(argv[Arg + 1]) > 0))
+        {
+            NumThreads = static_cast<uint32_t>(atoi(argv[++Arg]));
+        }
+        else if (Option == "--packed")
+        {
+            IsPacked = true;
+        }
+        else if (Option == "--validate")
+        {
+            Run.Format = OUTPUT_FORMAT_VALIDATE;
+        }
+        else if (Option == "--hdmi-budget")
+        {
+            Run.IsHdmiBudget = true;
+        }
+        else if ((Option == "--cache") && (Arg + 1 < argc) && (atoi(argv[Arg + 1]) > 0))
+        {
+            IsCached = true;
+            Cache.MaxEntries = static_cast<uint32_t>(atoi(argv[++Arg]));
+        }
+        else if ((Option == "--cache-dir") && (Arg + 1 < argc))
+        {
+            IsCached = true;
+            Cache.DiskDir = argv[++Arg];
+        }
+        else if ((Option == "--format") && (Arg + 1 < argc) && (0 == strcmp(argv[Arg + 1], "xml")))
+        {
+            Run.Format = OUTPUT_FORMAT_XML;
+            Arg++;
+        }
+        else if ((Option == "--format") && (Arg + 1 < argc) && (0 == strcmp(argv[Arg + 1], "bin")))
+        {
+            Run.Format = OUTPUT_FORMAT_BIN;
+            Arg++;
+        }
+        else if ((Option == "--format") && (Arg + 1 < argc) && (0 == strcmp(argv[Arg + 1], "ndjson")))
+        {
+            Run.Format = OUTPUT_FORMAT_NDJSON;
+            Arg++;
+        }
+        else
+        {
+            std::cerr << "Usage: EdidParser --batch <dir|glob|manifest> [--out-dir <dir> | --concat <file>] [--threads <n>] [--packed] [--format <xml|bin|ndjson> | --validate] [--hdmi-budget] [--cache <entries>] [--cache-dir <dir>]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (Run.IsHdmiBudget && (OUTPUT_FORMAT_XML != Run.Format) && (OUTPUT_FORMAT_NDJSON != Run.Format))
+    {
+        std::cerr << "--hdmi-budget needs --format xml or ndjson" << std::endl;
+        return 1;
+    }
+
+    if (Input.empty() || !collectBatchInputs(Input, Files))
+    {
+        std::cerr << "Unable to read batch input " << Input << std::endl;
+        return 1;
+    }
+
+    Run.pCache = IsCached ? &Cache : nullptr;
+    if (!Cache.DiskDir.empty())
+    {
+        std::error_code Error;
+
+        std::filesystem::create_directories(Cache.DiskDir, Error);
+    }
+
+    for (uint32_t FileIndex = 0; FileIndex < Files.size(); FileIndex++)
+    {
+        if (!IsPacked)
+        {
+            Run.Records.push_back({ FileIndex, 0, 0, 0 });
+            continue;
+        }
+
+        EDID_MAPPED_FILE MappedFile = { 0 };
+        size_t Skipped;
+
+        if (!mapEdidFile(Files[FileIndex], &MappedFile))
+        {
+            std::cerr << "Unable to map " << Files[FileIndex] << std::endl;
+        }
+        Run.MappedFiles.push_back(MappedFile);
+
+        Skipped = splitEdidRecords(MappedFile.pData, MappedFile.SizeInBytes, FileIndex, Run.Records);
+        if (Skipped)
+        {
+            std::cerr << "Skipped " << Skipped << " bytes that are not a whole EDID in " << Files[FileIndex] << std::endl;
+        }
+    }
+
+    Run.pConcatFile = nullptr;
+    if (ConcatPath == "-")
+    {
+#ifdef _WIN32
+        // Binary records and line ends must go out unchanged
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        Run.pConcatFile = &std::cout;
+    }
+    else if (!ConcatPath.empty())
+    {
+        concatFile.open(ConcatPath, std::ios::binary);
+        if (!concatFile)
+        {
+            std::cerr << "Unable to create " << ConcatPath << std::endl;
+            return 1;
+        }
+        Run.pConcatFile = &concatFile;
+    }
+    if ((NULL != Run.pConcatFile) && (OUTPUT_FORMAT_XML == Run.Format))
+    {
+        *Run.pConcatFile << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n\n";
+        *Run.pConcatFile << "<EDIDS>" << std::endl;
+    }
+
+    Run.pFiles = &Files;
+    makeBatchOutputNames(Files, Run.OutNames);
+
+    double Seconds = runBatchWorkers(&Run, NumThreads);
+    NumThreads = Run.NumWorkers;
+
+    if ((NULL != Run.pConcatFile) && (OUTPUT_FORMAT_XML == Run.Format))
+    {
+        *Run.pConcatFile << "</EDIDS>" << std::endl;
+    }
+
+    for (size_t Index = 0; Index < Run.Records.size(); Index++)
+    {
+        if (Run.IsParsed[Index])
+        {
+            NumParsed++;
+        }
+        else
+        {
+            std::cerr << ((OUTPUT_FORMAT_VALIDATE == Run.Format) ? "Invalid " : "Failed to parse ") << Files[Run.Records[Index].FileIndex];
+            if (IsPacked)
+            {
+                std::cerr << "#" << Run.Records[Index].RecordInFile;
+            }
+            std::cerr << std::endl;
+            NumFailed++;
+        }
+    }
+
+    for (EDID_MAPPED_FILE& MappedFile : Run.MappedFiles)
+    {
+        unmapEdidFile(&MappedFile);
+    }
+
+    // Keep stdout clean when it carries the output
+    ((&std::cout == Run.pConcatFile) ? std::cerr : std::cout) << ((OUTPUT_FORMAT_VALIDATE == Run.Format) ? "Validated " : "Parsed ") << NumParsed << " EDIDs (" << NumFailed << " failed) in " << Seconds << " s, "
+              << ((Seconds > 0) ? (NumParsed / Seconds) : 0) << " EDIDs/s, " << NumThreads << " threads, "
+              << Run.NumSteals << " chunks stolen" << std::endl;
+    if (NULL != Run.pCache)
+    {
+        ((&std::cout == Run.pConcatFile) ? std::cerr : std::cout) << "Cache: " << Cache.NumHits << " hits, " << Cache.NumDiskHits << " disk hits, "
+                  << Cache.NumMisses << " misses, " << Cache.NumEvictions << " evictions, " << Cache.Entries.size() << " entries" << std::endl;
+    }
+
+    return (0 == NumFailed) ? 0 : 1;
+}
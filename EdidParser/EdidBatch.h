@@ -0,0 +1,93 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidBatch.h
+ * @brief Batch mode, parses many EDIDs on worker threads with work stealing.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "EdidInputFiles.h"
+#include "EdidParseCache.h"
+
+/**
+ * @brief One EDID in batch input, either a whole file or a record in a file of packed EDIDs.
+ */
+typedef struct _EDID_RECORD
+{
+    uint32_t FileIndex;
+    uint32_t RecordInFile;
+    size_t Offset;
+    size_t SizeInBytes; // 0 for a whole file, size is known only once it is mapped
+} EDID_RECORD;
+
+// Number of consecutive inputs handed to a worker at a time
+#define BATCH_CHUNK_SIZE 16
+
+/**
+ * @brief Output format of batch mode.
+ */
+typedef enum _OUTPUT_FORMAT
+{
+    OUTPUT_FORMAT_XML,
+    OUTPUT_FORMAT_BIN,    // Records of EdidBinaryFormat.h
+    OUTPUT_FORMAT_NDJSON, // One JSON object per line
+    OUTPUT_FORMAT_VALIDATE, // Block status report, EDIDs are validated but not parsed
+} OUTPUT_FORMAT;
+
+/**
+ * @brief Chunks of inputs owned by one batch worker, other workers steal from it when their own queue is empty.
+ */
+typedef struct _BATCH_WORK_QUEUE
+{
+    std::mutex Lock;
+    std::deque<uint32_t> Chunks;
+} BATCH_WORK_QUEUE;
+
+/**
+ * @brief State shared by batch workers.
+ */
+typedef struct _BATCH_RUN
+{
+    const std::vector<std::string>* pFiles;
+    std::vector<std::string> OutNames;             // Per file, name of its outputs without extension
+    std::vector<EDID_RECORD> Records;               // Work items, one per file or per packed EDID
+    std::vector<EDID_MAPPED_FILE> MappedFiles;      // Files of packed EDIDs, mapped for the whole run. Empty otherwise
+    std::string OutDir;
+    OUTPUT_FORMAT Format;
+    bool IsHdmiBudget;         // XML and NDJSON outputs get the HDMI link budget of every mode
+    PARSE_CACHE* pCache;       // NULL if every EDID is parsed
+    std::ostream* pConcatFile; // NULL if one output per input is written
+    uint32_t NumWorkers;
+    std::unique_ptr<BATCH_WORK_QUEUE[]> pQueues;
+    std::vector<uint8_t> IsParsed;                  // Per record, written only by the worker that parsed it. With --validate, set if valid
+    std::atomic<uint32_t> NumSteals;
+    std::mutex OutputLock;                          // Protects concat file and below
+    uint32_t NextChunkToWrite;
+    std::map<uint32_t, std::string> PendingOutput; // Concat output of chunks done ahead of NextChunkToWrite
+} BATCH_RUN;
+
+size_t splitEdidRecords(const DDU8* pData, size_t SizeInBytes, uint32_t FileIndex, std::vector<EDID_RECORD>& Records);
+double runBatchWorkers(BATCH_RUN* pRun, uint32_t NumThreads);
+int runBatch(int argc, char* argv[]);
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidBinaryFormat.h
+ * @brief Binary output of EdidParser and its reader.
+ *
+ *  A binary output is a sequence of records, one per EDID, each laid out as
+ *
+ *      EDID_BIN_HEADER | DD_DISPLAY_CAPS | DD_TIMING_INFO[NumTimings] | padding
+ *
+ *  Sections are raw copies of the parser structures, in little endian host layout, starting at
+ *  EDID_BIN_ALIGNMENT aligned offsets. Records are padded to EDID_BIN_ALIGNMENT, so every record of a file
+ *  mapped at a page boundary can be used in place without any parsing step.
+ *
+ *  The reader accepts a record only if caps and timing sizes match the structures it was built with.
+ *  Version is bumped whenever layout of the header changes, new header fields are only appended.
+ *
+ */
+
+#pragma once
+
+#include "DisplayArgsInternal.h"
+
+#define EDID_BIN_SIGNATURE 0x4E424445 // "EDBN"
+#define EDID_BIN_VERSION 1
+#define EDID_BIN_ALIGNMENT 8
+#define EDID_BIN_ALIGN_UP(Size) (((Size) + (EDID_BIN_ALIGNMENT - 1)) & ~((size_t)EDID_BIN_ALIGNMENT - 1))
+
+/**
+ * @brief Header of a binary record. Offsets are from start of the record.
+ */
+typedef struct _EDID_BIN_HEADER
+{
+    DDU32 Signature;         // EDID_BIN_SIGNATURE
+    DDU16 Version;           // EDID_BIN_VERSION
+    DDU16 HeaderSizeInBytes; // sizeof(EDID_BIN_HEADER) of the writer
+    DDU32 RecordSizeInBytes; // Whole record including padding, next record starts here
+    DDU32 CapsOffset;
+    DDU32 CapsSizeInBytes; // sizeof(DD_DISPLAY_CAPS) of the writer
+    DDU32 TimingsOffset;
+    DDU32 TimingSizeInBytes; // sizeof(DD_TIMING_INFO) of the writer
+    DDU32 NumTimings;
+} EDID_BIN_HEADER;
+
+C_ASSERT(sizeof(EDID_BIN_HEADER) == 32);
+C_ASSERT((sizeof(EDID_BIN_HEADER) % EDID_BIN_ALIGNMENT) == 0);
+
+/**
+ * @brief Record of a binary output, pointing into the caller's buffer.
+ */
+typedef struct _EDID_BIN_VIEW
+{
+    const EDID_BIN_HEADER* pHeader;
+    const DD_DISPLAY_CAPS* pCaps;
+    const DD_TIMING_INFO* pTimings;
+    DDU32 NumTimings;
+} EDID_BIN_VIEW;
+
+/**
+ * @brief Validates the record at start of a buffer and fills the view for it.
+ *
+ * @param  pData start of record, EDID_BIN_ALIGNMENT aligned
+ * @param  SizeInBytes bytes available from pData
+ * @param  pView
+ * @return DDSTATUS DDS_BUFFER_TOO_SMALL if record is truncated, DDS_NOT_SUPPORTED if version or structure
+ *         sizes don't match this build, DDS_INVALID_DATA if record is malformed
+ */
+static inline DDSTATUS EdidBinReadRecord(const DDU8* pData, size_t SizeInBytes, EDID_BIN_VIEW* pView)
+{
+    const EDID_BIN_HEADER* pHeader = (const EDID_BIN_HEADER*)pData;
+
+    if ((NULL == pData) || (NULL == pView) || (0 != ((size_t)pData % EDID_BIN_ALIGNMENT)))
+    {
+        return DDS_INVALID_PARAM;
+    }
+
+    if (SizeInBytes < sizeof(EDID_BIN_HEADER))
+    {
+        return DDS_BUFFER_TOO_SMALL;
+    }
+
+    if ((EDID_BIN_SIGNATURE != pHeader->Signature) || (pHeader->HeaderSizeInBytes < sizeof(EDID_BIN_HEADER)))
+    {
+        return DDS_INVALID_DATA;
+    }
+
+    if ((EDID_BIN_VERSION != pHeader->Version) || (sizeof(DD_DISPLAY_CAPS) != pHeader->CapsSizeInBytes) ||
+        (sizeof(DD_TIMING_INFO) != pHeader->TimingSizeInBytes))
+    {
+        return DDS_NOT_SUPPORTED;
+    }
+
+    if (pHeader->RecordSizeInBytes > SizeInBytes)
+    {
+        return DDS_BUFFER_TOO_SMALL;
+    }
+
+    if ((0 != (pHeader->RecordSizeInBytes % EDID_BIN_ALIGNMENT)) || (0 != (pHeader->CapsOffset % EDID_BIN_ALIGNMENT)) ||
+        (0 != (pHeader->TimingsOffset % EDID_BIN_ALIGNMENT)) || (pHeader->CapsOffset < pHeader->HeaderSizeInBytes) ||
+        (pHeader->TimingsOffset < pHeader->HeaderSizeInBytes) || (pHeader->RecordSizeInBytes < pHeader->HeaderSizeInBytes) ||
+        ((DDU64)pHeader->CapsOffset + pHeader->CapsSizeInBytes > pHeader->RecordSizeInBytes) ||
+        ((DDU64)pHeader->TimingsOffset + (DDU64)pHeader->NumTimings * pHeader->TimingSizeInBytes > pHeader->RecordSizeInBytes))
+    {
+        return DDS_INVALID_DATA;
+    }
+
+    pView->pHeader = pHeader;
+    pView->pCaps = (const DD_DISPLAY_CAPS*)(pData + pHeader->CapsOffset);
+    pView->pTimings = (const DD_TIMING_INFO*)(pData + pHeader->TimingsOffset);
+    pView->NumTimings = pHeader->NumTimings;
+
+    return DDS_SUCCESS;
+}
+
+/**
+ * @brief Reads the record at *pOffset of a buffer of back to back records and moves *pOffset past it.
+ *        Callers loop while *pOffset is below SizeInBytes.
+ *
+ * @param  pData start of buffer, EDID_BIN_ALIGNMENT aligned
+ * @param  SizeInBytes
+ * @param  pOffset
+ * @param  pView
+ * @return DDSTATUS see EdidBinReadRecord
+ */
+static inline DDSTATUS EdidBinReadNextRecord(const DDU8* pData, size_t SizeInBytes, size_t* pOffset, EDID_BIN_VIEW* pView)
+{
+    DDSTATUS Status;
+
+    if (*pOffset >= SizeInBytes)
+    {
+        return DDS_BUFFER_TOO_SMALL;
+    }
+
+    Status = EdidBinReadRecord(pData + *pOffset, SizeInBytes - *pOffset, pView);
+    if (IS_DDSTATUS_SUCCESS(Status))
+    {
+        *pOffset += pView->pHeader->RecordSizeInBytes;
+    }
+
+    return Status;
+}
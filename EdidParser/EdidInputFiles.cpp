@@ -0,0 +1,277 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "EdidInputFiles.h"
+
+/**
+ * @brief Matches a file name against a pattern with '*' and '?' wildcards.
+ *
+ * @param  pPattern
+ * @param  pName
+ * @return bool
+ */
+static bool wildcardMatch(const char* pPattern, const char* pName)
+{
+    const char* pStar = nullptr;
+    const char* pStarName = nullptr;
+
+    while (*pName)
+    {
+        if ((*pPattern == '?') || (*pPattern == *pName))
+        {
+            pPattern++;
+            pName++;
+        }
+        else if (*pPattern == '*')
+        {
+            pStar = pPattern++;
+            pStarName = pName;
+        }
+        else if (pStar)
+        {
+            // Let the last '*' eat one more char and retry
+            pPattern = pStar + 1;
+            pName = ++pStarName;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (*pPattern == '*')
+    {
+        pPattern++;
+    }
+
+    return (*pPattern == '\0');
+}
+
+/**
+ * @brief Expands batch input to list of EDID files.
+ *
+ *  Input can be a directory (all files in it), a glob with '*' / '?' in the file name part,
+ *  or a manifest file with one path per line. Empty lines and lines starting with '#' in manifest are skipped.
+ * @param  Input
+ * @param  Files
+ * @return bool false if input can't be read
+ */
+bool collectBatchInputs(const std::string& Input, std::vector<std::string>& Files)
+{
+    namespace fs = std::filesystem;
+    std::error_code Error;
+    fs::path InputPath(Input);
+
+    if (fs::is_directory(InputPath, Error))
+    {
+        for (const fs::directory_entry& Entry : fs::directory_iterator(InputPath, Error))
+        {
+            if (Entry.is_regular_file(Error))
+            {
+                Files.push_back(Entry.path().string());
+            }
+        }
+        std::sort(Files.begin(), Files.end());
+        return !Error;
+    }
+
+    if (Input.find_first_of("*?") != std::string::npos)
+    {
+        std::string Pattern = InputPath.filename().string();
+        fs::path Parent = InputPath.has_parent_path() ? InputPath.parent_path() : fs::path(".");
+
+        for (const fs::directory_entry& Entry : fs::directory_iterator(Parent, Error))
+        {
+            if (Entry.is_regular_file(Error) && wildcardMatch(Pattern.c_str(), Entry.path().filename().string().c_str()))
+            {
+                Files.push_back(Entry.path().string());
+            }
+        }
+        std::sort(Files.begin(), Files.end());
+        return !Error;
+    }
+
+    std::ifstream Manifest(Input);
+    std::string Line;
+
+    if (!Manifest)
+    {
+        return false;
+    }
+
+    while (std::getline(Manifest, Line))
+    {
+        size_t Last = Line.find_last_not_of(" \t\r");
+        size_t First = Line.find_first_not_of(" \t");
+
+        if ((Last == std::string::npos) || (Line[First] == '#'))
+        {
+            continue;
+        }
+        Files.push_back(Line.substr(First, Last - First + 1));
+    }
+
+    return true;
+}
+
+/**
+ * @brief Names the per input outputs of batch mode after the input file names.
+ *
+ *  Inputs from different directories can share a file name (manifests list any paths), those names get
+ *  the input index appended so that their outputs don't overwrite each other. Names are compared ignoring
+ *  ASCII case, as they clash on case insensitive file systems too.
+ * @param  Files
+ * @param  OutNames output file name without extension, per input
+ * @return void
+ */
+void makeBatchOutputNames(const std::vector<std::string>& Files, std::vector<std::string>& OutNames)
+{
+    std::unordered_map<std::string, uint32_t> NumInputsPerName;
+    std::vector<std::string> Keys;
+
+    OutNames.clear();
+    for (const std::string& File : Files)
+    {
+        std::string Name = std::filesystem::path(File).filename().string();
+        std::string Key = Name;
+
+        for (char& Char : Key)
+        {
+            Char = static_cast<char>(tolower(static_cast<unsigned char>(Char)));
+        }
+        NumInputsPerName[Key]++;
+        OutNames.push_back(Name);
+        Keys.push_back(Key);
+    }
+
+    for (size_t FileIndex = 0; FileIndex < Files.size(); FileIndex++)
+    {
+        if (NumInputsPerName[Keys[FileIndex]] > 1)
+        {
+            OutNames[FileIndex] += "." + std::to_string(FileIndex);
+        }
+    }
+}
+
+
+/**
+ * @brief Maps an input file in memory.
+ *
+ *  View is private copy-on-write, so the file is never modified through it and pages are shared until written.
+ *  An empty file is mapped as NULL data with size 0.
+ * @param  Path
+ * @param  pMappedFile
+ * @return bool false if file can't be opened or mapped
+ */
+bool mapEdidFile(const std::string& Path, EDID_MAPPED_FILE* pMappedFile)
+{
+    uint64_t FileSize;
+
+    pMappedFile->pData = nullptr;
+    pMappedFile->SizeInBytes = 0;
+
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    HANDLE hMapping = NULL;
+    LARGE_INTEGER FileSizeInfo;
+
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        return false;
+    }
+
+    if (!GetFileSizeEx(hFile, &FileSizeInfo))
+    {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    FileSize = static_cast<uint64_t>(FileSizeInfo.QuadPart);
+    if (FileSize > 0)
+    {
+        hMapping = CreateFileMappingA(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (NULL != hMapping)
+        {
+            pMappedFile->pData = static_cast<DDU8*>(MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0));
+            // View keeps the mapping alive
+            CloseHandle(hMapping);
+        }
+    }
+    CloseHandle(hFile);
+#else
+    struct stat FileStat;
+    int Fd = open(Path.c_str(), O_RDONLY);
+
+    if (Fd < 0)
+    {
+        return false;
+    }
+
+    if (0 != fstat(Fd, &FileStat))
+    {
+        close(Fd);
+        return false;
+    }
+
+    FileSize = static_cast<uint64_t>(FileStat.st_size);
+    if (FileSize > 0)
+    {
+        void* pView = mmap(NULL, static_cast<size_t>(FileSize), PROT_READ | PROT_WRITE, MAP_PRIVATE, Fd, 0);
+        pMappedFile->pData = (MAP_FAILED == pView) ? nullptr : static_cast<DDU8*>(pView);
+    }
+    close(Fd);
+#endif
+
+    if ((FileSize > 0) && (NULL == pMappedFile->pData))
+    {
+        return false;
+    }
+    pMappedFile->SizeInBytes = static_cast<size_t>(FileSize);
+
+    return true;
+}
+
+/**
+ * @brief
+ *
+ * @param  pMappedFile
+ * @return void
+ */
+void unmapEdidFile(EDID_MAPPED_FILE* pMappedFile)
+{
+    if (pMappedFile->pData)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(pMappedFile->pData);
+#else
+        munmap(pMappedFile->pData, pMappedFile->SizeInBytes);
+#endif
+    }
+    pMappedFile->pData = nullptr;
+    pMappedFile->SizeInBytes = 0;
+}
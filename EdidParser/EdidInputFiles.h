@@ -0,0 +1,39 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidInputFiles.h
+ * @brief Expansion of batch inputs and memory mapped EDID files.
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "DisplayDefs.h"
+
+/**
+ * @brief Input file mapped in memory.
+ */
+typedef struct _EDID_MAPPED_FILE
+{
+    DDU8* pData; // Copy-on-write view, parser gets pointers straight into it
+    size_t SizeInBytes;
+} EDID_MAPPED_FILE;
+
+bool collectBatchInputs(const std::string& Input, std::vector<std::string>& Files);
+void makeBatchOutputNames(const std::vector<std::string>& Files, std::vector<std::string>& OutNames);
+bool mapEdidFile(const std::string& Path, EDID_MAPPED_FILE* pMappedFile);
+void unmapEdidFile(EDID_MAPPED_FILE* pMappedFile);
@@ -0,0 +1,1588 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include "EdidLinkPlanners.h"
+#include "EdidInputFiles.h"
+#include "EdidOutputWriters.h"
+
+/**
+ * @brief Parses a list of positive integers separated by ',' (e.g. "1,2,4").
+ *
+ * @param  pList
+ * @param  Values
+ * @return bool false if the list is empty or has an invalid value
+ */
+static bool parseUintList(const char* pList, std::vector<uint32_t>& Values)
+{
+    const char* pEnd = pList + strlen(pList);
+
+    Values.clear();
+    while (pList < pEnd)
+    {
+        uint32_t Value = 0;
+        std::from_chars_result Result = std::from_chars(pList, pEnd, Value);
+
+        if ((Result.ec != std::errc()) || (0 == Value) || ((Result.ptr != pEnd) && (',' != *Result.ptr)))
+        {
+            return false;
+        }
+        Values.push_back(Value);
+        pList = Result.ptr + 1;
+    }
+
+    return !Values.empty();
+}
+
+/**
+ * @brief Appends a U6.4 bpp in decimal, e.g. 8.0625.
+ *
+ * @param  pWriter
+ * @param  Bppx16
+ * @return void
+ */
+static void writerPutBppx16(OUTPUT_WRITER* pWriter, DDU32 Bppx16)
+{
+    DDU32 Fraction = (Bppx16 & 0xF) * 625; // 1/16 = 0.0625
+
+    writerPutDec(pWriter, Bppx16 >> 4);
+    if (Fraction)
+    {
+        pWriter->Buffer.push_back('.');
+        for (DDU32 Divisor = 1000; Fraction; Divisor /= 10)
+        {
+            pWriter->Buffer.push_back(static_cast<char>('0' + Fraction / Divisor));
+            Fraction %= Divisor;
+        }
+    }
+}
+
+/**
+ * @brief Sweeps DSC configurations of a mode and lists the valid ones.
+ *
+ *  EdidParser --dsc-sweep <width>x<height> [--dsc <1.1|1.2>] [--slices <n1,n2,...>] [--bpc <8,10,12>]
+ *              [--bpp <min>-<max>[/<step>]] [--sampling <rgb|ycbcr444|native422|native420>] [--line-buffer-depth <n>]
+ *              [--min-slice-height <n>] [--max-slice-width <n>] [--threads <n>] [--simd <scalar|sse2|avx2>] [--verify]
+ *              [--out <csv file|->]
+ *  Every (bpc, bpp, slice count, slice height) point is checked with DisplayInfoRoutinesSweepDscCfgs(), bpp in
+ *  steps of 1/16 by default and slice heights being the divisors of the mode height. Defaults are DSC 1.2, slices
+ *  1,2,4,8, bpc 8,10,12, bpp 8-16, RGB, line buffer depth 11 and slice heights from 8. (bpc, bpp) rate points are
+ *  shared out to n worker threads (one per core by default), using the highest SIMD level the CPU supports unless
+ *  --simd lowers it. With --out the valid points are written as CSV in sweep order, "-" for stdout. The summary
+ *  goes to stderr.
+ *  With --verify every grid point is also computed on its own with DisplayInfoRoutinesCreateDscSweepCfg(), and the
+ *  sweep is run again on one thread at every SIMD level the CPU supports. Time per level is reported, and the run
+ *  fails if any level's points differ from the per point ones. The per point path reuses the RC parameter code of
+ *  DisplayInfoRoutinesCreateDscCfg(), so --verify shows the SIMD levels agree with it, not with the DSC C-model.
+ * @param  argc
+ * @param  argv
+ * @return int 0 if the sweep ran, and with --verify matched
+ */
+int runDscSweep(int argc, char* argv[])
+{
+    DD_RX_DSC_CAPS Caps;
+    DSC_CFG_SWEEP_ARGS SweepArgs;
+    std::vector<uint32_t> SliceCounts = { 1, 2, 4, 8 };
+    std::vector<uint32_t> Bpcs = { 8, 10, 12 };
+    std::vector<std::thread> Workers;
+    std::string OutPath;
+    uint32_t NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    DDU32 NumRatePoints, NumSlicePoints;
+    size_t NumPoints = 0;
+    bool IsVerify = false;
+    bool IsMismatch = false;
+    bool IsValid = (argc > 2) && (2 == sscanf(argv[2], "%ux%u", &SweepArgs.PicWidth, &SweepArgs.PicHeight)) && SweepArgs.PicWidth &&
+                   SweepArgs.PicHeight;
+
+    DD_ZERO_MEM(&Caps, sizeof(Caps));
+    Caps.DscMajorVersion = 1;
+    Caps.DscMinorVersion = 2;
+    Caps.LineBufferDepth = 11;
+    Caps.IsBlockPredictionSupported = 1;
+    Caps.ConvertRgb = 1;
+    SweepArgs.pSinkDscDecoderCaps = &Caps;
+    SweepArgs.MinSliceHeight = 8;
+    SweepArgs.MinBppx16 = 8 * 16;
+    SweepArgs.MaxBppx16 = 16 * 16;
+    SweepArgs.BppStepx16 = 1;
+    SweepArgs.SimdLevel = DisplayInfoRoutinesGetSimdLevel();
+
+    for (int Arg = 3; IsValid && (Arg < argc); Arg++)
+    {
+        std::string Option = argv[Arg];
+        const char* pValue = (Arg + 1 < argc) ? argv[Arg + 1] : nullptr;
+        double MinBpp = 0, MaxBpp = 0, StepBpp = 1.0 / 16;
+
+        if (Option == "--verify")
+        {
+            IsVerify = true;
+            continue;
+        }
+        else if (nullptr == pValue)
+        {
+            IsValid = false;
+        }
+        else if ((Option == "--dsc") && ((0 == strcmp(pValue, "1.1")) || (0 == strcmp(pValue, "1.2"))))
+        {
+            Caps.DscMinorVersion = static_cast<DDU8>(pValue[2] - '0');
+        }
+        else if (Option == "--slices")
+        {
+            IsValid = parseUintList(pValue, SliceCounts) && (SliceCounts.size() <= MAX_DSC_SLICES_INDEX);
+        }
+        else if (Option == "--bpc")
+        {
+            IsValid = parseUintList(pValue, Bpcs);
+        }
+        else if (Option == "--bpp")
+        {
+            IsValid = (sscanf(pValue, "%lf-%lf/%lf", &MinBpp, &MaxBpp, &StepBpp) >= 2) && (MinBpp > 0) && (MaxBpp >= MinBpp) && (StepBpp > 0);
+            SweepArgs.MinBppx16 = static_cast<DDU32>(MinBpp * 16 + 0.5);
+            SweepArgs.MaxBppx16 = static_cast<DDU32>(MaxBpp * 16 + 0.5);
+            SweepArgs.BppStepx16 = std::max(1u, static_cast<DDU32>(StepBpp * 16 + 0.5));
+        }
+        else if ((Option == "--sampling") && (0 == strcmp(pValue, "rgb")))
+        {
+            Caps.ConvertRgb = 1;
+        }
+        else if ((Option == "--sampling") && (0 == strcmp(pValue, "ycbcr444")))
+        {
+            Caps.ConvertRgb = 0;
+        }
+        else if ((Option == "--sampling") && (0 == strcmp(pValue, "native422")))
+        {
+            Caps.ConvertRgb = 0;
+            Caps.IsYCbCrNative422Supported = 1;
+        }
+        else if ((Option == "--sampling") && (0 == strcmp(pValue, "native420")))
+        {
+            Caps.ConvertRgb = 0;
+            Caps.IsYCbCrNative420Supported = 1;
+        }
+        else if ((Option == "--line-buffer-depth") && (atoi(pValue) > 0))
+        {
+            Caps.LineBufferDepth = static_cast<DDU8>(atoi(pValue));
+        }
+        else if ((Option == "--min-slice-height") && (atoi(pValue) > 0))
+        {
+            SweepArgs.MinSliceHeight = static_cast<DDU32>(atoi(pValue));
+        }
+        else if ((Option == "--max-slice-width") && (atoi(pValue) > 0))
+        {
+            Caps.DscMaxSliceWidth = static_cast<DDU32>(atoi(pValue));
+        }
+        else if ((Option == "--threads") && (atoi(pValue) > 0))
+        {
+            NumThreads = static_cast<uint32_t>(atoi(pValue));
+        }
+        else if ((Option == "--simd") && (0 == strcmp(pValue, "scalar")))
+        {
+            SweepArgs.SimdLevel = DD_SIMD_LEVEL_SCALAR;
+        }
+        else if ((Option == "--simd") && (0 == strcmp(pValue, "sse2")))
+        {
+            SweepArgs.SimdLevel = DD_SIMD_LEVEL_SSE2;
+        }
+        else if ((Option == "--simd") && (0 == strcmp(pValue, "avx2")))
+        {
+            SweepArgs.SimdLevel = DD_SIMD_LEVEL_AVX2;
+        }
+        else if (Option == "--out")
+        {
+            OutPath = pValue;
+        }
+        else
+        {
+            IsValid = false;
+        }
+        Arg++;
+    }
+
+    for (uint32_t Bpc : Bpcs)
+    {
+        Caps.CompressionBpc.DSC_8BPC_Supported |= (8 == Bpc);
+        Caps.CompressionBpc.DSC_10BPC_Supported |= (10 == Bpc);
+        Caps.CompressionBpc.DSC_12BPC_Supported |= (12 == Bpc);
+        IsValid = IsValid && ((8 == Bpc) || (10 == Bpc) || (12 == Bpc));
+    }
+    for (uint32_t Index = 0; IsValid && (Index < SliceCounts.size()); Index++)
+    {
+        Caps.SupportedSlices[Index] = static_cast<DDU8>(SliceCounts[Index]);
+    }
+
+    if (!IsValid)
+    {
+        std::cerr << "Usage: EdidParser --dsc-sweep <width>x<height> [--dsc <1.1|1.2>] [--slices <n1,n2,...>] [--bpc <8,10,12>]"
+                  << " [--bpp <min>-<max>[/<step>]] [--sampling <rgb|ycbcr444|native422|native420>] [--line-buffer-depth <n>]"
+                  << " [--min-slice-height <n>] [--max-slice-width <n>] [--threads <n>] [--simd <scalar|sse2|avx2>] [--verify] [--out <csv file|->]"
+                  << std::endl;
+        return 1;
+    }
+
+    DisplayInfoRoutinesGetDscSweepSize(&SweepArgs, &NumRatePoints, &NumSlicePoints);
+
+    // Rate points take about the same time, so workers simply claim the next one. Points are kept per rate point
+    // for output in sweep order.
+    std::vector<std::vector<DSC_CFG_SWEEP_POINT>> RatePoints(NumRatePoints);
+    std::atomic<DDU32> NextRatePoint(0);
+
+    auto StartTime = std::chrono::steady_clock::now();
+    NumThreads = std::max(1u, std::min<uint32_t>(NumThreads, NumRatePoints));
+    for (uint32_t WorkerIndex = 0; WorkerIndex < NumThreads; WorkerIndex++)
+    {
+        Workers.emplace_back([&]() {
+            std::vector<DSC_CFG_SWEEP_POINT> Points(NumSlicePoints);
+
+            for (DDU32 RatePoint = NextRatePoint++; RatePoint < NumRatePoints; RatePoint = NextRatePoint++)
+            {
+                DDU32 NumFound = DisplayInfoRoutinesSweepDscCfgs(&SweepArgs, RatePoint, 1, Points.data(), NumSlicePoints);
+
+                RatePoints[RatePoint].assign(Points.begin(), Points.begin() + NumFound);
+            }
+        });
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+    for (const std::vector<DSC_CFG_SWEEP_POINT>& Points : RatePoints)
+    {
+        NumPoints += Points.size();
+    }
+
+    if (!OutPath.empty())
+    {
+        OUTPUT_WRITER Writer;
+
+        Writer.Buffer.reserve(NumPoints * 48 + 128);
+        writerPut(&Writer, "bpc,bpp,slices,slice_width,slice_height,chunk_size,initial_xmit_delay,initial_dec_delay,rcb_bits\n");
+        for (const std::vector<DSC_CFG_SWEEP_POINT>& Points : RatePoints)
+        {
+            for (const DSC_CFG_SWEEP_POINT& Point : Points)
+            {
+                writerPutDec(&Writer, Point.BitsPerComponent);
+                writerPut(&Writer, ",");
+                writerPutBppx16(&Writer, Point.Bppx16);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Point.SliceCount);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Point.SliceWidth);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Point.SliceHeight);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Point.ChunkSize);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Point.InitialXmitDelay);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Point.InitialDecDelay);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Point.RcbBits);
+                writerPut(&Writer, "\n");
+            }
+        }
+
+        if (OutPath == "-")
+        {
+            std::cout.write(Writer.Buffer.data(), Writer.Buffer.size());
+            std::cout.flush();
+        }
+        else if (!writeOutputFile(OutPath, Writer.Buffer))
+        {
+            std::cerr << "Unable to write " << OutPath << std::endl;
+            return 1;
+        }
+    }
+
+    std::cerr << "Swept " << (static_cast<uint64_t>(NumRatePoints) * NumSlicePoints) << " DSC configurations (" << NumRatePoints
+              << " bpc/bpp x " << NumSlicePoints << " slice layouts), " << NumPoints << " valid, in " << (Seconds * 1e3) << " ms with "
+              << NumThreads << " threads" << std::endl;
+
+    if (IsVerify)
+    {
+        static const char* const SimdLevelNames[DD_SIMD_LEVEL_MAX] = { "scalar", "sse2", "avx2" };
+        std::vector<DSC_CFG_SWEEP_POINT> Reference;
+        DSC_CFG_SWEEP_POINT Point;
+        DSC_CFG DscCfg;
+
+        // Same order as the sweep: bpc, bpp, slice count as listed in the caps, then ascending slice height
+        StartTime = std::chrono::steady_clock::now();
+        for (uint32_t Bpc = 8; Bpc <= 12; Bpc += 2)
+        {
+            if (std::find(Bpcs.begin(), Bpcs.end(), Bpc) == Bpcs.end())
+            {
+                continue;
+            }
+            for (DDU32 Bppx16 = SweepArgs.MinBppx16; Bppx16 <= SweepArgs.MaxBppx16; Bppx16 += SweepArgs.BppStepx16)
+            {
+                for (uint32_t SliceCount : SliceCounts)
+                {
+                    if ((0 != Caps.DscMaxSliceWidth) && (DD_ROUND_UP_DIV(SweepArgs.PicWidth, SliceCount) > Caps.DscMaxSliceWidth))
+                    {
+                        continue;
+                    }
+                    for (DDU32 SliceHeight = SweepArgs.MinSliceHeight; SliceHeight <= SweepArgs.PicHeight; SliceHeight++)
+                    {
+                        DD_ZERO_MEM(&Point, sizeof(Point));
+                        Point.BitsPerComponent = Bpc;
+                        Point.Bppx16 = Bppx16;
+                        Point.SliceCount = SliceCount;
+                        Point.SliceHeight = SliceHeight;
+                        if ((0 != (SweepArgs.PicHeight % SliceHeight)) || !DisplayInfoRoutinesCreateDscSweepCfg(&SweepArgs, &Point, &DscCfg))
+                        {
+                            continue;
+                        }
+
+                        Point.SliceWidth = DscCfg.SliceWidth;
+                        Point.ChunkSize = DscCfg.ChunkSize;
+                        Point.InitialXmitDelay = DscCfg.InitialXmitDelay;
+                        Point.InitialDecDelay = DscCfg.InitialDecDelay;
+                        Point.RcbBits = DscCfg.RcbBits;
+                        Reference.push_back(Point);
+                    }
+                }
+            }
+        }
+        Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+        std::cerr << "per point: " << Reference.size() << " valid in " << (Seconds * 1e3) << " ms" << std::endl;
+
+        for (uint32_t Level = DD_SIMD_LEVEL_SCALAR; Level <= static_cast<uint32_t>(DisplayInfoRoutinesGetSimdLevel()); Level++)
+        {
+            DSC_CFG_SWEEP_ARGS LevelArgs = SweepArgs;
+            std::vector<DSC_CFG_SWEEP_POINT> Points(Reference.size() + 1);
+            DDU32 NumFound;
+
+            LevelArgs.SimdLevel = static_cast<DD_SIMD_LEVEL>(Level);
+            StartTime = std::chrono::steady_clock::now();
+            NumFound = DisplayInfoRoutinesSweepDscCfgs(&LevelArgs, 0, NumRatePoints, Points.data(), static_cast<DDU32>(Points.size()));
+            Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+            bool IsSame = (NumFound == Reference.size()) &&
+                          (Reference.empty() || (0 == DD_MEM_CMP(Points.data(), Reference.data(), Reference.size() * sizeof(DSC_CFG_SWEEP_POINT))));
+            IsMismatch = IsMismatch || !IsSame;
+            std::cerr << SimdLevelNames[Level] << ": " << NumFound << " valid in " << (Seconds * 1e3) << " ms, " << (IsSame ? "same as per point" : "MISMATCH")
+                      << std::endl;
+        }
+    }
+
+    return IsMismatch ? 1 : 0;
+}
+
+/**
+ * @brief Ranks a DP link config the way DpProtocolPlanLinkCfgs() prefers them, lower is better.
+ *
+ * @param  FormatIndex index of the bpp in the order bpps are tried
+ * @param  LinkRateMbps
+ * @param  LaneCount
+ * @param  EnableFec
+ * @param  EnableSpread
+ * @return uint64_t
+ */
+static uint64_t dpLinkPlanRank(uint32_t FormatIndex, DDU32 LinkRateMbps, DDU32 LaneCount, DD_BOOL EnableFec, DD_BOOL EnableSpread)
+{
+    return (static_cast<uint64_t>(FormatIndex) << 40) | (static_cast<uint64_t>(LinkRateMbps * LaneCount) << 18) | (static_cast<uint64_t>(LinkRateMbps) << 2) |
+           (EnableFec ? 2 : 0) | (EnableSpread ? 0 : 1);
+}
+
+/**
+ * @brief Plans the DP link config of every mode of an EDID.
+ *
+ *  EdidParser --dp-plan <edid file> [--mntu <sst|mst|eoc|llsc>] [--lanes <1|2|4>] [--rates <mbps1,mbps2,...>] [--mst] [--edp]
+ *              [--no-fec] [--no-ssc] [--no-dsc] [--bpc <bpc1,bpc2,...>] [--dsc-bpp <min>-<max>[/<step>]] [--slices <n>]
+ *              [--threads <n>] [--verify] [--out <csv file|->]
+ *  Each mode of the parsed mode table is planned with DpProtocolPlanLinkCfgs() on the least link bandwidth at the
+ *  best bpp that fits: uncompressed at the listed bpcs (highest first), then DSC from the highest bpp down. Defaults
+ *  are the DpProtocolComputeMNTuPbnConsideringEoc() MNTU routine, 4 lanes of RBR to UHBR20, a DP sink with FEC and
+ *  spread, bpc 12,10,8,6, and DSC at 8-24 bpp in steps of 1/16 with 4 slices. Modes are shared out to n worker
+ *  threads (one per core by default). With --out the plan is written as CSV in mode table order, "-" for stdout. The
+ *  summary goes to stderr.
+ *  With --verify every (bpp, lanes, link rate, FEC, spread) config of every mode is also computed on its own with the
+ *  MNTU routine, and the run fails if the best of them by the same preference is not the planned one.
+ * @param  argc
+ * @param  argv
+ * @return int 0 if the plan ran, and with --verify matched
+ */
+int runDpLinkPlan(int argc, char* argv[])
+{
+    static const char* const MntuNames[DP_LINK_PLAN_MNTU_MAX] = { "sst", "mst", "eoc", "llsc" };
+    EDID_PARSE_SESSION* pSession = nullptr;
+    EDID_MAPPED_FILE MappedFile = { 0 };
+    DP_LINK_PLAN_SINK_CAPS SinkCaps;
+    DP_LINK_PLAN_ARGS PlanArgs;
+    std::vector<uint32_t> LinkRates = { DP_LINKRATE_1620_MBPS, DP_LINKRATE_2700_MBPS,  DP_LINKRATE_5400_MBPS, DP_LINKRATE_8100_MBPS,
+                                        DP_LINKRATE_10000_MBPS, DP_LINKRATE_13500_MBPS, DP_LINKRATE_20000_MBPS };
+    std::vector<uint32_t> Bpcs = { 12, 10, 8, 6 };
+    std::vector<DDU32> Bppx16s;
+    std::vector<std::thread> Workers;
+    std::string OutPath;
+    uint32_t NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    DDU32 NumModes, NumFeasible = 0;
+    bool IsVerify = false;
+    bool IsMismatch = false;
+    bool IsValid = (argc > 2);
+
+    DD_ZERO_MEM(&SinkCaps, sizeof(SinkCaps));
+    SinkCaps.SinkType = DD_VOT_DISPLAYPORT_EXTERNAL;
+    SinkCaps.MaxLaneCount = LANE_X4;
+    SinkCaps.IsFecSupported = TRUE;
+    SinkCaps.IsSscSupported = TRUE;
+    SinkCaps.DpSscOverheadx1e6 = 1002506; // 0.5% down spread, 1/0.9975
+    SinkCaps.IsDscSupported = TRUE;
+    SinkCaps.DscSlicesPerScanline = 4;
+    DD_ZERO_MEM(&PlanArgs, sizeof(PlanArgs));
+    PlanArgs.pSinkCaps = &SinkCaps;
+    PlanArgs.MntuMethod = DP_LINK_PLAN_MNTU_EOC;
+    PlanArgs.MinDscBppx16 = 8 * 16;
+    PlanArgs.MaxDscBppx16 = 24 * 16;
+    PlanArgs.DscBppStepx16 = 1;
+
+    for (int Arg = 3; IsValid && (Arg < argc); Arg++)
+    {
+        std::string Option = argv[Arg];
+        const char* pValue = (Arg + 1 < argc) ? argv[Arg + 1] : nullptr;
+        double MinBpp = 0, MaxBpp = 0, StepBpp = 1.0 / 16;
+
+        if (Option == "--verify")
+        {
+            IsVerify = true;
+            continue;
+        }
+        else if (Option == "--mst")
+        {
+            SinkCaps.IsMstEnabled = TRUE;
+            continue;
+        }
+        else if (Option == "--edp")
+        {
+            SinkCaps.SinkType = DD_VOT_DISPLAYPORT_EMBEDDED;
+            continue;
+        }
+        else if (Option == "--no-fec")
+        {
+            SinkCaps.IsFecSupported = FALSE;
+            continue;
+        }
+        else if (Option == "--no-ssc")
+        {
+            SinkCaps.IsSscSupported = FALSE;
+            continue;
+        }
+        else if (Option == "--no-dsc")
+        {
+            SinkCaps.IsDscSupported = FALSE;
+            continue;
+        }
+        else if (nullptr == pValue)
+        {
+            IsValid = false;
+        }
+        else if (Option == "--mntu")
+        {
+            IsValid = false;
+            for (uint32_t Method = 0; Method < DP_LINK_PLAN_MNTU_MAX; Method++)
+            {
+                if (0 == strcmp(pValue, MntuNames[Method]))
+                {
+                    PlanArgs.MntuMethod = static_cast<DP_LINK_PLAN_MNTU_METHOD>(Method);
+                    IsValid = true;
+                }
+            }
+        }
+        else if ((Option == "--lanes") && ((1 == atoi(pValue)) || (2 == atoi(pValue)) || (4 == atoi(pValue))))
+        {
+            SinkCaps.MaxLaneCount = static_cast<DDU8>(atoi(pValue));
+        }
+        else if (Option == "--rates")
+        {
+            IsValid = parseUintList(pValue, LinkRates) && (LinkRates.size() <= DP_LINK_PLAN_MAX_LINK_RATES);
+        }
+        else if (Option == "--bpc")
+        {
+            IsValid = parseUintList(pValue, Bpcs);
+        }
+        else if (Option == "--dsc-bpp")
+        {
+            IsValid = (sscanf(pValue, "%lf-%lf/%lf", &MinBpp, &MaxBpp, &StepBpp) >= 2) && (MinBpp > 0) && (MaxBpp >= MinBpp) && (StepBpp > 0);
+            PlanArgs.MinDscBppx16 = static_cast<DDU32>(MinBpp * 16 + 0.5);
+            PlanArgs.MaxDscBppx16 = static_cast<DDU32>(MaxBpp * 16 + 0.5);
+            PlanArgs.DscBppStepx16 = std::max(1u, static_cast<DDU32>(StepBpp * 16 + 0.5));
+        }
+        else if ((Option == "--slices") && (atoi(pValue) > 0) && (atoi(pValue) <= UINT8_MAX))
+        {
+            SinkCaps.DscSlicesPerScanline = static_cast<DDU8>(atoi(pValue));
+        }
+        else if ((Option == "--threads") && (atoi(pValue) > 0))
+        {
+            NumThreads = static_cast<uint32_t>(atoi(pValue));
+        }
+        else if (Option == "--out")
+        {
+            OutPath = pValue;
+        }
+        else
+        {
+            IsValid = false;
+        }
+        Arg++;
+    }
+
+    // Uncompressed bpps are tried highest first, 3 components of bpc bits each
+    std::sort(Bpcs.begin(), Bpcs.end(), std::greater<uint32_t>());
+    for (uint32_t Bpc : Bpcs)
+    {
+        IsValid = IsValid && (Bpc <= 16);
+        Bppx16s.push_back(Bpc * 3 * 16);
+    }
+    IsValid = IsValid && ((DP_LINK_PLAN_MNTU_MST != PlanArgs.MntuMethod) || SinkCaps.IsMstEnabled);
+
+    if (!IsValid)
+    {
+        std::cerr << "Usage: EdidParser --dp-plan <edid file> [--mntu <sst|mst|eoc|llsc>] [--lanes <1|2|4>] [--rates <mbps1,mbps2,...>] [--mst] [--edp]"
+                  << " [--no-fec] [--no-ssc] [--no-dsc] [--bpc <bpc1,bpc2,...>] [--dsc-bpp <min>-<max>[/<step>]] [--slices <n>] [--threads <n>] [--verify]"
+                  << " [--out <csv file|->] (--mntu mst needs --mst)" << std::endl;
+        return 1;
+    }
+
+    SinkCaps.NumLinkRates = static_cast<DDU8>(LinkRates.size());
+    std::copy(LinkRates.begin(), LinkRates.end(), SinkCaps.LinkRatesMbps);
+    PlanArgs.pBppx16s = Bppx16s.data();
+    PlanArgs.NumBpps = static_cast<DDU32>(Bppx16s.size());
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        return 1;
+    }
+    if (!mapEdidFile(argv[2], &MappedFile) || IS_DDSTATUS_ERROR(parseEdid(pSession, MappedFile.pData, MappedFile.SizeInBytes)))
+    {
+        std::cerr << "Invalid EDID " << argv[2] << std::endl;
+        unmapEdidFile(&MappedFile);
+        parseSessionFree(pSession);
+        DD_SAFE_FREE(pSession);
+        return 1;
+    }
+    unmapEdidFile(&MappedFile);
+
+    PlanArgs.pModeTable = &pSession->ModeTable.Table;
+    NumModes = PlanArgs.pModeTable->NumEntries;
+    const DD_TIMING_INFO* pModes = static_cast<const DD_TIMING_INFO*>(PlanArgs.pModeTable->pEntry);
+
+    // Modes that only fit with DSC cost far more than the others, so workers claim one mode at a time
+    std::vector<DP_LINK_PLAN_RESULT> Results(NumModes);
+    std::atomic<DDU32> NextMode(0);
+    std::atomic<DDU32> NumFeasibleShared(0);
+
+    auto StartTime = std::chrono::steady_clock::now();
+    NumThreads = std::max(1u, std::min<uint32_t>(NumThreads, NumModes));
+    for (uint32_t WorkerIndex = 0; WorkerIndex < NumThreads; WorkerIndex++)
+    {
+        Workers.emplace_back([&]() {
+            for (DDU32 Mode = NextMode++; Mode < NumModes; Mode = NextMode++)
+            {
+                NumFeasibleShared += DpProtocolPlanLinkCfgs(&PlanArgs, Mode, 1, &Results[Mode]);
+            }
+        });
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+    NumFeasible = NumFeasibleShared;
+
+    uint64_t NumEvaluated = 0;
+    for (const DP_LINK_PLAN_RESULT& Result : Results)
+    {
+        NumEvaluated += Result.NumEvaluated;
+    }
+
+    if (!OutPath.empty())
+    {
+        OUTPUT_WRITER Writer;
+
+        Writer.Buffer.reserve(NumModes * 128 + 256);
+        writerPut(&Writer, "mode,h_active,v_active,refresh,dot_clock_hz,feasible,lanes,link_rate_mbps,bpp,dsc,fec,ssc,data_m,data_n,link_m,link_n,data_tu,"
+                           "actual_pbn,allocated_pbn\n");
+        for (DDU32 Mode = 0; Mode < NumModes; Mode++)
+        {
+            const DP_LINK_PLAN_RESULT& Result = Results[Mode];
+
+            writerPutDec(&Writer, Mode);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, pModes[Mode].HActive);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, pModes[Mode].VActive);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, pModes[Mode].VRoundedRR);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, pModes[Mode].DotClockInHz);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, static_cast<uint32_t>(Result.IsFeasible));
+            if (Result.IsFeasible)
+            {
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.LaneCount);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.LinkRateMbps);
+                writerPut(&Writer, ",");
+                writerPutBppx16(&Writer, Result.BitsPerPixel.Bppx16);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, static_cast<uint32_t>(Result.IsDscEnabled));
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, static_cast<uint32_t>(Result.EnableFec));
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, static_cast<uint32_t>(Result.EnableSpread));
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.MNTUData.DataM);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.MNTUData.DataN);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.MNTUData.LinkM);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.MNTUData.LinkN);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.MNTUData.DataTU);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.ActualPBN);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.AllocatedPBN);
+                writerPut(&Writer, "\n");
+            }
+            else
+            {
+                writerPut(&Writer, ",,,,,,,,,,,,,\n");
+            }
+        }
+
+        if (OutPath == "-")
+        {
+            std::cout.write(Writer.Buffer.data(), Writer.Buffer.size());
+            std::cout.flush();
+        }
+        else if (!writeOutputFile(OutPath, Writer.Buffer))
+        {
+            std::cerr << "Unable to write " << OutPath << std::endl;
+            parseSessionFree(pSession);
+            DD_SAFE_FREE(pSession);
+            return 1;
+        }
+    }
+
+    std::cerr << "Planned " << NumModes << " modes with " << MntuNames[PlanArgs.MntuMethod] << " MNTU, " << NumFeasible << " fit, " << NumEvaluated
+              << " link configs checked in " << (Seconds * 1e3) << " ms with " << NumThreads << " threads" << std::endl;
+
+    if (IsVerify)
+    {
+        std::vector<DDU32> Formats(Bppx16s);
+        uint64_t NumComputed = 0;
+        uint32_t NumDscFormats = 0;
+
+        // Same bpps as the planner tries them, DSC ones tagged with bit 31
+        if (SinkCaps.IsDscSupported && (0 != SinkCaps.DscSlicesPerScanline))
+        {
+            DDU32 TopBppx16 = PlanArgs.MinDscBppx16 + ((PlanArgs.MaxDscBppx16 - PlanArgs.MinDscBppx16) / PlanArgs.DscBppStepx16) * PlanArgs.DscBppStepx16;
+
+            for (DDU32 Bppx16 = TopBppx16; Bppx16 >= PlanArgs.MinDscBppx16; Bppx16 -= PlanArgs.DscBppStepx16)
+            {
+                Formats.push_back(Bppx16 | 0x80000000);
+                NumDscFormats++;
+                if (Bppx16 < PlanArgs.MinDscBppx16 + PlanArgs.DscBppStepx16)
+                {
+                    break;
+                }
+            }
+        }
+
+        StartTime = std::chrono::steady_clock::now();
+        for (DDU32 Mode = 0; Mode < NumModes; Mode++)
+        {
+            DP_LINK_PLAN_RESULT Best;
+            uint64_t BestRank = UINT64_MAX;
+            DP_LINK_DATA DpLinkData;
+
+            DD_ZERO_MEM(&Best, sizeof(Best));
+            for (uint32_t FormatIndex = 0; FormatIndex < Formats.size(); FormatIndex++)
+            {
+                DD_BOOL IsDsc = (0 != (Formats[FormatIndex] & 0x80000000));
+
+                for (uint32_t LinkRate : LinkRates)
+                {
+                    for (DDU32 LaneCount = LANE_X1; LaneCount <= SinkCaps.MaxLaneCount; LaneCount *= 2)
+                    {
+                        for (uint32_t Variant = 0; Variant < 4; Variant++)
+                        {
+                            DD_BOOL EnableFec = (0 != (Variant & 1));
+                            DD_BOOL EnableSpread = (0 != (Variant & 2));
+                            bool Is8b10b = (CH_CODING_8B_10B == GET_DP_CHANNEL_CODING(LinkRate));
+                            DDSTATUS Status = DDS_UNSUCCESSFUL;
+
+                            if ((EnableFec && (!SinkCaps.IsFecSupported || !Is8b10b)) || (EnableSpread && !SinkCaps.IsSscSupported) ||
+                                (IsDsc && Is8b10b && !EnableFec && (DD_VOT_DISPLAYPORT_EMBEDDED != SinkCaps.SinkType)) ||
+                                ((DP_LINK_PLAN_MNTU_SST == PlanArgs.MntuMethod) && !Is8b10b))
+                            {
+                                continue;
+                            }
+
+                            DpProtocolInitLinkPlanData(&PlanArgs, &pModes[Mode], &DpLinkData);
+                            DpLinkData.LinkBwData.LinkRateMbps = LinkRate;
+                            DpLinkData.LinkBwData.DpLaneWidthSelection = static_cast<DD_LANE_WIDTH>(LaneCount);
+                            DpLinkData.LinkBwData.DpChannelCodingType = GET_DP_CHANNEL_CODING(LinkRate);
+                            DpLinkData.LinkBwData.BitsPerPixel.Bppx16 = static_cast<DDU16>(Formats[FormatIndex] & 0xFFFF);
+                            DpLinkData.LinkBwData.EnableFec = EnableFec;
+                            DpLinkData.LinkBwData.EnableSpread = EnableSpread;
+                            DpLinkData.DscCapable = IsDsc;
+
+                            switch (PlanArgs.MntuMethod)
+                            {
+                            case DP_LINK_PLAN_MNTU_SST: Status = DpProtocolSstComputeMNTu(&DpLinkData); break;
+                            case DP_LINK_PLAN_MNTU_MST: Status = DpProtocolMstComputeMNTuPbn(&DpLinkData); break;
+                            case DP_LINK_PLAN_MNTU_EOC: Status = DpProtocolComputeMNTuPbnConsideringEoc(&DpLinkData); break;
+                            default: Status = DpProtocolComputeMNTuPbnLinkLayerSymbolCount(&DpLinkData); break;
+                            }
+                            NumComputed++;
+
+                            uint64_t Rank = dpLinkPlanRank(FormatIndex, LinkRate, LaneCount, EnableFec, EnableSpread);
+                            if (IS_DDSTATUS_SUCCESS(Status) && (Rank < BestRank))
+                            {
+                                BestRank = Rank;
+                                Best.IsFeasible = TRUE;
+                                Best.LinkRateMbps = LinkRate;
+                                Best.LaneCount = LaneCount;
+                                Best.IsDscEnabled = IsDsc;
+                                Best.EnableFec = EnableFec;
+                                Best.EnableSpread = EnableSpread;
+                                Best.BitsPerPixel = DpLinkData.LinkBwData.BitsPerPixel;
+                                Best.MNTUData = DpLinkData.LinkBwData.MNTUData;
+                                Best.ActualPBN = DpLinkData.MstBwData.ActualPBN;
+                                Best.AllocatedPBN = DpLinkData.MstBwData.AllocatedPBN;
+                            }
+                        }
+                    }
+                }
+            }
+
+            Best.NumEvaluated = Results[Mode].NumEvaluated;
+            if (0 != DD_MEM_CMP(&Best, &Results[Mode], sizeof(Best)))
+            {
+                std::cerr << "Mode " << Mode << " (" << pModes[Mode].HActive << "x" << pModes[Mode].VActive << "@" << pModes[Mode].VRoundedRR
+                          << ") MISMATCH" << std::endl;
+                IsMismatch = true;
+            }
+        }
+        Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+        std::cerr << "every config: " << NumComputed << " computed (" << Formats.size() << " bpps, " << NumDscFormats << " with DSC) in " << (Seconds * 1e3)
+                  << " ms, " << (IsMismatch ? "MISMATCH" : "same as planned") << std::endl;
+    }
+
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pSession);
+    return IsMismatch ? 1 : 0;
+}
+
+/**
+ * @brief Number of streams in an MST stream set.
+ *
+ * @param  StreamSet
+ * @return uint32_t
+ */
+static uint32_t mstStreamCount(uint64_t StreamSet)
+{
+    uint32_t Count = 0;
+
+    for (; StreamSet; StreamSet &= StreamSet - 1)
+    {
+        Count++;
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Parses an MST stream request "<width>x<height>@<refresh>[:<bpp>][:dsc<slices>]" into a CVT reduced blanking timing.
+ *
+ * @param  pSpec
+ * @param  pStream [out]
+ * @param  pTiming [out]
+ * @return bool false if the spec is invalid or no timing could be created for it
+ */
+static bool parseMstStreamSpec(const char* pSpec, DP_MST_STREAM_REQUEST* pStream, DD_TIMING_INFO* pTiming)
+{
+    CREATE_CVT_TIMING_ARGS CvtArgs;
+    unsigned int Width = 0, Height = 0, Refresh = 0, Slices = 0;
+    double Bpp = 24;
+    int Length = 0;
+
+    if ((sscanf(pSpec, "%ux%u@%u%n", &Width, &Height, &Refresh, &Length) != 3) || (0 == Width) || (0 == Height) || (0 == Refresh))
+    {
+        return false;
+    }
+    for (pSpec += Length; ':' == *pSpec; pSpec += Length)
+    {
+        Length = 0;
+        if ((0 == strncmp(pSpec, ":dsc", 4)) && (sscanf(pSpec, ":dsc%u%n", &Slices, &Length) == 1) && (Slices > 0) && (Slices <= UINT8_MAX))
+        {
+            continue;
+        }
+        if ((sscanf(pSpec, ":%lf%n", &Bpp, &Length) != 1) || (Bpp <= 0) || (Bpp > 48))
+        {
+            return false;
+        }
+    }
+    if ('\0' != *pSpec)
+    {
+        return false;
+    }
+
+    DD_ZERO_MEM(&CvtArgs, sizeof(CvtArgs));
+    DD_ZERO_MEM(pTiming, sizeof(DD_TIMING_INFO));
+    CvtArgs.XRes = Width;
+    CvtArgs.YRes = Height;
+    CvtArgs.RRate = Refresh;
+    CvtArgs.IsRed_Blank_Req = TRUE;
+    CvtArgs.RedBlankVersion = RED_BLANK_VER_1;
+    CvtArgs.pTimingInfo = pTiming;
+    if (IS_DDSTATUS_ERROR(DisplayInfoRoutinesCreateCVTTiming(&CvtArgs)) || (0 == pTiming->DotClockInHz))
+    {
+        return false;
+    }
+
+    DD_ZERO_MEM(pStream, sizeof(DP_MST_STREAM_REQUEST));
+    pStream->DotClockInHz = pTiming->DotClockInHz;
+    pStream->HActive = pTiming->HActive;
+    pStream->HTotal = pTiming->HTotal;
+    pStream->BitsPerPixel.Bppx16 = static_cast<DDU16>(Bpp * 16 + 0.5);
+    pStream->IsDscEnabled = (0 != Slices);
+    pStream->DscSlicesPerScanline = static_cast<DDU8>(Slices);
+    return true;
+}
+
+/**
+ * @brief Allocates MST streams on one link and lists which combinations of them fit.
+ *
+ *  EdidParser --mst-alloc <lanes>x<link rate mbps> <stream> [<stream> ...] [--mntu <mst|eoc|llsc>] [--no-ssc] [--threads <n>]
+ *              [--verify] [--out <csv file|->]
+ *  A stream is "<width>x<height>@<refresh>[:<bpp>][:dsc<slices>]", with a CVT reduced blanking timing, 24 bpp by
+ *  default and DSC at that bpp when slices are given. Time slots and PBN of each stream are computed with
+ *  DpProtocolMstAllocStreams(), by default with the DpProtocolComputeMNTuPbnConsideringEoc() MNTU routine and spread
+ *  on. FEC is enabled on 8b/10b links when a stream uses DSC. The greedy and exact stream sets of
+ *  DpProtocolMstPackStreams() are reported, and with up to DP_MST_ALLOC_MAX_EXACT_STREAMS streams all 2^n stream sets
+ *  are checked with DpProtocolMstGetFittingStreamSets(), shared out to n worker threads (one per core by default) in
+ *  blocks of stream sets. With --out the stream sets that fit are written as CSV, "-" for stdout. The summary goes
+ *  to stderr.
+ *  With --verify every stream set is also checked on its own with DpProtocolMstDoesStreamSetFit(), and the run fails
+ *  if the fitting stream sets or the best of them differ from the packed ones.
+ * @param  argc
+ * @param  argv
+ * @return int 0 if the allocation ran, and with --verify matched
+ */
+int runMstAlloc(int argc, char* argv[])
+{
+    static const char* const MntuNames[DP_LINK_PLAN_MNTU_MAX] = { "sst", "mst", "eoc", "llsc" };
+    static const uint64_t SetsPerBlock = 1ULL << 16; // Multiple of 64, so workers never share a bitmap word
+    DP_MST_ALLOC_ARGS AllocArgs;
+    std::vector<DP_MST_STREAM_REQUEST> Streams;
+    std::vector<DD_TIMING_INFO> Timings;
+    std::vector<std::thread> Workers;
+    std::string OutPath;
+    uint32_t NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int LaneCount = 0, LinkRateMbps = 0;
+    DDU32 LinkSlots, LinkPbn;
+    bool IsVerify = false;
+    bool IsMismatch = false;
+    bool IsValid = (argc > 3) && (sscanf(argv[2], "%ux%u", &LaneCount, &LinkRateMbps) == 2) &&
+                   ((LANE_X1 == LaneCount) || (LANE_X2 == LaneCount) || (LANE_X4 == LaneCount)) && (0 != LinkRateMbps);
+
+    DD_ZERO_MEM(&AllocArgs, sizeof(AllocArgs));
+    AllocArgs.LinkRateMbps = LinkRateMbps;
+    AllocArgs.LaneCount = LaneCount;
+    AllocArgs.EnableSpread = TRUE;
+    AllocArgs.DpSscOverheadx1e6 = 1002506; // 0.5% down spread, 1/0.9975
+    AllocArgs.MntuMethod = DP_LINK_PLAN_MNTU_EOC;
+
+    for (int Arg = 3; IsValid && (Arg < argc); Arg++)
+    {
+        std::string Option = argv[Arg];
+        const char* pValue = (Arg + 1 < argc) ? argv[Arg + 1] : nullptr;
+
+        if (0 != Option.compare(0, 2, "--"))
+        {
+            DP_MST_STREAM_REQUEST Stream;
+            DD_TIMING_INFO Timing;
+
+            IsValid = (Streams.size() < DP_MST_ALLOC_MAX_STREAMS) && parseMstStreamSpec(argv[Arg], &Stream, &Timing);
+            Streams.push_back(Stream);
+            Timings.push_back(Timing);
+            continue;
+        }
+        else if (Option == "--verify")
+        {
+            IsVerify = true;
+            continue;
+        }
+        else if (Option == "--no-ssc")
+        {
+            AllocArgs.EnableSpread = FALSE;
+            continue;
+        }
+        else if (nullptr == pValue)
+        {
+            IsValid = false;
+        }
+        else if (Option == "--mntu")
+        {
+            IsValid = false;
+            for (uint32_t Method = DP_LINK_PLAN_MNTU_MST; Method < DP_LINK_PLAN_MNTU_MAX; Method++)
+            {
+                if (0 == strcmp(pValue, MntuNames[Method]))
+                {
+                    AllocArgs.MntuMethod = static_cast<DP_LINK_PLAN_MNTU_METHOD>(Method);
+                    IsValid = true;
+                }
+            }
+        }
+        else if ((Option == "--threads") && (atoi(pValue) > 0))
+        {
+            NumThreads = static_cast<uint32_t>(atoi(pValue));
+        }
+        else if (Option == "--out")
+        {
+            OutPath = pValue;
+        }
+        else
+        {
+            IsValid = false;
+        }
+        Arg++;
+    }
+    IsValid = IsValid && !Streams.empty();
+
+    if (!IsValid)
+    {
+        std::cerr << "Usage: EdidParser --mst-alloc <lanes>x<link rate mbps> <width>x<height>@<refresh>[:<bpp>][:dsc<slices>] [...] [--mntu <mst|eoc|llsc>]"
+                  << " [--no-ssc] [--threads <n>] [--verify] [--out <csv file|->] (up to " << DP_MST_ALLOC_MAX_STREAMS << " streams)" << std::endl;
+        return 1;
+    }
+
+    AllocArgs.pStreams = Streams.data();
+    AllocArgs.NumStreams = static_cast<DDU32>(Streams.size());
+    for (const DP_MST_STREAM_REQUEST& Stream : Streams)
+    {
+        AllocArgs.EnableFec = AllocArgs.EnableFec || (Stream.IsDscEnabled && (CH_CODING_8B_10B == GET_DP_CHANNEL_CODING(LinkRateMbps)));
+    }
+    DpProtocolMstGetLinkBudget(LaneCount, LinkRateMbps, &LinkSlots, &LinkPbn);
+
+    std::vector<DP_MST_STREAM_ALLOC> Allocs(Streams.size());
+    DDU32 NumAllocated = DpProtocolMstAllocStreams(&AllocArgs, Allocs.data());
+
+    std::cerr << LaneCount << "x" << LinkRateMbps << " Mbps link, " << LinkSlots << " time slots, " << LinkPbn << " PBN, " << MntuNames[AllocArgs.MntuMethod]
+              << " MNTU, fec " << static_cast<uint32_t>(AllocArgs.EnableFec) << ", ssc " << static_cast<uint32_t>(AllocArgs.EnableSpread) << std::endl;
+    for (DDU32 Index = 0; Index < AllocArgs.NumStreams; Index++)
+    {
+        OUTPUT_WRITER Writer;
+
+        writerPut(&Writer, "  stream ");
+        writerPutDec(&Writer, Index);
+        writerPut(&Writer, ": ");
+        writerPutDec(&Writer, Timings[Index].HActive);
+        writerPut(&Writer, "x");
+        writerPutDec(&Writer, Timings[Index].VActive);
+        writerPut(&Writer, "@");
+        writerPutDec(&Writer, Timings[Index].VRoundedRR);
+        writerPut(&Writer, " ");
+        writerPutDec(&Writer, Streams[Index].DotClockInHz);
+        writerPut(&Writer, " Hz ");
+        writerPutBppx16(&Writer, Streams[Index].BitsPerPixel.Bppx16);
+        writerPut(&Writer, " bpp");
+        if (Streams[Index].IsDscEnabled)
+        {
+            writerPut(&Writer, " dsc");
+        }
+        if (IS_DDSTATUS_SUCCESS(Allocs[Index].Status))
+        {
+            writerPut(&Writer, ", slots ");
+            writerPutDec(&Writer, Allocs[Index].NumSlots);
+            writerPut(&Writer, ", actual pbn ");
+            writerPutDec(&Writer, Allocs[Index].ActualPBN);
+            writerPut(&Writer, ", allocated pbn ");
+            writerPutDec(&Writer, Allocs[Index].AllocatedPBN);
+        }
+        else
+        {
+            writerPut(&Writer, ", does not fit");
+        }
+        std::cerr << Writer.Buffer << std::endl;
+    }
+
+    uint64_t GreedySet = DpProtocolMstPackStreams(&AllocArgs, Allocs.data(), DP_MST_PACK_GREEDY);
+    std::cerr << "greedy: 0x" << std::hex << GreedySet << std::dec << " (" << mstStreamCount(GreedySet) << " streams)" << std::endl;
+
+    if (AllocArgs.NumStreams > DP_MST_ALLOC_MAX_EXACT_STREAMS)
+    {
+        std::cerr << NumAllocated << " of " << AllocArgs.NumStreams << " streams fit alone, stream sets are only listed for up to "
+                  << DP_MST_ALLOC_MAX_EXACT_STREAMS << " streams" << std::endl;
+        return 0;
+    }
+
+    uint64_t ExactSet = DpProtocolMstPackStreams(&AllocArgs, Allocs.data(), DP_MST_PACK_EXACT);
+    std::cerr << "exact: 0x" << std::hex << ExactSet << std::dec << " (" << mstStreamCount(ExactSet) << " streams)" << std::endl;
+
+    // Stream sets are shared out in blocks, each worker filling the bitmap words of the blocks it claims
+    uint64_t NumSets = 1ULL << AllocArgs.NumStreams;
+    uint64_t NumBlocks = (NumSets + SetsPerBlock - 1) / SetsPerBlock;
+    std::vector<DDU64> FitBitmap(DD_BLOCK_BITMAP_WORDS(NumSets));
+    std::atomic<uint64_t> NextBlock(0);
+    std::atomic<uint64_t> NumFitShared(0);
+
+    auto StartTime = std::chrono::steady_clock::now();
+    NumThreads = static_cast<uint32_t>(std::max<uint64_t>(1, std::min<uint64_t>(NumThreads, NumBlocks)));
+    for (uint32_t WorkerIndex = 0; WorkerIndex < NumThreads; WorkerIndex++)
+    {
+        Workers.emplace_back([&]() {
+            for (uint64_t Block = NextBlock++; Block < NumBlocks; Block = NextBlock++)
+            {
+                uint64_t FirstSet = Block * SetsPerBlock;
+
+                NumFitShared += DpProtocolMstGetFittingStreamSets(&AllocArgs, Allocs.data(), FirstSet, std::min(SetsPerBlock, NumSets - FirstSet),
+                                                                  &FitBitmap[FirstSet / 64]);
+            }
+        });
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+    uint64_t NumFit = NumFitShared;
+
+    if (!OutPath.empty())
+    {
+        OUTPUT_WRITER Writer;
+
+        writerPut(&Writer, "set,streams,slots,actual_pbn,allocated_pbn\n");
+        for (uint64_t StreamSet = 0; StreamSet < NumSets; StreamSet++)
+        {
+            DDU32 NumSlots = 0, ActualPbn = 0, AllocatedPbn = 0;
+            bool IsFirst = true;
+
+            if (!DD_IS_BLOCK_BIT_SET(FitBitmap.data(), StreamSet))
+            {
+                continue;
+            }
+            writerPut(&Writer, "0x");
+            writerPutHex(&Writer, StreamSet);
+            writerPut(&Writer, ",");
+            for (DDU32 Index = 0; Index < AllocArgs.NumStreams; Index++)
+            {
+                if (StreamSet & (1ULL << Index))
+                {
+                    if (!IsFirst)
+                    {
+                        writerPut(&Writer, "+");
+                    }
+                    writerPutDec(&Writer, Index);
+                    NumSlots += Allocs[Index].NumSlots;
+                    ActualPbn += Allocs[Index].ActualPBN;
+                    AllocatedPbn += Allocs[Index].AllocatedPBN;
+                    IsFirst = false;
+                }
+            }
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, NumSlots);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, ActualPbn);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, AllocatedPbn);
+            writerPut(&Writer, "\n");
+        }
+
+        if (OutPath == "-")
+        {
+            std::cout.write(Writer.Buffer.data(), Writer.Buffer.size());
+            std::cout.flush();
+        }
+        else if (!writeOutputFile(OutPath, Writer.Buffer))
+        {
+            std::cerr << "Unable to write " << OutPath << std::endl;
+            return 1;
+        }
+    }
+
+    std::cerr << NumFit << " of " << NumSets << " stream sets fit, checked in " << (Seconds * 1e3) << " ms with " << NumThreads << " threads ("
+              << (NumSets / std::max(Seconds, 1e-9)) << " stream sets/s)" << std::endl;
+
+    if (IsVerify)
+    {
+        uint64_t BestSet = 0;
+        uint32_t BestCount = 0;
+        DDU32 BestPbn = 0;
+        uint64_t NumMismatched = 0;
+
+        StartTime = std::chrono::steady_clock::now();
+        for (uint64_t StreamSet = 0; StreamSet < NumSets; StreamSet++)
+        {
+            bool IsFit = (FALSE != DpProtocolMstDoesStreamSetFit(&AllocArgs, Allocs.data(), StreamSet));
+            DDU32 Pbn = 0;
+
+            NumMismatched += (IsFit != DD_IS_BLOCK_BIT_SET(FitBitmap.data(), StreamSet));
+            if (!IsFit)
+            {
+                continue;
+            }
+            for (DDU32 Index = 0; Index < AllocArgs.NumStreams; Index++)
+            {
+                Pbn += (StreamSet & (1ULL << Index)) ? Allocs[Index].ActualPBN : 0;
+            }
+            if ((mstStreamCount(StreamSet) > BestCount) || ((mstStreamCount(StreamSet) == BestCount) && (Pbn > BestPbn)))
+            {
+                BestSet = StreamSet;
+                BestCount = mstStreamCount(StreamSet);
+                BestPbn = Pbn;
+            }
+        }
+        Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+        IsMismatch = (0 != NumMismatched) || (BestSet != ExactSet) || !DpProtocolMstDoesStreamSetFit(&AllocArgs, Allocs.data(), GreedySet);
+        std::cerr << "every stream set: " << NumMismatched << " differ, best 0x" << std::hex << BestSet << std::dec << " in " << (Seconds * 1e3) << " ms, "
+                  << (IsMismatch ? "MISMATCH" : "same as packed") << std::endl;
+    }
+
+    return IsMismatch ? 1 : 0;
+}
+
+// Uncompressed bpcs of the HDMI link budget unless --bpc is given, most preferred first
+static const DDU32 DefaultHdmiBudgetBpcs[] = { 12, 10, 8 };
+
+/**
+ * @brief Sets the HDMI link budget defaults: bpc 12,10,8, DSC from 12 bpc at 8-24 bpp in steps of 1/16, and 2 channel
+ *  48 kHz audio. Mode table and HDMI caps are left to the caller.
+ *
+ * @param  pBudgetArgs
+ * @return void
+ */
+static void hdmiLinkBudgetArgsInit(HDMI_LINK_BUDGET_ARGS* pBudgetArgs)
+{
+    DD_ZERO_MEM(pBudgetArgs, sizeof(HDMI_LINK_BUDGET_ARGS));
+    pBudgetArgs->pBpcs = DefaultHdmiBudgetBpcs;
+    pBudgetArgs->NumBpcs = sizeof(DefaultHdmiBudgetBpcs) / sizeof(DefaultHdmiBudgetBpcs[0]);
+    pBudgetArgs->DscBpc = 12;
+    pBudgetArgs->MinDscBppx16 = 8 * 16;
+    pBudgetArgs->MaxDscBppx16 = 24 * 16;
+    pBudgetArgs->DscBppStepx16 = 1;
+    pBudgetArgs->AudioSampleRateHz = 48000;
+    pBudgetArgs->AudioChannels = 2;
+}
+
+/**
+ * @brief Budgets the HDMI link of every mode of a parsed EDID with the --hdmi-budget defaults, on the calling thread.
+ *
+ * @param  pSession
+ * @param  Results [out] one per mode, resized to the mode table
+ * @return DDU32 number of modes that fit
+ */
+DDU32 computeHdmiLinkBudgets(const EDID_PARSE_SESSION* pSession, std::vector<HDMI_LINK_BUDGET_RESULT>& Results)
+{
+    HDMI_LINK_BUDGET_ARGS BudgetArgs;
+
+    hdmiLinkBudgetArgsInit(&BudgetArgs);
+    BudgetArgs.pModeTable = &pSession->ModeTable.Table;
+    BudgetArgs.pHdmiCaps = &pSession->EdidCaps.HdmiCaps;
+    Results.resize(BudgetArgs.pModeTable->NumEntries);
+
+    return DisplayInfoRoutinesComputeHdmiLinkBudgets(&BudgetArgs, 0, BudgetArgs.pModeTable->NumEntries, Results.data());
+}
+
+/**
+ * @brief Budgets the HDMI link of every mode of an EDID.
+ *
+ *  EdidParser --hdmi-budget <edid file> [--bpc <bpc1,bpc2,...>] [--dsc-bpc <8|10|12>] [--no-dsc] [--dsc-bpp <min>-<max>[/<step>]]
+ *              [--audio <rate hz>[x<channels>]] [--threads <n>] [--verify] [--out <csv file|->]
+ *  Each mode of the parsed mode table is budgeted with DisplayInfoRoutinesComputeHdmiLinkBudgets() against the HDMI
+ *  caps of the EDID: TMDS or the lowest FRL rate at the best pixel format that fits, uncompressed at the listed bpcs
+ *  (in order), then DSC from the highest bpp down. Defaults are bpc 12,10,8, DSC from 12 bpc at 8-24 bpp in steps of
+ *  1/16, and 2 channel 48 kHz audio. Blocks of modes are shared out to n worker threads (one per core by default).
+ *  With --out the budget is written as CSV in mode table order, "-" for stdout. The summary goes to stderr.
+ *  With --verify every (format, link) of every mode is also checked on its own, formats in order of preference and
+ *  links from TMDS up, and the run fails if the first that fits is not the budgeted one.
+ * @param  argc
+ * @param  argv
+ * @return int 0 if the budget ran, and with --verify matched
+ */
+int runHdmiLinkBudget(int argc, char* argv[])
+{
+    EDID_PARSE_SESSION* pSession = nullptr;
+    EDID_MAPPED_FILE MappedFile = { 0 };
+    HDMI_LINK_BUDGET_ARGS BudgetArgs;
+    std::vector<uint32_t> Bpcs(DefaultHdmiBudgetBpcs, DefaultHdmiBudgetBpcs + sizeof(DefaultHdmiBudgetBpcs) / sizeof(DefaultHdmiBudgetBpcs[0]));
+    std::vector<std::thread> Workers;
+    std::string OutPath;
+    uint32_t NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    DDU32 NumModes, NumFeasible = 0;
+    bool IsVerify = false;
+    bool IsMismatch = false;
+    bool IsValid = (argc > 2);
+
+    hdmiLinkBudgetArgsInit(&BudgetArgs);
+
+    for (int Arg = 3; IsValid && (Arg < argc); Arg++)
+    {
+        std::string Option = argv[Arg];
+        const char* pValue = (Arg + 1 < argc) ? argv[Arg + 1] : nullptr;
+        double MinBpp = 0, MaxBpp = 0, StepBpp = 1.0 / 16;
+        unsigned int AudioRate = 0, AudioChannels = 2;
+
+        if (Option == "--verify")
+        {
+            IsVerify = true;
+            continue;
+        }
+        else if (Option == "--no-dsc")
+        {
+            BudgetArgs.DscBpc = 0;
+            continue;
+        }
+        else if (nullptr == pValue)
+        {
+            IsValid = false;
+        }
+        else if (Option == "--bpc")
+        {
+            IsValid = parseUintList(pValue, Bpcs);
+        }
+        else if ((Option == "--dsc-bpc") && ((8 == atoi(pValue)) || (10 == atoi(pValue)) || (12 == atoi(pValue))))
+        {
+            BudgetArgs.DscBpc = static_cast<DDU32>(atoi(pValue));
+        }
+        else if (Option == "--dsc-bpp")
+        {
+            IsValid = (sscanf(pValue, "%lf-%lf/%lf", &MinBpp, &MaxBpp, &StepBpp) >= 2) && (MinBpp > 0) && (MaxBpp >= MinBpp) && (StepBpp > 0);
+            BudgetArgs.MinDscBppx16 = static_cast<DDU32>(MinBpp * 16 + 0.5);
+            BudgetArgs.MaxDscBppx16 = static_cast<DDU32>(MaxBpp * 16 + 0.5);
+            BudgetArgs.DscBppStepx16 = std::max(1u, static_cast<DDU32>(StepBpp * 16 + 0.5));
+        }
+        else if (Option == "--audio")
+        {
+            IsValid = (sscanf(pValue, "%ux%u", &AudioRate, &AudioChannels) >= 1) && (AudioChannels > 0) && (AudioChannels <= 32);
+            BudgetArgs.AudioSampleRateHz = AudioRate;
+            BudgetArgs.AudioChannels = AudioChannels;
+        }
+        else if ((Option == "--threads") && (atoi(pValue) > 0))
+        {
+            NumThreads = static_cast<uint32_t>(atoi(pValue));
+        }
+        else if (Option == "--out")
+        {
+            OutPath = pValue;
+        }
+        else
+        {
+            IsValid = false;
+        }
+        Arg++;
+    }
+
+    for (uint32_t Bpc : Bpcs)
+    {
+        IsValid = IsValid && (Bpc >= 6) && (Bpc <= 16);
+    }
+
+    if (!IsValid)
+    {
+        std::cerr << "Usage: EdidParser --hdmi-budget <edid file> [--bpc <bpc1,bpc2,...>] [--dsc-bpc <8|10|12>] [--no-dsc] [--dsc-bpp <min>-<max>[/<step>]]"
+                  << " [--audio <rate hz>[x<channels>]] [--threads <n>] [--verify] [--out <csv file|->]" << std::endl;
+        return 1;
+    }
+
+    BudgetArgs.pBpcs = Bpcs.data();
+    BudgetArgs.NumBpcs = static_cast<DDU32>(Bpcs.size());
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        return 1;
+    }
+    if (!mapEdidFile(argv[2], &MappedFile) || IS_DDSTATUS_ERROR(parseEdid(pSession, MappedFile.pData, MappedFile.SizeInBytes)))
+    {
+        std::cerr << "Invalid EDID " << argv[2] << std::endl;
+        unmapEdidFile(&MappedFile);
+        parseSessionFree(pSession);
+        DD_SAFE_FREE(pSession);
+        return 1;
+    }
+    unmapEdidFile(&MappedFile);
+
+    BudgetArgs.pModeTable = &pSession->ModeTable.Table;
+    BudgetArgs.pHdmiCaps = &pSession->EdidCaps.HdmiCaps;
+    NumModes = BudgetArgs.pModeTable->NumEntries;
+    const DD_TIMING_INFO* pModes = static_cast<const DD_TIMING_INFO*>(BudgetArgs.pModeTable->pEntry);
+    const DD_HF_VSDB_INFO* pHfVsdbInfo = &BudgetArgs.pHdmiCaps->HfVsdbInfo;
+
+    // Workers claim whole blocks so every call runs the block loops at full width
+    std::vector<HDMI_LINK_BUDGET_RESULT> Results(NumModes);
+    std::atomic<DDU32> NextBlock(0);
+    std::atomic<DDU32> NumFeasibleShared(0);
+    DDU32 NumBlocks = DD_ROUND_UP_DIV(NumModes, HDMI_LINK_BUDGET_BLOCK_MODES);
+
+    auto StartTime = std::chrono::steady_clock::now();
+    NumThreads = std::max(1u, std::min<uint32_t>(NumThreads, NumBlocks));
+    for (uint32_t WorkerIndex = 0; WorkerIndex < NumThreads; WorkerIndex++)
+    {
+        Workers.emplace_back([&]() {
+            for (DDU32 Block = NextBlock++; Block < NumBlocks; Block = NextBlock++)
+            {
+                DDU32 FirstMode = Block * HDMI_LINK_BUDGET_BLOCK_MODES;
+
+                NumFeasibleShared += DisplayInfoRoutinesComputeHdmiLinkBudgets(&BudgetArgs, FirstMode, std::min<DDU32>(NumModes - FirstMode, HDMI_LINK_BUDGET_BLOCK_MODES),
+                                                                               &Results[FirstMode]);
+            }
+        });
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+    NumFeasible = NumFeasibleShared;
+
+    if (!OutPath.empty())
+    {
+        OUTPUT_WRITER Writer;
+
+        Writer.Buffer.reserve(NumModes * 128 + 256);
+        writerPut(&Writer, "mode,h_active,v_active,refresh,dot_clock_hz,status,link,frl_rate_index,link_rate_mbps,lanes,bpc,dsc,dsc_bpp,dsc_slices,"
+                           "pixel_clock_hz,tmds_char_rate_hz,tb_borrowed\n");
+        for (const HDMI_LINK_BUDGET_RESULT& Result : Results)
+        {
+            const DD_TIMING_INFO& Timing = pModes[Result.ModeIndex];
+
+            writerPutDec(&Writer, Result.ModeIndex);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, Timing.HActive);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, Timing.VActive);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, Timing.VRoundedRR);
+            writerPut(&Writer, ",");
+            writerPutDec(&Writer, Timing.DotClockInHz);
+            writerPut(&Writer, ",");
+            writerPutHex(&Writer, static_cast<uint32_t>(Result.Status));
+            if (IS_DDSTATUS_SUCCESS(Result.Status))
+            {
+                if (Result.IsFrl)
+                {
+                    writerPut(&Writer, ",frl,");
+                }
+                else
+                {
+                    writerPut(&Writer, ",tmds,");
+                }
+                writerPutDec(&Writer, Result.FrlRateIndex);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.LinkRateMbps);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.LaneCount);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.Bpc);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, static_cast<uint32_t>(Result.IsDscEnabled));
+                writerPut(&Writer, ",");
+                if (Result.IsDscEnabled)
+                {
+                    writerPutBppx16(&Writer, Result.DscBppx16);
+                }
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.DscSlices);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.PixelClockHz);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.TmdsCharRateHz);
+                writerPut(&Writer, ",");
+                writerPutDec(&Writer, Result.TbBorrowed);
+                writerPut(&Writer, "\n");
+            }
+            else
+            {
+                writerPut(&Writer, ",,,,,,,,,,,\n");
+            }
+        }
+
+        if (OutPath == "-")
+        {
+            std::cout.write(Writer.Buffer.data(), Writer.Buffer.size());
+            std::cout.flush();
+        }
+        else if (!writeOutputFile(OutPath, Writer.Buffer))
+        {
+            std::cerr << "Unable to write " << OutPath << std::endl;
+            parseSessionFree(pSession);
+            DD_SAFE_FREE(pSession);
+            return 1;
+        }
+    }
+
+    std::cerr << "Budgeted " << NumModes << " modes, " << NumFeasible << " fit, sink max TMDS " << pHfVsdbInfo->MaxTmdsCharRateCsc << " csc, FRL "
+              << pHfVsdbInfo->MaxFrlInMbps << " Mbps x " << static_cast<uint32_t>(pHfVsdbInfo->MaxFrlLaneCount) << ", DSC FRL " << pHfVsdbInfo->MaxDscFrlInMbps
+              << " Mbps x " << static_cast<uint32_t>(pHfVsdbInfo->MaxDscFrlLaneCount) << ", in " << (Seconds * 1e3) << " ms with " << NumThreads
+              << " threads" << std::endl;
+
+    if (IsVerify)
+    {
+        static const DDU8 DscSliceCounts[] = { 1, 2, 4, 8, 12, 16 };
+        HDMI_LINK_BUDGET_LINK Links[NUM_FRL_LINK_RATES];
+        std::vector<DDU32> Formats;
+        uint64_t NumChecked = 0;
+        DDU64 MaxTmdsCharRateHz = (pHfVsdbInfo->IsHfVsdbInfoValid && (0 != pHfVsdbInfo->MaxTmdsCharRateCsc)) ? pHfVsdbInfo->MaxTmdsCharRateCsc :
+                                  (0 != BudgetArgs.pHdmiCaps->HdmiVsdbMaxTmdsClockRate)                    ? BudgetArgs.pHdmiCaps->HdmiVsdbMaxTmdsClockRate :
+                                                                                                             TMDS_CHAR_RATE_165MCSC;
+        DDU8 MaxFrlRateIndex = DD_IS_FRL_MODE_SUPPORTED(*pHfVsdbInfo) ? DisplayInfoRoutinesGetMaxHdmiFrlRateIndex(pHfVsdbInfo->MaxFrlInMbps, pHfVsdbInfo->MaxFrlLaneCount) : 0;
+        DDU8 MaxDscFrlRateIndex = DD_MIN(MaxFrlRateIndex, DisplayInfoRoutinesGetMaxHdmiFrlRateIndex(pHfVsdbInfo->MaxDscFrlInMbps, pHfVsdbInfo->MaxDscFrlLaneCount));
+        DDU32 NumLinks = DisplayInfoRoutinesGetHdmiBudgetLinks(MaxFrlRateIndex, Links);
+        bool IsDscBpcSupported = ((8 == BudgetArgs.DscBpc) && pHfVsdbInfo->CompressionBpc.DSC_8BPC_Supported) ||
+                                 ((10 == BudgetArgs.DscBpc) && pHfVsdbInfo->CompressionBpc.DSC_10BPC_Supported) ||
+                                 ((12 == BudgetArgs.DscBpc) && pHfVsdbInfo->CompressionBpc.DSC_12BPC_Supported);
+
+        // Uncompressed bpcs as listed, then DSC bpps from the highest down tagged with bit 31, on the sink's bpp granularity
+        for (uint32_t Bpc : Bpcs)
+        {
+            Formats.push_back(Bpc);
+        }
+        if (pHfVsdbInfo->IsHfVsdbInfoValid && pHfVsdbInfo->IsDsc1p2Supported && IsDscBpcSupported && (0 != MaxDscFrlRateIndex) && (0 != pHfVsdbInfo->MaxDscSlices))
+        {
+            std::vector<DDU32> DscBppx16s;
+            DDU32 MinBppx16 = pHfVsdbInfo->IsDscAllBppSupported ? BudgetArgs.MinDscBppx16 : DD_ROUND_UP_DIV(BudgetArgs.MinDscBppx16, 16) * 16;
+            DDU32 StepBppx16 = pHfVsdbInfo->IsDscAllBppSupported ? BudgetArgs.DscBppStepx16 : DD_ROUND_UP_DIV(BudgetArgs.DscBppStepx16, 16) * 16;
+
+            for (DDU32 Bppx16 = MinBppx16; Bppx16 <= BudgetArgs.MaxDscBppx16; Bppx16 += StepBppx16)
+            {
+                DscBppx16s.push_back(Bppx16);
+            }
+            for (auto It = DscBppx16s.rbegin(); It != DscBppx16s.rend(); ++It)
+            {
+                Formats.push_back(*It | 0x80000000);
+            }
+        }
+
+        StartTime = std::chrono::steady_clock::now();
+        for (DDU32 Mode = 0; Mode < NumModes; Mode++)
+        {
+            const DD_TIMING_INFO& Timing = pModes[Mode];
+            HDMI_LINK_BUDGET_RESULT Expected;
+            DDU64 PixelClockHz = Timing.DotClockInHz * (static_cast<DDU64>(Timing.FvaFactorM1) + 1);
+            DDU32 PixelClockKHz = static_cast<DDU32>(DD_ROUND_UP_DIV(PixelClockHz, DD_1K));
+            DDU32 HBlank = (Timing.HTotal > Timing.HActive) ? (Timing.HTotal - Timing.HActive) : 0;
+            bool Is420 = Timing.CeData.SamplingMode.Yuv420 && !Timing.CeData.SamplingMode.Rgb && !Timing.CeData.SamplingMode.Yuv444;
+            bool IsFva = (0 != Timing.FvaFactorM1);
+            DDU32 AudioMinTb = HDMI_FRL_HBLANK_AUDIO_MIN_TB;
+            DDU32 Slices = 0;
+            bool IsFound = false;
+
+            if ((0 != BudgetArgs.AudioSampleRateHz) && (0 != PixelClockHz))
+            {
+                AudioMinTb += 32 * static_cast<DDU32>(DD_ROUND_UP_DIV(static_cast<DDU64>(BudgetArgs.AudioSampleRateHz) * Timing.HTotal,
+                                                                      PixelClockHz * ((BudgetArgs.AudioChannels <= 2) ? 4 : 1)));
+            }
+            for (DDU8 SliceCount : DscSliceCounts)
+            {
+                if ((0 == Slices) && (SliceCount <= pHfVsdbInfo->MaxDscSlices) && (PixelClockKHz <= SliceCount * pHfVsdbInfo->DscMaxPixelClockPerSliceMHz * DD_1K) &&
+                    (DD_ROUND_UP_DIV(Timing.HActive, SliceCount) <= HDMI_DSC_MAX_SLICE_WIDTH))
+                {
+                    Slices = SliceCount;
+                }
+            }
+
+            DD_ZERO_MEM(&Expected, sizeof(Expected));
+            Expected.ModeIndex = Mode;
+            Expected.PixelClockHz = PixelClockHz;
+            for (uint32_t FormatIndex = 0; !IsFound && (0 != Timing.HActive) && (0 != PixelClockKHz) && (FormatIndex < Formats.size()); FormatIndex++)
+            {
+                bool IsDsc = (0 != (Formats[FormatIndex] & 0x80000000));
+                DDU32 Bpc = IsDsc ? BudgetArgs.DscBpc : Formats[FormatIndex];
+                DDU32 Bppx16 = IsDsc ? (Formats[FormatIndex] & 0xFFFF) : (Is420 ? (Bpc * 3 * 16) / 2 : Bpc * 3 * 16);
+
+                if (IsDsc && ((0 == Slices) || (Is420 && (!pHfVsdbInfo->IsDscNative420Supported || (Bppx16 > (BudgetArgs.DscBpc * 3 * 16) / 2)))))
+                {
+                    continue;
+                }
+                for (DDU32 Link = 0; !IsFound && (Link < (IsDsc ? static_cast<DDU32>(MaxDscFrlRateIndex) + 1 : NumLinks)); Link++)
+                {
+                    DDU64 TmdsCharRateHz = (PixelClockHz * Bpc) / (Is420 ? 16 : 8);
+                    DDSTATUS Status;
+
+                    if (IsFva && (!pHfVsdbInfo->IsHfVsdbInfoValid || !pHfVsdbInfo->IsFvaSupported || (0 == Link)))
+                    {
+                        continue;
+                    }
+                    if ((0 == Link) && IsDsc)
+                    {
+                        continue;
+                    }
+                    if (0 == Link)
+                    {
+                        Status = ((TmdsCharRateHz <= MaxTmdsCharRateHz) && ((TmdsCharRateHz <= TMDS_CHAR_RATE_340MCSC) || DD_IS_SCRAMBLING_SUPPORTED(*pHfVsdbInfo))) ?
+                                     DDS_SUCCESS :
+                                     DDS_DPL_HDMI_FRL_NOT_SUPPORTED_BY_SINK;
+                    }
+                    else if (IsDsc)
+                    {
+                        Status = DisplayInfoRoutinesCheckHdmiDscLine(pHfVsdbInfo, Bppx16, Slices, AudioMinTb, Links[Link].CapCharsPerMs, PixelClockKHz, Timing.HActive, HBlank);
+                    }
+                    else
+                    {
+                        Status = DisplayInfoRoutinesCheckHdmiFrlLine(DD_ROUND_UP_DIV(Timing.HActive * Bppx16, 24 * 16), DD_ROUND_UP_DIV(HBlank * Bppx16, 24 * 16), AudioMinTb,
+                                                                     Links[Link].CapCharsPerMs, PixelClockKHz, Timing.HActive, HBlank);
+                    }
+                    NumChecked++;
+
+                    if (IS_DDSTATUS_SUCCESS(Status))
+                    {
+                        IsFound = true;
+                        Expected.IsFrl = (0 != Link);
+                        Expected.FrlRateIndex = Links[Link].FrlRateIndex;
+                        Expected.LinkRateMbps = Links[Link].LinkRateMbps;
+                        Expected.LaneCount = Expected.IsFrl ? Links[Link].LaneCount : MAX_HDMI_LANES_TMDS_MODE;
+                        Expected.Bpc = Bpc;
+                        Expected.IsDscEnabled = IsDsc;
+                        Expected.DscBppx16 = IsDsc ? Bppx16 : 0;
+                        Expected.DscSlices = IsDsc ? static_cast<DDU8>(Slices) : 0;
+                        Expected.TmdsCharRateHz = Expected.IsFrl ? 0 : TmdsCharRateHz;
+                    }
+                }
+            }
+
+            // Status and borrowed tribytes are the budget's own, only the chosen link config is compared
+            HDMI_LINK_BUDGET_RESULT Actual = Results[Mode];
+            Expected.Status = IsFound ? DDS_SUCCESS : Actual.Status;
+            Actual.TbBorrowed = 0;
+            if (IsFound != IS_DDSTATUS_SUCCESS(Actual.Status) || (0 != DD_MEM_CMP(&Expected, &Actual, sizeof(Expected))))
+            {
+                std::cerr << "Mode " << Mode << " (" << Timing.HActive << "x" << Timing.VActive << "@" << Timing.VRoundedRR << ") MISMATCH" << std::endl;
+                IsMismatch = true;
+            }
+        }
+        Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+        std::cerr << "every config: " << NumChecked << " checked (" << Formats.size() << " formats, " << NumLinks << " links) in " << (Seconds * 1e3) << " ms, "
+                  << (IsMismatch ? "MISMATCH" : "same as budgeted") << std::endl;
+    }
+
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pSession);
+    return IsMismatch ? 1 : 0;
+}
@@ -0,0 +1,30 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidLinkPlanners.h
+ * @brief DSC sweep, DP link plan, MST allocation and HDMI link budget command lines.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include "EdidParseSession.h"
+
+DDU32 computeHdmiLinkBudgets(const EDID_PARSE_SESSION* pSession, std::vector<HDMI_LINK_BUDGET_RESULT>& Results);
+int runDscSweep(int argc, char* argv[]);
+int runDpLinkPlan(int argc, char* argv[]);
+int runMstAlloc(int argc, char* argv[]);
+int runHdmiLinkBudget(int argc, char* argv[]);
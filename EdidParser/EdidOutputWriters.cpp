@@ -0,0 +1,1124 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2021-2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "EdidOutputWriters.h"
+#include "EdidBinaryFormat.h"
+
+/**
+ * @brief
+ *
+ * @param  pWriter
+ * @param  pPnpId
+ * @return void
+ */
+static void writeXmlPnpId(OUTPUT_WRITER* pWriter, const DD_PNP_ID* pPnpId)
+{
+    writerPut(pWriter, "      <PnpId ");
+    writerPut(pWriter, "ManufacturerID = \"0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->ManufacturerID[0]));
+    writerPut(pWriter, " 0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->ManufacturerID[1]));
+    writerPut(pWriter, "\" ProductID = \"0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->ProductID[0]));
+    writerPut(pWriter, " 0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->ProductID[1]));
+    writerPut(pWriter, "\" SerialNumber = \"0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->SerialNumber[0]));
+    writerPut(pWriter, " 0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->SerialNumber[1]));
+    writerPut(pWriter, " 0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->SerialNumber[2]));
+    writerPut(pWriter, " 0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->SerialNumber[3]));
+    writerPut(pWriter, "\" WeekOfManufacture = \"0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->WeekOfManufacture));
+    writerPut(pWriter, "\" YearOfManufacture = \"0x");
+    writerPutHex(pWriter, static_cast<uint16_t>(pPnpId->YearOfManufacture));
+    writerPut(pWriter, "\"/>\n");
+}
+
+/**
+ * @brief Chroma values are written in decimal after the 0x prefix, as the tool always did.
+ *
+ * @param  pWriter
+ * @param  pChromaLumaData
+ * @return void
+ */
+static void writeXmlChromaLumaData(OUTPUT_WRITER* pWriter, const DD_CHROMA_AND_LUMA_DATA* pChromaLumaData)
+{
+    writerPut(pWriter, "<Chroma Data= \"0x");
+    writerPutDec(pWriter, pChromaLumaData->RedX);
+    writerPut(pWriter, " 0x");
+    writerPutDec(pWriter, pChromaLumaData->RedY);
+    writerPut(pWriter, " 0x");
+    writerPutDec(pWriter, static_cast<uint16_t>(pChromaLumaData->GreenX));
+    writerPut(pWriter, " 0x");
+    writerPutDec(pWriter, static_cast<uint16_t>(pChromaLumaData->GreenY));
+    writerPut(pWriter, " 0x");
+    writerPutDec(pWriter, static_cast<uint16_t>(pChromaLumaData->BlueX));
+    writerPut(pWriter, " 0x");
+    writerPutDec(pWriter, static_cast<uint16_t>(pChromaLumaData->BlueY));
+    writerPut(pWriter, " 0x");
+    writerPutDec(pWriter, static_cast<uint16_t>(pChromaLumaData->WhiteX));
+    writerPut(pWriter, " 0x");
+    writerPutDec(pWriter, static_cast<uint16_t>(pChromaLumaData->WhiteY));
+    writerPut(pWriter, "\"/>\n");
+}
+
+/**
+ * @brief
+ *
+ * @param  pWriter
+ * @param  pSad
+ * @return void
+ */
+static void writeXmlSad(OUTPUT_WRITER* pWriter, const CEA_861B_ADB* pSad)
+{
+    writerPut(pWriter, "MaxChannels = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->MaxChannels));
+    writerPut(pWriter, "\" AudioFormatCode = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->AudioFormatCode));
+    writerPut(pWriter, "\" _32kHzSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_32kHz));
+    writerPut(pWriter, "\"  _44kHzSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_44kHz));
+    writerPut(pWriter, "\"  _48kHzSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_32kHz));
+    writerPut(pWriter, "\"  _88kHzSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_48kHz));
+    writerPut(pWriter, "\"  _96kHzSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_32kHz));
+    writerPut(pWriter, "\"  _176kHzSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_88kHz));
+    writerPut(pWriter, "\"  _192kHzSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_32kHz));
+    writerPut(pWriter, "\"\n");
+
+    writerPut(pWriter, " _16BitSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_16Bit));
+    writerPut(pWriter, "\"  _20BitSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_20Bit));
+    writerPut(pWriter, "\"  _24BitSupport = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pSad->_24Bit));
+    writerPut(pWriter, "\" >\n");
+}
+
+/**
+ * @brief
+ *
+ * @param  pWriter
+ * @param  pAudioCaps
+ * @return void
+ */
+static void writeXmlAudioCaps(OUTPUT_WRITER* pWriter, const DD_EDID_AUDIO_CAPS* pAudioCaps)
+{
+    uint32_t Count = 0;
+
+    writerPut(pWriter, "    <CeAudioCaps IsLpcmSadFound = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pAudioCaps->IsLpcmSadFound));
+    writerPut(pWriter, "\" SpeakerAllocationBlock = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pAudioCaps->SpeakerAllocationBlock));
+    writerPut(pWriter, "\"\nNumSADBlocks = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pAudioCaps->NumSADBytes));
+    writerPut(pWriter, "\">\n");
+
+    if (pAudioCaps->IsLpcmSadFound)
+    {
+        writerPut(pWriter, "      <LpcmSAD ");
+        writeXmlSad(pWriter, &pAudioCaps->LpcmSad);
+        writerPut(pWriter, "      </LpcmSAD>\n");
+
+        Count++;
+    }
+
+    for (; Count < pAudioCaps->NumSADBytes; Count++)
+    {
+        writerPut(pWriter, "      <SADBlock");
+        writerPutDec(pWriter, Count);
+        writerPut(pWriter, " ");
+        writeXmlSad(pWriter, &pAudioCaps->SadBlock[Count]);
+        writerPut(pWriter, "      </SADBlock");
+        writerPutDec(pWriter, Count);
+        writerPut(pWriter, ">\n");
+    }
+    writerPut(pWriter, "    </CeAudioCaps>\n");
+}
+
+/**
+ * @brief
+ *
+ * @param  pWriter
+ * @param  pTiledBlock
+ * @return void
+ */
+static void writeXmlTiledBlock(OUTPUT_WRITER* pWriter, const DD_TILED_DISPLAY_INFO_BLOCK* pTiledBlock)
+{
+    if (pTiledBlock->IsValidBlock)
+    {
+        writerPut(pWriter, "    <TiledBlock \n");
+        writerPut(pWriter, "      IsValidBlock = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->IsValidBlock));
+        writerPut(pWriter, "\" InSinglePhysicalDisplayEnclosure = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->InSinglePhysicalDisplayEnclosure));
+        writerPut(pWriter, "\" IsBezelInfoAvailable = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->IsBezelInfoAvailable));
+        writerPut(pWriter, "\" TiledScaling = \"");
+        writerPutDec(pWriter, static_cast<int>(pTiledBlock->Scaling));
+        writerPut(pWriter, "\"       BlockRevision = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->BlockRevision));
+        writerPut(pWriter, "\"\n");
+
+        writerPut(pWriter, "      TotalNumberOfHTiles = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->TotalNumberOfHTiles));
+        writerPut(pWriter, "\" TotalNumberOfVTiles = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->TotalNumberOfVTiles));
+        writerPut(pWriter, "\" HTileLocation = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->HTileLocation));
+        writerPut(pWriter, "\" VTileLocation = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->VTileLocation));
+        writerPut(pWriter, "\" HTileSizeInPixels = \"");
+        writerPutDec(pWriter, pTiledBlock->HTileSizeInPixels);
+        writerPut(pWriter, "\"  VTileSizeInLines = \"");
+        writerPutDec(pWriter, pTiledBlock->VTileSizeInLines);
+        writerPut(pWriter, "\" PixelMultiplier = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->PixelMultiplier));
+        writerPut(pWriter, "\" >\n");
+
+        writerPut(pWriter, "      <BezelInfo TopBezelsize = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->TopBezelsize));
+        writerPut(pWriter, "\" BottomBezelsize = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->BottomBezelsize));
+        writerPut(pWriter, "\" RightBezelsize = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->RightBezelsize));
+        writerPut(pWriter, "\" LeftBezelsize = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pTiledBlock->LeftBezelsize));
+        writerPut(pWriter, "\" > </BezelInfo>\n");
+
+        DD_PNP_ID PnpId;
+        DD_ZERO_MEM(&PnpId, sizeof(PnpId));
+        PnpId.ManufacturerID[0] = pTiledBlock->ManufacturerID[0];
+        PnpId.ManufacturerID[1] = pTiledBlock->ManufacturerID[1];
+        ////PnpId.ManufacturerID[2] = pTiledBlock.ManufacturerID[2]; Not
+        // printing
+        PnpId.ProductID[0] = pTiledBlock->ProductID[0];
+        PnpId.ProductID[1] = pTiledBlock->ProductID[1];
+        PnpId.SerialNumber[0] = pTiledBlock->SerialNumber[0];
+        PnpId.SerialNumber[1] = pTiledBlock->SerialNumber[1];
+        PnpId.SerialNumber[2] = pTiledBlock->SerialNumber[2];
+        PnpId.SerialNumber[3] = pTiledBlock->SerialNumber[3];
+        writeXmlPnpId(pWriter, &PnpId);
+        writerPut(pWriter, "    </TiledBlock>\n");
+    }
+}
+
+/**
+ * @brief
+ *
+ * @param  pWriter
+ * @param  pRrSwitchCaps
+ * @return void
+ */
+static void writeXmlRrSwitchCaps(OUTPUT_WRITER* pWriter, const DD_RR_SWITCH_CAPS* pRrSwitchCaps)
+{
+    writerPut(pWriter, "    <VrrDisplayCaps MinRR=\"");
+    writerPutDec(pWriter, uint32_t(pRrSwitchCaps->VariableRrCaps.MinRr1000 / 1000));
+    writerPut(pWriter, "\" MaxRR=\"");
+    writerPutDec(pWriter, uint32_t(pRrSwitchCaps->VariableRrCaps.MaxRr1000 / 1000));
+    writerPut(pWriter, "\" />\n");
+
+    writerPut(pWriter, "    <RrSwitchCaps IsFullRrRangeSupported=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->FixedRrCaps.IsFullRrRangeSupported ? 1 : 0));
+    writerPut(pWriter, "\" IsFlickerParamsValid=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->IsFlickerParamsValid ? 1 : 0));
+    writerPut(pWriter, "\" MinRr1000=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->VariableRrCaps.MinRr1000));
+    writerPut(pWriter, "\" MaxRr1000=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->VariableRrCaps.MaxRr1000));
+    writerPut(pWriter, "\" SfditInUs=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->SfditInUs));
+    writerPut(pWriter, "\" SfddtInUs=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->SfddtInUs));
+    writerPut(pWriter, "\" NumberOfAsDescriptors=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->NumberOfAsDescriptors));
+    writerPut(pWriter, "\" >\n");
+
+    for (int i = 0; i < pRrSwitchCaps->NumberOfAsDescriptors; i++)
+    {
+        writerPut(pWriter, "<AsDescriptor NumAdded= \"");
+        writerPutDec(pWriter, i + 1);
+        writerPut(pWriter, "\" IsAvtSupported=\"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].IsAvtSupported ? 1 : 0));
+        writerPut(pWriter, "\" MinRr1000=\"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].MinRr1000));
+        writerPut(pWriter, "\" MaxRr1000=\"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].MaxRr1000));
+        writerPut(pWriter, "\" SfditInUs=\"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].SfditInUs));
+        writerPut(pWriter, "\" SfddtInUs=\"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].SfddtInUs));
+        writerPut(pWriter, "\" />");
+    }
+
+    writerPut(pWriter, "    </RrSwitchCaps> ");
+}
+
+/**
+ * @brief
+ *
+ * @param  pWriter
+ * @param  pCaps
+ * @return void
+ */
+static void writeXmlDisplayCaps(OUTPUT_WRITER* pWriter, const DD_DISPLAY_CAPS* pCaps)
+{
+    writerPut(pWriter, "<EdidCaps>\n");
+    writerPut(pWriter, "<FtrSupport IsDigitalInput=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->FtrSupport.IsDigitalInput ? 1 : 0));
+    writerPut(pWriter, "\" IsDisplayIDData=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->FtrSupport.IsDisplayIDData ? 1 : 0));
+    writerPut(pWriter, "\" IsMRLBlockPresent=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->FtrSupport.IsMRLBlockPresent ? 1 : 0));
+    writerPut(pWriter, "\" IsDidAsDataBlockPresent=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->FtrSupport.IsDidAsDataBlockPresent ? 1 : 0));
+    writerPut(pWriter, "\" IsFecCapable=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->FtrSupport.IsFecCapable ? 1 : 0));
+    writerPut(pWriter, "\" IsHdcpCapable=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->FtrSupport.IsHdcpCapable ? 1 : 0));
+    writerPut(pWriter, "\" IsHdrSupported=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->FtrSupport.IsHdrSupported ? 1 : 0));
+    writerPut(pWriter, "\" />\n");
+
+    writerPut(pWriter, "<BasicDisplayCaps MonitorName=\"");
+    for (unsigned char Count : pCaps->BasicDisplayCaps.MonitorName)
+    {
+        if ((Count == 0xA) || (Count == 0x0))
+            break;
+        pWriter->Buffer.push_back(static_cast<char>(Count));
+    }
+    writerPut(pWriter, "\" MonitorNameLength=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->BasicDisplayCaps.MonitorNameLength));
+    writerPut(pWriter, "\" DisplayGamma=\"0x");
+    writerPutHex(pWriter, static_cast<uint32_t>(pCaps->BasicDisplayCaps.DisplayGamma));
+    writerPut(pWriter, "\" BpcsSupportedForAllModes=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->BasicDisplayCaps.BpcsSupportedForAllModes.ColorDepthMask));
+    writerPut(pWriter, "\" BpcsSupportedFor420Modes=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->BasicDisplayCaps.BpcsSupportedFor420Modes.ColorDepthMask));
+    writerPut(pWriter, "\" MaxDotClockSupportedInHz=\"");
+    writerPutDec(pWriter, pCaps->BasicDisplayCaps.MaxDotClockSupportedInHz);
+    writerPut(pWriter, "\" HSize=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->BasicDisplayCaps.HSize));
+    writerPut(pWriter, "\" VSize=\"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->BasicDisplayCaps.VSize));
+    writerPut(pWriter, "\" MaxSymbolClockInMHz=\"");
+    writerPutDec(pWriter, pCaps->BasicDisplayCaps.MaxSymbolClockInMHz);
+    writerPut(pWriter, "\" >\n");
+    writeXmlPnpId(pWriter, &pCaps->BasicDisplayCaps.BaseBlkPnpID);
+    writeXmlChromaLumaData(pWriter, &pCaps->BasicDisplayCaps.ChromaLumaData);
+    writerPut(pWriter, "</BasicDisplayCaps>\n");
+
+    // HDMI, HDR and CE video caps, CeAudioCaps (writeXmlAudioCaps) and TiledBlock (writeXmlTiledBlock) are not
+    // part of the output
+    writerPut(pWriter, "<CeExtnCaps \n");
+    writerPut(pWriter, "IsMsoCapable   = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->MsoDisplayCaps.IsMsoCapable));
+    writerPut(pWriter, "\"  NumOfLinks   = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->MsoDisplayCaps.NumOfLinks));
+    writerPut(pWriter, "\"  OverlapPixelCount   = \"");
+    writerPutDec(pWriter, static_cast<uint32_t>(pCaps->MsoDisplayCaps.OverlapPixelCount));
+    writerPut(pWriter, "\" />\n");
+
+    writeXmlRrSwitchCaps(pWriter, &pCaps->RrSwitchCaps);
+
+    writerPut(pWriter, "  </EdidCaps>\n");
+}
+
+/**
+ * @brief
+ *
+ * @param  pWriter
+ * @param  pModeTable
+ * @return void
+ */
+static void writeXmlModes(OUTPUT_WRITER* pWriter, const DD_TABLE* pModeTable)
+{
+    for (uint32_t entry = 0; entry < pModeTable->NumEntries; entry++)
+    {
+        const DD_TIMING_INFO* pMode = (static_cast<const DD_TIMING_INFO*>(pModeTable->pEntry) + entry);
+
+        writerPut(pWriter, "  <TimingInfo NumAdded = \"");
+        writerPutDec(pWriter, entry + 1);
+        writerPut(pWriter, "\">  \n");
+
+        writerPut(pWriter, "    <Timings \nHActive = \"");
+        writerPutDec(pWriter, pMode->HActive);
+        writerPut(pWriter, "\" HTotal = \"");
+        writerPutDec(pWriter, pMode->HTotal);
+        writerPut(pWriter, "\" DotClockInHz = \"");
+        writerPutDec(pWriter, pMode->DotClockInHz);
+        writerPut(pWriter, "\" HBlankStart = \"");
+        writerPutDec(pWriter, pMode->HBlankStart);
+        writerPut(pWriter, "\" HBlankEnd = \"");
+        writerPutDec(pWriter, pMode->HBlankEnd);
+        writerPut(pWriter, "\" HSyncStart = \"");
+        writerPutDec(pWriter, pMode->HSyncStart);
+        writerPut(pWriter, "\" HSyncEnd = \"");
+        writerPutDec(pWriter, pMode->HSyncEnd);
+        writerPut(pWriter, "\" HRefresh = \"");
+        writerPutDec(pWriter, pMode->HRefresh);
+        writerPut(pWriter, "\" VActive = \"");
+        writerPutDec(pWriter, pMode->VActive);
+        writerPut(pWriter, "\" VTotal = \"");
+        writerPutDec(pWriter, pMode->VTotal);
+        writerPut(pWriter, "\" VBlankStart = \"");
+        writerPutDec(pWriter, pMode->VBlankStart);
+        writerPut(pWriter, "\" VBlankEnd = \"");
+        writerPutDec(pWriter, pMode->VBlankEnd);
+        writerPut(pWriter, "\" VSyncStart = \"");
+        writerPutDec(pWriter, pMode->VSyncStart);
+        writerPut(pWriter, "\" VSyncEnd = \"");
+        writerPutDec(pWriter, pMode->VSyncEnd);
+        writerPut(pWriter, "\" VRoundedRR = \"");
+        writerPutDec(pWriter, pMode->VRoundedRR);
+        writerPut(pWriter, "\" IsInterlaced = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->IsInterlaced));
+        writerPut(pWriter, "\" HSyncPolarity = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->HSyncPolarity));
+        writerPut(pWriter, "\" VSyncPolarity = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->VSyncPolarity));
+        writerPut(pWriter, "\" ModeType = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->ModeType));
+        writerPut(pWriter, "\" S3DFormat = \"0x");
+        writerPutHex(pWriter, pMode->S3DFormatMask);
+        writerPut(pWriter, "\" SignalStandard = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->SignalStandard));
+        writerPut(pWriter, "\" FvaFactorM1 = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->FvaFactorM1));
+        writerPut(pWriter, "\" PreferredMode =  \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->Flags.PreferredMode ? 1 : 0));
+        writerPut(pWriter, "\" SupportedBPCMask = \"");
+        writerPutDec(pWriter, pMode->Flags.SupportedBPCMask.ColorDepthMask);
+        writerPut(pWriter, "\" PixelReplication =  \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.PixelReplication));
+        writerPut(pWriter, "\" IsCeaNativeFormat = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.IsNativeFormat[0]));
+        writerPut(pWriter, "\" SamplingMode = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.SamplingMode.Value));
+        writerPut(pWriter, "\" VicID = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.VicId[0]));
+        writerPut(pWriter, "\"\nAspectRatio = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.Par[0].Value));
+        writerPut(pWriter, "\" ");
+        if ((pMode->CeData.VicId[0] != VIC_UNDEFINED) && (pMode->CeData.VicId[1] != VIC_UNDEFINED))
+        {
+            writerPut(pWriter, "IsCeaNativeFormat1 = \"");
+            writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.IsNativeFormat[1]));
+            writerPut(pWriter, "\" VicID1 = \"");
+            writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.VicId[1]));
+            writerPut(pWriter, "\" \nAspectRatio1 = \"");
+            writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.Par[1].Value));
+            writerPut(pWriter, "\" ");
+        }
+        writerPut(pWriter, "VicId4k2k = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->CeData.VicId4k2k));
+        writerPut(pWriter, "\" PixelOverlapCount = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->Flags.PixelOverlapCount));
+        writerPut(pWriter, "\" NumLinks = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->Flags.NumLinks));
+        writerPut(pWriter, "\" DscCapable = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->Flags.DscCapable));
+        writerPut(pWriter, "\" Is64BppPossible = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pMode->Flags.Is64BppPossible));
+        writerPut(pWriter, "\" />\n");
+
+        writerPut(pWriter, "</TimingInfo>\n");
+    }
+
+    writerPut(pWriter, "\n<TotalEDIDModes Num = \"");
+    writerPutDec(pWriter, pModeTable->NumEntries);
+    writerPut(pWriter, "\"/> \n\n\n");
+}
+
+/**
+ * @brief Appends the <HdmiLinkBudget> element, one <Budget> per budgeted mode, NumAdded naming its <TimingInfo>.
+ *
+ * @param  pWriter
+ * @param  pModeTable
+ * @param  pHdmiBudgets
+ * @param  NumHdmiBudgets
+ * @return void
+ */
+static void writeXmlHdmiLinkBudgets(OUTPUT_WRITER* pWriter, const DD_TABLE* pModeTable, const HDMI_LINK_BUDGET_RESULT* pHdmiBudgets, DDU32 NumHdmiBudgets)
+{
+    writerPut(pWriter, "<HdmiLinkBudget>\n");
+    for (uint32_t entry = 0; entry < NumHdmiBudgets; entry++)
+    {
+        const HDMI_LINK_BUDGET_RESULT* pBudget = &pHdmiBudgets[entry];
+        const DD_TIMING_INFO* pMode = (static_cast<const DD_TIMING_INFO*>(pModeTable->pEntry) + pBudget->ModeIndex);
+
+        writerPut(pWriter, "  <Budget NumAdded = \"");
+        writerPutDec(pWriter, pBudget->ModeIndex + 1);
+        writerPut(pWriter, "\" HActive = \"");
+        writerPutDec(pWriter, pMode->HActive);
+        writerPut(pWriter, "\" VActive = \"");
+        writerPutDec(pWriter, pMode->VActive);
+        writerPut(pWriter, "\" VRoundedRR = \"");
+        writerPutDec(pWriter, pMode->VRoundedRR);
+        writerPut(pWriter, "\" Status = \"0x");
+        writerPutHex(pWriter, static_cast<uint32_t>(pBudget->Status));
+        if (IS_DDSTATUS_SUCCESS(pBudget->Status))
+        {
+            if (pBudget->IsFrl)
+            {
+                writerPut(pWriter, "\" Link = \"frl");
+            }
+            else
+            {
+                writerPut(pWriter, "\" Link = \"tmds");
+            }
+        }
+        else
+        {
+            writerPut(pWriter, "\" Link = \"none");
+        }
+        writerPut(pWriter, "\" FrlRateIndex = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pBudget->FrlRateIndex));
+        writerPut(pWriter, "\" LinkRateMbps = \"");
+        writerPutDec(pWriter, pBudget->LinkRateMbps);
+        writerPut(pWriter, "\" LaneCount = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pBudget->LaneCount));
+        writerPut(pWriter, "\" Bpc = \"");
+        writerPutDec(pWriter, pBudget->Bpc);
+        writerPut(pWriter, "\" IsDscEnabled = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pBudget->IsDscEnabled ? 1 : 0));
+        writerPut(pWriter, "\" DscBppx16 = \"");
+        writerPutDec(pWriter, pBudget->DscBppx16);
+        writerPut(pWriter, "\" DscSlices = \"");
+        writerPutDec(pWriter, static_cast<uint32_t>(pBudget->DscSlices));
+        writerPut(pWriter, "\" PixelClockHz = \"");
+        writerPutDec(pWriter, pBudget->PixelClockHz);
+        writerPut(pWriter, "\" TmdsCharRateHz = \"");
+        writerPutDec(pWriter, pBudget->TmdsCharRateHz);
+        writerPut(pWriter, "\" TbBorrowed = \"");
+        writerPutDec(pWriter, pBudget->TbBorrowed);
+        writerPut(pWriter, "\" />\n");
+    }
+    writerPut(pWriter, "</HdmiLinkBudget>\n\n");
+}
+
+/**
+ * @brief Appends a string escaped for use as XML attribute value.
+ *
+ * @param  pWriter
+ * @param  pValue
+ * @return void
+ */
+static void xmlPutAttribute(OUTPUT_WRITER* pWriter, const char* pValue)
+{
+    for (; *pValue != '\0'; pValue++)
+    {
+        switch (*pValue)
+        {
+        case '&': writerPut(pWriter, "&amp;"); break;
+        case '<': writerPut(pWriter, "&lt;"); break;
+        case '>': writerPut(pWriter, "&gt;"); break;
+        case '"': writerPut(pWriter, "&quot;"); break;
+        default: pWriter->Buffer.push_back(*pValue); break;
+        }
+    }
+}
+
+/**
+ * @brief Appends the <EDID> element for caps and mode table of an EDID.
+ *
+ * @param  pCaps
+ * @param  pModeTable
+ * @param  pHdmiBudgets HDMI link budgets of modes of the table, NULL to omit <HdmiLinkBudget>
+ * @param  NumHdmiBudgets
+ * @param  pSource file name put in Source attribute of <EDID>, NULL to omit it
+ * @param  pWriter
+ * @return void
+ */
+void writeXmlEdid(const DD_DISPLAY_CAPS* pCaps, const DD_TABLE* pModeTable, const HDMI_LINK_BUDGET_RESULT* pHdmiBudgets, DDU32 NumHdmiBudgets,
+                  const char* pSource, OUTPUT_WRITER* pWriter)
+{
+    if (NULL == pSource)
+    {
+        writerPut(pWriter, "<EDID>\n");
+    }
+    else
+    {
+        writerPut(pWriter, "<EDID Source=\"");
+        xmlPutAttribute(pWriter, pSource);
+        writerPut(pWriter, "\">\n");
+    }
+
+    writeXmlDisplayCaps(pWriter, pCaps);
+    writeXmlModes(pWriter, pModeTable);
+    if (NULL != pHdmiBudgets)
+    {
+        writeXmlHdmiLinkBudgets(pWriter, pModeTable, pHdmiBudgets, NumHdmiBudgets);
+    }
+
+    writerPut(pWriter, "</EDID>\n\n");
+}
+
+/**
+ * @brief Parses one EDID/DisplayID buffer and appends its <EDID> element to the writer.
+ *
+ * @param  pSession
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @param  pSource file name put in Source attribute of <EDID>, NULL to omit it
+ * @param  pWriter
+ * @return DDSTATUS DDS_INVALID_PARAM if buffer is too short for an EDID, DDS_SUCCESS otherwise
+ */
+DDSTATUS parseEdidToXml(EDID_PARSE_SESSION* pSession, DDU8* pEdid, size_t SizeInBytes, const char* pSource, OUTPUT_WRITER* pWriter)
+{
+    DDSTATUS Status = parseEdid(pSession, pEdid, SizeInBytes);
+
+    if (IS_DDSTATUS_ERROR(Status))
+    {
+        return Status;
+    }
+
+    writeXmlEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, NULL, 0, pSource, pWriter);
+
+    return DDS_SUCCESS;
+}
+
+/**
+ * @brief Appends a JSON string. Bytes from 0x80 up are copied as is, unless EscapeNonAscii is set.
+ *
+ * @param  pWriter
+ * @param  pValue
+ * @param  Length
+ * @param  EscapeNonAscii set for EDID strings, which are not UTF-8
+ * @return void
+ */
+static void jsonPutString(OUTPUT_WRITER* pWriter, const char* pValue, size_t Length, bool EscapeNonAscii)
+{
+    static const char HexDigits[] = "0123456789abcdef";
+
+    pWriter->Buffer.push_back('"');
+    for (size_t Index = 0; Index < Length; Index++)
+    {
+        unsigned char Ch = static_cast<unsigned char>(pValue[Index]);
+
+        if ((Ch == '"') || (Ch == '\\'))
+        {
+            pWriter->Buffer.push_back('\\');
+            pWriter->Buffer.push_back(static_cast<char>(Ch));
+        }
+        else if ((Ch < 0x20) || (Ch == 0x7F) || (EscapeNonAscii && (Ch >= 0x80)))
+        {
+            writerPut(pWriter, "\\u00");
+            pWriter->Buffer.push_back(HexDigits[Ch >> 4]);
+            pWriter->Buffer.push_back(HexDigits[Ch & 0xF]);
+        }
+        else
+        {
+            pWriter->Buffer.push_back(static_cast<char>(Ch));
+        }
+    }
+    pWriter->Buffer.push_back('"');
+}
+
+/**
+ * @brief Appends a key, given with its quotes, colon and leading comma if any, and a number.
+ *
+ * @param  pWriter
+ * @param  Key
+ * @param  Value
+ * @return void
+ */
+template <size_t N, typename T>
+static inline void jsonPutNumber(OUTPUT_WRITER* pWriter, const char (&Key)[N], T Value)
+{
+    writerPut(pWriter, Key);
+    writerPutDec(pWriter, Value);
+}
+
+/**
+ * @brief Appends a key, given with its quotes, colon and leading comma if any, and a boolean.
+ *
+ * @param  pWriter
+ * @param  Key
+ * @param  Value
+ * @return void
+ */
+template <size_t N>
+static inline void jsonPutBool(OUTPUT_WRITER* pWriter, const char (&Key)[N], bool Value)
+{
+    writerPut(pWriter, Key);
+    if (Value)
+    {
+        writerPut(pWriter, "true");
+    }
+    else
+    {
+        writerPut(pWriter, "false");
+    }
+}
+
+/**
+ * @brief Appends the EdidCaps object, with the fields of the XML <EdidCaps> element.
+ *
+ * @param  pWriter
+ * @param  pCaps
+ * @return void
+ */
+static void writeJsonDisplayCaps(OUTPUT_WRITER* pWriter, const DD_DISPLAY_CAPS* pCaps)
+{
+    const DD_BASIC_DISPLAY_CAPS* pBasicCaps = &pCaps->BasicDisplayCaps;
+    const DD_PNP_ID* pPnpId = &pBasicCaps->BaseBlkPnpID;
+    const DD_CHROMA_AND_LUMA_DATA* pChroma = &pBasicCaps->ChromaLumaData;
+    const DD_RR_SWITCH_CAPS* pRrSwitchCaps = &pCaps->RrSwitchCaps;
+    size_t NameLength = 0;
+
+    jsonPutBool(pWriter, "{\"FtrSupport\":{\"IsDigitalInput\":", pCaps->FtrSupport.IsDigitalInput);
+    jsonPutBool(pWriter, ",\"IsDisplayIDData\":", pCaps->FtrSupport.IsDisplayIDData);
+    jsonPutBool(pWriter, ",\"IsMRLBlockPresent\":", pCaps->FtrSupport.IsMRLBlockPresent);
+    jsonPutBool(pWriter, ",\"IsDidAsDataBlockPresent\":", pCaps->FtrSupport.IsDidAsDataBlockPresent);
+    jsonPutBool(pWriter, ",\"IsFecCapable\":", pCaps->FtrSupport.IsFecCapable);
+    jsonPutBool(pWriter, ",\"IsHdcpCapable\":", pCaps->FtrSupport.IsHdcpCapable);
+    jsonPutBool(pWriter, ",\"IsHdrSupported\":", pCaps->FtrSupport.IsHdrSupported);
+
+    // Name ends at line feed or NUL, as in the XML output
+    while ((NameLength < sizeof(pBasicCaps->MonitorName)) && (pBasicCaps->MonitorName[NameLength] != 0xA) &&
+           (pBasicCaps->MonitorName[NameLength] != 0x0))
+    {
+        NameLength++;
+    }
+    writerPut(pWriter, "},\"BasicDisplayCaps\":{\"MonitorName\":");
+    jsonPutString(pWriter, reinterpret_cast<const char*>(pBasicCaps->MonitorName), NameLength, true);
+    jsonPutNumber(pWriter, ",\"MonitorNameLength\":", static_cast<uint32_t>(pBasicCaps->MonitorNameLength));
+    jsonPutNumber(pWriter, ",\"DisplayGamma\":", static_cast<uint32_t>(pBasicCaps->DisplayGamma));
+    jsonPutNumber(pWriter, ",\"BpcsSupportedForAllModes\":", static_cast<uint32_t>(pBasicCaps->BpcsSupportedForAllModes.ColorDepthMask));
+    jsonPutNumber(pWriter, ",\"BpcsSupportedFor420Modes\":", static_cast<uint32_t>(pBasicCaps->BpcsSupportedFor420Modes.ColorDepthMask));
+    jsonPutNumber(pWriter, ",\"MaxDotClockSupportedInHz\":", pBasicCaps->MaxDotClockSupportedInHz);
+    jsonPutNumber(pWriter, ",\"HSize\":", static_cast<uint32_t>(pBasicCaps->HSize));
+    jsonPutNumber(pWriter, ",\"VSize\":", static_cast<uint32_t>(pBasicCaps->VSize));
+    jsonPutNumber(pWriter, ",\"MaxSymbolClockInMHz\":", pBasicCaps->MaxSymbolClockInMHz);
+
+    jsonPutNumber(pWriter, ",\"PnpId\":{\"ManufacturerID\":[", static_cast<uint32_t>(pPnpId->ManufacturerID[0]));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pPnpId->ManufacturerID[1]));
+    jsonPutNumber(pWriter, "],\"ProductID\":[", static_cast<uint32_t>(pPnpId->ProductID[0]));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pPnpId->ProductID[1]));
+    jsonPutNumber(pWriter, "],\"SerialNumber\":[", static_cast<uint32_t>(pPnpId->SerialNumber[0]));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pPnpId->SerialNumber[1]));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pPnpId->SerialNumber[2]));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pPnpId->SerialNumber[3]));
+    jsonPutNumber(pWriter, "],\"WeekOfManufacture\":", static_cast<uint32_t>(pPnpId->WeekOfManufacture));
+    jsonPutNumber(pWriter, ",\"YearOfManufacture\":", static_cast<uint32_t>(pPnpId->YearOfManufacture));
+
+    jsonPutNumber(pWriter, "},\"Chroma\":[", static_cast<uint32_t>(pChroma->RedX));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pChroma->RedY));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pChroma->GreenX));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pChroma->GreenY));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pChroma->BlueX));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pChroma->BlueY));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pChroma->WhiteX));
+    jsonPutNumber(pWriter, ",", static_cast<uint32_t>(pChroma->WhiteY));
+
+    jsonPutNumber(pWriter, "]},\"CeExtnCaps\":{\"IsMsoCapable\":", static_cast<uint32_t>(pCaps->MsoDisplayCaps.IsMsoCapable));
+    jsonPutNumber(pWriter, ",\"NumOfLinks\":", static_cast<uint32_t>(pCaps->MsoDisplayCaps.NumOfLinks));
+    jsonPutNumber(pWriter, ",\"OverlapPixelCount\":", static_cast<uint32_t>(pCaps->MsoDisplayCaps.OverlapPixelCount));
+
+    jsonPutNumber(pWriter, "},\"VrrDisplayCaps\":{\"MinRR\":", uint32_t(pRrSwitchCaps->VariableRrCaps.MinRr1000 / 1000));
+    jsonPutNumber(pWriter, ",\"MaxRR\":", uint32_t(pRrSwitchCaps->VariableRrCaps.MaxRr1000 / 1000));
+
+    jsonPutBool(pWriter, "},\"RrSwitchCaps\":{\"IsFullRrRangeSupported\":", pRrSwitchCaps->FixedRrCaps.IsFullRrRangeSupported);
+    jsonPutBool(pWriter, ",\"IsFlickerParamsValid\":", pRrSwitchCaps->IsFlickerParamsValid);
+    jsonPutNumber(pWriter, ",\"MinRr1000\":", static_cast<uint32_t>(pRrSwitchCaps->VariableRrCaps.MinRr1000));
+    jsonPutNumber(pWriter, ",\"MaxRr1000\":", static_cast<uint32_t>(pRrSwitchCaps->VariableRrCaps.MaxRr1000));
+    jsonPutNumber(pWriter, ",\"SfditInUs\":", static_cast<uint32_t>(pRrSwitchCaps->SfditInUs));
+    jsonPutNumber(pWriter, ",\"SfddtInUs\":", static_cast<uint32_t>(pRrSwitchCaps->SfddtInUs));
+    jsonPutNumber(pWriter, ",\"NumberOfAsDescriptors\":", static_cast<uint32_t>(pRrSwitchCaps->NumberOfAsDescriptors));
+    writerPut(pWriter, ",\"AsDescriptors\":[");
+    for (int i = 0; i < pRrSwitchCaps->NumberOfAsDescriptors; i++)
+    {
+        if (i > 0)
+        {
+            writerPut(pWriter, ",");
+        }
+        jsonPutBool(pWriter, "{\"IsAvtSupported\":", pRrSwitchCaps->DidAsDescriptors[i].IsAvtSupported);
+        jsonPutNumber(pWriter, ",\"MinRr1000\":", static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].MinRr1000));
+        jsonPutNumber(pWriter, ",\"MaxRr1000\":", static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].MaxRr1000));
+        jsonPutNumber(pWriter, ",\"SfditInUs\":", static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].SfditInUs));
+        jsonPutNumber(pWriter, ",\"SfddtInUs\":", static_cast<uint32_t>(pRrSwitchCaps->DidAsDescriptors[i].SfddtInUs));
+        writerPut(pWriter, "}");
+    }
+    writerPut(pWriter, "]}}");
+}
+
+/**
+ * @brief Appends the TimingInfo array and TotalEDIDModes, with the fields of the XML <TimingInfo> elements.
+ *
+ * @param  pWriter
+ * @param  pModeTable
+ * @return void
+ */
+static void writeJsonModes(OUTPUT_WRITER* pWriter, const DD_TABLE* pModeTable)
+{
+    writerPut(pWriter, "\"TimingInfo\":[");
+    for (uint32_t entry = 0; entry < pModeTable->NumEntries; entry++)
+    {
+        const DD_TIMING_INFO* pMode = (static_cast<const DD_TIMING_INFO*>(pModeTable->pEntry) + entry);
+
+        if (entry > 0)
+        {
+            writerPut(pWriter, ",");
+        }
+        jsonPutNumber(pWriter, "{\"HActive\":", pMode->HActive);
+        jsonPutNumber(pWriter, ",\"HTotal\":", pMode->HTotal);
+        jsonPutNumber(pWriter, ",\"DotClockInHz\":", pMode->DotClockInHz);
+        jsonPutNumber(pWriter, ",\"HBlankStart\":", pMode->HBlankStart);
+        jsonPutNumber(pWriter, ",\"HBlankEnd\":", pMode->HBlankEnd);
+        jsonPutNumber(pWriter, ",\"HSyncStart\":", pMode->HSyncStart);
+        jsonPutNumber(pWriter, ",\"HSyncEnd\":", pMode->HSyncEnd);
+        jsonPutNumber(pWriter, ",\"HRefresh\":", pMode->HRefresh);
+        jsonPutNumber(pWriter, ",\"VActive\":", pMode->VActive);
+        jsonPutNumber(pWriter, ",\"VTotal\":", pMode->VTotal);
+        jsonPutNumber(pWriter, ",\"VBlankStart\":", pMode->VBlankStart);
+        jsonPutNumber(pWriter, ",\"VBlankEnd\":", pMode->VBlankEnd);
+        jsonPutNumber(pWriter, ",\"VSyncStart\":", pMode->VSyncStart);
+        jsonPutNumber(pWriter, ",\"VSyncEnd\":", pMode->VSyncEnd);
+        jsonPutNumber(pWriter, ",\"VRoundedRR\":", pMode->VRoundedRR);
+        jsonPutNumber(pWriter, ",\"IsInterlaced\":", static_cast<uint32_t>(pMode->IsInterlaced));
+        jsonPutNumber(pWriter, ",\"HSyncPolarity\":", static_cast<uint32_t>(pMode->HSyncPolarity));
+        jsonPutNumber(pWriter, ",\"VSyncPolarity\":", static_cast<uint32_t>(pMode->VSyncPolarity));
+        jsonPutNumber(pWriter, ",\"ModeType\":", static_cast<uint32_t>(pMode->ModeType));
+        jsonPutNumber(pWriter, ",\"S3DFormat\":", pMode->S3DFormatMask);
+        jsonPutNumber(pWriter, ",\"SignalStandard\":", static_cast<uint32_t>(pMode->SignalStandard));
+        jsonPutNumber(pWriter, ",\"FvaFactorM1\":", static_cast<uint32_t>(pMode->FvaFactorM1));
+        jsonPutBool(pWriter, ",\"PreferredMode\":", pMode->Flags.PreferredMode);
+        jsonPutNumber(pWriter, ",\"SupportedBPCMask\":", static_cast<uint32_t>(pMode->Flags.SupportedBPCMask.ColorDepthMask));
+        jsonPutNumber(pWriter, ",\"PixelReplication\":", static_cast<uint32_t>(pMode->CeData.PixelReplication));
+        jsonPutNumber(pWriter, ",\"IsCeaNativeFormat\":", static_cast<uint32_t>(pMode->CeData.IsNativeFormat[0]));
+        jsonPutNumber(pWriter, ",\"SamplingMode\":", static_cast<uint32_t>(pMode->CeData.SamplingMode.Value));
+        jsonPutNumber(pWriter, ",\"VicID\":", static_cast<uint32_t>(pMode->CeData.VicId[0]));
+        jsonPutNumber(pWriter, ",\"AspectRatio\":", static_cast<uint32_t>(pMode->CeData.Par[0].Value));
+        if ((pMode->CeData.VicId[0] != VIC_UNDEFINED) && (pMode->CeData.VicId[1] != VIC_UNDEFINED))
+        {
+            jsonPutNumber(pWriter, ",\"IsCeaNativeFormat1\":", static_cast<uint32_t>(pMode->CeData.IsNativeFormat[1]));
+            jsonPutNumber(pWriter, ",\"VicID1\":", static_cast<uint32_t>(pMode->CeData.VicId[1]));
+            jsonPutNumber(pWriter, ",\"AspectRatio1\":", static_cast<uint32_t>(pMode->CeData.Par[1].Value));
+        }
+        jsonPutNumber(pWriter, ",\"VicId4k2k\":", static_cast<uint32_t>(pMode->CeData.VicId4k2k));
+        jsonPutNumber(pWriter, ",\"PixelOverlapCount\":", static_cast<uint32_t>(pMode->Flags.PixelOverlapCount));
+        jsonPutNumber(pWriter, ",\"NumLinks\":", static_cast<uint32_t>(pMode->Flags.NumLinks));
+        jsonPutNumber(pWriter, ",\"DscCapable\":", static_cast<uint32_t>(pMode->Flags.DscCapable));
+        jsonPutNumber(pWriter, ",\"Is64BppPossible\":", static_cast<uint32_t>(pMode->Flags.Is64BppPossible));
+        writerPut(pWriter, "}");
+    }
+    jsonPutNumber(pWriter, "],\"TotalEDIDModes\":", pModeTable->NumEntries);
+}
+
+/**
+ * @brief Appends the HdmiLinkBudget array, with the fields of the XML <Budget> elements. ModeIndex is the index in
+ *  the TimingInfo array.
+ *
+ * @param  pWriter
+ * @param  pHdmiBudgets
+ * @param  NumHdmiBudgets
+ * @return void
+ */
+static void writeJsonHdmiLinkBudgets(OUTPUT_WRITER* pWriter, const HDMI_LINK_BUDGET_RESULT* pHdmiBudgets, DDU32 NumHdmiBudgets)
+{
+    writerPut(pWriter, "\"HdmiLinkBudget\":[");
+    for (uint32_t entry = 0; entry < NumHdmiBudgets; entry++)
+    {
+        const HDMI_LINK_BUDGET_RESULT* pBudget = &pHdmiBudgets[entry];
+
+        if (entry > 0)
+        {
+            writerPut(pWriter, ",");
+        }
+        jsonPutNumber(pWriter, "{\"ModeIndex\":", pBudget->ModeIndex);
+        jsonPutNumber(pWriter, ",\"Status\":", static_cast<uint32_t>(pBudget->Status));
+        jsonPutBool(pWriter, ",\"IsFrl\":", pBudget->IsFrl);
+        jsonPutNumber(pWriter, ",\"FrlRateIndex\":", static_cast<uint32_t>(pBudget->FrlRateIndex));
+        jsonPutNumber(pWriter, ",\"LinkRateMbps\":", pBudget->LinkRateMbps);
+        jsonPutNumber(pWriter, ",\"LaneCount\":", static_cast<uint32_t>(pBudget->LaneCount));
+        jsonPutNumber(pWriter, ",\"Bpc\":", pBudget->Bpc);
+        jsonPutBool(pWriter, ",\"IsDscEnabled\":", pBudget->IsDscEnabled);
+        jsonPutNumber(pWriter, ",\"DscBppx16\":", pBudget->DscBppx16);
+        jsonPutNumber(pWriter, ",\"DscSlices\":", static_cast<uint32_t>(pBudget->DscSlices));
+        jsonPutNumber(pWriter, ",\"PixelClockHz\":", pBudget->PixelClockHz);
+        jsonPutNumber(pWriter, ",\"TmdsCharRateHz\":", pBudget->TmdsCharRateHz);
+        jsonPutNumber(pWriter, ",\"TbBorrowed\":", pBudget->TbBorrowed);
+        writerPut(pWriter, "}");
+    }
+    writerPut(pWriter, "]");
+}
+
+/**
+ * @brief Appends the NDJSON line for caps and mode table of an EDID.
+ *
+ * @param  pCaps
+ * @param  pModeTable
+ * @param  pHdmiBudgets HDMI link budgets of modes of the table, NULL to omit HdmiLinkBudget
+ * @param  NumHdmiBudgets
+ * @param  pSource file name put in Source field, NULL to omit it
+ * @param  pWriter
+ * @return void
+ */
+void writeJsonEdid(const DD_DISPLAY_CAPS* pCaps, const DD_TABLE* pModeTable, const HDMI_LINK_BUDGET_RESULT* pHdmiBudgets, DDU32 NumHdmiBudgets,
+                   const char* pSource, OUTPUT_WRITER* pWriter)
+{
+    writerPut(pWriter, "{");
+    if (NULL != pSource)
+    {
+        writerPut(pWriter, "\"Source\":");
+        jsonPutString(pWriter, pSource, strlen(pSource), false);
+        writerPut(pWriter, ",");
+    }
+
+    writerPut(pWriter, "\"EdidCaps\":");
+    writeJsonDisplayCaps(pWriter, pCaps);
+    writerPut(pWriter, ",");
+    writeJsonModes(pWriter, pModeTable);
+    if (NULL != pHdmiBudgets)
+    {
+        writerPut(pWriter, ",");
+        writeJsonHdmiLinkBudgets(pWriter, pHdmiBudgets, NumHdmiBudgets);
+    }
+
+    writerPut(pWriter, "}\n");
+}
+
+/**
+ * @brief Appends a binary record (see EdidBinaryFormat.h) for caps and mode table of an EDID.
+ *
+ * @param  pCaps
+ * @param  pModeTable
+ * @param  pBuffer start of buffer must be EDID_BIN_ALIGNMENT aligned for the record to be readable in place
+ * @return void
+ */
+void writeBinEdid(const DD_DISPLAY_CAPS* pCaps, const DD_TABLE* pModeTable, std::string* pBuffer)
+{
+    EDID_BIN_HEADER Header = { 0 };
+    size_t RecordStart = pBuffer->size();
+    size_t TimingsSize = (size_t)pModeTable->NumEntries * sizeof(DD_TIMING_INFO);
+
+    Header.Signature = EDID_BIN_SIGNATURE;
+    Header.Version = EDID_BIN_VERSION;
+    Header.HeaderSizeInBytes = sizeof(EDID_BIN_HEADER);
+    Header.CapsOffset = (DDU32)EDID_BIN_ALIGN_UP(sizeof(EDID_BIN_HEADER));
+    Header.CapsSizeInBytes = sizeof(DD_DISPLAY_CAPS);
+    Header.TimingsOffset = (DDU32)EDID_BIN_ALIGN_UP(Header.CapsOffset + sizeof(DD_DISPLAY_CAPS));
+    Header.TimingSizeInBytes = sizeof(DD_TIMING_INFO);
+    Header.NumTimings = pModeTable->NumEntries;
+    Header.RecordSizeInBytes = (DDU32)EDID_BIN_ALIGN_UP(Header.TimingsOffset + TimingsSize);
+
+    // Padding stays zero
+    pBuffer->resize(RecordStart + Header.RecordSizeInBytes);
+    DDU8* pRecord = reinterpret_cast<DDU8*>(&(*pBuffer)[RecordStart]);
+    memcpy(pRecord, &Header, sizeof(Header));
+    memcpy(pRecord + Header.CapsOffset, pCaps, sizeof(DD_DISPLAY_CAPS));
+    memcpy(pRecord + Header.TimingsOffset, pModeTable->pEntry, TimingsSize);
+}
+
+/**
+ * @brief Name of an EDID block or Display ID section type in the validation report.
+ *
+ * @param  pValidateBlocks
+ * @param  BlockNum
+ * @return const char*
+ */
+static const char* validateBlockTypeName(const DD_VALIDATE_EDID_BLOCKS* pValidateBlocks, DDU32 BlockNum)
+{
+    if (pValidateBlocks->IsDisplayIdBaseBlock)
+    {
+        return "displayid";
+    }
+    if (DDS_BUFFER_TOO_SMALL == pValidateBlocks->Blocks[BlockNum].Status)
+    {
+        return "truncated";
+    }
+    if (0 == BlockNum)
+    {
+        return "base";
+    }
+
+    switch (pValidateBlocks->Blocks[BlockNum].Tag)
+    {
+    case CEA_EXT_TAG:
+        return "cta";
+    case VTB_EXT_TAG:
+        return "vtb";
+    case EDID_2_0_EXT_TAG:
+        return "edid2";
+    case DI_EXT_TAG:
+        return "di";
+    case LS_EXT_TAG:
+        return "ls";
+    case DPVL_EXT_TAG:
+        return "dpvl";
+    case DID_EXT_TAG:
+        return "displayid";
+    case BLOCK_MAP_EXT_TAG:
+        return "blockmap";
+    case MANF_SPECIFIED_EXT_TAG:
+        return "manufacturer";
+    case 0:
+        return "empty";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * @brief Appends the validation report of an EDID, one line for the EDID followed by one line per block.
+ *
+ *  [<source> ]<valid|invalid> type=<edid|displayid> blocks=<n> valid=<n>
+ *    block=<n> offset=<bytes> size=<bytes> type=<name> tag=<hex> status=<hex>
+ *
+ * @param  pValidateBlocks
+ * @param  Status of DisplayInfoParserValidateEdidOrDisplayId
+ * @param  pSource file name put at start of the EDID line, NULL to omit it
+ * @param  pWriter
+ * @return void
+ */
+void writeValidateReport(const DD_VALIDATE_EDID_BLOCKS* pValidateBlocks, DDSTATUS Status, const char* pSource, OUTPUT_WRITER* pWriter)
+{
+    if (NULL != pSource)
+    {
+        pWriter->Buffer.append(pSource);
+        writerPut(pWriter, " ");
+    }
+
+    if (IS_DDSTATUS_SUCCESS(Status))
+    {
+        writerPut(pWriter, "valid");
+    }
+    else
+    {
+        writerPut(pWriter, "invalid");
+    }
+    if (pValidateBlocks->IsDisplayIdBaseBlock)
+    {
+        writerPut(pWriter, " type=displayid blocks=");
+    }
+    else
+    {
+        writerPut(pWriter, " type=edid blocks=");
+    }
+    writerPutDec(pWriter, pValidateBlocks->NumBlocks);
+    writerPut(pWriter, " valid=");
+    writerPutDec(pWriter, pValidateBlocks->NumValidBlocks);
+    writerPut(pWriter, "\n");
+
+    for (DDU32 BlockNum = 0; BlockNum < pValidateBlocks->NumBlocks; BlockNum++)
+    {
+        const DD_EDID_BLOCK_STATUS* pBlockStatus = &pValidateBlocks->Blocks[BlockNum];
+
+        writerPut(pWriter, "  block=");
+        writerPutDec(pWriter, BlockNum);
+        writerPut(pWriter, " offset=");
+        writerPutDec(pWriter, pBlockStatus->Offset);
+        writerPut(pWriter, " size=");
+        writerPutDec(pWriter, pBlockStatus->SizeInBytes);
+        writerPut(pWriter, " type=");
+        pWriter->Buffer.append(validateBlockTypeName(pValidateBlocks, BlockNum));
+        writerPut(pWriter, " tag=0x");
+        writerPutHex(pWriter, pBlockStatus->Tag);
+        writerPut(pWriter, " status=0x");
+        writerPutHex(pWriter, static_cast<uint32_t>(pBlockStatus->Status));
+        writerPut(pWriter, "\n");
+    }
+}
+
+/**
+ * @brief Writes a whole output file with a single write call.
+ *
+ * @param  Path
+ * @param  Data
+ * @return bool
+ */
+bool writeOutputFile(const std::string& Path, const std::string& Data)
+{
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA(Path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    DWORD BytesWritten = 0;
+    BOOL IsWritten;
+
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        return false;
+    }
+
+    IsWritten = (Data.size() <= MAXDWORD) && WriteFile(hFile, Data.data(), static_cast<DWORD>(Data.size()), &BytesWritten, NULL);
+    CloseHandle(hFile);
+
+    return IsWritten && (BytesWritten == Data.size());
+#else
+    int Fd = open(Path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    size_t Offset = 0;
+
+    if (Fd < 0)
+    {
+        return false;
+    }
+
+    // One write for regular files, loop only covers short writes
+    while (Offset < Data.size())
+    {
+        ssize_t BytesWritten = write(Fd, Data.data() + Offset, Data.size() - Offset);
+        if (BytesWritten <= 0)
+        {
+            break;
+        }
+        Offset += static_cast<size_t>(BytesWritten);
+    }
+    close(Fd);
+
+    return (Offset == Data.size());
+#endif
+}
+
+#ifdef _WIN32
+/**
+ * @brief Converts LF line ends to CRLF, as a text mode stream writes them on Windows.
+ *
+ * @param  Data
+ * @return std::string
+ */
+std::string toCrlfLineEnds(const std::string& Data)
+{
+    std::string Converted;
+
+    Converted.reserve(Data.size() + (Data.size() / 16));
+    for (char Char : Data)
+    {
+        if ('\n' == Char)
+        {
+            Converted += '\r';
+        }
+        Converted += Char;
+    }
+
+    return Converted;
+}
+#endif
@@ -0,0 +1,93 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidOutputWriters.h
+ * @brief XML, JSON, binary and validation report serializers of parse results.
+ *
+ */
+
+#pragma once
+
+#include <charconv>
+#include <string>
+#include "EdidParseSession.h"
+
+// Large enough for the XML or JSON of an EDID with a full mode table
+#define OUTPUT_WRITER_RESERVE_SIZE (256 * 1024)
+
+/**
+ * @brief Output buffer of the XML and JSON serializers. Storage is reserved once and reused across EDIDs.
+ */
+typedef struct _OUTPUT_WRITER
+{
+    std::string Buffer;
+} OUTPUT_WRITER;
+
+/**
+ * @brief Appends a string literal.
+ *
+ * @param  pWriter
+ * @param  Text
+ * @return void
+ */
+template <size_t N>
+inline void writerPut(OUTPUT_WRITER* pWriter, const char (&Text)[N])
+{
+    pWriter->Buffer.append(Text, N - 1);
+}
+
+/**
+ * @brief Appends an integer in decimal.
+ *
+ * @param  pWriter
+ * @param  Value
+ * @return void
+ */
+template <typename T>
+inline void writerPutDec(OUTPUT_WRITER* pWriter, T Value)
+{
+    char Digits[24];
+    std::to_chars_result Result = std::to_chars(Digits, Digits + sizeof(Digits), Value);
+
+    pWriter->Buffer.append(Digits, Result.ptr - Digits);
+}
+
+/**
+ * @brief Appends an integer in lower case hex, without 0x prefix.
+ *
+ * @param  pWriter
+ * @param  Value
+ * @return void
+ */
+template <typename T>
+inline void writerPutHex(OUTPUT_WRITER* pWriter, T Value)
+{
+    char Digits[24];
+    std::to_chars_result Result = std::to_chars(Digits, Digits + sizeof(Digits), Value, 16);
+
+    pWriter->Buffer.append(Digits, Result.ptr - Digits);
+}
+
+void writeXmlEdid(const DD_DISPLAY_CAPS* pCaps, const DD_TABLE* pModeTable, const HDMI_LINK_BUDGET_RESULT* pHdmiBudgets, DDU32 NumHdmiBudgets,
+                  const char* pSource, OUTPUT_WRITER* pWriter);
+DDSTATUS parseEdidToXml(EDID_PARSE_SESSION* pSession, DDU8* pEdid, size_t SizeInBytes, const char* pSource, OUTPUT_WRITER* pWriter);
+void writeJsonEdid(const DD_DISPLAY_CAPS* pCaps, const DD_TABLE* pModeTable, const HDMI_LINK_BUDGET_RESULT* pHdmiBudgets, DDU32 NumHdmiBudgets,
+                   const char* pSource, OUTPUT_WRITER* pWriter);
+void writeBinEdid(const DD_DISPLAY_CAPS* pCaps, const DD_TABLE* pModeTable, std::string* pBuffer);
+void writeValidateReport(const DD_VALIDATE_EDID_BLOCKS* pValidateBlocks, DDSTATUS Status, const char* pSource, OUTPUT_WRITER* pWriter);
+bool writeOutputFile(const std::string& Path, const std::string& Data);
+#ifdef _WIN32
+std::string toCrlfLineEnds(const std::string& Data);
+#endif
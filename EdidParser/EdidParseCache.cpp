@@ -0,0 +1,398 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+
+#include <charconv>
+#include <filesystem>
+#include <thread>
+#include "EdidParseCache.h"
+#include "EdidInputFiles.h"
+#include "EdidOutputWriters.h"
+#include "EdidBinaryFormat.h"
+
+#define PARSE_CACHE_FILE_SIGNATURE 0x43504445 // "EDPC"
+#define PARSE_CACHE_FILE_EXTENSION ".edidcache"
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t xxhRotl64(uint64_t Value, uint32_t Bits)
+{
+    return (Value << Bits) | (Value >> (64 - Bits));
+}
+
+static inline uint64_t xxhRead64(const DDU8* pData)
+{
+    uint64_t Value;
+
+    memcpy(&Value, pData, sizeof(Value));
+    return Value;
+}
+
+static inline uint64_t xxhRound(uint64_t Acc, uint64_t Input)
+{
+    return xxhRotl64(Acc + Input * XXH_PRIME64_2, 31) * XXH_PRIME64_1;
+}
+
+static inline uint64_t xxhMergeRound(uint64_t Acc, uint64_t Value)
+{
+    return (Acc ^ xxhRound(0, Value)) * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/**
+ * @brief XXH64 of a buffer with seed 0. Input is read as little endian, same as the binary output format.
+ *
+ * @param  pData
+ * @param  SizeInBytes
+ * @return uint64_t
+ */
+static uint64_t hashEdid(const DDU8* pData, size_t SizeInBytes)
+{
+    const DDU8* pEnd = pData + SizeInBytes;
+    uint64_t Hash;
+
+    if (SizeInBytes >= 32)
+    {
+        uint64_t V1 = XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t V2 = XXH_PRIME64_2;
+        uint64_t V3 = 0;
+        uint64_t V4 = 0 - XXH_PRIME64_1;
+
+        do
+        {
+            V1 = xxhRound(V1, xxhRead64(pData));
+            V2 = xxhRound(V2, xxhRead64(pData + 8));
+            V3 = xxhRound(V3, xxhRead64(pData + 16));
+            V4 = xxhRound(V4, xxhRead64(pData + 24));
+            pData += 32;
+        } while (pData + 32 <= pEnd);
+
+        Hash = xxhRotl64(V1, 1) + xxhRotl64(V2, 7) + xxhRotl64(V3, 12) + xxhRotl64(V4, 18);
+        Hash = xxhMergeRound(Hash, V1);
+        Hash = xxhMergeRound(Hash, V2);
+        Hash = xxhMergeRound(Hash, V3);
+        Hash = xxhMergeRound(Hash, V4);
+    }
+    else
+    {
+        Hash = XXH_PRIME64_5;
+    }
+
+    Hash += SizeInBytes;
+
+    for (; pData + 8 <= pEnd; pData += 8)
+    {
+        Hash = xxhRotl64(Hash ^ xxhRound(0, xxhRead64(pData)), 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (pData + 4 <= pEnd)
+    {
+        uint32_t Value;
+
+        memcpy(&Value, pData, sizeof(Value));
+        Hash = xxhRotl64(Hash ^ (Value * XXH_PRIME64_1), 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        pData += 4;
+    }
+    for (; pData < pEnd; pData++)
+    {
+        Hash = xxhRotl64(Hash ^ (*pData * XXH_PRIME64_5), 11) * XXH_PRIME64_1;
+    }
+
+    Hash ^= Hash >> 33;
+    Hash *= XXH_PRIME64_2;
+    Hash ^= Hash >> 29;
+    Hash *= XXH_PRIME64_3;
+    Hash ^= Hash >> 32;
+
+    return Hash;
+}
+
+/**
+ * @brief Header of an on-disk cache file, followed by the EDID, padding to EDID_BIN_ALIGNMENT and a binary record
+ *        (EdidBinaryFormat.h) of the parse result.
+ */
+typedef struct _PARSE_CACHE_FILE_HEADER
+{
+    DDU32 Signature; // PARSE_CACHE_FILE_SIGNATURE
+    DDU32 EdidSizeInBytes;
+    uint64_t Hash;
+} PARSE_CACHE_FILE_HEADER;
+
+C_ASSERT((sizeof(PARSE_CACHE_FILE_HEADER) % EDID_BIN_ALIGNMENT) == 0);
+
+/**
+ * @brief Loads a cached result into the session, as if the EDID had been parsed by it.
+ *
+ *  Mode index of the session is left empty, it is only needed while a parse adds modes.
+ * @param  pSession
+ * @param  pCaps
+ * @param  pTimings
+ * @param  NumTimings
+ * @return DDSTATUS
+ */
+static DDSTATUS parseCacheRestore(EDID_PARSE_SESSION* pSession, const DD_DISPLAY_CAPS* pCaps, const DD_TIMING_INFO* pTimings, DDU32 NumTimings)
+{
+    DDSTATUS Status;
+
+    modeIndexReset(&pSession->ModeTable);
+    Status = modeTableReserve(&pSession->ModeTable, NumTimings);
+    if (IS_DDSTATUS_ERROR(Status))
+    {
+        return Status;
+    }
+
+    memcpy(&pSession->EdidCaps, pCaps, sizeof(DD_DISPLAY_CAPS));
+    memcpy(pSession->ModeTable.Table.pEntry, pTimings, (size_t)NumTimings * sizeof(DD_TIMING_INFO));
+    pSession->ModeTable.Table.NumEntries = NumTimings;
+
+    return DDS_SUCCESS;
+}
+
+/**
+ * @brief Path of the on-disk cache file of a hash.
+ *
+ * @param  pCache
+ * @param  Hash
+ * @return std::string
+ */
+static std::string parseCacheFilePath(const PARSE_CACHE* pCache, uint64_t Hash)
+{
+    char Name[17] = { 0 };
+
+    std::to_chars(Name, Name + 16, Hash, 16);
+    return (std::filesystem::path(pCache->DiskDir) / (std::string(16 - strlen(Name), '0') + Name + PARSE_CACHE_FILE_EXTENSION)).string();
+}
+
+/**
+ * @brief Adds a parse result to the in-memory tier, evicting least recently used results beyond MaxEntries.
+ *        Caller holds pCache->Lock.
+ *
+ * @param  pCache
+ * @param  Hash
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @param  pCaps
+ * @param  pTimings
+ * @param  NumTimings
+ * @return void
+ */
+static void parseCacheAddLocked(PARSE_CACHE* pCache, uint64_t Hash, const DDU8* pEdid, size_t SizeInBytes, const DD_DISPLAY_CAPS* pCaps,
+                                const DD_TIMING_INFO* pTimings, DDU32 NumTimings)
+{
+    auto Range = pCache->Index.equal_range(Hash);
+
+    // Another worker may have parsed the same EDID meanwhile
+    for (auto Slot = Range.first; Slot != Range.second; ++Slot)
+    {
+        const PARSE_CACHE_ENTRY& Entry = *Slot->second;
+
+        if ((Entry.Edid.size() == SizeInBytes) && (0 == memcmp(Entry.Edid.data(), pEdid, SizeInBytes)))
+        {
+            return;
+        }
+    }
+
+    pCache->Entries.emplace_front();
+    PARSE_CACHE_ENTRY& Entry = pCache->Entries.front();
+    Entry.Hash = Hash;
+    Entry.Edid.assign(pEdid, pEdid + SizeInBytes);
+    memcpy(&Entry.Caps, pCaps, sizeof(DD_DISPLAY_CAPS));
+    Entry.Timings.assign(pTimings, pTimings + NumTimings);
+    pCache->Index.emplace(Hash, pCache->Entries.begin());
+
+    while (pCache->Entries.size() > pCache->MaxEntries)
+    {
+        auto Last = std::prev(pCache->Entries.end());
+
+        Range = pCache->Index.equal_range(Last->Hash);
+        for (auto Slot = Range.first; Slot != Range.second; ++Slot)
+        {
+            if (Slot->second == Last)
+            {
+                pCache->Index.erase(Slot);
+                break;
+            }
+        }
+        pCache->Entries.erase(Last);
+        pCache->NumEvictions++;
+    }
+}
+
+/**
+ * @brief Looks up the in-memory tier and loads a hit into the session.
+ *
+ * @param  pCache
+ * @param  Hash
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @param  pSession
+ * @return bool true on hit
+ */
+static bool parseCacheLookupMemory(PARSE_CACHE* pCache, uint64_t Hash, const DDU8* pEdid, size_t SizeInBytes, EDID_PARSE_SESSION* pSession)
+{
+    std::lock_guard<std::mutex> Guard(pCache->Lock);
+    auto Range = pCache->Index.equal_range(Hash);
+
+    for (auto Slot = Range.first; Slot != Range.second; ++Slot)
+    {
+        auto Entry = Slot->second;
+
+        if ((Entry->Edid.size() != SizeInBytes) || (0 != memcmp(Entry->Edid.data(), pEdid, SizeInBytes)))
+        {
+            continue;
+        }
+        if (IS_DDSTATUS_ERROR(parseCacheRestore(pSession, &Entry->Caps, Entry->Timings.data(), (DDU32)Entry->Timings.size())))
+        {
+            return false;
+        }
+
+        pCache->Entries.splice(pCache->Entries.begin(), pCache->Entries, Entry);
+        pCache->NumHits++;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Looks up the on-disk tier, loads a hit into the session and adds it to the in-memory tier.
+ *
+ * @param  pCache
+ * @param  Hash
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @param  pSession
+ * @return bool true on hit
+ */
+static bool parseCacheLookupDisk(PARSE_CACHE* pCache, uint64_t Hash, const DDU8* pEdid, size_t SizeInBytes, EDID_PARSE_SESSION* pSession)
+{
+    EDID_MAPPED_FILE MappedFile = { 0 };
+    PARSE_CACHE_FILE_HEADER Header;
+    EDID_BIN_VIEW View;
+    size_t RecordOffset = EDID_BIN_ALIGN_UP(sizeof(PARSE_CACHE_FILE_HEADER) + SizeInBytes);
+    bool IsHit = false;
+    std::error_code Error;
+    std::string Path = parseCacheFilePath(pCache, Hash);
+
+    if (!std::filesystem::is_regular_file(Path, Error) || !mapEdidFile(Path, &MappedFile))
+    {
+        return false;
+    }
+
+    // Mapping is page aligned, so the record can be read in place
+    if (MappedFile.SizeInBytes > RecordOffset)
+    {
+        memcpy(&Header, MappedFile.pData, sizeof(Header));
+        if ((PARSE_CACHE_FILE_SIGNATURE == Header.Signature) && (SizeInBytes == Header.EdidSizeInBytes) && (Hash == Header.Hash) &&
+            (0 == memcmp(MappedFile.pData + sizeof(Header), pEdid, SizeInBytes)) &&
+            IS_DDSTATUS_SUCCESS(EdidBinReadRecord(MappedFile.pData + RecordOffset, MappedFile.SizeInBytes - RecordOffset, &View)))
+        {
+            IsHit = IS_DDSTATUS_SUCCESS(parseCacheRestore(pSession, View.pCaps, View.pTimings, View.NumTimings));
+        }
+    }
+
+    if (IsHit)
+    {
+        std::lock_guard<std::mutex> Guard(pCache->Lock);
+
+        parseCacheAddLocked(pCache, Hash, pEdid, SizeInBytes, View.pCaps, View.pTimings, View.NumTimings);
+        pCache->NumDiskHits++;
+    }
+
+    unmapEdidFile(&MappedFile);
+    return IsHit;
+}
+
+/**
+ * @brief Writes the parse result held by the session to the on-disk tier.
+ *
+ *  File is written under a temporary name and renamed, so readers in other workers or processes never see a
+ *  partial file. Failures are ignored, the result is only not cached on disk.
+ * @param  pCache
+ * @param  Hash
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @param  pSession
+ * @return void
+ */
+static void parseCacheStoreDisk(const PARSE_CACHE* pCache, uint64_t Hash, const DDU8* pEdid, size_t SizeInBytes, const EDID_PARSE_SESSION* pSession)
+{
+    PARSE_CACHE_FILE_HEADER Header = { PARSE_CACHE_FILE_SIGNATURE, (DDU32)SizeInBytes, Hash };
+    std::string Data(reinterpret_cast<const char*>(&Header), sizeof(Header));
+    std::string Path = parseCacheFilePath(pCache, Hash);
+    std::string TempPath = Path + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    std::error_code Error;
+
+    Data.append(reinterpret_cast<const char*>(pEdid), SizeInBytes);
+    Data.resize(EDID_BIN_ALIGN_UP(Data.size()));
+    writeBinEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, &Data);
+
+    if (writeOutputFile(TempPath, Data))
+    {
+        std::filesystem::rename(TempPath, Path, Error);
+        if (Error)
+        {
+            std::filesystem::remove(TempPath, Error);
+        }
+    }
+}
+
+/**
+ * @brief Parses an EDID, or loads its result from the cache if the same EDID was parsed before.
+ *
+ * @param  pCache
+ * @param  pSession
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @return DDSTATUS same as parseEdid
+ */
+DDSTATUS parseEdidCached(PARSE_CACHE* pCache, EDID_PARSE_SESSION* pSession, DDU8* pEdid, size_t SizeInBytes)
+{
+    uint64_t Hash;
+    DDSTATUS Status;
+
+    // Same argument checks as parseEdid, so invalid input is never cached
+    if ((NULL == pEdid) || (SizeInBytes <= 126) || (SizeInBytes > UINT32_MAX))
+    {
+        return DDS_INVALID_PARAM;
+    }
+
+    Hash = hashEdid(pEdid, SizeInBytes);
+    if (parseCacheLookupMemory(pCache, Hash, pEdid, SizeInBytes, pSession) ||
+        (!pCache->DiskDir.empty() && parseCacheLookupDisk(pCache, Hash, pEdid, SizeInBytes, pSession)))
+    {
+        return DDS_SUCCESS;
+    }
+
+    Status = parseEdid(pSession, pEdid, SizeInBytes);
+    if (IS_DDSTATUS_ERROR(Status))
+    {
+        return Status;
+    }
+
+    {
+        std::lock_guard<std::mutex> Guard(pCache->Lock);
+
+        parseCacheAddLocked(pCache, Hash, pEdid, SizeInBytes, &pSession->EdidCaps, (const DD_TIMING_INFO*)pSession->ModeTable.Table.pEntry,
+                            pSession->ModeTable.Table.NumEntries);
+        pCache->NumMisses++;
+    }
+    if (!pCache->DiskDir.empty())
+    {
+        parseCacheStoreDisk(pCache, Hash, pEdid, SizeInBytes, pSession);
+    }
+
+    return DDS_SUCCESS;
+}
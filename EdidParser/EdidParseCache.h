@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidParseCache.h
+ * @brief Parse results cached by EDID content, in memory and optionally on disk.
+ *
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "EdidParseSession.h"
+
+// Parse cache. Results are keyed by a hash of the whole EDID buffer, the buffer itself is kept with every
+// result and compared on lookup, so a hash collision is a miss and never returns caps of another EDID.
+#define PARSE_CACHE_DEFAULT_ENTRIES 1024
+
+/**
+ * @brief Parse result held in memory.
+ */
+typedef struct _PARSE_CACHE_ENTRY
+{
+    uint64_t Hash;
+    std::vector<DDU8> Edid;
+    DD_DISPLAY_CAPS Caps;
+    std::vector<DD_TIMING_INFO> Timings;
+} PARSE_CACHE_ENTRY;
+
+/**
+ * @brief Parse cache shared by batch workers. In-memory tier is LRU, optional on-disk tier has one file per EDID
+ *        and is never evicted. Counters are under Lock as well.
+ */
+typedef struct _PARSE_CACHE
+{
+    std::mutex Lock;
+    uint32_t MaxEntries;
+    std::list<PARSE_CACHE_ENTRY> Entries; // Most recently used first
+    std::unordered_multimap<uint64_t, std::list<PARSE_CACHE_ENTRY>::iterator> Index;
+    std::string DiskDir; // Empty if there is no on-disk tier
+    uint64_t NumHits;
+    uint64_t NumDiskHits; // Misses of memory tier found on disk, not counted in NumHits
+    uint64_t NumMisses;
+    uint64_t NumEvictions;
+} PARSE_CACHE;
+
+DDSTATUS parseEdidCached(PARSE_CACHE* pCache, EDID_PARSE_SESSION* pSession, DDU8* pEdid, size_t SizeInBytes);
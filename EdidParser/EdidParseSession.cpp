@@ -0,0 +1,822 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2021-2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+#include "GenericDisplayInfoRoutines.c"          // NOLINT [build/include]
+#include "DisplayInfoParser/GlobalTimings.c"     // NOLINT [build/include]
+#include "DisplayInfoParser/DisplayInfoParser.c" // NOLINT [build/include]
+#include "EdidParseSession.h"
+
+/**
+ * @brief Adds, replaces or skips an entry once the index of its matching entry is known.
+ *
+ * @param  pTable
+ * @param  MatchIndex index of the entry matching pEntryToAdd, pTable->NumEntries if there is none
+ * @param  pEntryToAdd
+ * @param  ForceAdd
+ * @return DDSTATUS
+ */
+static DDSTATUS commitEntry(DD_TABLE* pTable, uint32_t MatchIndex, const void* pEntryToAdd, DD_BOOL ForceAdd)
+{
+    void* pEntry = nullptr;
+    DDSTATUS Status;
+
+    Status = DDS_UNSUCCESSFUL;
+    if (MatchIndex < pTable->NumEntries)
+    {
+        Status = (FALSE == ForceAdd) ? DDS_SUCCESS_ENTRY_EXISTS_NO_UPDATE : DDS_SUCCESS_ENTRY_EXISTS_REPLACED;
+    }
+
+    if (DDS_SUCCESS_ENTRY_EXISTS_NO_UPDATE == Status)
+    {
+        goto _Exit;
+    }
+    else if (DDS_SUCCESS_ENTRY_EXISTS_REPLACED == Status)
+    {
+        pEntry = DD_VOID_PTR_INC(pTable->pEntry, (pTable->EntrySizeInBytes * MatchIndex));
+        if (pTable->pfnReplaceEntry)
+        {
+            pTable->pfnReplaceEntry(pEntry, pEntryToAdd);
+            // ReplaceEntry Function might replace only if certain conditions are satisfied.
+            // So we compare values of both entries to check if it is replaced and update Status accordingly
+            if (0 == DD_MEM_CMP(pEntry, pEntryToAdd, sizeof(DD_TIMING_INFO)))
+            {
+                //EXPECT_EQ(ValidateTimingInfo(static_cast<DD_TIMING_INFO *>(pEntry)), TRUE);
+            }
+            else
+            {
+                Status = DDS_SUCCESS_ENTRY_EXISTS_NO_UPDATE;
+            }
+        }
+        else
+        {
+            DD_MEM_COPY_SAFE(pEntry, pTable->EntrySizeInBytes, pEntryToAdd, pTable->EntrySizeInBytes);
+            //EXPECT_EQ(ValidateTimingInfo(static_cast<DD_TIMING_INFO *>(pEntry)), TRUE);
+        }
+        goto _Exit;
+    }
+
+    if (pTable->TableSize == pTable->NumEntries)
+    {
+        // Callers owning a growable table grow it before getting here
+        Status = DDS_BUFFER_OVERFLOW;
+        goto _Exit;
+    }
+
+    pEntry = DD_VOID_PTR_INC(pTable->pEntry, (pTable->NumEntries * pTable->EntrySizeInBytes));
+    DD_MEM_COPY_SAFE(pEntry, pTable->EntrySizeInBytes, pEntryToAdd, pTable->EntrySizeInBytes);
+    pTable->NumEntries++;
+
+_Exit:
+    return Status;
+}
+
+/**
+ * @brief
+ *
+ * @param  pInputTable
+ * @param  pEntryToAdd
+ * @param  ForceAdd
+ * @return DDSTATUS
+ */
+DDSTATUS addEntry(void* pInputTable, const void* pEntryToAdd, DD_BOOL ForceAdd)
+{
+    void* pEntry = nullptr;
+    uint32_t Count = 0;
+    DDSTATUS Status;
+    DD_TABLE* pTable = nullptr;
+
+    DISP_FUNC_ENTRY();
+    DDASSERT(pInputTable);
+
+    pTable = static_cast<DD_TABLE*>(pInputTable);
+
+    pEntry = pTable->pEntry;
+    // Check whether the mode already exists
+    for (Count = 0; Count < pTable->NumEntries; Count++)
+    {
+        if (TRUE == pTable->pfnMatchEntry(pEntryToAdd, pEntry, FALSE))
+        {
+            break;
+        }
+        pEntry = DD_VOID_PTR_INC(pEntry, pTable->EntrySizeInBytes);
+    }
+
+    Status = commitEntry(pTable, Count, pEntryToAdd, ForceAdd);
+
+    DISP_FUNC_EXIT();
+
+    return Status;
+}
+
+
+/**
+ * @brief Returns the media RR type of the timing.
+ *
+ *
+ * @param  pTimingInfo
+ * @return DD_MEDIA_RR_TYPE
+ */
+DD_MEDIA_RR_TYPE GetMediaRRType(const DD_TIMING_INFO* pTimingInfo)
+{
+    return DisplayInfoRoutinesGetMediaRrType(pTimingInfo);
+}
+
+/**
+ * @brief
+ *
+ *  Classifies the media RR type of both modes on every call. Mode tables that match often should keep a DD_MODE_KEY
+ *  per entry and match with matchModeKey() instead, as addEntryIndexed() does.
+ * @param pInputMode1
+ * @param pInputMode2
+ * @param IsWireformatMatchNeeded
+ * @return DD_BOOL
+ */
+DD_BOOL matchTargetMode(const void* pInputMode1, const void* pInputMode2, DD_BOOL IsWireformatMatchNeeded)
+{
+    const DD_TIMING_INFO* pMode1 = const_cast<DD_TIMING_INFO*>(static_cast<const DD_TIMING_INFO*>(pInputMode1));
+    const DD_TIMING_INFO* pMode2 = const_cast<DD_TIMING_INFO*>(static_cast<const DD_TIMING_INFO*>(pInputMode2));
+
+    // Media RR type is compared last, it is the only field that has to be computed
+    if ((pMode1->HActive == pMode2->HActive) && (pMode1->VActive == pMode2->VActive) && (pMode1->VRoundedRR == pMode2->
+        VRoundedRR) && (pMode1->IsInterlaced == pMode2->IsInterlaced) &&
+        (pMode1->CeData.SamplingMode.Rgb == pMode2->CeData.SamplingMode.Rgb) && (pMode1->CeData.SamplingMode.Yuv420 ==
+            pMode2->CeData.SamplingMode.Yuv420) &&
+        (GetMediaRRType(pMode1) == GetMediaRRType(pMode2)))
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief
+ *
+ * @param  pModeToReplace
+ * @param  pNewMode
+ * @return void
+ */
+void replaceTargetMode(void* pModeToReplace, const void* pNewMode)
+{
+    DD_TIMING_INFO* pCurModeToReplace = static_cast<DD_TIMING_INFO*>(pModeToReplace);
+    const DD_TIMING_INFO* pCurNewMode = const_cast<DD_TIMING_INFO*>(static_cast<const DD_TIMING_INFO*>(pNewMode));
+
+    DDASSERT(pModeToReplace);
+    DDASSERT(pNewMode);
+    // Mode Should not be replaced if the existing mode is a preferred mode and the new mode is a non preferred mode
+
+    if ((TRUE == pCurModeToReplace->Flags.PreferredMode) && (FALSE == pCurNewMode->Flags.PreferredMode))
+    {
+        return;
+    }
+
+    *pCurModeToReplace = *pCurNewMode;
+
+    return;
+}
+
+
+#define MIN_MODE_INDEX_SLOTS 64
+
+/**
+ * @brief Fills the key of a timing, its media RR type is classified here and nowhere else on the indexed path.
+ *
+ * @param  pTimingInfo
+ * @param  pKey
+ * @return void
+ */
+void getModeKey(const DD_TIMING_INFO* pTimingInfo, DD_MODE_KEY* pKey)
+{
+    pKey->HActive = pTimingInfo->HActive;
+    pKey->VActive = pTimingInfo->VActive;
+    pKey->VRoundedRR = pTimingInfo->VRoundedRR;
+    pKey->MediaRrType = static_cast<DDU8>(GetMediaRRType(pTimingInfo));
+    pKey->IsInterlaced = pTimingInfo->IsInterlaced;
+    pKey->Rgb = pTimingInfo->CeData.SamplingMode.Rgb;
+    pKey->Yuv420 = pTimingInfo->CeData.SamplingMode.Yuv420;
+}
+
+/**
+ * @brief matchTargetMode() for keys, compares the cached media RR type instead of classifying the timings again.
+ *
+ * @param  pInputKey1
+ * @param  pInputKey2
+ * @param  IsWireformatMatchNeeded
+ * @return DD_BOOL
+ */
+DD_BOOL matchModeKey(const void* pInputKey1, const void* pInputKey2, DD_BOOL IsWireformatMatchNeeded)
+{
+    const DD_MODE_KEY* pKey1 = static_cast<const DD_MODE_KEY*>(pInputKey1);
+    const DD_MODE_KEY* pKey2 = static_cast<const DD_MODE_KEY*>(pInputKey2);
+
+    if ((pKey1->HActive == pKey2->HActive) && (pKey1->VActive == pKey2->VActive) && (pKey1->VRoundedRR == pKey2->VRoundedRR) &&
+        (pKey1->MediaRrType == pKey2->MediaRrType) && (pKey1->IsInterlaced == pKey2->IsInterlaced) && (pKey1->Rgb == pKey2->Rgb) &&
+        (pKey1->Yuv420 == pKey2->Yuv420))
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief
+ *
+ * @param  pKey
+ * @return DDU32
+ */
+static DDU32 hashModeKey(const DD_MODE_KEY* pKey)
+{
+    DDU64 Hash;
+
+    Hash = (static_cast<DDU64>(pKey->HActive) << 32) | pKey->VActive;
+    Hash = (Hash ^ (Hash >> 29)) * 0xBF58476D1CE4E5B9ull;
+    Hash ^= (static_cast<DDU64>(pKey->VRoundedRR) << 8) | (static_cast<DDU64>(pKey->MediaRrType) << 4) | (static_cast<DDU64>(pKey->IsInterlaced & 1) << 2) |
+        (static_cast<DDU64>(pKey->Rgb) << 1) | pKey->Yuv420;
+    Hash = (Hash ^ (Hash >> 32)) * 0x9E3779B97F4A7C15ull;
+
+    return static_cast<DDU32>(Hash >> 32);
+}
+
+/**
+ * @brief Returns the slot holding Key, or the empty slot where it should be inserted.
+ *
+ * @param  pSlots
+ * @param  NumSlots
+ * @param  pKey
+ * @return DD_MODE_INDEX_SLOT*
+ */
+static DD_MODE_INDEX_SLOT* findModeIndexSlot(DD_MODE_INDEX_SLOT* pSlots, DDU32 NumSlots, const DD_MODE_KEY* pKey)
+{
+    DDU32 Slot = hashModeKey(pKey) & (NumSlots - 1);
+
+    while ((0 != pSlots[Slot].EntryIndexPlus1) && (FALSE == matchModeKey(&pSlots[Slot].Key, pKey, FALSE)))
+    {
+        Slot = (Slot + 1) & (NumSlots - 1);
+    }
+
+    return &pSlots[Slot];
+}
+
+/**
+ * @brief Re-allocates the index with NumSlots slots and re-inserts the current keys.
+ *
+ * @param  pIndexedTable
+ * @param  NumSlots
+ * @return DDSTATUS
+ */
+static DDSTATUS resizeModeIndex(DD_INDEXED_TABLE* pIndexedTable, DDU32 NumSlots)
+{
+    DD_MODE_INDEX_SLOT* pNewSlots = nullptr;
+    DD_MODE_INDEX_SLOT* pSlot = nullptr;
+    DDU32 Count;
+
+    DDASSERT(DD_IS_POWER_OF_2(NumSlots));
+
+    pNewSlots = static_cast<DD_MODE_INDEX_SLOT*>(DD_ALLOC_MEM(NumSlots * sizeof(DD_MODE_INDEX_SLOT)));
+    if (NULL == pNewSlots)
+    {
+        return DDS_NO_MEMORY;
+    }
+
+    for (Count = 0; Count < pIndexedTable->NumSlots; Count++)
+    {
+        if (0 != pIndexedTable->pSlots[Count].EntryIndexPlus1)
+        {
+            pSlot = findModeIndexSlot(pNewSlots, NumSlots, &pIndexedTable->pSlots[Count].Key);
+            *pSlot = pIndexedTable->pSlots[Count];
+        }
+    }
+
+    DD_SAFE_FREE(pIndexedTable->pSlots);
+    pIndexedTable->pSlots = pNewSlots;
+    pIndexedTable->NumSlots = NumSlots;
+
+    return DDS_SUCCESS;
+}
+
+/**
+ * @brief Builds the index for the entries already present in the table.
+ *
+ *  Table has to be initialized, entries may be NULL with TableSize 0. Index is sized for Table.TableSize entries and
+ *  grows if more get added.
+ * @param  pIndexedTable
+ * @return DDSTATUS
+ */
+DDSTATUS modeIndexInit(DD_INDEXED_TABLE* pIndexedTable)
+{
+    DD_TABLE* pTable = &pIndexedTable->Table;
+    DD_MODE_INDEX_SLOT* pSlot = nullptr;
+    DD_MODE_KEY Key;
+    DDU32 NumSlots = MIN_MODE_INDEX_SLOTS;
+    DDU32 Count;
+    DDSTATUS Status;
+
+    while (NumSlots < (2 * DD_MAX(pTable->TableSize, pTable->NumEntries)))
+    {
+        NumSlots *= 2;
+    }
+
+    pIndexedTable->NumSlots = 0;
+    pIndexedTable->pSlots = nullptr;
+    pIndexedTable->OwnsEntries = FALSE;
+    Status = resizeModeIndex(pIndexedTable, NumSlots);
+    if (IS_DDSTATUS_ERROR(Status))
+    {
+        return Status;
+    }
+
+    for (Count = 0; Count < pTable->NumEntries; Count++)
+    {
+        getModeKey(static_cast<DD_TIMING_INFO*>(pTable->pEntry) + Count, &Key);
+        pSlot = findModeIndexSlot(pIndexedTable->pSlots, pIndexedTable->NumSlots, &Key);
+        if (0 == pSlot->EntryIndexPlus1)
+        {
+            pSlot->Key = Key;
+            pSlot->EntryIndexPlus1 = Count + 1;
+        }
+    }
+
+    return DDS_SUCCESS;
+}
+
+/**
+ * @brief Empties the table and its index, keeping the allocations for the next EDID.
+ *
+ * @param  pIndexedTable
+ * @return void
+ */
+void modeIndexReset(DD_INDEXED_TABLE* pIndexedTable)
+{
+    pIndexedTable->Table.NumEntries = 0;
+    DD_ZERO_MEM(pIndexedTable->pSlots, pIndexedTable->NumSlots * sizeof(DD_MODE_INDEX_SLOT));
+}
+
+/**
+ * @brief
+ *
+ * @param  pIndexedTable
+ * @return void
+ */
+void modeIndexFree(DD_INDEXED_TABLE* pIndexedTable)
+{
+    DD_SAFE_FREE(pIndexedTable->pSlots);
+    pIndexedTable->NumSlots = 0;
+    if (pIndexedTable->OwnsEntries)
+    {
+        DD_SAFE_FREE(pIndexedTable->Table.pEntry);
+        pIndexedTable->Table.TableSize = 0;
+        pIndexedTable->Table.NumEntries = 0;
+        pIndexedTable->OwnsEntries = FALSE;
+    }
+}
+
+/**
+ * @brief Makes room for at least NumEntries entries, so that adding up to that many doesn't re-allocate.
+ *
+ *  Entries move to a new allocation owned by the table, existing entries are kept. Never shrinks the table.
+ * @param  pIndexedTable
+ * @param  NumEntries
+ * @return DDSTATUS
+ */
+DDSTATUS modeTableReserve(DD_INDEXED_TABLE* pIndexedTable, DDU32 NumEntries)
+{
+    DD_TABLE* pTable = &pIndexedTable->Table;
+    void* pNewEntries = nullptr;
+    DDU32 NumSlots = pIndexedTable->NumSlots;
+    DDSTATUS Status;
+
+    if (NumEntries <= pTable->TableSize)
+    {
+        return DDS_SUCCESS;
+    }
+
+    if (NumEntries > (DDMAXU32 / 2 / pTable->EntrySizeInBytes))
+    {
+        return DDS_BUFFER_OVERFLOW;
+    }
+
+    while (NumSlots < (2 * NumEntries))
+    {
+        NumSlots *= 2;
+    }
+    if (NumSlots != pIndexedTable->NumSlots)
+    {
+        Status = resizeModeIndex(pIndexedTable, NumSlots);
+        if (IS_DDSTATUS_ERROR(Status))
+        {
+            return Status;
+        }
+    }
+
+    pNewEntries = DD_ALLOC_MEM(NumEntries * pTable->EntrySizeInBytes);
+    if (NULL == pNewEntries)
+    {
+        return DDS_NO_MEMORY;
+    }
+
+    if (pTable->NumEntries > 0)
+    {
+        DD_MEM_COPY_SAFE(pNewEntries, NumEntries * pTable->EntrySizeInBytes, pTable->pEntry, pTable->NumEntries * pTable->EntrySizeInBytes);
+    }
+    if (pIndexedTable->OwnsEntries)
+    {
+        DD_SAFE_FREE(pTable->pEntry);
+    }
+
+    pTable->pEntry = pNewEntries;
+    pTable->TableSize = NumEntries;
+    pIndexedTable->OwnsEntries = TRUE;
+
+    return DDS_SUCCESS;
+}
+
+/**
+ * @brief addEntry() for a DD_INDEXED_TABLE.
+ *
+ *  Finds the matching entry with one hash lookup instead of calling pfnMatchEntry on every entry, so it must only be used
+ *  with matchTargetMode as the match function. The timing is classified once, into its key, and only compared with the
+ *  keys cached in the index after that. Insert order, replace and return status are the same as addEntry().
+ * @param  pInputTable
+ * @param  pEntryToAdd
+ * @param  ForceAdd
+ * @return DDSTATUS
+ */
+DDSTATUS addEntryIndexed(void* pInputTable, const void* pEntryToAdd, DD_BOOL ForceAdd)
+{
+    DD_INDEXED_TABLE* pIndexedTable = nullptr;
+    DD_TABLE* pTable = nullptr;
+    DD_MODE_INDEX_SLOT* pSlot = nullptr;
+    DD_MODE_KEY Key;
+    uint32_t MatchIndex;
+    DDSTATUS Status;
+
+    DISP_FUNC_ENTRY();
+    DDASSERT(pInputTable);
+
+    pIndexedTable = static_cast<DD_INDEXED_TABLE*>(pInputTable);
+    pTable = &pIndexedTable->Table;
+    DDASSERT(pTable->pfnMatchEntry == matchTargetMode);
+
+    if ((2 * (pTable->NumEntries + 1)) > pIndexedTable->NumSlots)
+    {
+        Status = resizeModeIndex(pIndexedTable, DD_MAX(2 * pIndexedTable->NumSlots, MIN_MODE_INDEX_SLOTS));
+        if (IS_DDSTATUS_ERROR(Status))
+        {
+            DISP_FUNC_EXIT();
+            return Status;
+        }
+    }
+
+    getModeKey(static_cast<const DD_TIMING_INFO*>(pEntryToAdd), &Key);
+    pSlot = findModeIndexSlot(pIndexedTable->pSlots, pIndexedTable->NumSlots, &Key);
+
+    if ((0 == pSlot->EntryIndexPlus1) && (pTable->NumEntries == pTable->TableSize))
+    {
+        // New entry and no room left, grow geometrically. Index may get re-allocated, so look the slot up again
+        Status = modeTableReserve(pIndexedTable, DD_MAX(2 * pTable->TableSize, MIN_MODE_TABLE_ENTRIES));
+        if (IS_DDSTATUS_ERROR(Status))
+        {
+            DISP_FUNC_EXIT();
+            return Status;
+        }
+        pSlot = findModeIndexSlot(pIndexedTable->pSlots, pIndexedTable->NumSlots, &Key);
+    }
+    MatchIndex = (0 != pSlot->EntryIndexPlus1) ? (pSlot->EntryIndexPlus1 - 1) : pTable->NumEntries;
+
+    Status = commitEntry(pTable, MatchIndex, pEntryToAdd, ForceAdd);
+
+    if ((0 == pSlot->EntryIndexPlus1) && (MatchIndex < pTable->NumEntries))
+    {
+        // New entry got appended
+        pSlot->Key = Key;
+        pSlot->EntryIndexPlus1 = MatchIndex + 1;
+    }
+
+    DISP_FUNC_EXIT();
+
+    return Status;
+}
+
+/**
+ * @brief Number of 1 bits in a byte range.
+ *
+ * @param  pData
+ * @param  Length
+ * @return DDU32
+ */
+static DDU32 countBitsSet(const DDU8* pData, DDU32 Length)
+{
+    DDU32 Count = 0;
+
+    for (DDU32 Index = 0; Index < Length; Index++)
+    {
+        for (DDU8 Value = pData[Index]; Value != 0; Value &= (Value - 1))
+        {
+            Count++;
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Number of 18 byte detailed timing descriptors with a pixel clock, in [Offset, End) of a block.
+ *
+ * @param  pBlock
+ * @param  Offset
+ * @param  End
+ * @return DDU32
+ */
+static DDU32 countDtds(const DDU8* pBlock, DDU32 Offset, DDU32 End)
+{
+    DDU32 Count = 0;
+
+    for (; Offset + 18 <= End; Offset += 18)
+    {
+        // Display descriptors have a zero pixel clock
+        if ((0 != pBlock[Offset]) || (0 != pBlock[Offset + 1]))
+        {
+            Count++;
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Number of timings described by the data blocks of a DisplayID section.
+ *
+ * @param  pSection starts with the 4 byte section header
+ * @param  SizeInBytes bytes available from pSection
+ * @return DDU32
+ */
+static DDU32 countDisplayIdTimings(const DDU8* pSection, DDU32 SizeInBytes)
+{
+    DDU32 Count = 0;
+    DDU32 Offset = 4;
+    DDU32 End;
+
+    if (SizeInBytes < 4)
+    {
+        return 0;
+    }
+    End = DD_MIN(SizeInBytes, 4 + static_cast<DDU32>(pSection[1]));
+
+    // Data block: tag, revision, payload length, payload
+    while (Offset + 3 <= End)
+    {
+        DDU8 Tag = pSection[Offset];
+        DDU32 Length = DD_MIN(static_cast<DDU32>(pSection[Offset + 2]), End - (Offset + 3));
+        const DDU8* pPayload = pSection + Offset + 3;
+
+        switch (Tag)
+        {
+        case DID_DATA_BLOCK_DETAILED_TIMING_1:
+        case DID2_DATA_BLOCK_DETAIL_TIMING_VII:
+            Count += Length / 20;
+            break;
+        case DID_DATA_BLOCK_DETAILED_TIMING_2:
+        case DID_DATA_BLOCK_SHORT_DESCRIPTOR_TIMING_5:
+            Count += Length / 11;
+            break;
+        case DID_DATA_BLOCK_SHORT_TIMING_3:
+            Count += Length / 3;
+            break;
+        case DID_DATA_BLOCK_DETAILED_DESCRIPTOR_TIMING_6:
+            Count += Length / 17;
+            break;
+        case DID_DATA_BLOCK_DMTID_CODE_TIMING_4:
+        case DID2_DATA_BLOCK_ENUMERATED_TIMING_VIII:
+            // Upper bound, Type VIII codes take 1 or 2 bytes
+            Count += Length;
+            break;
+        case DID_DATA_BLOCK_VESA_TIMING_STD:
+        case DID_DATA_BLOCK_CEA_TIMING_STD:
+            Count += countBitsSet(pPayload, Length);
+            break;
+        case DID2_DATA_BLOCK_FORMULA_TIMING_IX:
+        case DID2_DATA_BLOCK_FORMULA_TIMING_X:
+            Count += Length / 6;
+            break;
+        default:
+            break;
+        }
+        Offset += 3 + Length;
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Number of timings described by the data blocks and DTDs of a CTA extension block.
+ *
+ * @param  pBlock
+ * @return DDU32
+ */
+static DDU32 countCeaTimings(const DDU8* pBlock)
+{
+    DDU32 DtdOffset = pBlock[2];
+    DDU32 NumSvds = 0;
+    DDU32 Num420Svds = 0;
+    DD_BOOL Is420CapabilityMapPresent = FALSE;
+    DDU32 Count = 0;
+    DDU32 Offset = 4;
+
+    if ((DtdOffset < 4) || (DtdOffset > EDID_BLOCK_SIZE - 1))
+    {
+        DtdOffset = 4;
+    }
+
+    while (Offset < DtdOffset)
+    {
+        DDU8 Tag = pBlock[Offset] >> 5;
+        DDU32 Length = DD_MIN(static_cast<DDU32>(pBlock[Offset] & 0x1F), DtdOffset - Offset - 1);
+        const DDU8* pPayload = pBlock + Offset + 1;
+
+        if (CEA_VIDEO_DATABLOCK == Tag)
+        {
+            NumSvds += Length;
+        }
+        else if ((CEA_USE_EXTENDED_TAG == Tag) && (Length > 0))
+        {
+            switch (pPayload[0])
+            {
+            case CEA_420_VIDEO_DATABLOCK:
+                Num420Svds += Length - 1;
+                break;
+            case CEA_420_CAPABILITY_MAP_DATABLOCK:
+                Is420CapabilityMapPresent = TRUE;
+                break;
+            case CEA_TYPE_VII_VIDEO_TIMING_DATA_BLOCK:
+                Count += (Length - 1) / 20;
+                break;
+            case CEA_TYPE_VIII_VIDEO_TIMING_DATA_BLOCK:
+                Count += Length - 1;
+                break;
+            case CEA_TYPE_X_VIDEO_TIMING_DATA_BLOCK:
+                Count += (Length - 1) / 6;
+                break;
+            default:
+                break;
+            }
+        }
+        Offset += 1 + Length;
+    }
+
+    // SVDs listed in the 4:2:0 capability map get a YCbCr 4:2:0 entry besides the RGB one
+    Count += NumSvds + Num420Svds + (Is420CapabilityMapPresent ? NumSvds : 0);
+    Count += countDtds(pBlock, DtdOffset, EDID_BLOCK_SIZE - 1);
+
+    return Count;
+}
+
+/**
+ * @brief Estimates the number of mode table entries an EDID or DisplayID buffer adds, from a count of its
+ *        timing descriptors. Nothing is decoded, the result is only used to reserve the mode table upfront.
+ *
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @return DDU32
+ */
+static DDU32 estimateNumModes(const DDU8* pEdid, DDU32 SizeInBytes)
+{
+    DDU32 NumBlocks;
+    DDU32 Count = 0;
+
+    if (0 != memcmp(BaseEdidHeader, pEdid, EDID_HEADER_SIZE))
+    {
+        // Pure DisplayID
+        return countDisplayIdTimings(pEdid, SizeInBytes);
+    }
+
+    // Established timings, standard timings other than unused (0x0101) and DTDs of base block
+    Count += countBitsSet(pEdid + 35, 2) + ((pEdid[37] & 0x80) ? 1 : 0);
+    for (DDU32 Offset = 38; Offset < 54; Offset += 2)
+    {
+        if ((0x01 != pEdid[Offset]) || (0x01 != pEdid[Offset + 1]))
+        {
+            Count++;
+        }
+    }
+    Count += countDtds(pEdid, 54, 126);
+
+    NumBlocks = DD_MIN(static_cast<DDU32>(pEdid[126]) + 1, SizeInBytes / EDID_BLOCK_SIZE);
+    for (DDU32 Block = 1; Block < NumBlocks; Block++)
+    {
+        const DDU8* pBlock = pEdid + (Block * EDID_BLOCK_SIZE);
+
+        if (CEA_EXT_TAG == pBlock[0])
+        {
+            Count += countCeaTimings(pBlock);
+        }
+        else if (DID_EXT_TAG == pBlock[0])
+        {
+            Count += countDisplayIdTimings(pBlock + 1, EDID_BLOCK_SIZE - 2);
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Sets up mode table, mode index and parser context of the session.
+ *
+ * @param  pSession
+ * @return DDSTATUS
+ */
+DDSTATUS parseSessionInit(EDID_PARSE_SESSION* pSession)
+{
+    DD_TABLE* pModeTable = &pSession->ModeTable.Table;
+    DDSTATUS Status;
+
+    DD_ZERO_MEM(pSession, sizeof(EDID_PARSE_SESSION));
+    pModeTable->EntrySizeInBytes = sizeof(DD_TIMING_INFO);
+    pModeTable->pfnAddEntry = addEntryIndexed;
+    pModeTable->pfnMatchEntry = matchTargetMode;
+    pModeTable->pfnReplaceEntry = replaceTargetMode;
+
+    Status = modeIndexInit(&pSession->ModeTable);
+    if (IS_DDSTATUS_SUCCESS(Status))
+    {
+        Status = modeTableReserve(&pSession->ModeTable, MIN_MODE_TABLE_ENTRIES);
+    }
+    if (IS_DDSTATUS_ERROR(Status))
+    {
+        modeIndexFree(&pSession->ModeTable);
+        return Status;
+    }
+
+    Status = DisplayInfoParserContextInit(&pSession->ParserContext);
+    if (IS_DDSTATUS_ERROR(Status))
+    {
+        modeIndexFree(&pSession->ModeTable);
+    }
+
+    return Status;
+}
+
+/**
+ * @brief
+ *
+ * @param  pSession
+ * @return void
+ */
+void parseSessionFree(EDID_PARSE_SESSION* pSession)
+{
+    DisplayInfoParserContextFree(&pSession->ParserContext);
+    modeIndexFree(&pSession->ModeTable);
+}
+
+/**
+ * @brief Parses one EDID/DisplayID buffer into caps and mode table of the session.
+ *
+ * @param  pSession
+ * @param  pEdid
+ * @param  SizeInBytes
+ * @return DDSTATUS DDS_INVALID_PARAM if buffer is too short for an EDID, DDS_SUCCESS otherwise
+ */
+DDSTATUS parseEdid(EDID_PARSE_SESSION* pSession, DDU8* pEdid, size_t SizeInBytes)
+{
+    DD_GET_EDID_CAPS_AND_MODES GetEdidCapsAndModes = { 0 };
+
+    // Extension count is at byte 126 of base block
+    if ((NULL == pEdid) || (SizeInBytes <= 126) || (SizeInBytes > UINT32_MAX))
+    {
+        return DDS_INVALID_PARAM;
+    }
+
+    modeIndexReset(&pSession->ModeTable);
+    memset(&pSession->EdidCaps, 0, sizeof(DD_DISPLAY_CAPS));
+
+    // Only a hint, table still grows if the estimate is short. Failing to reserve is left to the adds as well
+    modeTableReserve(&pSession->ModeTable, estimateNumModes(pEdid, (DDU32)SizeInBytes));
+
+    // Buffer may be one parsed before with new data, Display ID block indexes are rebuilt for it
+    DisplayInfoParserContextReset(&pSession->ParserContext);
+
+    GetEdidCapsAndModes.BufSizeInBytes = (DDU32)SizeInBytes;
+    GetEdidCapsAndModes.pEdidOrDisplayIDBuf = pEdid;
+    GetEdidCapsAndModes.NumEdidExtensionsParsed = pEdid[126];
+    GetEdidCapsAndModes.pData = &pSession->EdidCaps;
+    GetEdidCapsAndModes.pModeTable = &pSession->ModeTable.Table;
+    GetEdidCapsAndModes.pParserContext = &pSession->ParserContext;
+    // Status of parse is not checked, last mode added to table is reported with an error status
+    DisplayInfoParserGetEdidCapsAndModes(&GetEdidCapsAndModes);
+
+    return DDS_SUCCESS;
+}
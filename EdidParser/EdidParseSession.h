@@ -0,0 +1,81 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidParseSession.h
+ * @brief Mode table with hashed de-dup and the parse session reused across EDIDs.
+ *
+ */
+
+#pragma once
+
+#include "DisplayInfoParser/DisplayInfoParser.h"
+
+#define MIN_MODE_TABLE_ENTRIES 64
+
+// Key of a DD_TIMING_INFO made of the fields compared by matchTargetMode.
+// Two timings match if and only if their keys are equal.
+typedef struct _DD_MODE_KEY
+{
+    DDU32 HActive;
+    DDU32 VActive;
+    DDU32 VRoundedRR;
+    DDU8 MediaRrType; // DD_MEDIA_RR_TYPE
+    DD_BOOL IsInterlaced;
+    DDU8 Rgb;
+    DDU8 Yuv420;
+} DD_MODE_KEY;
+
+typedef struct _DD_MODE_INDEX_SLOT
+{
+    DD_MODE_KEY Key;
+    DDU32 EntryIndexPlus1; // 0 - Empty slot
+} DD_MODE_INDEX_SLOT;
+
+// Mode table with an open addressed hash index over its entries, used with addEntryIndexed() in place of the linear
+// search done by addEntry(). Index only holds the first entry for each key, which is the one the linear search finds.
+// Entries are re-allocated with geometric growth when the table is full, see modeTableReserve().
+typedef struct _DD_INDEXED_TABLE
+{
+    DD_TABLE Table; // Has to be the first member, pfnAddEntry gets called with a DD_TABLE*
+    DDU32 NumSlots; // Power of 2, kept at least twice the number of entries
+    DD_MODE_INDEX_SLOT* pSlots;
+    DD_BOOL OwnsEntries; // Table.pEntry was allocated by modeTableReserve(), otherwise it belongs to the caller
+} DD_INDEXED_TABLE;
+
+/**
+ * @brief Parser state reused across EDIDs, so that parsing many EDIDs in one process doesn't allocate per EDID.
+ */
+typedef struct _EDID_PARSE_SESSION
+{
+    DD_INDEXED_TABLE ModeTable; // Grows on demand and keeps its size for the next EDID
+    DD_PARSER_CONTEXT ParserContext;
+    DD_DISPLAY_CAPS EdidCaps;
+} EDID_PARSE_SESSION;
+
+DDSTATUS addEntry(void* pInputTable, const void* pEntryToAdd, DD_BOOL ForceAdd);
+DD_BOOL matchTargetMode(const void* pInputMode1, const void* pInputMode2, DD_BOOL IsWireformatMatchNeeded);
+void replaceTargetMode(void* pModeToReplace, const void* pNewMode);
+void getModeKey(const DD_TIMING_INFO* pTimingInfo, DD_MODE_KEY* pKey);
+DD_BOOL matchModeKey(const void* pInputKey1, const void* pInputKey2, DD_BOOL IsWireformatMatchNeeded);
+
+DDSTATUS modeIndexInit(DD_INDEXED_TABLE* pIndexedTable);
+void modeIndexReset(DD_INDEXED_TABLE* pIndexedTable);
+void modeIndexFree(DD_INDEXED_TABLE* pIndexedTable);
+DDSTATUS modeTableReserve(DD_INDEXED_TABLE* pIndexedTable, DDU32 NumEntries);
+DDSTATUS addEntryIndexed(void* pInputTable, const void* pEntryToAdd, DD_BOOL ForceAdd);
+
+DDSTATUS parseSessionInit(EDID_PARSE_SESSION* pSession);
+void parseSessionFree(EDID_PARSE_SESSION* pSession);
+DDSTATUS parseEdid(EDID_PARSE_SESSION* pSession, DDU8* pEdid, size_t SizeInBytes);
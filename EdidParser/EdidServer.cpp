@@ -0,0 +1,712 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+// Framing of requests and responses is in EdidServerProtocol.h
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <winsock2.h>
+#include <afunix.h>
+#else
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+#include "EdidServer.h"
+#include "EdidInputFiles.h"
+#include "EdidOutputWriters.h"
+#include "EdidParseCache.h"
+#include "EdidServerProtocol.h"
+
+#ifdef _WIN32
+typedef SOCKET EDID_SOCKET;
+#define EDID_INVALID_SOCKET INVALID_SOCKET
+#define closeSocket(Socket) closesocket(Socket)
+#else
+typedef int EDID_SOCKET;
+#define EDID_INVALID_SOCKET (-1)
+#define closeSocket(Socket) close(Socket)
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0 // Only Linux raises SIGPIPE on send to a closed socket
+#endif
+
+#define SERVER_DEFAULT_MAX_CONNECTIONS 64 // Clients past this wait in the listen backlog
+
+#define LOAD_DEFAULT_RATES "1000,10000,0"
+#define LOAD_DEFAULT_REQUESTS 10000
+#define LOAD_DEFAULT_CONNECTIONS 4
+
+/**
+ * @brief Initializes the socket library where one is needed.
+ *
+ * @return bool
+ */
+static bool socketStartup()
+{
+#ifdef _WIN32
+    WSADATA WsaData;
+
+    return 0 == WSAStartup(MAKEWORD(2, 2), &WsaData);
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief
+ *
+ * @return void
+ */
+static void socketCleanup()
+{
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+/**
+ * @brief Fills a Unix domain socket address.
+ *
+ * @param  Path
+ * @param  pAddress
+ * @return bool false if path doesn't fit in the address
+ */
+static bool socketAddress(const std::string& Path, struct sockaddr_un* pAddress)
+{
+    memset(pAddress, 0, sizeof(*pAddress));
+    if (Path.empty() || (Path.size() >= sizeof(pAddress->sun_path)))
+    {
+        return false;
+    }
+
+    pAddress->sun_family = AF_UNIX;
+    memcpy(pAddress->sun_path, Path.c_str(), Path.size());
+    return true;
+}
+
+/**
+ * @brief Receives exactly SizeInBytes bytes.
+ *
+ * @param  Socket
+ * @param  pData
+ * @param  SizeInBytes
+ * @return bool false if the connection was closed or failed
+ */
+static bool socketRecvAll(EDID_SOCKET Socket, void* pData, size_t SizeInBytes)
+{
+    char* pNext = static_cast<char*>(pData);
+
+    while (SizeInBytes > 0)
+    {
+        int Received = static_cast<int>(recv(Socket, pNext, static_cast<int>(std::min<size_t>(SizeInBytes, INT_MAX)), 0));
+
+        if (Received <= 0)
+        {
+#ifndef _WIN32
+            if ((Received < 0) && (EINTR == errno))
+            {
+                continue;
+            }
+#endif
+            return false;
+        }
+        pNext += Received;
+        SizeInBytes -= Received;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Sends exactly SizeInBytes bytes.
+ *
+ * @param  Socket
+ * @param  pData
+ * @param  SizeInBytes
+ * @return bool false if the connection was closed or failed
+ */
+static bool socketSendAll(EDID_SOCKET Socket, const void* pData, size_t SizeInBytes)
+{
+    const char* pNext = static_cast<const char*>(pData);
+
+    while (SizeInBytes > 0)
+    {
+        int Sent = static_cast<int>(send(Socket, pNext, static_cast<int>(std::min<size_t>(SizeInBytes, INT_MAX)), MSG_NOSIGNAL));
+
+        if (Sent <= 0)
+        {
+#ifndef _WIN32
+            if ((Sent < 0) && (EINTR == errno))
+            {
+                continue;
+            }
+#endif
+            return false;
+        }
+        pNext += Sent;
+        SizeInBytes -= Sent;
+    }
+
+    return true;
+}
+
+/**
+ * @brief State shared by the accept loop and connection threads.
+ */
+typedef struct _SERVER_STATE
+{
+    PARSE_CACHE* pCache; // NULL if every request is parsed
+    std::mutex Lock;     // Protects below
+    std::condition_variable SessionReady;
+    std::vector<EDID_PARSE_SESSION*> IdleSessions; // Warm sessions, one per parse thread allowed
+    uint32_t NumConnections;                        // Connection threads still running
+    std::condition_variable ConnectionsDone;        // Signalled whenever a connection thread ends
+} SERVER_STATE;
+
+/**
+ * @brief Answers requests of a connection until the client closes it or sends a malformed request.
+ *
+ *  Runs on its own thread so an idle client never holds up others, but parses only with a session taken from the
+ *  idle list, so at most as many requests as there are sessions are parsed at a time.
+ * @param  pServer
+ * @param  Socket
+ * @return void
+ */
+static void serverConnection(SERVER_STATE* pServer, EDID_SOCKET Socket)
+{
+    EDID_SERVER_REQUEST Request;
+    EDID_SERVER_RESPONSE Response;
+    EDID_PARSE_SESSION* pSession;
+    OUTPUT_WRITER Writer;
+    std::vector<DDU8> Edid;
+    DDSTATUS Status;
+
+    Edid.reserve(EDID_SERVER_MAX_EDID_SIZE);
+    while (socketRecvAll(Socket, &Request, sizeof(Request)))
+    {
+        memset(&Response, 0, sizeof(Response));
+        Response.Signature = EDID_SERVER_RESPONSE_SIGNATURE;
+
+        if ((EDID_SERVER_REQUEST_SIGNATURE != Request.Signature) || (EDID_SERVER_PROTOCOL_VERSION != Request.Version) ||
+            (Request.Format >= EDID_SERVER_FORMAT_MAX) || (Request.EdidSizeInBytes > EDID_SERVER_MAX_EDID_SIZE))
+        {
+            // Rest of the stream can't be framed any more
+            Response.Status = static_cast<DDU32>(DDS_INVALID_PARAM);
+            socketSendAll(Socket, &Response, sizeof(Response));
+            break;
+        }
+
+        Edid.resize(Request.EdidSizeInBytes);
+        if (!socketRecvAll(Socket, Edid.data(), Edid.size()))
+        {
+            break;
+        }
+
+        {
+            std::unique_lock<std::mutex> Guard(pServer->Lock);
+
+            pServer->SessionReady.wait(Guard, [pServer] { return !pServer->IdleSessions.empty(); });
+            pSession = pServer->IdleSessions.back();
+            pServer->IdleSessions.pop_back();
+        }
+
+        if (NULL != pServer->pCache)
+        {
+            Status = parseEdidCached(pServer->pCache, pSession, Edid.data(), Edid.size());
+        }
+        else
+        {
+            Status = parseEdid(pSession, Edid.data(), Edid.size());
+        }
+
+        // Header is filled in once the payload size is known, so the response goes out in one send
+        Writer.Buffer.assign(sizeof(Response), '\0');
+        if (IS_DDSTATUS_SUCCESS(Status))
+        {
+            switch (Request.Format)
+            {
+            case EDID_SERVER_FORMAT_BIN:
+                writeBinEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, &Writer.Buffer);
+                break;
+            case EDID_SERVER_FORMAT_NDJSON:
+                writeJsonEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, nullptr, 0, nullptr, &Writer);
+                break;
+            default:
+                writeXmlEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, nullptr, 0, nullptr, &Writer);
+                break;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> Guard(pServer->Lock);
+
+            pServer->IdleSessions.push_back(pSession);
+            pServer->SessionReady.notify_one();
+        }
+
+        Response.Status = static_cast<DDU32>(Status);
+        Response.PayloadSizeInBytes = static_cast<DDU32>(Writer.Buffer.size() - sizeof(Response));
+        memcpy(&Writer.Buffer[0], &Response, sizeof(Response));
+        if (!socketSendAll(Socket, Writer.Buffer.data(), Writer.Buffer.size()))
+        {
+            break;
+        }
+    }
+
+    closeSocket(Socket);
+
+    std::lock_guard<std::mutex> Guard(pServer->Lock);
+    pServer->NumConnections--;
+    pServer->ConnectionsDone.notify_all();
+}
+
+/**
+ * @brief Frees the idle sessions of the server.
+ *
+ * @param  pServer
+ * @return void
+ */
+static void serverFreeSessions(SERVER_STATE* pServer)
+{
+    for (EDID_PARSE_SESSION* pSession : pServer->IdleSessions)
+    {
+        parseSessionFree(pSession);
+        DD_SAFE_FREE(pSession);
+    }
+    pServer->IdleSessions.clear();
+}
+
+/**
+ * @brief Server mode, parses EDIDs sent over a Unix domain socket.
+ *
+ *  EdidParser --serve <socket path> [--threads <n>] [--connections <n>] [--cache <entries>] [--cache-dir <dir>]
+ *  Requests are framed as in EdidServerProtocol.h. Every connection gets its own thread, up to --connections at a
+ *  time (SERVER_DEFAULT_MAX_CONNECTIONS by default), further clients aren't accepted until one of them closes. Parsing uses
+ *  one of n warm sessions (one per core by default) kept for the life of the server, so there is no per request
+ *  process, file or session allocation cost. Results are cached as with --batch, in memory by default (--cache 0 turns it off).
+ *  Fails if no session can be set up. An existing socket file at the path is replaced. Runs until the process is terminated.
+ * @param  argc
+ * @param  argv
+ * @return int
+ */
+int runServer(int argc, char* argv[])
+{
+    SERVER_STATE Server;
+    PARSE_CACHE Cache;
+    std::string SocketPath;
+    struct sockaddr_un Address;
+    EDID_SOCKET ListenSocket;
+    EDID_SOCKET Socket;
+    uint32_t NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t MaxConnections = SERVER_DEFAULT_MAX_CONNECTIONS;
+    std::error_code Error;
+
+    Cache.MaxEntries = PARSE_CACHE_DEFAULT_ENTRIES;
+    Cache.NumHits = 0;
+    Cache.NumDiskHits = 0;
+    Cache.NumMisses = 0;
+    Cache.NumEvictions = 0;
+    for (int Arg = 1; Arg < argc; Arg++)
+    {
+        std::string Option = argv[Arg];
+
+        if ((Option == "--serve") && (Arg + 1 < argc))
+        {
+            SocketPath = argv[++Arg];
+        }
+        else if ((Option == "--threads") && (Arg + 1 < argc) && (atoi(argv[Arg + 1]) > 0))
+        {
+            NumThreads = static_cast<uint32_t>(atoi(argv[++Arg]));
+        }
+        else if ((Option == "--connections") && (Arg + 1 < argc) && (atoi(argv[Arg + 1]) > 0))
+        {
+            MaxConnections = static_cast<uint32_t>(atoi(argv[++Arg]));
+        }
+        else if ((Option == "--cache") && (Arg + 1 < argc) && (atoi(argv[Arg + 1]) >= 0))
+        {
+            Cache.MaxEntries = static_cast<uint32_t>(atoi(argv[++Arg]));
+        }
+        else if ((Option == "--cache-dir") && (Arg + 1 < argc))
+        {
+            Cache.DiskDir = argv[++Arg];
+        }
+        else
+        {
+            SocketPath.clear();
+            break;
+        }
+    }
+
+    if (!socketAddress(SocketPath, &Address))
+    {
+        std::cerr << "Usage: EdidParser --serve <socket path> [--threads <n>] [--connections <n>] [--cache <entries>] [--cache-dir <dir>]" << std::endl;
+        return 1;
+    }
+    if (!Cache.DiskDir.empty())
+    {
+        std::filesystem::create_directories(Cache.DiskDir, Error);
+    }
+    Server.pCache = ((0 != Cache.MaxEntries) || !Cache.DiskDir.empty()) ? &Cache : nullptr;
+    Server.NumConnections = 0;
+
+    for (uint32_t SessionIndex = 0; SessionIndex < NumThreads; SessionIndex++)
+    {
+        EDID_PARSE_SESSION* pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+
+        if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+        {
+            DD_SAFE_FREE(pSession);
+            break;
+        }
+        Server.IdleSessions.push_back(pSession);
+    }
+    NumThreads = static_cast<uint32_t>(Server.IdleSessions.size());
+    if (0 == NumThreads)
+    {
+        // Every request would wait forever for a session
+        std::cerr << "Unable to set up a parse session" << std::endl;
+        return 1;
+    }
+
+    if (!socketStartup())
+    {
+        serverFreeSessions(&Server);
+        return 1;
+    }
+
+    std::filesystem::remove(SocketPath, Error);
+    ListenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ((EDID_INVALID_SOCKET == ListenSocket) || (0 != bind(ListenSocket, reinterpret_cast<struct sockaddr*>(&Address), sizeof(Address))) ||
+        (0 != listen(ListenSocket, SOMAXCONN)))
+    {
+        std::cerr << "Unable to listen on " << SocketPath << std::endl;
+        if (EDID_INVALID_SOCKET != ListenSocket)
+        {
+            closeSocket(ListenSocket);
+        }
+        socketCleanup();
+        serverFreeSessions(&Server);
+        return 1;
+    }
+
+    std::cout << "Listening on " << SocketPath << ", " << NumThreads << " threads, " << MaxConnections << " connections" << std::endl;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> Guard(Server.Lock);
+            Server.ConnectionsDone.wait(Guard, [&Server, MaxConnections] { return Server.NumConnections < MaxConnections; });
+        }
+
+        Socket = accept(ListenSocket, nullptr, nullptr);
+        if (EDID_INVALID_SOCKET == Socket)
+        {
+#ifndef _WIN32
+            if (EINTR == errno)
+            {
+                continue;
+            }
+#endif
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> Guard(Server.Lock);
+            Server.NumConnections++;
+        }
+        std::thread(serverConnection, &Server, Socket).detach();
+    }
+
+    std::cerr << "Accept failed on " << SocketPath << ", stopping" << std::endl;
+    {
+        std::unique_lock<std::mutex> Guard(Server.Lock);
+        Server.ConnectionsDone.wait(Guard, [&Server] { return 0 == Server.NumConnections; });
+    }
+    serverFreeSessions(&Server);
+
+    closeSocket(ListenSocket);
+    std::filesystem::remove(SocketPath, Error);
+    socketCleanup();
+    return 1;
+}
+
+/**
+ * @brief Results of one load test connection.
+ */
+typedef struct _LOAD_CONNECTION_RESULT
+{
+    std::vector<double> LatenciesUs;
+    uint32_t NumErrors; // Requests answered with an error status, or lost with the connection
+} LOAD_CONNECTION_RESULT;
+
+/**
+ * @brief Load test connection thread, sends every NumConnections-th request starting at ConnectionIndex.
+ *
+ *  With a rate, request N is due at StartTime + N / Rate and its latency is counted from then, so time a request
+ *  waits behind a slow earlier one is part of its latency. Without a rate (0) requests are sent back to back.
+ * @param  SocketPath
+ * @param  pEdids
+ * @param  Format
+ * @param  Rate requests per second over all connections, 0 for no limit
+ * @param  NumRequests over all connections
+ * @param  ConnectionIndex
+ * @param  NumConnections
+ * @param  StartTime
+ * @param  pResult
+ * @return void
+ */
+static void loadConnection(const std::string& SocketPath, const std::vector<std::vector<DDU8>>* pEdids, EDID_SERVER_FORMAT Format, double Rate,
+                           uint32_t NumRequests, uint32_t ConnectionIndex, uint32_t NumConnections, std::chrono::steady_clock::time_point StartTime,
+                           LOAD_CONNECTION_RESULT* pResult)
+{
+    struct sockaddr_un Address;
+    EDID_SOCKET Socket;
+    EDID_SERVER_REQUEST Request = { 0 };
+    EDID_SERVER_RESPONSE Response;
+    std::vector<DDU8> Payload;
+    uint32_t RequestIndex;
+
+    pResult->NumErrors = 0;
+    socketAddress(SocketPath, &Address);
+    Socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ((EDID_INVALID_SOCKET == Socket) || (0 != connect(Socket, reinterpret_cast<struct sockaddr*>(&Address), sizeof(Address))))
+    {
+        pResult->NumErrors = (NumRequests - ConnectionIndex + NumConnections - 1) / NumConnections;
+        if (EDID_INVALID_SOCKET != Socket)
+        {
+            closeSocket(Socket);
+        }
+        return;
+    }
+
+    Request.Signature = EDID_SERVER_REQUEST_SIGNATURE;
+    Request.Version = EDID_SERVER_PROTOCOL_VERSION;
+    Request.Format = static_cast<DDU16>(Format);
+    for (RequestIndex = ConnectionIndex; RequestIndex < NumRequests; RequestIndex += NumConnections)
+    {
+        const std::vector<DDU8>& Edid = (*pEdids)[RequestIndex % pEdids->size()];
+        std::chrono::steady_clock::time_point DueTime = std::chrono::steady_clock::now();
+
+        if (Rate > 0)
+        {
+            DueTime = StartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(RequestIndex / Rate));
+            std::this_thread::sleep_until(DueTime);
+        }
+
+        Request.EdidSizeInBytes = static_cast<DDU32>(Edid.size());
+        if (!socketSendAll(Socket, &Request, sizeof(Request)) || !socketSendAll(Socket, Edid.data(), Edid.size()) ||
+            !socketRecvAll(Socket, &Response, sizeof(Response)) || (EDID_SERVER_RESPONSE_SIGNATURE != Response.Signature))
+        {
+            break;
+        }
+        Payload.resize(Response.PayloadSizeInBytes);
+        if (!socketRecvAll(Socket, Payload.data(), Payload.size()))
+        {
+            break;
+        }
+
+        if (IS_DDSTATUS_SUCCESS(static_cast<DDSTATUS>(Response.Status)))
+        {
+            pResult->LatenciesUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - DueTime).count());
+        }
+        else
+        {
+            pResult->NumErrors++;
+        }
+    }
+
+    // Requests not sent because the connection failed
+    if (RequestIndex < NumRequests)
+    {
+        pResult->NumErrors += (NumRequests - RequestIndex + NumConnections - 1) / NumConnections;
+    }
+
+    closeSocket(Socket);
+}
+
+/**
+ * @brief Load test client of the server mode.
+ *
+ *  EdidParser --load <socket path> <edid file|directory|glob|manifest> [--rates <r1,r2,...>] [--requests <n>]
+ *              [--connections <n>] [--format <xml|bin|ndjson>]
+ *  For every rate (requests per second, 0 for as fast as the server answers) sends n requests (10000 by default)
+ *  over the given number of connections (4 by default), cycling through the input EDIDs, and reports achieved
+ *  rate, p50, p99 and max latency. Rates default to 1000,10000,0.
+ * @param  argc
+ * @param  argv
+ * @return int 0 if every request succeeded
+ */
+int runLoadTest(int argc, char* argv[])
+{
+    std::vector<std::string> Files;
+    std::vector<std::vector<DDU8>> Edids;
+    std::vector<double> Rates;
+    std::string SocketPath;
+    std::string Input;
+    std::string RateList = LOAD_DEFAULT_RATES;
+    EDID_SERVER_FORMAT Format = EDID_SERVER_FORMAT_XML;
+    uint32_t NumRequests = LOAD_DEFAULT_REQUESTS;
+    uint32_t NumConnections = LOAD_DEFAULT_CONNECTIONS;
+    uint32_t TotalErrors = 0;
+    std::error_code Error;
+
+    for (int Arg = 1; Arg < argc; Arg++)
+    {
+        std::string Option = argv[Arg];
+
+        if ((Option == "--load") && (Arg + 2 < argc))
+        {
+            SocketPath = argv[++Arg];
+            Input = argv[++Arg];
+        }
+        else if ((Option == "--rates") && (Arg + 1 < argc))
+        {
+            RateList = argv[++Arg];
+        }
+        else if ((Option == "--requests") && (Arg + 1 < argc) && (atoi(argv[Arg + 1]) > 0))
+        {
+            NumRequests = static_cast<uint32_t>(atoi(argv[++Arg]));
+        }
+        else if ((Option == "--connections") && (Arg + 1 < argc) && (atoi(argv[Arg + 1]) > 0))
+        {
+            NumConnections = static_cast<uint32_t>(atoi(argv[++Arg]));
+        }
+        else if ((Option == "--format") && (Arg + 1 < argc) && (0 == strcmp(argv[Arg + 1], "xml")))
+        {
+            Format = EDID_SERVER_FORMAT_XML;
+            Arg++;
+        }
+        else if ((Option == "--format") && (Arg + 1 < argc) && (0 == strcmp(argv[Arg + 1], "bin")))
+        {
+            Format = EDID_SERVER_FORMAT_BIN;
+            Arg++;
+        }
+        else if ((Option == "--format") && (Arg + 1 < argc) && (0 == strcmp(argv[Arg + 1], "ndjson")))
+        {
+            Format = EDID_SERVER_FORMAT_NDJSON;
+            Arg++;
+        }
+        else
+        {
+            Input.clear();
+            break;
+        }
+    }
+
+    for (size_t Start = 0; Start < RateList.size();)
+    {
+        size_t End = std::min(RateList.find(',', Start), RateList.size());
+
+        Rates.push_back(atof(RateList.substr(Start, End - Start).c_str()));
+        Start = End + 1;
+    }
+
+    if (Input.empty() || Rates.empty())
+    {
+        std::cerr << "Usage: EdidParser --load <socket path> <edid file|directory|glob|manifest> [--rates <r1,r2,...>] [--requests <n>]"
+                  << " [--connections <n>] [--format <xml|bin|ndjson>]" << std::endl;
+        return 1;
+    }
+
+    if (std::filesystem::is_regular_file(Input, Error) && (std::filesystem::file_size(Input, Error) <= EDID_SERVER_MAX_EDID_SIZE))
+    {
+        Files.push_back(Input);
+    }
+    else if (!collectBatchInputs(Input, Files))
+    {
+        std::cerr << "Unable to read input " << Input << std::endl;
+        return 1;
+    }
+    for (const std::string& File : Files)
+    {
+        EDID_MAPPED_FILE MappedFile = { 0 };
+
+        if (mapEdidFile(File, &MappedFile))
+        {
+            if ((MappedFile.SizeInBytes > 126) && (MappedFile.SizeInBytes <= EDID_SERVER_MAX_EDID_SIZE))
+            {
+                Edids.emplace_back(MappedFile.pData, MappedFile.pData + MappedFile.SizeInBytes);
+            }
+            unmapEdidFile(&MappedFile);
+        }
+    }
+    if (Edids.empty())
+    {
+        std::cerr << "No EDIDs in " << Input << std::endl;
+        return 1;
+    }
+
+    if (!socketStartup())
+    {
+        return 1;
+    }
+
+    for (double Rate : Rates)
+    {
+        std::vector<std::thread> Connections;
+        std::vector<LOAD_CONNECTION_RESULT> Results(NumConnections);
+        std::vector<double> LatenciesUs;
+        uint32_t NumErrors = 0;
+
+        auto StartTime = std::chrono::steady_clock::now();
+        for (uint32_t ConnectionIndex = 0; ConnectionIndex < NumConnections; ConnectionIndex++)
+        {
+            Connections.emplace_back(loadConnection, SocketPath, &Edids, Format, Rate, NumRequests, ConnectionIndex, NumConnections, StartTime,
+                                     &Results[ConnectionIndex]);
+        }
+        for (std::thread& Connection : Connections)
+        {
+            Connection.join();
+        }
+        double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+        for (LOAD_CONNECTION_RESULT& Result : Results)
+        {
+            LatenciesUs.insert(LatenciesUs.end(), Result.LatenciesUs.begin(), Result.LatenciesUs.end());
+            NumErrors += Result.NumErrors;
+        }
+        std::sort(LatenciesUs.begin(), LatenciesUs.end());
+        TotalErrors += NumErrors;
+
+        if (Rate > 0)
+        {
+            std::cout << "rate " << Rate << "/s: ";
+        }
+        else
+        {
+            std::cout << "rate max: ";
+        }
+        std::cout << LatenciesUs.size() << " ok, " << NumErrors << " errors, " << (LatenciesUs.size() / Seconds) << " requests/s";
+        if (!LatenciesUs.empty())
+        {
+            std::cout << ", p50 " << LatenciesUs[LatenciesUs.size() / 2] << " us, p99 " << LatenciesUs[std::min(LatenciesUs.size() - 1, LatenciesUs.size() * 99 / 100)]
+                      << " us, max " << LatenciesUs.back() << " us";
+        }
+        std::cout << std::endl;
+    }
+
+    socketCleanup();
+    return (0 == TotalErrors) ? 0 : 1;
+}
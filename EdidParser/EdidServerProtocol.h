@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidServerProtocol.h
+ * @brief Request and response framing of the EdidParser server (--serve).
+ *
+ *  Clients connect to the Unix domain socket of the server and send any number of requests on a connection.
+ *  Requests on a connection are answered in order, each as
+ *
+ *      request:  EDID_SERVER_REQUEST  | EDID/Display ID bytes[EdidSizeInBytes]
+ *      response: EDID_SERVER_RESPONSE | payload[PayloadSizeInBytes]
+ *
+ *  Payload is the <EDID> XML element, an NDJSON line or a binary record (EdidBinaryFormat.h) as selected by Format
+ *  of the request, and is empty if Status is an error. Binary records start EDID_BIN_ALIGNMENT aligned relative to
+ *  the start of the response. Fields are little endian. The server answers a malformed request with
+ *  DDS_INVALID_PARAM and closes the connection.
+ *
+ */
+
+#pragma once
+
+#include "EdidBinaryFormat.h"
+
+#define EDID_SERVER_REQUEST_SIGNATURE 0x51524445  // "EDRQ"
+#define EDID_SERVER_RESPONSE_SIGNATURE 0x53524445 // "EDRS"
+#define EDID_SERVER_PROTOCOL_VERSION 1
+#define EDID_SERVER_MAX_EDID_SIZE ((MAX_EDID_BLOCKS + 1) * EDID_BLOCK_SIZE)
+
+/**
+ * @brief Payload format of a response.
+ */
+typedef enum _EDID_SERVER_FORMAT
+{
+    EDID_SERVER_FORMAT_XML = 0,
+    EDID_SERVER_FORMAT_BIN,
+    EDID_SERVER_FORMAT_NDJSON,
+    EDID_SERVER_FORMAT_MAX
+} EDID_SERVER_FORMAT;
+
+/**
+ * @brief Header of a request, followed by EdidSizeInBytes bytes of EDID/Display ID.
+ */
+typedef struct _EDID_SERVER_REQUEST
+{
+    DDU32 Signature;       // EDID_SERVER_REQUEST_SIGNATURE
+    DDU16 Version;         // EDID_SERVER_PROTOCOL_VERSION
+    DDU16 Format;          // EDID_SERVER_FORMAT
+    DDU32 EdidSizeInBytes; // At most EDID_SERVER_MAX_EDID_SIZE
+    DDU32 Reserved;        // 0
+} EDID_SERVER_REQUEST;
+
+C_ASSERT(sizeof(EDID_SERVER_REQUEST) == 16);
+
+/**
+ * @brief Header of a response, followed by PayloadSizeInBytes bytes of payload.
+ */
+typedef struct _EDID_SERVER_RESPONSE
+{
+    DDU32 Signature;          // EDID_SERVER_RESPONSE_SIGNATURE
+    DDU32 Status;             // DDSTATUS of the parse
+    DDU32 PayloadSizeInBytes;
+    DDU32 Reserved;           // 0
+} EDID_SERVER_RESPONSE;
+
+C_ASSERT(sizeof(EDID_SERVER_RESPONSE) == 16);
+C_ASSERT((sizeof(EDID_SERVER_RESPONSE) % EDID_BIN_ALIGNMENT) == 0);
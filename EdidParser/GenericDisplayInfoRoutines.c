@@ -21,6 +21,38 @@
 
 #include "GenericDisplayInfoRoutines.h"
 #include "DisplayLogging.h"
+#include <stddef.h>
+
+// SIMD paths are built for x64 only, where SSE2 is part of the baseline. AVX2 is picked at run time.
+#if defined(_M_X64) || defined(__x86_64__)
+#define DD_SIMD_X64
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define DD_TARGET_AVX2
+#else
+#define DD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// Lock of the formula timing cache, reader/writer so cache hits from parallel parses don't serialize
+#if defined(_WIN32)
+#include <windows.h>
+typedef SRWLOCK DD_TIMING_CACHE_LOCK;
+#define DD_TIMING_CACHE_LOCK_INIT SRWLOCK_INIT
+#define DD_TIMING_CACHE_ACQUIRE_SHARED(pLock) AcquireSRWLockShared(pLock)
+#define DD_TIMING_CACHE_RELEASE_SHARED(pLock) ReleaseSRWLockShared(pLock)
+#define DD_TIMING_CACHE_ACQUIRE_EXCLUSIVE(pLock) AcquireSRWLockExclusive(pLock)
+#define DD_TIMING_CACHE_RELEASE_EXCLUSIVE(pLock) ReleaseSRWLockExclusive(pLock)
+#else
+#include <pthread.h>
+typedef pthread_rwlock_t DD_TIMING_CACHE_LOCK;
+#define DD_TIMING_CACHE_LOCK_INIT PTHREAD_RWLOCK_INITIALIZER
+#define DD_TIMING_CACHE_ACQUIRE_SHARED(pLock) pthread_rwlock_rdlock(pLock)
+#define DD_TIMING_CACHE_RELEASE_SHARED(pLock) pthread_rwlock_unlock(pLock)
+#define DD_TIMING_CACHE_ACQUIRE_EXCLUSIVE(pLock) pthread_rwlock_wrlock(pLock)
+#define DD_TIMING_CACHE_RELEASE_EXCLUSIVE(pLock) pthread_rwlock_unlock(pLock)
+#endif
 
 #define OFFSET_FRACTIONAL_BITS 11
 #define MAX_LINKM_LINKN_VALUE (DDU32)((1 << 24) - 1) // LinkM/LinkN are 24bit values(2^24-1)
@@ -498,6 +530,9 @@ static RC_PARAMETERS RcParams[][MAX_COLUMN_INDEX] = {
 };
 // clang-format on
 
+// Number of bpp columns of a QP table below, RC parameters can't be generated for a bpp past the last column
+#define DSC_QP_TABLE_COLUMNS(Table) (sizeof((Table)[0]) / sizeof((Table)[0][0]))
+
 /*
 rc_range_minqp, rc_range_maxqp parameters for computation as per DSCParameterValuesVESA V1-2 spreadsheet
 maximum column-index for 444= ((3*BPC - 6)*2 + 1)
@@ -866,6 +901,406 @@ DDU32 DisplayInfoRoutinesGetHdmiLinkBwInMbps(DDU8 MaxFrlRateIndex)
     }
 }
 
+// HDMI 2.1 FRL packetization overheads, in parts per million of the FRL character rate
+#define HDMI_FRL_CHARS_PER_CHAR_BLOCK 510
+#define HDMI_FRL_OVERHEAD_RS_PPM 15686 // 8 RS parity characters per character block
+#define HDMI_FRL_OVERHEAD_MAP_PPM 4902 // 2.5 map characters per character block
+#define HDMI_FRL_OVERHEAD_M_PPM 3000   // Margin
+#define HDMI_FRL_CHAR_RATE_TOLERANCE_PPM 300
+#define HDMI_FRL_MAX_TB_BORROWED 400 // Tribytes of active video the source may send in horizontal blanking
+
+/**
+ * @brief Returns the highest FRL rate index of the HF-VSDB whose link rate and lane count the sink supports.
+ *
+ * @param MaxFrlInMbps
+ * @param MaxFrlLaneCount
+ * @return DDU8 0 if FRL is not supported
+ */
+DDU8 DisplayInfoRoutinesGetMaxHdmiFrlRateIndex(DDU32 MaxFrlInMbps, DDU8 MaxFrlLaneCount)
+{
+    DDU8 FrlRateIndex;
+
+    for (FrlRateIndex = NUM_FRL_LINK_RATES - 1; FrlRateIndex > 0; FrlRateIndex--)
+    {
+        DDU8 LaneCount = (FrlRateIndex <= 2) ? MAX_HDMI_LANES_TMDS_MODE : MAX_HDMI_LANES_FRL_MODE;
+
+        if ((Hdmi2_1_FrlLinkBwMbps[FrlRateIndex] <= MaxFrlInMbps) && (LaneCount <= MaxFrlLaneCount))
+        {
+            break;
+        }
+    }
+
+    return FrlRateIndex;
+}
+
+/**
+ * @brief Lists TMDS and the FRL rates up to MaxFrlRateIndex, lowest bandwidth first, with their character capacity.
+ *
+ * Capacity is the FRL character rate (link rate / 18 per lane) less the 300 ppm clock tolerance and the super block,
+ * RS, map and margin overheads of HDMI 2.1 FRL packetization.
+ * @param MaxFrlRateIndex
+ * @param pLinks: [out] room for NUM_FRL_LINK_RATES links
+ * @return DDU32 number of links, TMDS being the first
+ */
+DDU32 DisplayInfoRoutinesGetHdmiBudgetLinks(DDU8 MaxFrlRateIndex, HDMI_LINK_BUDGET_LINK* pLinks)
+{
+    DDU8 FrlRateIndex;
+
+    DD_ZERO_MEM(pLinks, sizeof(HDMI_LINK_BUDGET_LINK));
+    for (FrlRateIndex = 1; FrlRateIndex <= MaxFrlRateIndex; FrlRateIndex++)
+    {
+        HDMI_LINK_BUDGET_LINK* pLink = &pLinks[FrlRateIndex];
+        DDU32 OverheadPpm;
+        DDU64 CharsPerSec;
+
+        pLink->FrlRateIndex = FrlRateIndex;
+        pLink->LaneCount = (FrlRateIndex <= 2) ? MAX_HDMI_LANES_TMDS_MODE : MAX_HDMI_LANES_FRL_MODE;
+        pLink->LinkRateMbps = Hdmi2_1_FrlLinkBwMbps[FrlRateIndex];
+
+        // One super block start character per lane per 4 character blocks
+        OverheadPpm = (pLink->LaneCount * DD_MILLION) / (4 * HDMI_FRL_CHARS_PER_CHAR_BLOCK + pLink->LaneCount);
+        OverheadPpm += HDMI_FRL_OVERHEAD_RS_PPM + HDMI_FRL_OVERHEAD_MAP_PPM + HDMI_FRL_OVERHEAD_M_PPM;
+
+        CharsPerSec = ((DDU64)pLink->LaneCount * pLink->LinkRateMbps * DD_MILLION) / 18;
+        CharsPerSec = (CharsPerSec * (DD_MILLION - HDMI_FRL_CHAR_RATE_TOLERANCE_PPM)) / DD_MILLION;
+        CharsPerSec = (CharsPerSec * (DD_MILLION - OverheadPpm)) / DD_MILLION;
+        pLink->CapCharsPerMs = (DDU32)(CharsPerSec / DD_1K);
+    }
+
+    return MaxFrlRateIndex + 1;
+}
+
+/**
+ * @brief Checks one line of video on an FRL link.
+ *
+ * Active tribytes take 3/2 FRL characters each and blanking tribytes one. Blanking needs room for the audio packets
+ * of the line and has to fit in the blanking time, active video may overrun the active time by up to
+ * HDMI_FRL_MAX_TB_BORROWED tribytes taken from blanking, and the whole line has to fit in the line time.
+ * Times are compared as characters x pixel clock against capacity x pixels, so there is no division per mode.
+ * @param ActiveTb:
+ * @param BlankTb:
+ * @param AudioMinTb:
+ * @param CapCharsPerMs: of the link
+ * @param PixelClockKHz:
+ * @param HActive:
+ * @param HBlank:
+ * @return DDSTATUS DDS_SUCCESS, or the DDS_DPL_HDMI_FRL_BW_* check that failed
+ */
+DDSTATUS DisplayInfoRoutinesCheckHdmiFrlLine(DDU32 ActiveTb, DDU32 BlankTb, DDU32 AudioMinTb, DDU32 CapCharsPerMs, DDU32 PixelClockKHz,
+                                             DDU32 HActive, DDU32 HBlank)
+{
+    DDU64 ActiveChars = ((DDU64)ActiveTb * 3 + 1) / 2;
+    DDU64 BorrowChars = (HDMI_FRL_MAX_TB_BORROWED * 3) / 2;
+
+    return (BlankTb < AudioMinTb) ? DDS_DPL_HDMI_FRL_BW_TBBLANK_EXCEEDS_HBLANK_AUDIOMIN :
+           (((DDU64)BlankTb * PixelClockKHz) > ((DDU64)CapCharsPerMs * HBlank)) ? DDS_DPL_HDMI_FRL_BW_TBLANK_MIN_EXCEEDS_TBLANK_REF :
+           ((ActiveChars > BorrowChars) && (((ActiveChars - BorrowChars) * PixelClockKHz) > ((DDU64)CapCharsPerMs * HActive))) ?
+                                                  DDS_DPL_HDMI_FRL_BW_TB_BORROW_REQ_EXCEEDS_MAX_TB_BORROW_ALLOWED :
+           (((ActiveChars + BlankTb) * PixelClockKHz) > ((DDU64)CapCharsPerMs * (HActive + HBlank))) ? DDS_DPL_HDMI_FRL_BW_PAYLOAD_UTILIZATION_EXCEEDS_PAYLOAD_CAPACITY :
+                                                                                                         DDS_SUCCESS;
+}
+
+/**
+ * @brief Checks one line of DSC compressed video on an FRL link.
+ *
+ * The compressed line is HCactive tribytes holding a chunk per slice, and HCblank tribytes in the ratio of the
+ * uncompressed blanking to active video, but no less than the audio minimum. The line is then checked as by
+ * DisplayInfoRoutinesCheckHdmiFrlLine(). Total chunk bytes are limited by the sink's DSC_TotalChunkKBytes, if given.
+ * @param pHfVsdbInfo:
+ * @param Bppx16:
+ * @param Slices:
+ * @param AudioMinTb:
+ * @param CapCharsPerMs:
+ * @param PixelClockKHz:
+ * @param HActive:
+ * @param HBlank:
+ * @return DDSTATUS
+ */
+DDSTATUS DisplayInfoRoutinesCheckHdmiDscLine(const DD_HF_VSDB_INFO* pHfVsdbInfo, DDU32 Bppx16, DDU32 Slices, DDU32 AudioMinTb, DDU32 CapCharsPerMs,
+                                             DDU32 PixelClockKHz, DDU32 HActive, DDU32 HBlank)
+{
+    DDU32 SliceWidth = DD_ROUND_UP_DIV(HActive, Slices);
+    DDU32 ChunkBytes = DD_ROUND_UP_DIV(SliceWidth * Bppx16, 8 * 16);
+    DDU32 HcActive = DD_ROUND_UP_DIV(Slices * ChunkBytes, 3);
+    DDU32 HcBlank = DD_MAX((DDU32)DD_ROUND_UP_DIV((DDU64)HcActive * HBlank, HActive), AudioMinTb);
+
+    if ((0 != pHfVsdbInfo->DscTotalChunkKBytes) && ((Slices * ChunkBytes) > (DD_1K * (1 + (DDU32)pHfVsdbInfo->DscTotalChunkKBytes))))
+    {
+        return DDS_DPL_HDMI21_MODE_NOT_SUPPORTED;
+    }
+
+    return DisplayInfoRoutinesCheckHdmiFrlLine(HcActive, HcBlank, AudioMinTb, CapCharsPerMs, PixelClockKHz, HActive, HBlank);
+}
+
+/**
+ * @brief Budgets the HDMI link config of a range of modes of the mode table.
+ *
+ * For every mode, pixel formats are tried in order of preference: the uncompressed bpcs as listed, then DSC from the
+ * highest bpp down. The first format that fits at all is budgeted on TMDS if it fits there, else on the lowest FRL
+ * rate that carries it, so the result is the least link the mode needs.
+ * - TMDS carries a mode up to the sink's Max TMDS character rate (HF-VSDB, else HDMI VSDB, else 165 Mcsc), above
+ *   340 Mcsc only with scrambling. 4:2:0 only modes run at half the character rate.
+ * - FRL rates up to the sink's Max_FRL_Rate are checked line by line with DisplayInfoRoutinesCheckHdmiFrlLine().
+ * - FVA modes (FvaFactorM1 != 0) run at DotClockInHz times the FVA factor, on FRL only and only if the sink supports
+ *   FVA.
+ * - DSC 1.2 needs sink support for DSC 1.2 and DscBpc, and runs on FRL rates up to DSC_Max_FRL_Rate. The slice count
+ *   is the lowest of 1, 2, 4, 8, 12 and 16 up to DSC_MaxSlices that keeps the pixel clock per slice and the slice
+ *   width (2720) in limits. 4:2:0 only modes need native 4:2:0 DSC support and at most 1.5 x DscBpc bpp.
+ * Modes are computed HDMI_LINK_BUDGET_BLOCK_MODES at a time with one array per field, and each link and pixel format
+ * is checked on a whole block in a loop of integer arithmetic and selects without division by mode values, which
+ * the compiler can vectorize. The highest DSC bpp is found by bisection with a fixed number of steps for the same
+ * reason. Modes share nothing, so callers can budget ranges of modes in parallel.
+ * @param pBudgetArgs:
+ * @param FirstMode: index in the mode table
+ * @param NumModes:
+ * @param pResults: [out] one per mode
+ * @return DDU32 number of modes that fit
+ */
+DDU32 DisplayInfoRoutinesComputeHdmiLinkBudgets(const HDMI_LINK_BUDGET_ARGS* pBudgetArgs, DDU32 FirstMode, DDU32 NumModes, HDMI_LINK_BUDGET_RESULT* pResults)
+{
+    static const DDU8 DscSliceCounts[] = { 1, 2, 4, 8, 12, 16 };
+    HDMI_LINK_BUDGET_LINK Links[NUM_FRL_LINK_RATES];
+    DDU64 PixelClockHz[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 PixelClockKHz[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 HActive[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 HBlank[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 AudioMinTb[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 MaxDscBppx16[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 DscSlices[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 Lo[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 Hi[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU8 Is420[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU8 IsFva[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU8 LinkIndex[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDU32 FormatIndex[HDMI_LINK_BUDGET_BLOCK_MODES];
+    DDSTATUS Status[HDMI_LINK_BUDGET_BLOCK_MODES];
+    const DD_HF_VSDB_INFO* pHfVsdbInfo;
+    DDU64 MaxTmdsCharRateHz;
+    DD_BOOL IsScramblingSupported, IsFvaSupported, IsDscSupported;
+    DDU32 NumLinks, NumDscLinks, NumDscBpps, NumBisectSteps;
+    DDU32 TopDscBppx16 = 0;
+    DDU32 DscBppStepx16 = 0;
+    DDU32 NumFeasible = 0;
+    DDU32 BlockStart, NumBlockModes, Index, Link, Format, Step;
+
+    DDASSERT(pBudgetArgs && pBudgetArgs->pModeTable && pBudgetArgs->pHdmiCaps && pResults);
+    DDASSERT((FirstMode + NumModes) <= pBudgetArgs->pModeTable->NumEntries);
+
+    pHfVsdbInfo = &pBudgetArgs->pHdmiCaps->HfVsdbInfo;
+    MaxTmdsCharRateHz = (pHfVsdbInfo->IsHfVsdbInfoValid && (0 != pHfVsdbInfo->MaxTmdsCharRateCsc)) ? pHfVsdbInfo->MaxTmdsCharRateCsc :
+                        (0 != pBudgetArgs->pHdmiCaps->HdmiVsdbMaxTmdsClockRate)                    ? pBudgetArgs->pHdmiCaps->HdmiVsdbMaxTmdsClockRate :
+                                                                                                     TMDS_CHAR_RATE_165MCSC;
+    IsScramblingSupported = DD_IS_SCRAMBLING_SUPPORTED(*pHfVsdbInfo);
+    IsFvaSupported = pHfVsdbInfo->IsHfVsdbInfoValid && pHfVsdbInfo->IsFvaSupported;
+
+    NumLinks = DisplayInfoRoutinesGetHdmiBudgetLinks(
+        DD_IS_FRL_MODE_SUPPORTED(*pHfVsdbInfo) ? DisplayInfoRoutinesGetMaxHdmiFrlRateIndex(pHfVsdbInfo->MaxFrlInMbps, pHfVsdbInfo->MaxFrlLaneCount) : 0, Links);
+    NumDscLinks = DD_MIN(NumLinks, (DDU32)DisplayInfoRoutinesGetMaxHdmiFrlRateIndex(pHfVsdbInfo->MaxDscFrlInMbps, pHfVsdbInfo->MaxDscFrlLaneCount) + 1);
+
+    // DSC bpps are TopDscBppx16 - n * DscBppStepx16, down to MinDscBppx16
+    IsDscSupported = pHfVsdbInfo->IsHfVsdbInfoValid && pHfVsdbInfo->IsDsc1p2Supported && (NumDscLinks > 1) && (0 != pHfVsdbInfo->MaxDscSlices) &&
+                     (((8 == pBudgetArgs->DscBpc) && pHfVsdbInfo->CompressionBpc.DSC_8BPC_Supported) ||
+                      ((10 == pBudgetArgs->DscBpc) && pHfVsdbInfo->CompressionBpc.DSC_10BPC_Supported) ||
+                      ((12 == pBudgetArgs->DscBpc) && pHfVsdbInfo->CompressionBpc.DSC_12BPC_Supported)) &&
+                     (0 != pBudgetArgs->MinDscBppx16) && (0 != pBudgetArgs->DscBppStepx16) && (pBudgetArgs->MaxDscBppx16 >= pBudgetArgs->MinDscBppx16);
+    NumDscBpps = 0;
+    if (IsDscSupported)
+    {
+        DDU32 MinDscBppx16 = pBudgetArgs->MinDscBppx16;
+
+        DscBppStepx16 = pBudgetArgs->DscBppStepx16;
+        if (FALSE == pHfVsdbInfo->IsDscAllBppSupported)
+        {
+            MinDscBppx16 = DD_ROUND_UP_DIV(MinDscBppx16, 16) * 16;
+            DscBppStepx16 = DD_ROUND_UP_DIV(DscBppStepx16, 16) * 16;
+        }
+        if (pBudgetArgs->MaxDscBppx16 >= MinDscBppx16)
+        {
+            NumDscBpps = (pBudgetArgs->MaxDscBppx16 - MinDscBppx16) / DscBppStepx16 + 1;
+            TopDscBppx16 = MinDscBppx16 + (NumDscBpps - 1) * DscBppStepx16;
+        }
+    }
+    NumBisectSteps = 0;
+    while ((1u << NumBisectSteps) <= NumDscBpps)
+    {
+        NumBisectSteps++;
+    }
+
+    for (BlockStart = 0; BlockStart < NumModes; BlockStart += NumBlockModes)
+    {
+        NumBlockModes = DD_MIN(NumModes - BlockStart, HDMI_LINK_BUDGET_BLOCK_MODES);
+
+        for (Index = 0; Index < NumBlockModes; Index++)
+        {
+            const DD_TIMING_INFO* pMode = (const DD_TIMING_INFO*)pBudgetArgs->pModeTable->pEntry + FirstMode + BlockStart + Index;
+            DDU32 SamplesPerPacket = (pBudgetArgs->AudioChannels <= 2) ? 4 : 1;
+            DDU32 SliceIndex;
+
+            PixelClockHz[Index] = pMode->DotClockInHz * ((DDU64)pMode->FvaFactorM1 + 1);
+            PixelClockKHz[Index] = (DDU32)DD_ROUND_UP_DIV(PixelClockHz[Index], DD_1K);
+            HActive[Index] = pMode->HActive;
+            HBlank[Index] = (pMode->HTotal > pMode->HActive) ? (pMode->HTotal - pMode->HActive) : 0;
+            Is420[Index] = (pMode->CeData.SamplingMode.Yuv420 && !pMode->CeData.SamplingMode.Rgb && !pMode->CeData.SamplingMode.Yuv444);
+            IsFva[Index] = (0 != pMode->FvaFactorM1);
+            AudioMinTb[Index] = HDMI_FRL_HBLANK_AUDIO_MIN_TB;
+            if ((0 != pBudgetArgs->AudioSampleRateHz) && (0 != PixelClockHz[Index]))
+            {
+                AudioMinTb[Index] += 32 * (DDU32)DD_ROUND_UP_DIV((DDU64)pBudgetArgs->AudioSampleRateHz * pMode->HTotal, PixelClockHz[Index] * SamplesPerPacket);
+            }
+
+            // Fewest slices that keep pixel clock per slice and slice width in limits, 0 if none does
+            DscSlices[Index] = 0;
+            for (SliceIndex = 0; (0 == DscSlices[Index]) && (SliceIndex < sizeof(DscSliceCounts) / sizeof(DscSliceCounts[0])); SliceIndex++)
+            {
+                DDU32 Slices = DscSliceCounts[SliceIndex];
+
+                if ((Slices <= pHfVsdbInfo->MaxDscSlices) && (PixelClockKHz[Index] <= Slices * pHfVsdbInfo->DscMaxPixelClockPerSliceMHz * DD_1K) &&
+                    (DD_ROUND_UP_DIV(HActive[Index], Slices) <= HDMI_DSC_MAX_SLICE_WIDTH))
+                {
+                    DscSlices[Index] = Slices;
+                }
+            }
+            MaxDscBppx16[Index] = Is420[Index] ? (pHfVsdbInfo->IsDscNative420Supported ? (pBudgetArgs->DscBpc * 3 * 16) / 2 : 0) : UINT32_MAX;
+            if ((0 == HActive[Index]) || (0 == PixelClockKHz[Index]) || (FALSE == IsDscSupported))
+            {
+                DscSlices[Index] = 0;
+            }
+
+            LinkIndex[Index] = HDMI_LINK_BUDGET_NO_LINK;
+            FormatIndex[Index] = 0;
+            Status[Index] = ((0 == HActive[Index]) || (0 == PixelClockKHz[Index]) || (IsFva[Index] && !IsFvaSupported)) ? DDS_DPL_HDMI21_MODE_NOT_SUPPORTED :
+                            DDS_DPL_HDMI_FRL_NOT_SUPPORTED_BY_SINK;
+        }
+
+        // Uncompressed formats, each link on the whole block
+        for (Format = 0; Format < pBudgetArgs->NumBpcs; Format++)
+        {
+            DDU32 Bpc = pBudgetArgs->pBpcs[Format];
+
+            for (Link = 0; Link < NumLinks; Link++)
+            {
+                for (Index = 0; Index < NumBlockModes; Index++)
+                {
+                    DDU32 Bppx16 = Is420[Index] ? (Bpc * 3 * 16) / 2 : Bpc * 3 * 16;
+                    DDU64 TmdsCharRateHz = (PixelClockHz[Index] * Bpc) / (Is420[Index] ? 16 : 8);
+                    DD_BOOL IsValid = (0 != HActive[Index]) && (0 != PixelClockKHz[Index]) && (!IsFva[Index] || (IsFvaSupported && (0 != Link)));
+                    DDSTATUS LinkStatus;
+
+                    if (0 == Link)
+                    {
+                        LinkStatus = (IsValid && !IsFva[Index] && (TmdsCharRateHz <= MaxTmdsCharRateHz) && ((TmdsCharRateHz <= TMDS_CHAR_RATE_340MCSC) || IsScramblingSupported)) ?
+                                         DDS_SUCCESS :
+                                         DDS_DPL_HDMI_FRL_NOT_SUPPORTED_BY_SINK;
+                    }
+                    else
+                    {
+                        LinkStatus = IsValid ? DisplayInfoRoutinesCheckHdmiFrlLine(DD_ROUND_UP_DIV(HActive[Index] * Bppx16, 24 * 16),
+                                                                                   DD_ROUND_UP_DIV(HBlank[Index] * Bppx16, 24 * 16), AudioMinTb[Index],
+                                                                                   Links[Link].CapCharsPerMs, PixelClockKHz[Index], HActive[Index], HBlank[Index]) :
+                                               DDS_DPL_HDMI21_MODE_NOT_SUPPORTED;
+                    }
+
+                    FormatIndex[Index] = (IS_DDSTATUS_SUCCESS(LinkStatus) && (HDMI_LINK_BUDGET_NO_LINK == LinkIndex[Index])) ? Format : FormatIndex[Index];
+                    LinkIndex[Index] = (IS_DDSTATUS_SUCCESS(LinkStatus) && (HDMI_LINK_BUDGET_NO_LINK == LinkIndex[Index])) ? (DDU8)Link : LinkIndex[Index];
+                    Status[Index] = ((0 == Format) && ((Link + 1) == NumLinks) && IsValid) ? LinkStatus : Status[Index];
+                }
+            }
+        }
+
+        // Highest DSC bpp that fits on the fastest DSC link, Lo ends at its index or NumDscBpps if none does
+        for (Index = 0; Index < NumBlockModes; Index++)
+        {
+            Lo[Index] = 0;
+            Hi[Index] = ((0 != DscSlices[Index]) && (HDMI_LINK_BUDGET_NO_LINK == LinkIndex[Index])) ? NumDscBpps : 0;
+        }
+        for (Step = 0; (0 != NumDscBpps) && (Step < NumBisectSteps); Step++)
+        {
+            for (Index = 0; Index < NumBlockModes; Index++)
+            {
+                DDU32 Mid = (Lo[Index] + Hi[Index]) / 2;
+                DDU32 Bppx16 = TopDscBppx16 - Mid * DscBppStepx16;
+                DD_BOOL IsFit = (Lo[Index] < Hi[Index]) && (Bppx16 <= MaxDscBppx16[Index]) &&
+                                IS_DDSTATUS_SUCCESS(DisplayInfoRoutinesCheckHdmiDscLine(pHfVsdbInfo, Bppx16, DscSlices[Index], AudioMinTb[Index],
+                                                                                       Links[NumDscLinks - 1].CapCharsPerMs, PixelClockKHz[Index], HActive[Index],
+                                                                                       HBlank[Index]));
+
+                Lo[Index] = ((Lo[Index] < Hi[Index]) && !IsFit) ? (Mid + 1) : Lo[Index];
+                Hi[Index] = IsFit ? Mid : Hi[Index];
+            }
+        }
+        for (Index = 0; Index < NumBlockModes; Index++)
+        {
+            Lo[Index] = ((0 != DscSlices[Index]) && (HDMI_LINK_BUDGET_NO_LINK == LinkIndex[Index]) && (Lo[Index] < NumDscBpps)) ? Lo[Index] : NumDscBpps;
+        }
+
+        // Lowest DSC link for that bpp
+        for (Link = 1; (0 != NumDscBpps) && (Link < NumDscLinks); Link++)
+        {
+            for (Index = 0; Index < NumBlockModes; Index++)
+            {
+                DD_BOOL IsFit = (Lo[Index] < NumDscBpps) && (HDMI_LINK_BUDGET_NO_LINK == LinkIndex[Index]) &&
+                                IS_DDSTATUS_SUCCESS(DisplayInfoRoutinesCheckHdmiDscLine(pHfVsdbInfo, TopDscBppx16 - Lo[Index] * DscBppStepx16, DscSlices[Index],
+                                                                                       AudioMinTb[Index], Links[Link].CapCharsPerMs, PixelClockKHz[Index],
+                                                                                       HActive[Index], HBlank[Index]));
+
+                FormatIndex[Index] = IsFit ? pBudgetArgs->NumBpcs : FormatIndex[Index];
+                LinkIndex[Index] = IsFit ? (DDU8)Link : LinkIndex[Index];
+            }
+        }
+
+        for (Index = 0; Index < NumBlockModes; Index++)
+        {
+            HDMI_LINK_BUDGET_RESULT* pResult = &pResults[BlockStart + Index];
+            const HDMI_LINK_BUDGET_LINK* pLink;
+
+            DD_ZERO_MEM(pResult, sizeof(HDMI_LINK_BUDGET_RESULT));
+            pResult->ModeIndex = FirstMode + BlockStart + Index;
+            pResult->PixelClockHz = PixelClockHz[Index];
+            if (HDMI_LINK_BUDGET_NO_LINK == LinkIndex[Index])
+            {
+                pResult->Status = Status[Index];
+                continue;
+            }
+
+            pLink = &Links[LinkIndex[Index]];
+            pResult->Status = DDS_SUCCESS;
+            pResult->IsFrl = (0 != pLink->FrlRateIndex);
+            pResult->FrlRateIndex = pLink->FrlRateIndex;
+            pResult->LinkRateMbps = pLink->LinkRateMbps;
+            pResult->LaneCount = pResult->IsFrl ? pLink->LaneCount : MAX_HDMI_LANES_TMDS_MODE;
+            pResult->IsDscEnabled = (FormatIndex[Index] == pBudgetArgs->NumBpcs);
+            pResult->Bpc = pResult->IsDscEnabled ? pBudgetArgs->DscBpc : pBudgetArgs->pBpcs[FormatIndex[Index]];
+            if (pResult->IsFrl)
+            {
+                DDU32 ActiveTb;
+                DDU64 ActiveCapChars = ((DDU64)pLink->CapCharsPerMs * HActive[Index]) / PixelClockKHz[Index];
+
+                if (pResult->IsDscEnabled)
+                {
+                    pResult->DscBppx16 = TopDscBppx16 - Lo[Index] * DscBppStepx16;
+                    pResult->DscSlices = (DDU8)DscSlices[Index];
+                    ActiveTb = DD_ROUND_UP_DIV(DscSlices[Index] * DD_ROUND_UP_DIV(DD_ROUND_UP_DIV(HActive[Index], DscSlices[Index]) * pResult->DscBppx16, 8 * 16), 3);
+                }
+                else
+                {
+                    ActiveTb = DD_ROUND_UP_DIV(HActive[Index] * (Is420[Index] ? (pResult->Bpc * 3 * 16) / 2 : pResult->Bpc * 3 * 16), 24 * 16);
+                }
+                if (((DDU64)ActiveTb * 3 + 1) / 2 > ActiveCapChars)
+                {
+                    pResult->TbBorrowed = (DDU32)DD_ROUND_UP_DIV((((DDU64)ActiveTb * 3 + 1) / 2 - ActiveCapChars) * 2, 3);
+                }
+            }
+            else
+            {
+                pResult->TmdsCharRateHz = (PixelClockHz[Index] * pResult->Bpc) / (Is420[Index] ? 16 : 8);
+            }
+            NumFeasible++;
+        }
+    }
+
+    return NumFeasible;
+}
+
 /**
  * @brief Method to get TIMING_INFO from DTD.
  *
@@ -1257,7 +1692,7 @@ void DisplayInfoRoutinesUpdateTimingforCustomAlignment(DD_TIMING_INFO* pTimingIn
  * @param pCreateGTFTimingArgs
  * @return DDSTATUS
  */
-DDSTATUS DisplayInfoRoutinesCreateGTFTiming(CREATE_GTF_TIMING_ARGS* pCreateGTFTimingArgs)
+static DDSTATUS DisplayInfoRoutinesComputeGTFTiming(CREATE_GTF_TIMING_ARGS* pCreateGTFTimingArgs)
 {
     DDASSERT(pCreateGTFTimingArgs);
 
@@ -1435,7 +1870,7 @@ DDSTATUS DisplayInfoRoutinesCreateGTFTiming(CREATE_GTF_TIMING_ARGS* pCreateGTFTi
  * @param pCreateCvtTimingArgs
  * @return DDSTATUS
  */
-DDSTATUS DisplayInfoRoutinesCreateCVTTiming(CREATE_CVT_TIMING_ARGS* pCreateCvtTimingArgs)
+static DDSTATUS DisplayInfoRoutinesComputeCVTTiming(CREATE_CVT_TIMING_ARGS* pCreateCvtTimingArgs)
 {
     float FlActHFreq;
     float FlInterLaced;
@@ -1724,6 +2159,62 @@ DD_BOOL DisplayInfoRoutinesIsSamePixelClock(PIXELCLK_COMPARE_ARGS* pPixelClkComp
 
     return FALSE;
 }
+/**
+ * @brief Method to classify the refresh rate of a timing as integer or fractional media RR.
+ *
+ * Timing is a media RR timing if its rounded RR is one of 24, 30 or 60 Hz. It is integer RR if the dot clock is within
+ * +/-0.05 % of HTotal * VTotal * RR, and fractional RR (RR / 1.001) if the dot clock multiplied by 1.001 is within that range.
+ * Multiplying by 10000 is done to avoid floating point calculation.
+ * @param pTimingInfo
+ * @return DD_MEDIA_RR_TYPE
+ */
+DD_MEDIA_RR_TYPE DisplayInfoRoutinesGetMediaRrType(const DD_TIMING_INFO* pTimingInfo)
+{
+    static const DDU8 MediaRrList[] = { 24, 30, 60 };
+    DDU32 IntRrRangeMin, IntRrRangeMax, Index;
+    DDU64 IntDcRangeMin, IntDcRangeMax, OrigDC, DerivedDC;
+
+    for (Index = 0; Index < sizeof(MediaRrList) / sizeof(MediaRrList[0]); Index++)
+    {
+        if (MediaRrList[Index] == pTimingInfo->VRoundedRR)
+        {
+            break;
+        }
+    }
+    if (Index == sizeof(MediaRrList) / sizeof(MediaRrList[0]))
+    {
+        return DD_MEDIA_RR_NONE;
+    }
+
+    // Find rounded integer RR
+    OrigDC = pTimingInfo->DotClockInHz;
+    if (TRUE == pTimingInfo->IsInterlaced)
+    {
+        OrigDC = OrigDC * 2;
+    }
+
+    IntRrRangeMin = MediaRrList[Index] * 9995;  // Precision Factor of 10000, (1 - 0.0005) * 10000 = 9995
+    IntRrRangeMax = MediaRrList[Index] * 10005; // Precision Factor of 10000, (1 + 0.0005) * 10000 = 10005
+    OrigDC = OrigDC * 10000;                    // Adjust Precision Factor
+    IntDcRangeMin = (DDU64)pTimingInfo->HTotal * pTimingInfo->VTotal * IntRrRangeMin;
+    IntDcRangeMax = (DDU64)pTimingInfo->HTotal * pTimingInfo->VTotal * IntRrRangeMax;
+    if ((OrigDC >= IntDcRangeMin) && (OrigDC <= IntDcRangeMax))
+    {
+        return DD_MEDIA_RR_INTEGER;
+    }
+
+    // if original dot clock is not integer then check if it is fractional...
+    // we convert original dot clock (now assumed to be fractional),into integer dot clock
+    // by multiplying it by 1.001 and then compare with allowed range for integer dot clock
+    DerivedDC = (OrigDC * 1001) / 1000;
+    if ((DerivedDC >= IntDcRangeMin) && (DerivedDC <= IntDcRangeMax))
+    {
+        return DD_MEDIA_RR_FRACTIONAL;
+    }
+
+    return DD_MEDIA_RR_NONE;
+}
+
 /**
  * @brief  Display Info Routines Get Timing From PRTiming For PRMask.
  *
@@ -1795,6 +2286,173 @@ DDU8 DisplayInfoRoutinesCalcChksum(DDU8* pBuffer, DDU32 BufferLen)
 
     return Chksum;
 }
+
+/**
+ * @brief  This function returns the highest SIMD level supported by CPU and OS.
+ *
+ * @param  None
+ * @return DD_SIMD_LEVEL
+ */
+DD_SIMD_LEVEL DisplayInfoRoutinesGetSimdLevel(void)
+{
+#if defined(DD_SIMD_X64) && defined(_MSC_VER)
+    int CpuInfo[4];
+
+    __cpuid(CpuInfo, 0);
+    if (CpuInfo[0] >= 7)
+    {
+        // Leaf 1 ECX: OSXSAVE (27) and AVX (28), OS must save YMM state (XCR0 bits 1 and 2)
+        __cpuid(CpuInfo, 1);
+        if ((0x18000000 == (CpuInfo[2] & 0x18000000)) && (0x6 == (_xgetbv(0) & 0x6)))
+        {
+            // Leaf 7 EBX bit 5: AVX2
+            __cpuidex(CpuInfo, 7, 0);
+            if (0 != (CpuInfo[1] & 0x20))
+            {
+                return DD_SIMD_LEVEL_AVX2;
+            }
+        }
+    }
+
+    return DD_SIMD_LEVEL_SSE2;
+#elif defined(DD_SIMD_X64)
+    // Checks OS support of YMM state as well
+    return __builtin_cpu_supports("avx2") ? DD_SIMD_LEVEL_AVX2 : DD_SIMD_LEVEL_SSE2;
+#else
+    return DD_SIMD_LEVEL_SCALAR;
+#endif
+}
+
+#if defined(DD_SIMD_X64)
+/**
+ * @brief  Checksum bits for up to 64 blocks, SSE2 version. Bit N is set if block N adds up to 0 mod 256.
+ *
+ * @param  pBlocks
+ * @param  NumBlocks at most 64
+ * @return DDU64
+ */
+static DDU64 DisplayInfoRoutinesGetChksumOkMaskSse2(const DDU8* pBlocks, DDU32 NumBlocks)
+{
+    const __m128i Zero = _mm_setzero_si128();
+    DDU64 Mask = 0;
+    DDU32 Block, Index;
+
+    for (Block = 0; Block < NumBlocks; Block++)
+    {
+        const DDU8* pBlock = pBlocks + Block * EDID_BLOCK_SIZE;
+        __m128i Sum = Zero;
+
+        // SAD against zero sums 8 bytes into each 64 bit lane
+        for (Index = 0; Index < EDID_BLOCK_SIZE; Index += sizeof(__m128i))
+        {
+            Sum = _mm_add_epi64(Sum, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(pBlock + Index)), Zero));
+        }
+        Sum = _mm_add_epi64(Sum, _mm_srli_si128(Sum, 8));
+
+        Mask |= (DDU64)(0 == (_mm_cvtsi128_si32(Sum) & 0xFF)) << Block;
+    }
+
+    return Mask;
+}
+
+/**
+ * @brief  Checksum bits for up to 64 blocks, AVX2 version. Bit N is set if block N adds up to 0 mod 256.
+ *
+ * @param  pBlocks
+ * @param  NumBlocks at most 64
+ * @return DDU64
+ */
+static DD_TARGET_AVX2 DDU64 DisplayInfoRoutinesGetChksumOkMaskAvx2(const DDU8* pBlocks, DDU32 NumBlocks)
+{
+    const __m256i Zero = _mm256_setzero_si256();
+    DDU64 Mask = 0;
+    DDU32 Block;
+
+    for (Block = 0; Block < NumBlocks; Block++)
+    {
+        const DDU8* pBlock = pBlocks + Block * EDID_BLOCK_SIZE;
+        __m256i Sum;
+        __m128i Sum128;
+
+        Sum = _mm256_add_epi64(_mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)pBlock), Zero),
+                               _mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)(pBlock + 32)), Zero));
+        Sum = _mm256_add_epi64(Sum, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)(pBlock + 64)), Zero));
+        Sum = _mm256_add_epi64(Sum, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)(pBlock + 96)), Zero));
+
+        Sum128 = _mm_add_epi64(_mm256_castsi256_si128(Sum), _mm256_extracti128_si256(Sum, 1));
+        Sum128 = _mm_add_epi64(Sum128, _mm_srli_si128(Sum128, 8));
+
+        Mask |= (DDU64)(0 == (_mm_cvtsi128_si32(Sum128) & 0xFF)) << Block;
+    }
+
+    return Mask;
+}
+#endif
+
+/**
+ * @brief  Checksum bits for up to 64 blocks. Bit N is set if block N adds up to 0 mod 256.
+ *
+ * @param  pBlocks
+ * @param  NumBlocks at most 64
+ * @return DDU64
+ */
+static DDU64 DisplayInfoRoutinesGetChksumOkMaskScalar(const DDU8* pBlocks, DDU32 NumBlocks)
+{
+    DDU64 Mask = 0;
+    DDU32 Block, Index;
+
+    for (Block = 0; Block < NumBlocks; Block++)
+    {
+        const DDU8* pBlock = pBlocks + Block * EDID_BLOCK_SIZE;
+        DDU8 Sum = 0;
+
+        for (Index = 0; Index < EDID_BLOCK_SIZE; Index++)
+        {
+            Sum += pBlock[Index];
+        }
+
+        Mask |= (DDU64)(0 == Sum) << Block;
+    }
+
+    return Mask;
+}
+
+/**
+ * @brief  This function verifies checksums of back to back EDID_BLOCK_SIZE blocks.
+ *
+ *  Same check as comparing last byte against DisplayInfoRoutinesCalcChksum(), done with horizontal sums over
+ *  the whole block. SimdLevel above what DisplayInfoRoutinesGetSimdLevel() reports is lowered to it.
+ *
+ * @param  pBlocks NumBlocks * EDID_BLOCK_SIZE bytes
+ * @param  NumBlocks
+ * @param  SimdLevel
+ * @param  pChksumOkBitmap DD_BLOCK_BITMAP_WORDS(NumBlocks) words, bit set for blocks with a valid checksum
+ * @return void
+ */
+void DisplayInfoRoutinesCheckBlockChksums(const DDU8* pBlocks, DDU32 NumBlocks, DD_SIMD_LEVEL SimdLevel, DDU64* pChksumOkBitmap)
+{
+    DDU64 (*pfnGetChksumOkMask)(const DDU8*, DDU32) = DisplayInfoRoutinesGetChksumOkMaskScalar;
+    DDU32 Block;
+
+    DDASSERT(pBlocks && pChksumOkBitmap);
+
+    SimdLevel = DD_MIN(SimdLevel, DisplayInfoRoutinesGetSimdLevel());
+#if defined(DD_SIMD_X64)
+    if (DD_SIMD_LEVEL_AVX2 == SimdLevel)
+    {
+        pfnGetChksumOkMask = DisplayInfoRoutinesGetChksumOkMaskAvx2;
+    }
+    else if (DD_SIMD_LEVEL_SSE2 == SimdLevel)
+    {
+        pfnGetChksumOkMask = DisplayInfoRoutinesGetChksumOkMaskSse2;
+    }
+#endif
+
+    for (Block = 0; Block < NumBlocks; Block += 64)
+    {
+        pChksumOkBitmap[Block / 64] = pfnGetChksumOkMask(pBlocks + (DDU64)Block * EDID_BLOCK_SIZE, DD_MIN(NumBlocks - Block, 64));
+    }
+}
 /**
  * @brief This function.
  *
@@ -1802,7 +2460,7 @@ DDU8 DisplayInfoRoutinesCalcChksum(DDU8* pBuffer, DDU32 BufferLen)
  * @param pTargetTimings
  * @return DD_BOOL
  */
-DD_BOOL DisplayInfoRoutinesIsSameTiming(DD_TIMING_INFO* pSourceTimings, DD_TIMING_INFO* pTargetTimings)
+DD_BOOL DisplayInfoRoutinesIsSameTiming(const DD_TIMING_INFO* pSourceTimings, const DD_TIMING_INFO* pTargetTimings)
 {
     if ((pSourceTimings->HActive == pTargetTimings->HActive) && (pSourceTimings->HTotal == pTargetTimings->HTotal) && (pSourceTimings->VActive == pTargetTimings->VActive) &&
         (pSourceTimings->VTotal == pTargetTimings->VTotal) && (pSourceTimings->DotClockInHz == pTargetTimings->DotClockInHz) && (pSourceTimings->IsInterlaced == pTargetTimings->IsInterlaced) &&
@@ -2071,31 +2729,260 @@ static DD_BOOL DisplayInfoRoutinesComputeRcParameters(DSC_CFG* pDscCfg)
     return TRUE;
 }
 
+#if defined(DD_SIMD_X64)
 /**
- * @brief Get DSC PPS Initial Fullness Offset value.
+ * @brief  Unsigned 32 bit division of 8 lanes, AVX2 version.
  *
- * @param pDscCfg
- * @return DD_BOOL
+ *  Done in double precision, whose quotient of 32 bit operands truncates to the exact integer quotient.
+ *  Quotients must be below 2^31, lanes divided by 0 give 0x80000000.
+ *
+ * @param  Dividend
+ * @param  Divisor
+ * @return __m256i
  */
-static DD_BOOL DisplayInfoRoutinesUpdateDscPpsInitialOffsetValue(DSC_CFG* pDscCfg)
+static DD_TARGET_AVX2 __m256i DisplayInfoRoutinesDivU32Avx2(__m256i Dividend, __m256i Divisor)
 {
-    if (pDscCfg->Native422)
+    const __m256i SignBit = _mm256_set1_epi32((int)0x80000000);
+    const __m256d SignOffset = _mm256_set1_pd(2147483648.0);
+    __m256i FlippedDividend = _mm256_xor_si256(Dividend, SignBit);
+    __m256i FlippedDivisor = _mm256_xor_si256(Divisor, SignBit);
+    __m256d DividendLo, DividendHi, DivisorLo, DivisorHi;
+    __m128i QuotientLo, QuotientHi;
+
+    // Only signed conversion exists, so convert with the sign bit flipped and add it back
+    DividendLo = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(FlippedDividend)), SignOffset);
+    DividendHi = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(FlippedDividend, 1)), SignOffset);
+    DivisorLo = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(FlippedDivisor)), SignOffset);
+    DivisorHi = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(FlippedDivisor, 1)), SignOffset);
+
+    QuotientLo = _mm256_cvttpd_epi32(_mm256_div_pd(DividendLo, DivisorLo));
+    QuotientHi = _mm256_cvttpd_epi32(_mm256_div_pd(DividendHi, DivisorHi));
+
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(QuotientLo), QuotientHi, 1);
+}
+
+/**
+ * @brief  DD_ROUND_UP_DIV() of 8 lanes, AVX2 version.
+ *
+ * @param  Dividend
+ * @param  Divisor
+ * @return __m256i
+ */
+static DD_TARGET_AVX2 __m256i DisplayInfoRoutinesRoundUpDivU32Avx2(__m256i Dividend, __m256i Divisor)
+{
+    __m256i Quotient = DisplayInfoRoutinesDivU32Avx2(Dividend, Divisor);
+    __m256i IsExact = _mm256_cmpeq_epi32(_mm256_mullo_epi32(Quotient, Divisor), Dividend);
+
+    // Not exact lanes are all ones (-1), subtracting adds 1
+    return _mm256_sub_epi32(Quotient, _mm256_xor_si256(IsExact, _mm256_set1_epi32(-1)));
+}
+
+/**
+ * @brief  DisplayInfoRoutinesComputeOffset() for 8 slice configurations, AVX2 version.
+ *
+ *  GroupCount is the same for all lanes, so the branches of the C-Model are taken once.
+ *
+ * @param  pDscCfg
+ * @param  PixelsPerGroup
+ * @param  GroupsPerLine
+ * @param  GroupCount
+ * @param  FirstLineBpgOfs
+ * @param  SliceBpgOffset
+ * @param  NflBpgOffset
+ * @param  NslBpgOffset
+ * @return __m256i Offset Value per lane
+ */
+static DD_TARGET_AVX2 __m256i DisplayInfoRoutinesComputeOffsetAvx2(const DSC_CFG* pDscCfg, DDU32 PixelsPerGroup, DDU32 GroupsPerLine, DDU32 GroupCount, __m256i FirstLineBpgOfs,
+                                                                   __m256i SliceBpgOffset, __m256i NflBpgOffset, __m256i NslBpgOffset)
+{
+    DDU32 GroupCountId = DD_ROUND_UP_DIV(pDscCfg->InitialXmitDelay, PixelsPerGroup);
+    __m256i Offset;
+
+    if (GroupCount <= GroupCountId)
     {
-        // =IF(CompressBpp >= 8, 2048, IF(CompressBpp <=  7, 5632, 5632 - ROUND((CompressBpp - 7) * (3584), 0)))
-        // For Native422/Native420 CompressBpp value is doubled, so the above conditions are modified as follows:
-        // =IF(CompressBpp >= 16, 2048, IF(CompressBpp <=  14, 5632, 5632 - ROUND((CompressBpp - 14) * (1792), 0)))
-        if (pDscCfg->BitsPerPixel >= DSC_BPP_16)
-        {
-            pDscCfg->InitialOffset = 2048;
-        }
-        else if (pDscCfg->BitsPerPixel >= DSC_BPP_14)
-        {
-            pDscCfg->InitialOffset = 5632 - ((pDscCfg->BitsPerPixel - DSC_BPP_14) * 112);
-        }
-        else if (pDscCfg->BitsPerPixel >= DSC_BPP_12)
-        {
-            pDscCfg->InitialOffset = 5632;
-        }
+        Offset = _mm256_set1_epi32((int)DD_ROUND_UP_DIV(GroupCount * PixelsPerGroup * pDscCfg->BitsPerPixel, 16));
+    }
+    else
+    {
+        Offset = _mm256_sub_epi32(_mm256_set1_epi32((int)DD_ROUND_UP_DIV(GroupCountId * PixelsPerGroup * pDscCfg->BitsPerPixel, 16)),
+                                  _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)(GroupCount - GroupCountId)), SliceBpgOffset), OFFSET_FRACTIONAL_BITS));
+    }
+
+    if (GroupCount <= GroupsPerLine)
+    {
+        Offset = _mm256_add_epi32(Offset, _mm256_mullo_epi32(_mm256_set1_epi32((int)GroupCount), FirstLineBpgOfs));
+    }
+    else
+    {
+        Offset = _mm256_add_epi32(Offset, _mm256_mullo_epi32(_mm256_set1_epi32((int)GroupsPerLine), FirstLineBpgOfs));
+        Offset = _mm256_sub_epi32(Offset, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)(GroupCount - GroupsPerLine)), NflBpgOffset), OFFSET_FRACTIONAL_BITS));
+    }
+
+    if (pDscCfg->Native420)
+    {
+        if (GroupCount <= GroupsPerLine)
+        {
+            Offset = _mm256_sub_epi32(Offset, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)GroupCount), NslBpgOffset), OFFSET_FRACTIONAL_BITS));
+        }
+        else
+        {
+            DDU32 NslGroups = (GroupCount <= 2 * GroupsPerLine) ? GroupsPerLine : (GroupCount - GroupsPerLine);
+
+            Offset = _mm256_add_epi32(Offset, _mm256_set1_epi32((int)((GroupCount - GroupsPerLine) * pDscCfg->SecondLineBpgOfs)));
+            Offset = _mm256_sub_epi32(Offset, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)NslGroups), NslBpgOffset), OFFSET_FRACTIONAL_BITS));
+        }
+    }
+
+    return Offset;
+}
+
+/**
+ * @brief  DisplayInfoRoutinesComputeRcParameters() for 8 slice heights of the same slice layout, AVX2 version.
+ *
+ *  Same steps and 32 bit arithmetic as the scalar routine, with each check clearing the lane it fails instead of
+ *  returning. Only ChunkSize is written to pDscCfg, the slice height dependent results go to the output arrays.
+ *
+ * @param  pDscCfg           RC model, rate and slice width parameters
+ * @param  pSliceHeights     8 slice heights
+ * @param  pFirstLineBpgOfs  FirstLineBpgOfs of each slice height
+ * @param  pInitialDecDelay  [out] 8 entries
+ * @param  pRcbBits          [out] 8 entries
+ * @return DDU32 Bit N set if lane N is valid
+ */
+static DD_TARGET_AVX2 DDU32 DisplayInfoRoutinesComputeRcParametersAvx2(DSC_CFG* pDscCfg, const DDU32* pSliceHeights, const DDU32* pFirstLineBpgOfs, DDU32* pInitialDecDelay, DDU32* pRcbBits)
+{
+    const __m256i Zero = _mm256_setzero_si256();
+    const __m256i One = _mm256_set1_epi32(1);
+    const __m256i RcModelSize = _mm256_set1_epi32((int)pDscCfg->RcModelSize);
+    const __m256i BitsPerPixel = _mm256_set1_epi32((int)pDscCfg->BitsPerPixel);
+    __m256i SliceHeight = _mm256_loadu_si256((const __m256i*)pSliceHeights);
+    __m256i FirstLineBpgOfs = _mm256_loadu_si256((const __m256i*)pFirstLineBpgOfs);
+    __m256i Valid = _mm256_set1_epi32(-1);
+    __m256i SliceBits, MuxWordSize, NumExtraMuxBits, MuxBitsLimit, Remainder, Steps, IsNoWrap;
+    __m256i FinalOffset, FinalScale, NflBpgOffset, NslBpgOffset, SliceBpgOffset, ScaleIncrementInterval, RbsMin, HrdDelay;
+    DDU32 SliceWidth, GroupsPerLine, NumExtraMuxBitsMax, NumSsps, PixelsPerGroup;
+
+    NumSsps = pDscCfg->Native422 ? 4 : 3;
+    PixelsPerGroup = 3;
+    SliceWidth = ((pDscCfg->Native422 || pDscCfg->Native420) ? (pDscCfg->SliceWidth / 2) : pDscCfg->SliceWidth);
+    GroupsPerLine = DD_ROUND_UP_DIV(SliceWidth, PixelsPerGroup);
+    pDscCfg->ChunkSize = DD_ROUND_UP_DIV(SliceWidth * pDscCfg->BitsPerPixel, (8 * 16));
+
+    if (pDscCfg->ConvertRgb)
+    {
+        NumExtraMuxBitsMax = NumSsps * (pDscCfg->MuxWordSize + (4 * pDscCfg->BitsPerComponent + 4) - 2);
+    }
+    else if (TRUE == pDscCfg->Native422)
+    {
+        NumExtraMuxBitsMax = NumSsps * pDscCfg->MuxWordSize + (4 * pDscCfg->BitsPerComponent + 4) + 3 * (4 * pDscCfg->BitsPerComponent) - 2;
+    }
+    else
+    {
+        NumExtraMuxBitsMax = NumSsps * pDscCfg->MuxWordSize + (4 * pDscCfg->BitsPerComponent + 4) + 2 * (4 * pDscCfg->BitsPerComponent) - 2;
+    }
+
+    // The scalar loop lowers NumExtraMuxBits until (SliceBits - NumExtraMuxBits) % MuxWordSize is 0, or until it is 0.
+    // That takes Steps = (MuxWordSize - (SliceBits - NumExtraMuxBits) % MuxWordSize) % MuxWordSize decrements, unless
+    // SliceBits - NumExtraMuxBits wraps below 0, then the loop ends when NumExtraMuxBits reaches SliceBits.
+    SliceBits = _mm256_mullo_epi32(SliceHeight, _mm256_set1_epi32((int)(8 * pDscCfg->ChunkSize)));
+    MuxWordSize = _mm256_set1_epi32((int)pDscCfg->MuxWordSize);
+    NumExtraMuxBits = _mm256_set1_epi32((int)NumExtraMuxBitsMax);
+    Remainder = _mm256_sub_epi32(SliceBits, NumExtraMuxBits);
+    Remainder = _mm256_sub_epi32(Remainder, _mm256_mullo_epi32(DisplayInfoRoutinesDivU32Avx2(Remainder, MuxWordSize), MuxWordSize));
+    Steps = _mm256_andnot_si256(_mm256_cmpeq_epi32(Remainder, Zero), _mm256_sub_epi32(MuxWordSize, Remainder));
+    IsNoWrap = _mm256_cmpeq_epi32(_mm256_max_epu32(SliceBits, NumExtraMuxBits), SliceBits);
+    MuxBitsLimit = _mm256_blendv_epi8(_mm256_sub_epi32(NumExtraMuxBits, SliceBits), NumExtraMuxBits, IsNoWrap);
+    NumExtraMuxBits = _mm256_sub_epi32(NumExtraMuxBits, _mm256_min_epu32(Steps, MuxBitsLimit));
+
+    // FinalOffset must be less than RcModelSize
+    FinalOffset = _mm256_add_epi32(_mm256_set1_epi32((int)(pDscCfg->RcModelSize - (pDscCfg->InitialXmitDelay * pDscCfg->BitsPerPixel + 8) / 16)), NumExtraMuxBits);
+    Valid = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(FinalOffset, RcModelSize), FinalOffset), Valid);
+
+    // FinalScale must not exceed 63
+    FinalScale = DisplayInfoRoutinesDivU32Avx2(_mm256_set1_epi32((int)(8 * pDscCfg->RcModelSize)), _mm256_sub_epi32(RcModelSize, FinalOffset));
+    Valid = _mm256_andnot_si256(_mm256_cmpgt_epi32(FinalScale, _mm256_set1_epi32(63)), Valid);
+
+    // NflBpgOffset and NslBpgOffset are 0 below 2 and 3 lines and must fit 16 bits
+    NflBpgOffset = DisplayInfoRoutinesRoundUpDivU32Avx2(_mm256_slli_epi32(FirstLineBpgOfs, OFFSET_FRACTIONAL_BITS), _mm256_sub_epi32(SliceHeight, One));
+    NflBpgOffset = _mm256_and_si256(_mm256_cmpgt_epi32(SliceHeight, One), NflBpgOffset);
+    Valid = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_srli_epi32(NflBpgOffset, 16), Zero), Valid);
+    NslBpgOffset = DisplayInfoRoutinesRoundUpDivU32Avx2(_mm256_set1_epi32((int)(pDscCfg->SecondLineBpgOfs << OFFSET_FRACTIONAL_BITS)), _mm256_sub_epi32(SliceHeight, One));
+    NslBpgOffset = _mm256_and_si256(_mm256_cmpgt_epi32(SliceHeight, _mm256_set1_epi32(2)), NslBpgOffset);
+    Valid = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_srli_epi32(NslBpgOffset, 16), Zero), Valid);
+
+    SliceBpgOffset = _mm256_slli_epi32(_mm256_add_epi32(_mm256_set1_epi32((int)(pDscCfg->RcModelSize - pDscCfg->InitialOffset)), NumExtraMuxBits), OFFSET_FRACTIONAL_BITS);
+    SliceBpgOffset = DisplayInfoRoutinesRoundUpDivU32Avx2(SliceBpgOffset, _mm256_mullo_epi32(SliceHeight, _mm256_set1_epi32((int)GroupsPerLine)));
+
+    if (pDscCfg->DscVersionMinor == 2)
+    {
+        __m256i BitsLeft;
+
+        // FirstLineBpgOfs must be 0 for slice_height == 1
+        Valid = _mm256_andnot_si256(_mm256_andnot_si256(_mm256_cmpeq_epi32(FirstLineBpgOfs, Zero), _mm256_cmpeq_epi32(SliceHeight, One)), Valid);
+
+        // Bits/pixel allocation for non-first lines must not be below (1 + 5 * PixelsPerGroup), unsigned compare
+        BitsLeft = _mm256_sub_epi32(_mm256_set1_epi32((int)(PixelsPerGroup * pDscCfg->BitsPerPixel)), _mm256_slli_epi32(_mm256_add_epi32(SliceBpgOffset, NflBpgOffset), 4 + OFFSET_FRACTIONAL_BITS));
+        Valid = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_min_epu32(BitsLeft, _mm256_set1_epi32((int)(5 * PixelsPerGroup))), BitsLeft), Valid);
+    }
+
+    // ScaleIncrementInterval is 0 for FinalScale up to 9 and must fit 16 bits
+    ScaleIncrementInterval = DisplayInfoRoutinesDivU32Avx2(_mm256_slli_epi32(FinalOffset, OFFSET_FRACTIONAL_BITS),
+                                                           _mm256_mullo_epi32(_mm256_add_epi32(_mm256_add_epi32(NflBpgOffset, SliceBpgOffset), NslBpgOffset),
+                                                                              _mm256_sub_epi32(FinalScale, _mm256_set1_epi32(9))));
+    ScaleIncrementInterval = _mm256_and_si256(_mm256_cmpgt_epi32(FinalScale, _mm256_set1_epi32(9)), ScaleIncrementInterval);
+    Valid = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_srli_epi32(ScaleIncrementInterval, 16), Zero), Valid);
+
+    if ((pDscCfg->DscVersionMinor == 2) && (pDscCfg->Native422 || pDscCfg->Native420))
+    {
+        __m256i MaxOffset;
+
+        MaxOffset = DisplayInfoRoutinesComputeOffsetAvx2(pDscCfg, PixelsPerGroup, GroupsPerLine, DD_ROUND_UP_DIV(pDscCfg->InitialXmitDelay, PixelsPerGroup), FirstLineBpgOfs,
+                                                         SliceBpgOffset, NflBpgOffset, NslBpgOffset);
+        MaxOffset = _mm256_max_epi32(MaxOffset, DisplayInfoRoutinesComputeOffsetAvx2(pDscCfg, PixelsPerGroup, GroupsPerLine, GroupsPerLine, FirstLineBpgOfs, SliceBpgOffset,
+                                                                                     NflBpgOffset, NslBpgOffset));
+        MaxOffset = _mm256_max_epi32(MaxOffset, DisplayInfoRoutinesComputeOffsetAvx2(pDscCfg, PixelsPerGroup, GroupsPerLine, 2 * GroupsPerLine, FirstLineBpgOfs, SliceBpgOffset,
+                                                                                     NflBpgOffset, NslBpgOffset));
+        RbsMin = _mm256_add_epi32(_mm256_set1_epi32((int)(pDscCfg->RcModelSize - pDscCfg->InitialOffset)), MaxOffset);
+    }
+    else
+    {
+        RbsMin = _mm256_set1_epi32((int)(pDscCfg->RcModelSize - pDscCfg->InitialOffset + DD_ROUND_UP_DIV((pDscCfg->InitialXmitDelay * pDscCfg->BitsPerPixel), 16)));
+        RbsMin = _mm256_add_epi32(RbsMin, _mm256_mullo_epi32(_mm256_set1_epi32((int)GroupsPerLine), FirstLineBpgOfs));
+    }
+
+    HrdDelay = DisplayInfoRoutinesRoundUpDivU32Avx2(_mm256_slli_epi32(RbsMin, 4), BitsPerPixel);
+    _mm256_storeu_si256((__m256i*)pRcbBits, DisplayInfoRoutinesRoundUpDivU32Avx2(_mm256_mullo_epi32(HrdDelay, BitsPerPixel), _mm256_set1_epi32(16)));
+    _mm256_storeu_si256((__m256i*)pInitialDecDelay, _mm256_sub_epi32(HrdDelay, _mm256_set1_epi32((int)pDscCfg->InitialXmitDelay)));
+
+    return (DDU32)_mm256_movemask_ps(_mm256_castsi256_ps(Valid));
+}
+#endif
+
+/**
+ * @brief Get DSC PPS Initial Fullness Offset value.
+ *
+ * @param pDscCfg
+ * @return DD_BOOL
+ */
+static DD_BOOL DisplayInfoRoutinesUpdateDscPpsInitialOffsetValue(DSC_CFG* pDscCfg)
+{
+    if (pDscCfg->Native422)
+    {
+        // =IF(CompressBpp >= 8, 2048, IF(CompressBpp <=  7, 5632, 5632 - ROUND((CompressBpp - 7) * (3584), 0)))
+        // For Native422/Native420 CompressBpp value is doubled, so the above conditions are modified as follows:
+        // =IF(CompressBpp >= 16, 2048, IF(CompressBpp <=  14, 5632, 5632 - ROUND((CompressBpp - 14) * (1792), 0)))
+        if (pDscCfg->BitsPerPixel >= DSC_BPP_16)
+        {
+            pDscCfg->InitialOffset = 2048;
+        }
+        else if (pDscCfg->BitsPerPixel >= DSC_BPP_14)
+        {
+            pDscCfg->InitialOffset = 5632 - ((pDscCfg->BitsPerPixel - DSC_BPP_14) * 112);
+        }
+        else if (pDscCfg->BitsPerPixel >= DSC_BPP_12)
+        {
+            pDscCfg->InitialOffset = 5632;
+        }
         else
         {
             DISP_DBG_MSG(GFXDBG_CRITICAL, "BitsPerPixel < 6 in Native 4:2:2");
@@ -2211,10 +3098,10 @@ static void DisplayInfoRoutinesUpdateDscPpsLineBpgOffsetValues(DSC_CFG* pDscCfg)
  * @param pDscCfg
  * @return DD_BOOL
  */
-static DD_BOOL DisplayInfoRoutinesGenerateRcParamerters(DSC_CFG* pDscCfg)
+static DD_BOOL DisplayInfoRoutinesGenerateRcRateParameters(DSC_CFG* pDscCfg)
 {
-    DDU32 QpBpcModifier, SliceWidth, ColumnIndex, YuvInput;
-    DDS32 Diff, Offset, PaddingPixels;
+    DDU32 QpBpcModifier, ColumnIndex, YuvInput;
+    DDS32 Diff, Offset;
 
     // ConvertRgb == 1, when output color space is RGB
     YuvInput = pDscCfg->ConvertRgb == 1 ? 0 : 1;
@@ -2232,18 +3119,9 @@ static DD_BOOL DisplayInfoRoutinesGenerateRcParamerters(DSC_CFG* pDscCfg)
 
     // InitialXmitDelay = rc_model_size/2/CompressBpp; rc_model_size = 8192
     // For Native422/Native420 CompressBpp value is doubled.
+    // Padding adjustment depends on slice width and is done in DisplayInfoRoutinesGenerateRcSliceParameters()
     pDscCfg->InitialXmitDelay = (DDU32)DD_ROUND((4096 * 16), pDscCfg->BitsPerPixel);
 
-    DisplayInfoRoutinesUpdateDscPpsLineBpgOffsetValues(pDscCfg);
-
-    // SliceWidth is halved for Native420/Native422 mode
-    SliceWidth = ((pDscCfg->Native422 || pDscCfg->Native420) ? (pDscCfg->SliceWidth / 2) : pDscCfg->SliceWidth);
-    PaddingPixels = ((SliceWidth % 3) ? (3 - (SliceWidth % 3)) : 0) * (pDscCfg->InitialXmitDelay / SliceWidth);
-    if (((3 * pDscCfg->BitsPerPixel) >= (16 * ((pDscCfg->InitialXmitDelay + 2) / 3) * (pDscCfg->Native422 ? 4 : 3))) && (((pDscCfg->InitialXmitDelay + PaddingPixels) % 3) == 1))
-    {
-        pDscCfg->InitialXmitDelay++;
-    }
-
     pDscCfg->FlatnessMinQp = 3 + QpBpcModifier;
     pDscCfg->FlatnessMaxQp = 12 + QpBpcModifier;
     pDscCfg->FlatnessDetThresh = 2 << (pDscCfg->BitsPerComponent - 8);
@@ -2265,14 +3143,26 @@ static DD_BOOL DisplayInfoRoutinesGenerateRcParamerters(DSC_CFG* pDscCfg)
             switch (pDscCfg->BitsPerComponent)
             {
             case 8:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp420_8bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp420_8bpc[Index][ColumnIndex]);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp420_8bpc[Index][ColumnIndex]);
                 break;
             case 10:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp420_10bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp420_10bpc[Index][ColumnIndex]);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp420_10bpc[Index][ColumnIndex]);
                 break;
             case 12:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp420_12bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp420_12bpc[Index][ColumnIndex]);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp420_12bpc[Index][ColumnIndex]);
                 break;
@@ -2312,14 +3202,26 @@ static DD_BOOL DisplayInfoRoutinesGenerateRcParamerters(DSC_CFG* pDscCfg)
             switch (pDscCfg->BitsPerComponent)
             {
             case 8:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp422_8bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp422_8bpc[Index][ColumnIndex]);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp422_8bpc[Index][ColumnIndex]);
                 break;
             case 10:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp422_10bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp422_10bpc[Index][ColumnIndex]);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp422_10bpc[Index][ColumnIndex]);
                 break;
             case 12:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp422_12bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp422_12bpc[Index][ColumnIndex]);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp422_12bpc[Index][ColumnIndex]);
                 break;
@@ -2362,14 +3264,26 @@ static DD_BOOL DisplayInfoRoutinesGenerateRcParamerters(DSC_CFG* pDscCfg)
             switch (pDscCfg->BitsPerComponent)
             {
             case 8:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp444_8bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp444_8bpc[Index][ColumnIndex] - Diff);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp444_8bpc[Index][ColumnIndex] - Diff);
                 break;
             case 10:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp444_10bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp444_10bpc[Index][ColumnIndex] - Diff);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp444_10bpc[Index][ColumnIndex] - Diff);
                 break;
             case 12:
+                if (ColumnIndex >= DSC_QP_TABLE_COLUMNS(RangeMinQp444_12bpc))
+                {
+                    return FALSE;
+                }
                 pDscCfg->RcRangeParameters[Index].RangeMinQp = DD_MAX(0, RangeMinQp444_12bpc[Index][ColumnIndex] - Diff);
                 pDscCfg->RcRangeParameters[Index].RangeMaxQp = DD_MAX(0, RangeMaxQp444_12bpc[Index][ColumnIndex] - Diff);
                 break;
@@ -2415,12 +3329,51 @@ static DD_BOOL DisplayInfoRoutinesGenerateRcParamerters(DSC_CFG* pDscCfg)
 }
 
 /**
- * @brief Get RcParameter from cfg.
+ * @brief Generate the slice geometry dependent RC parameters, after DisplayInfoRoutinesGenerateRcRateParameters().
+ *
+ * @param pDscCfg
+ * @return void
+ */
+static void DisplayInfoRoutinesGenerateRcSliceParameters(DSC_CFG* pDscCfg)
+{
+    DDU32 SliceWidth;
+    DDS32 PaddingPixels;
+
+    DisplayInfoRoutinesUpdateDscPpsLineBpgOffsetValues(pDscCfg);
+
+    // SliceWidth is halved for Native420/Native422 mode
+    SliceWidth = ((pDscCfg->Native422 || pDscCfg->Native420) ? (pDscCfg->SliceWidth / 2) : pDscCfg->SliceWidth);
+    PaddingPixels = ((SliceWidth % 3) ? (3 - (SliceWidth % 3)) : 0) * (pDscCfg->InitialXmitDelay / SliceWidth);
+    if (((3 * pDscCfg->BitsPerPixel) >= (16 * ((pDscCfg->InitialXmitDelay + 2) / 3) * (pDscCfg->Native422 ? 4 : 3))) && (((pDscCfg->InitialXmitDelay + PaddingPixels) % 3) == 1))
+    {
+        pDscCfg->InitialXmitDelay++;
+    }
+}
+
+/**
+ * @brief Generate RC parameters for PPS (Picture Parameter Set), see DisplayInfoRoutinesGenerateRcRateParameters().
+ *
+ * @param pDscCfg
+ * @return DD_BOOL
+ */
+static DD_BOOL DisplayInfoRoutinesGenerateRcParamerters(DSC_CFG* pDscCfg)
+{
+    if (FALSE == DisplayInfoRoutinesGenerateRcRateParameters(pDscCfg))
+    {
+        return FALSE;
+    }
+
+    DisplayInfoRoutinesGenerateRcSliceParameters(pDscCfg);
+    return TRUE;
+}
+
+/**
+ * @brief Get RcParameter from cfg. FirstLineBpgOfs of DSC 1.2 is set by DisplayInfoRoutinesGetRcSliceParamertersFromCfg().
  *
  * @param pDscCfg:
  * @return void
  */
-static DD_BOOL DisplayInfoRoutinesGetRcParamertersFromCfg(DSC_CFG* pDscCfg)
+static DD_BOOL DisplayInfoRoutinesGetRcRateParamertersFromCfg(DSC_CFG* pDscCfg)
 {
     // Generation of RC parameters is not designed when Pixels/Slice < 15000
     // So we shall be using the RC parameters from the supplied .cfg files as part of VESA C-Model.
@@ -2476,6 +3429,30 @@ static DD_BOOL DisplayInfoRoutinesGetRcParamertersFromCfg(DSC_CFG* pDscCfg)
         return FALSE;
     }
 
+    pDscCfg->FirstLineBpgOfs = RcParams[RcParamRowIndex][RcParamColumnIndex].FirstLineBpgOffset;
+    pDscCfg->InitialXmitDelay = RcParams[RcParamRowIndex][RcParamColumnIndex].InitialXmitDelay;
+    pDscCfg->InitialOffset = RcParams[RcParamRowIndex][RcParamColumnIndex].InitialOffset;
+    pDscCfg->FlatnessMinQp = RcParams[RcParamRowIndex][RcParamColumnIndex].FlatnessMinQp;
+    pDscCfg->FlatnessMaxQp = RcParams[RcParamRowIndex][RcParamColumnIndex].FlatnessMaxQp;
+    pDscCfg->RcQuantIncrLimit0 = RcParams[RcParamRowIndex][RcParamColumnIndex].RcQuantIncrLimit0;
+    pDscCfg->RcQuantIncrLimit1 = RcParams[RcParamRowIndex][RcParamColumnIndex].RcQuantIncrLimit1;
+    for (DDU8 Index = 0; Index < DD_NUM_BUF_RANGES; Index++)
+    {
+        pDscCfg->RcRangeParameters[Index].RangeMinQp = RcParams[RcParamRowIndex][RcParamColumnIndex].RcRangeParams[Index].RangeMinQp;
+        pDscCfg->RcRangeParameters[Index].RangeMaxQp = RcParams[RcParamRowIndex][RcParamColumnIndex].RcRangeParams[Index].RangeMaxQp;
+        pDscCfg->RcRangeParameters[Index].RangeBpgOffset = RcParams[RcParamRowIndex][RcParamColumnIndex].RcRangeParams[Index].RangeBpgOffset;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Get the slice height dependent RcParameter, after DisplayInfoRoutinesGetRcRateParamertersFromCfg().
+ *
+ * @param pDscCfg
+ * @return void
+ */
+static void DisplayInfoRoutinesGetRcSliceParamertersFromCfg(DSC_CFG* pDscCfg)
+{
     /* if (dsc_cfg->slice_height >= 8)
             firstLineBpgOfs = 12 + ((int)(0.09 * MIN(34, dsc_cfg->slice_height - 8)));
         else
@@ -2492,34 +3469,33 @@ static DD_BOOL DisplayInfoRoutinesGetRcParamertersFromCfg(DSC_CFG* pDscCfg)
             pDscCfg->FirstLineBpgOfs = 2 * (pDscCfg->SliceHeight - 1);
         }
     }
-    else
-    {
-        pDscCfg->FirstLineBpgOfs = RcParams[RcParamRowIndex][RcParamColumnIndex].FirstLineBpgOffset;
-    }
-    pDscCfg->InitialXmitDelay = RcParams[RcParamRowIndex][RcParamColumnIndex].InitialXmitDelay;
-    pDscCfg->InitialOffset = RcParams[RcParamRowIndex][RcParamColumnIndex].InitialOffset;
-    pDscCfg->FlatnessMinQp = RcParams[RcParamRowIndex][RcParamColumnIndex].FlatnessMinQp;
-    pDscCfg->FlatnessMaxQp = RcParams[RcParamRowIndex][RcParamColumnIndex].FlatnessMaxQp;
-    pDscCfg->RcQuantIncrLimit0 = RcParams[RcParamRowIndex][RcParamColumnIndex].RcQuantIncrLimit0;
-    pDscCfg->RcQuantIncrLimit1 = RcParams[RcParamRowIndex][RcParamColumnIndex].RcQuantIncrLimit1;
-    for (DDU8 Index = 0; Index < DD_NUM_BUF_RANGES; Index++)
+}
+
+/**
+ * @brief Get RcParameter from cfg.
+ *
+ * @param pDscCfg:
+ * @return void
+ */
+static DD_BOOL DisplayInfoRoutinesGetRcParamertersFromCfg(DSC_CFG* pDscCfg)
+{
+    if (FALSE == DisplayInfoRoutinesGetRcRateParamertersFromCfg(pDscCfg))
     {
-        pDscCfg->RcRangeParameters[Index].RangeMinQp = RcParams[RcParamRowIndex][RcParamColumnIndex].RcRangeParams[Index].RangeMinQp;
-        pDscCfg->RcRangeParameters[Index].RangeMaxQp = RcParams[RcParamRowIndex][RcParamColumnIndex].RcRangeParams[Index].RangeMaxQp;
-        pDscCfg->RcRangeParameters[Index].RangeBpgOffset = RcParams[RcParamRowIndex][RcParamColumnIndex].RcRangeParams[Index].RangeBpgOffset;
+        return FALSE;
     }
+
+    DisplayInfoRoutinesGetRcSliceParamertersFromCfg(pDscCfg);
     return TRUE;
 }
 /**
- * @brief Compute DSC PPS(Picture Parameter Set)
- * Refer to DSCv1.1 C-Model for more information.
+ * @brief Set up the RC model part of DSC PPS that depends only on bpc, bpp and sampling mode.
  *
  * @param  pDscCfg [in, out]   Pointer to the ::DSC_CFG object.
  * @return DD_BOOL
- * @retval TRUE    If DSC PPS parameters are successfully computed.
- * @retval FALSE   If any of PPS parameters are invalid.
+ * @retval TRUE    If the sampling mode is valid for the DSC version.
+ * @retval FALSE   Otherwise.
  **/
-static DD_BOOL DisplayInfoRoutinesComputeDscParameters(DSC_CFG* pDscCfg, DD_BOOL IsMipiDsiDisplay)
+static DD_BOOL DisplayInfoRoutinesInitDscRcModel(DSC_CFG* pDscCfg)
 {
     DDU8 Index = 0;
 
@@ -2561,6 +3537,50 @@ static DD_BOOL DisplayInfoRoutinesComputeDscParameters(DSC_CFG* pDscCfg, DD_BOOL
         pDscCfg->RcBufThresh[13] = 0x7D;
     }
 
+    // The muxWordSize is determined by the BitsPerComponent value:
+    // When BitsPerComponent is 12bpc, muxWordSize shall be equal to 64 bits
+    // When BitsPerComponent is 8 or 10bpc, muxWordSize shall be equal to 48 bits
+    if (pDscCfg->BitsPerComponent <= 10)
+    {
+        pDscCfg->MuxWordSize = 48;
+    }
+    else
+    {
+        pDscCfg->MuxWordSize = 64;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Tells if RC parameters come from the .cfg files of the VESA C-Model instead of being generated.
+ *
+ * @param  IsMipiDsiDisplay
+ * @param  SliceWidth
+ * @param  SliceHeight
+ * @return DD_BOOL
+ **/
+static DD_BOOL DisplayInfoRoutinesIsDscCfgTableUsed(DD_BOOL IsMipiDsiDisplay, DDU32 SliceWidth, DDU32 SliceHeight)
+{
+    return (IsMipiDsiDisplay || ((SliceHeight * SliceWidth) < MIN_PIXELS_PER_DSC_SLICE_444)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Compute DSC PPS(Picture Parameter Set)
+ * Refer to DSCv1.1 C-Model for more information.
+ *
+ * @param  pDscCfg [in, out]   Pointer to the ::DSC_CFG object.
+ * @return DD_BOOL
+ * @retval TRUE    If DSC PPS parameters are successfully computed.
+ * @retval FALSE   If any of PPS parameters are invalid.
+ **/
+static DD_BOOL DisplayInfoRoutinesComputeDscParameters(DSC_CFG* pDscCfg, DD_BOOL IsMipiDsiDisplay)
+{
+    if (FALSE == DisplayInfoRoutinesInitDscRcModel(pDscCfg))
+    {
+        return FALSE;
+    }
+
     // Pixels/Slice = (pDscCfg->SliceHeight * pDscCfg->SliceWidth)
     // Selection b/w calculated RcRangeParameters or RcRangeParameters from .cfg files. (part of VESA C-Model) is as follows:
     //      if (Pixels/Slice >= 15000) {
@@ -2571,7 +3591,7 @@ static DD_BOOL DisplayInfoRoutinesComputeDscParameters(DSC_CFG* pDscCfg, DD_BOOL
     // When RcRangeParameters are from .cfg files, they are defined for limited BPPs only.
     // Hence output DscBpp is limited to one of {8,10,12,15} BPPs.
 
-    if ((IsMipiDsiDisplay) || (pDscCfg->SliceHeight * pDscCfg->SliceWidth < 15000))
+    if (DisplayInfoRoutinesIsDscCfgTableUsed(IsMipiDsiDisplay, pDscCfg->SliceWidth, pDscCfg->SliceHeight))
     {
         DD_BOOL RetVal = DisplayInfoRoutinesGetRcParamertersFromCfg(pDscCfg);
         if (FALSE == RetVal)
@@ -2596,18 +3616,6 @@ static DD_BOOL DisplayInfoRoutinesComputeDscParameters(DSC_CFG* pDscCfg, DD_BOOL
         return FALSE;
     }
 
-    // The muxWordSize is determined by the BitsPerComponent value:
-    // When BitsPerComponent is 12bpc, muxWordSize shall be equal to 64 bits
-    // When BitsPerComponent is 8 or 10bpc, muxWordSize shall be equal to 48 bits
-    if (pDscCfg->BitsPerComponent <= 10)
-    {
-        pDscCfg->MuxWordSize = 48;
-    }
-    else
-    {
-        pDscCfg->MuxWordSize = 64;
-    }
-
     while (pDscCfg->SliceHeight != 0)
     {
         if (DisplayInfoRoutinesComputeRcParameters(pDscCfg))
@@ -2760,10 +3768,440 @@ DD_BOOL DisplayInfoRoutinesCreateDscCfg(DD_RX_DSC_CAPS* pSinkDscDecoderCaps, DD_
     return DisplayInfoRoutinesComputeDscParameters(pDscCfg, pSinkDscDecoderCaps->IsMipiDsiDisplay);
 }
 
+// Slice heights of a DSC sweep are divisors of the picture height, no height up to 65535 has more than 120
+#define DSC_SWEEP_MAX_SLICE_HEIGHTS 128
+#define DSC_SWEEP_MAX_BPCS 3
+
 /**
- * @brief For DP_SST calculate LinkM/N and DataM/N values.
+ * @brief RC parameters of one (bpc, bpp) point of a DSC sweep, shared by all slice configurations of the point.
+ */
+typedef struct _DSC_SWEEP_RATE
+{
+    DSC_CFG CfgTable;  // RC parameters from .cfg files, used for small slices and MIPI DSI
+    DSC_CFG Generated; // Generated RC parameters
+    DD_BOOL IsCfgTableValid;
+    DD_BOOL IsGeneratedValid;
+} DSC_SWEEP_RATE;
+
+/**
+ * @brief Gets the bpc values of a DSC sweep, in ascending order.
  *
- * LinkM/LinkN = PixelClock/LinkSymbolClock
+ * @param  pSinkDscDecoderCaps
+ * @param  pBpcs [out] DSC_SWEEP_MAX_BPCS entries
+ * @return DDU32 Number of bpc values
+ */
+static DDU32 DisplayInfoRoutinesGetDscSweepBpcs(const DD_RX_DSC_CAPS* pSinkDscDecoderCaps, DDU32* pBpcs)
+{
+    DDU32 NumBpcs = 0;
+
+    // 16 bpc is not supported by DisplayInfoRoutinesCreateDscCfg() either
+    if (pSinkDscDecoderCaps->CompressionBpc.DSC_8BPC_Supported)
+    {
+        pBpcs[NumBpcs++] = 8;
+    }
+    if (pSinkDscDecoderCaps->CompressionBpc.DSC_10BPC_Supported)
+    {
+        pBpcs[NumBpcs++] = 10;
+    }
+    if (pSinkDscDecoderCaps->CompressionBpc.DSC_12BPC_Supported)
+    {
+        pBpcs[NumBpcs++] = 12;
+    }
+
+    return NumBpcs;
+}
+
+/**
+ * @brief Gets the number of bpp values of a DSC sweep.
+ *
+ * @param  pSweepArgs
+ * @return DDU32
+ */
+static DDU32 DisplayInfoRoutinesGetDscSweepNumBpps(const DSC_CFG_SWEEP_ARGS* pSweepArgs)
+{
+    if ((0 == pSweepArgs->BppStepx16) || (0 == pSweepArgs->MinBppx16) || (pSweepArgs->MaxBppx16 < pSweepArgs->MinBppx16))
+    {
+        return 0;
+    }
+
+    return (pSweepArgs->MaxBppx16 - pSweepArgs->MinBppx16) / pSweepArgs->BppStepx16 + 1;
+}
+
+/**
+ * @brief Gets the slice heights of a DSC sweep, divisors of PicHeight from MinSliceHeight up, in ascending order.
+ *
+ * @param  pSweepArgs
+ * @param  pSliceHeights [out] DSC_SWEEP_MAX_SLICE_HEIGHTS entries
+ * @return DDU32 Number of slice heights
+ */
+static DDU32 DisplayInfoRoutinesGetDscSweepSliceHeights(const DSC_CFG_SWEEP_ARGS* pSweepArgs, DDU32* pSliceHeights)
+{
+    DDU32 NumSliceHeights = 0;
+    DDU32 SliceHeight;
+
+    for (SliceHeight = DD_MAX(1, pSweepArgs->MinSliceHeight); (SliceHeight <= pSweepArgs->PicHeight) && (NumSliceHeights < DSC_SWEEP_MAX_SLICE_HEIGHTS); SliceHeight++)
+    {
+        if (0 == (pSweepArgs->PicHeight % SliceHeight))
+        {
+            pSliceHeights[NumSliceHeights++] = SliceHeight;
+        }
+    }
+
+    return NumSliceHeights;
+}
+
+/**
+ * @brief Prepares the RC parameters of one (bpc, bpp) point of a DSC sweep.
+ *
+ * Everything that depends only on bpc, bpp and the sink caps is computed here once, for both
+ * the .cfg file and the generated RC parameters.
+ *
+ * @param  pSweepArgs
+ * @param  BitsPerComponent
+ * @param  Bppx16
+ * @param  pRate [out]
+ * @return void
+ */
+static void DisplayInfoRoutinesInitDscSweepRate(const DSC_CFG_SWEEP_ARGS* pSweepArgs, DDU32 BitsPerComponent, DDU32 Bppx16, DSC_SWEEP_RATE* pRate)
+{
+    const DD_RX_DSC_CAPS* pSinkDscDecoderCaps = pSweepArgs->pSinkDscDecoderCaps;
+    DSC_CFG* pDscCfg = &pRate->Generated;
+
+    DD_ZERO_MEM(pRate, sizeof(DSC_SWEEP_RATE));
+
+    // Same fields DisplayInfoRoutinesCreateDscCfg() takes from the sink caps
+    pDscCfg->DscVersionMajor = pSinkDscDecoderCaps->DscMajorVersion;
+    pDscCfg->DscVersionMinor = pSinkDscDecoderCaps->DscMinorVersion;
+    pDscCfg->LineBufDepth = pSinkDscDecoderCaps->LineBufferDepth;
+    pDscCfg->BlockPredEnable = pSinkDscDecoderCaps->IsBlockPredictionSupported;
+    pDscCfg->Simple422 = pSinkDscDecoderCaps->IsSimpleYCbCr422Supported;
+    pDscCfg->Native422 = pSinkDscDecoderCaps->IsYCbCrNative422Supported;
+    pDscCfg->Native420 = pSinkDscDecoderCaps->IsYCbCrNative420Supported;
+    pDscCfg->ConvertRgb = pSinkDscDecoderCaps->ConvertRgb;
+    pDscCfg->PicWidth = pSweepArgs->PicWidth;
+    pDscCfg->PicHeight = pSweepArgs->PicHeight;
+    pDscCfg->BitsPerComponent = BitsPerComponent;
+    pDscCfg->BitsPerPixel = Bppx16;
+
+    if (FALSE == DisplayInfoRoutinesInitDscRcModel(pDscCfg))
+    {
+        return;
+    }
+
+    // As in DisplayInfoRoutinesCreateDscCfg(), RC parameters from .cfg files are used only for the BPPs they are defined for
+    if ((0x80 == Bppx16) || (0xA0 == Bppx16) || (0xC0 == Bppx16) || (0xF0 == Bppx16))
+    {
+        pRate->CfgTable = *pDscCfg;
+        pRate->IsCfgTableValid = DisplayInfoRoutinesGetRcRateParamertersFromCfg(&pRate->CfgTable) && (pRate->CfgTable.InitialOffset < pRate->CfgTable.RcModelSize);
+    }
+    pRate->IsGeneratedValid = DisplayInfoRoutinesGenerateRcRateParameters(pDscCfg) && (pDscCfg->InitialOffset < pDscCfg->RcModelSize);
+}
+
+/**
+ * @brief Computes the PPS of one slice configuration of a DSC sweep (bpc, bpp) point.
+ *
+ * Unlike DisplayInfoRoutinesCreateDscCfg(), slice height is not halved when RC parameters fail,
+ * smaller heights are points of the sweep on their own.
+ *
+ * @param  pRate
+ * @param  IsMipiDsiDisplay
+ * @param  SliceCount
+ * @param  SliceHeight
+ * @param  pDscCfg [out]
+ * @return DD_BOOL TRUE if the configuration is valid
+ */
+static DD_BOOL DisplayInfoRoutinesEvaluateDscSweepSlice(const DSC_SWEEP_RATE* pRate, DD_BOOL IsMipiDsiDisplay, DDU32 SliceCount, DDU32 SliceHeight, DSC_CFG* pDscCfg)
+{
+    DDU32 SliceWidth = DD_ROUND_UP_DIV(pRate->Generated.PicWidth, SliceCount);
+    DD_BOOL IsCfgTableUsed = DisplayInfoRoutinesIsDscCfgTableUsed(IsMipiDsiDisplay, SliceWidth, SliceHeight);
+
+    if (FALSE == (IsCfgTableUsed ? pRate->IsCfgTableValid : pRate->IsGeneratedValid))
+    {
+        return FALSE;
+    }
+
+    *pDscCfg = IsCfgTableUsed ? pRate->CfgTable : pRate->Generated;
+    pDscCfg->SliceCount = SliceCount;
+    pDscCfg->SliceWidth = SliceWidth;
+    pDscCfg->SliceHeight = SliceHeight;
+    if (1 == SliceCount)
+    {
+        pDscCfg->NumVdscInstances = 1;
+    }
+
+    if (IsCfgTableUsed)
+    {
+        DisplayInfoRoutinesGetRcSliceParamertersFromCfg(pDscCfg);
+    }
+    else
+    {
+        DisplayInfoRoutinesGenerateRcSliceParameters(pDscCfg);
+    }
+
+    return DisplayInfoRoutinesComputeRcParameters(pDscCfg);
+}
+
+/**
+ * @brief Sets the slice height of a DSC sweep slice layout and the FirstLineBpgOfs that goes with it.
+ *
+ * @param  pDscCfg
+ * @param  IsCfgTableUsed
+ * @param  SliceHeight
+ * @return void
+ */
+static void DisplayInfoRoutinesSetDscSweepSliceHeight(DSC_CFG* pDscCfg, DD_BOOL IsCfgTableUsed, DDU32 SliceHeight)
+{
+    pDscCfg->SliceHeight = SliceHeight;
+    if (IsCfgTableUsed)
+    {
+        DisplayInfoRoutinesGetRcSliceParamertersFromCfg(pDscCfg);
+    }
+    else
+    {
+        DisplayInfoRoutinesUpdateDscPpsLineBpgOffsetValues(pDscCfg);
+    }
+}
+
+/**
+ * @brief Sweeps the slice heights of one slice layout of a DSC sweep (bpc, bpp) point, and adds the valid ones.
+ *
+ * Only FirstLineBpgOfs and the outputs of DisplayInfoRoutinesComputeRcParameters() change with slice height, so a
+ * single DSC_CFG is set up for the layout. With AVX2, RC parameters of 8 slice heights are computed at once.
+ *
+ * @param  pTemplate        Rate point RC parameters
+ * @param  IsCfgTableUsed   TRUE if pTemplate has RC parameters from .cfg files
+ * @param  SliceCount
+ * @param  SliceWidth
+ * @param  pSliceHeights    Slice heights, all on the same side of DisplayInfoRoutinesIsDscCfgTableUsed()
+ * @param  NumSliceHeights
+ * @param  Bppx16
+ * @param  SimdLevel
+ * @param  pPoints [out]
+ * @param  NumPoints        Points found so far
+ * @param  MaxPoints
+ * @return DDU32 Points found so far, including the ones of this layout
+ */
+static DDU32 DisplayInfoRoutinesSweepDscSliceHeights(const DSC_CFG* pTemplate, DD_BOOL IsCfgTableUsed, DDU32 SliceCount, DDU32 SliceWidth, const DDU32* pSliceHeights,
+                                                     DDU32 NumSliceHeights, DDU32 Bppx16, DD_SIMD_LEVEL SimdLevel, DSC_CFG_SWEEP_POINT* pPoints, DDU32 NumPoints, DDU32 MaxPoints)
+{
+    DSC_CFG DscCfg;
+    DDU32 InitialDecDelay[DSC_SWEEP_MAX_SLICE_HEIGHTS];
+    DDU32 RcbBits[DSC_SWEEP_MAX_SLICE_HEIGHTS];
+    DDU64 ValidBitmap[DD_BLOCK_BITMAP_WORDS(DSC_SWEEP_MAX_SLICE_HEIGHTS)] = { 0 };
+    DDU32 HeightIndex;
+
+    if (0 == NumSliceHeights)
+    {
+        return NumPoints;
+    }
+
+    DscCfg = *pTemplate;
+    DscCfg.SliceCount = SliceCount;
+    DscCfg.SliceWidth = SliceWidth;
+    if (1 == SliceCount)
+    {
+        DscCfg.NumVdscInstances = 1;
+    }
+    if (FALSE == IsCfgTableUsed)
+    {
+        // Padding adjustment of InitialXmitDelay depends on slice width only
+        DscCfg.SliceHeight = pSliceHeights[0];
+        DisplayInfoRoutinesGenerateRcSliceParameters(&DscCfg);
+    }
+
+#if defined(DD_SIMD_X64)
+    if (DD_SIMD_LEVEL_AVX2 == SimdLevel)
+    {
+        for (HeightIndex = 0; HeightIndex < NumSliceHeights; HeightIndex += 8)
+        {
+            DDU32 SliceHeights[8], FirstLineBpgOfs[8], Lane, ValidMask;
+
+            // Lanes past the last slice height repeat it and are dropped
+            for (Lane = 0; Lane < 8; Lane++)
+            {
+                DisplayInfoRoutinesSetDscSweepSliceHeight(&DscCfg, IsCfgTableUsed, pSliceHeights[DD_MIN(HeightIndex + Lane, NumSliceHeights - 1)]);
+                SliceHeights[Lane] = DscCfg.SliceHeight;
+                FirstLineBpgOfs[Lane] = DscCfg.FirstLineBpgOfs;
+            }
+
+            ValidMask = DisplayInfoRoutinesComputeRcParametersAvx2(&DscCfg, SliceHeights, FirstLineBpgOfs, &InitialDecDelay[HeightIndex], &RcbBits[HeightIndex]);
+            if (NumSliceHeights - HeightIndex < 8)
+            {
+                ValidMask &= (1u << (NumSliceHeights - HeightIndex)) - 1;
+            }
+            ValidBitmap[HeightIndex / 64] |= (DDU64)ValidMask << (HeightIndex % 64);
+        }
+    }
+    else
+#endif
+    {
+        for (HeightIndex = 0; HeightIndex < NumSliceHeights; HeightIndex++)
+        {
+            DisplayInfoRoutinesSetDscSweepSliceHeight(&DscCfg, IsCfgTableUsed, pSliceHeights[HeightIndex]);
+            if (DisplayInfoRoutinesComputeRcParameters(&DscCfg))
+            {
+                InitialDecDelay[HeightIndex] = DscCfg.InitialDecDelay;
+                RcbBits[HeightIndex] = DscCfg.RcbBits;
+                ValidBitmap[HeightIndex / 64] |= 1ULL << (HeightIndex % 64);
+            }
+        }
+    }
+
+    for (HeightIndex = 0; HeightIndex < NumSliceHeights; HeightIndex++)
+    {
+        if (FALSE == DD_IS_BLOCK_BIT_SET(ValidBitmap, HeightIndex))
+        {
+            continue;
+        }
+
+        if (NumPoints < MaxPoints)
+        {
+            pPoints[NumPoints].BitsPerComponent = DscCfg.BitsPerComponent;
+            pPoints[NumPoints].Bppx16 = Bppx16;
+            pPoints[NumPoints].SliceCount = SliceCount;
+            pPoints[NumPoints].SliceWidth = SliceWidth;
+            pPoints[NumPoints].SliceHeight = pSliceHeights[HeightIndex];
+            pPoints[NumPoints].ChunkSize = DscCfg.ChunkSize;
+            pPoints[NumPoints].InitialXmitDelay = DscCfg.InitialXmitDelay;
+            pPoints[NumPoints].InitialDecDelay = InitialDecDelay[HeightIndex];
+            pPoints[NumPoints].RcbBits = RcbBits[HeightIndex];
+        }
+        NumPoints++;
+    }
+
+    return NumPoints;
+}
+
+/**
+ * @brief Gets the size of a DSC configuration sweep.
+ *
+ * @param  pSweepArgs
+ * @param  pNumRatePoints [out] Number of (bpc, bpp) points, bpc major
+ * @param  pNumSlicePoints [out] Number of (slice count, slice height) points, the most feasible points one rate point can give
+ * @return void
+ */
+void DisplayInfoRoutinesGetDscSweepSize(const DSC_CFG_SWEEP_ARGS* pSweepArgs, DDU32* pNumRatePoints, DDU32* pNumSlicePoints)
+{
+    DDU32 Bpcs[DSC_SWEEP_MAX_BPCS];
+    DDU32 SliceHeights[DSC_SWEEP_MAX_SLICE_HEIGHTS];
+    DDU32 NumSliceCounts = 0;
+    DDU32 Index;
+
+    DDASSERT(pSweepArgs && pSweepArgs->pSinkDscDecoderCaps && pNumRatePoints && pNumSlicePoints);
+
+    for (Index = 0; Index < MAX_DSC_SLICES_INDEX; Index++)
+    {
+        NumSliceCounts += (0 != pSweepArgs->pSinkDscDecoderCaps->SupportedSlices[Index]) ? 1 : 0;
+    }
+
+    *pNumRatePoints = DisplayInfoRoutinesGetDscSweepBpcs(pSweepArgs->pSinkDscDecoderCaps, Bpcs) * DisplayInfoRoutinesGetDscSweepNumBpps(pSweepArgs);
+    *pNumSlicePoints = NumSliceCounts * DisplayInfoRoutinesGetDscSweepSliceHeights(pSweepArgs, SliceHeights);
+}
+
+/**
+ * @brief Sweeps DSC configurations over bpc, compressed bpp, slice count and slice height, and reports the valid ones.
+ *
+ * The grid is bpc (CompressionBpc of the caps) x bpp (MinBppx16 to MaxBppx16) x slice count (SupportedSlices of
+ * the caps) x slice height (divisors of PicHeight). RC parameters that depend only on bpc and bpp are computed once
+ * per (bpc, bpp) rate point and reused for all its slice configurations. Rate points are independent, so callers
+ * may split [0, NumRatePoints) of DisplayInfoRoutinesGetDscSweepSize() between threads. Feasible points come out
+ * in rate point order, then slice count order of the caps, then ascending slice height.
+ *
+ * @param  pSweepArgs
+ * @param  FirstRatePoint
+ * @param  NumRatePoints
+ * @param  pPoints [out] Feasible points, up to MaxPoints
+ * @param  MaxPoints
+ * @return DDU32 Number of feasible points, may be more than MaxPoints
+ */
+DDU32 DisplayInfoRoutinesSweepDscCfgs(const DSC_CFG_SWEEP_ARGS* pSweepArgs, DDU32 FirstRatePoint, DDU32 NumRatePoints, DSC_CFG_SWEEP_POINT* pPoints, DDU32 MaxPoints)
+{
+    const DD_RX_DSC_CAPS* pSinkDscDecoderCaps;
+    DSC_SWEEP_RATE Rate;
+    DD_SIMD_LEVEL SimdLevel;
+    DDU32 Bpcs[DSC_SWEEP_MAX_BPCS];
+    DDU32 SliceHeights[DSC_SWEEP_MAX_SLICE_HEIGHTS];
+    DDU32 NumBpps, NumSliceHeights, NumCfgTableHeights, RatePoint, EndRatePoint, SliceIndex, SliceCount, SliceWidth, Bppx16;
+    DDU32 NumPoints = 0;
+
+    DDASSERT(pSweepArgs && pSweepArgs->pSinkDscDecoderCaps);
+    DDASSERT(pPoints || (0 == MaxPoints));
+
+    pSinkDscDecoderCaps = pSweepArgs->pSinkDscDecoderCaps;
+    SimdLevel = DD_MIN(pSweepArgs->SimdLevel, DisplayInfoRoutinesGetSimdLevel());
+    NumBpps = DisplayInfoRoutinesGetDscSweepNumBpps(pSweepArgs);
+    EndRatePoint = DD_MIN(FirstRatePoint + NumRatePoints, DisplayInfoRoutinesGetDscSweepBpcs(pSinkDscDecoderCaps, Bpcs) * NumBpps);
+    NumSliceHeights = DisplayInfoRoutinesGetDscSweepSliceHeights(pSweepArgs, SliceHeights);
+
+    for (RatePoint = FirstRatePoint; RatePoint < EndRatePoint; RatePoint++)
+    {
+        Bppx16 = pSweepArgs->MinBppx16 + (RatePoint % NumBpps) * pSweepArgs->BppStepx16;
+        DisplayInfoRoutinesInitDscSweepRate(pSweepArgs, Bpcs[RatePoint / NumBpps], Bppx16, &Rate);
+        if ((FALSE == Rate.IsCfgTableValid) && (FALSE == Rate.IsGeneratedValid))
+        {
+            continue;
+        }
+
+        for (SliceIndex = 0; SliceIndex < MAX_DSC_SLICES_INDEX; SliceIndex++)
+        {
+            SliceCount = pSinkDscDecoderCaps->SupportedSlices[SliceIndex];
+            if (0 == SliceCount)
+            {
+                continue;
+            }
+            SliceWidth = DD_ROUND_UP_DIV(pSweepArgs->PicWidth, SliceCount);
+            if ((0 != pSinkDscDecoderCaps->DscMaxSliceWidth) && (SliceWidth > pSinkDscDecoderCaps->DscMaxSliceWidth))
+            {
+                continue;
+            }
+
+            // Slice heights are ascending, the ones with RC parameters from .cfg files come first
+            for (NumCfgTableHeights = 0; NumCfgTableHeights < NumSliceHeights; NumCfgTableHeights++)
+            {
+                if (FALSE == DisplayInfoRoutinesIsDscCfgTableUsed(pSinkDscDecoderCaps->IsMipiDsiDisplay, SliceWidth, SliceHeights[NumCfgTableHeights]))
+                {
+                    break;
+                }
+            }
+
+            if (Rate.IsCfgTableValid)
+            {
+                NumPoints = DisplayInfoRoutinesSweepDscSliceHeights(&Rate.CfgTable, TRUE, SliceCount, SliceWidth, SliceHeights, NumCfgTableHeights, Bppx16, SimdLevel, pPoints,
+                                                                    NumPoints, MaxPoints);
+            }
+            if (Rate.IsGeneratedValid)
+            {
+                NumPoints = DisplayInfoRoutinesSweepDscSliceHeights(&Rate.Generated, FALSE, SliceCount, SliceWidth, &SliceHeights[NumCfgTableHeights],
+                                                                    NumSliceHeights - NumCfgTableHeights, Bppx16, SimdLevel, pPoints, NumPoints, MaxPoints);
+            }
+        }
+    }
+
+    return NumPoints;
+}
+
+/**
+ * @brief Creates the full DSC config of a point reported by DisplayInfoRoutinesSweepDscCfgs().
+ *
+ * @param  pSweepArgs Same args the point was swept with
+ * @param  pPoint
+ * @param  pDscCfg [out]
+ * @return DD_BOOL TRUE if the point is valid
+ */
+DD_BOOL DisplayInfoRoutinesCreateDscSweepCfg(const DSC_CFG_SWEEP_ARGS* pSweepArgs, const DSC_CFG_SWEEP_POINT* pPoint, DSC_CFG* pDscCfg)
+{
+    DSC_SWEEP_RATE Rate;
+
+    DDASSERT(pSweepArgs && pSweepArgs->pSinkDscDecoderCaps && pPoint && pDscCfg);
+
+    DisplayInfoRoutinesInitDscSweepRate(pSweepArgs, pPoint->BitsPerComponent, pPoint->Bppx16, &Rate);
+    return DisplayInfoRoutinesEvaluateDscSweepSlice(&Rate, pSweepArgs->pSinkDscDecoderCaps->IsMipiDsiDisplay, pPoint->SliceCount, pPoint->SliceHeight, pDscCfg);
+}
+
+/**
+ * @brief For DP_SST calculate LinkM/N and DataM/N values.
+ *
+ * LinkM/LinkN = PixelClock/LinkSymbolClock
  * Link M,Link N are Mvid and Nvid data fields of MSA which are sent during vertical blanking period for
  * regenerating pixel clock. (used for main video stream clock regeneration)
  *
@@ -4105,67 +5543,628 @@ DDU64 DpProtocolComputePixelDataBwMbps(DDU64 DotClockInHz, DD_BITS_PER_PIXEL Bit
     return (DD_ROUND_UP_DIV(((PixelClock100Hz * (DDU64)BitsPerPixel.Bppx16) / FIXED_POINT_U6_4_TO_REALVALUE_CONV_DIVISOR), (10 * DD_1K)));
 }
 
+// Link rate and lane count DpProtocolPlanLinkCfgs() tries a pixel format on
+typedef struct _DP_LINK_PLAN_LINK_CFG
+{
+    DDU32 LinkRateMbps;
+    DDU32 LaneCount;
+} DP_LINK_PLAN_LINK_CFG;
+
 /***************************************************************
- * @brief Populate the common Edid and Monitor data for Dp/Hdmi.
+ * @brief Lists the link configs of the sink caps, least link bandwidth (lanes x link rate) first.
  *
- * @param SinkType
- * @param ppEDID
- * @param pTimingInfo
- * @param DtdNum
- * @return void
+ * Same bandwidth is ordered by link rate, so 4 lanes of HBR come before 2 lanes of HBR2.
+ * @param pPlanArgs:
+ * @param pLinkCfgs: [out] room for DP_LINK_PLAN_MAX_LINK_RATES * 3 configs
+ * @return DDU32 number of link configs
  ***************************************************************/
-void DisplayInfoRoutinePopulateEdidAndMonitorData(DD_VIDEO_OUTPUT_TECHNOLOGY SinkType, EDID_BASE_BLOCK** ppEDID, DD_TIMING_INFO* pTimingInfo, DDU8 DtdNum)
+static DDU32 DpProtocolGetLinkPlanLinkCfgs(const DP_LINK_PLAN_ARGS* pPlanArgs, DP_LINK_PLAN_LINK_CFG* pLinkCfgs)
 {
-    MONITOR_RANGE_LIMITS MonitorRangeLimits;
-    DDU8 Temp;
-    DDU8 Index;
-
-    DDASSERT(ppEDID);
-    DDASSERT(pTimingInfo);
+    static const DDU32 LaneCounts[] = { LANE_X1, LANE_X2, LANE_X4 };
+    const DP_LINK_PLAN_SINK_CAPS* pSinkCaps = pPlanArgs->pSinkCaps;
+    DDU32 NumLinkCfgs = 0;
+    DDU32 RateIndex, LaneIndex, Index;
 
-    DD_ZERO_MEM(&MonitorRangeLimits, sizeof(MonitorRangeLimits));
-    // Set header
-    DD_MEM_COPY_SAFE((*ppEDID)->Header, sizeof((*ppEDID)->Header), BaseEdidHeader, sizeof(BaseEdidHeader));
+    for (RateIndex = 0; RateIndex < DD_MIN(pSinkCaps->NumLinkRates, DP_LINK_PLAN_MAX_LINK_RATES); RateIndex++)
+    {
+        DDU32 LinkRateMbps = pSinkCaps->LinkRatesMbps[RateIndex];
 
-    // Set vendor/product ID
-    DD_MEM_COPY_SAFE((*ppEDID)->PnpID.VendorProductID, sizeof((*ppEDID)->PnpID.VendorProductID), FakeEdidPNPId, sizeof(FakeEdidPNPId));
-    (*ppEDID)->Version = 1;
+        // DpProtocolSstComputeMNTu() is for 8b/10b channel coding only
+        if ((0 == LinkRateMbps) || ((DP_LINK_PLAN_MNTU_SST == pPlanArgs->MntuMethod) && (CH_CODING_128B_132B == GET_DP_CHANNEL_CODING(LinkRateMbps))))
+        {
+            continue;
+        }
 
-    switch (SinkType)
-    {
-    case DD_VOT_DISPLAYPORT_EXTERNAL:
-        (*ppEDID)->Revision = 4;
-        (*ppEDID)->BasicDisplayParams.VideoInput = 0xA5;
-        // since Edid_14_MonitorInfo is shifted by 1 index, need to decrement 1 from DtdNum
-        (*ppEDID)->EdidTiming.Edid_14_MonitorInfo[DtdNum - 1].MonitorDescHeader.Flag0 = 0;
-        (*ppEDID)->EdidTiming.Edid_14_MonitorInfo[DtdNum - 1].MonitorDescHeader.DataTypeTag = 0xFD; // Monitor range limit, BASEEDID_MONITORRANGELIMIT_MDDATATYPE
-        (*ppEDID)->EdidTiming.Edid_14_MonitorInfo[DtdNum - 1].MonitorRangeLimits = MonitorRangeLimits;
+        for (LaneIndex = 0; (LaneIndex < sizeof(LaneCounts) / sizeof(LaneCounts[0])) && (LaneCounts[LaneIndex] <= pSinkCaps->MaxLaneCount); LaneIndex++)
+        {
+            DDU64 Bandwidth = (DDU64)LinkRateMbps * LaneCounts[LaneIndex];
 
-        break;
-    case DD_VOT_HDMI:
-        // Set EDID 1.3 version
-        (*ppEDID)->Revision = 3;
-        // set Video Input to 0x80, Bit 7 indicates its dvi (digital input)
-        (*ppEDID)->BasicDisplayParams.VideoInput = 0x80;
-        (*ppEDID)->EdidTiming.Edid_13_MonitorInfo[DtdNum].MonitorDescHeader.Flag0 = 0;
-        (*ppEDID)->EdidTiming.Edid_13_MonitorInfo[DtdNum].MonitorDescHeader.DataTypeTag = 0xFD; // Monitor range limit, BASEEDID_MONITORRANGELIMIT_MDDATATYPE
-        (*ppEDID)->EdidTiming.Edid_13_MonitorInfo[DtdNum].MonitorRangeLimits = MonitorRangeLimits;
-        break;
-    default:
-        DDRLSASSERT_UNEXPECTED(0, "Invalid SinkType Passed");
+            for (Index = NumLinkCfgs; Index > 0; Index--)
+            {
+                DDU64 PrevBandwidth = (DDU64)pLinkCfgs[Index - 1].LinkRateMbps * pLinkCfgs[Index - 1].LaneCount;
 
-        break;
+                if ((PrevBandwidth < Bandwidth) || ((PrevBandwidth == Bandwidth) && (pLinkCfgs[Index - 1].LinkRateMbps <= LinkRateMbps)))
+                {
+                    break;
+                }
+                pLinkCfgs[Index] = pLinkCfgs[Index - 1];
+            }
+            pLinkCfgs[Index].LinkRateMbps = LinkRateMbps;
+            pLinkCfgs[Index].LaneCount = LaneCounts[LaneIndex];
+            NumLinkCfgs++;
+        }
     }
 
-    // Set max H/V image size in cm. (Set 0x00 when unknown per EDID spec)
-    (*ppEDID)->BasicDisplayParams.MaxHImageSize = 0x00;
-    (*ppEDID)->BasicDisplayParams.MaxVImageSize = 0x00;
+    return NumLinkCfgs;
+}
 
-    // Gamma
-    (*ppEDID)->BasicDisplayParams.Gamma = 0xFF; // source: Legacy
+/***************************************************************
+ * @brief Fills the mode and sink fields of the link data a link plan checks link configs with.
+ *
+ * Link rate, lane count, bpp, DSC, FEC and spread are left for the caller to set per link config.
+ * @param pPlanArgs:
+ * @param pMode:
+ * @param pDpLinkData: [out]
+ * @return void
+ ***************************************************************/
+void DpProtocolInitLinkPlanData(const DP_LINK_PLAN_ARGS* pPlanArgs, const DD_TIMING_INFO* pMode, DP_LINK_DATA* pDpLinkData)
+{
+    const DP_LINK_PLAN_SINK_CAPS* pSinkCaps;
+
+    DDASSERT(pPlanArgs && pPlanArgs->pSinkCaps && pMode && pDpLinkData);
+
+    pSinkCaps = pPlanArgs->pSinkCaps;
+    DD_ZERO_MEM(pDpLinkData, sizeof(DP_LINK_DATA));
+    pDpLinkData->SinkType = pSinkCaps->SinkType;
+    pDpLinkData->LinkBwData.DotClockInHz = pMode->DotClockInHz;
+    pDpLinkData->LinkBwData.DpSscOverheadx1e6 = pSinkCaps->DpSscOverheadx1e6;
+    pDpLinkData->MstBwData.EnableMSTMode = pSinkCaps->IsMstEnabled;
+    pDpLinkData->IsSsSbmSupported = pSinkCaps->IsSsSbmSupported;
+    pDpLinkData->DscSlicesPerScanline = pSinkCaps->DscSlicesPerScanline;
+    pDpLinkData->HActive = pMode->HActive;
+    pDpLinkData->HTotal = pMode->HTotal;
+    pDpLinkData->HBlankIncLinkSymbolClocks = pSinkCaps->HBlankIncLinkSymbolClocks;
+}
 
-    // Feature support (Legacy sets "11101010" -> 0xEA)
-    // Note: New code sets GTF support and color space as 1 where as old one doesn't. HCT monitor tests might check for 0's for both of these
+/***************************************************************
+ * @brief Computes MNTU (and PBN) of one link config with the routine a link plan uses.
+ *
+ * @param MntuMethod:
+ * @param pDpLinkData:
+ * @return DDSTATUS status of the MNTU routine
+ ***************************************************************/
+DDSTATUS DpProtocolComputeLinkPlanMNTu(DP_LINK_PLAN_MNTU_METHOD MntuMethod, DD_IN_OUT DP_LINK_DATA* pDpLinkData)
+{
+    switch (MntuMethod)
+    {
+    case DP_LINK_PLAN_MNTU_SST:
+        return DpProtocolSstComputeMNTu(pDpLinkData);
+    case DP_LINK_PLAN_MNTU_MST:
+        return DpProtocolMstComputeMNTuPbn(pDpLinkData);
+    case DP_LINK_PLAN_MNTU_EOC:
+        return DpProtocolComputeMNTuPbnConsideringEoc(pDpLinkData);
+    case DP_LINK_PLAN_MNTU_LL_SYMBOL_COUNT:
+        return DpProtocolComputeMNTuPbnLinkLayerSymbolCount(pDpLinkData);
+    default:
+        return DDS_INVALID_PARAM;
+    }
+}
+
+/***************************************************************
+ * @brief Plans the least link bandwidth that carries a mode at one bpp.
+ *
+ * Link configs are tried in the order of DpProtocolGetLinkPlanLinkCfgs(), so the first one the MNTU routine accepts
+ * has the least bandwidth. On a link config FEC is tried off first, and spread on first when the sink supports it.
+ * FEC is not tried on 128b/132b links, where it is part of the channel coding, and DSC on an 8b/10b link is tried
+ * with FEC only unless the sink is eDP.
+ * @param pPlanArgs:
+ * @param pLinkCfgs:
+ * @param NumLinkCfgs:
+ * @param Bppx16:
+ * @param IsDscEnabled:
+ * @param pDpLinkData: Link data of the mode from DpProtocolInitLinkPlanData()
+ * @param pResult: [out] filled when a link config fits, NumEvaluated counts up either way
+ * @return DD_BOOL TRUE if a link config fits
+ ***************************************************************/
+static DD_BOOL DpProtocolPlanLinkCfgForBpp(const DP_LINK_PLAN_ARGS* pPlanArgs, const DP_LINK_PLAN_LINK_CFG* pLinkCfgs, DDU32 NumLinkCfgs, DDU32 Bppx16,
+                                           DD_BOOL IsDscEnabled, DP_LINK_DATA* pDpLinkData, DP_LINK_PLAN_RESULT* pResult)
+{
+    const DP_LINK_PLAN_SINK_CAPS* pSinkCaps = pPlanArgs->pSinkCaps;
+    DDU32 LinkIndex, FecIndex, SscIndex;
+
+    pDpLinkData->LinkBwData.BitsPerPixel.Bppx16 = (DDU16)Bppx16;
+    pDpLinkData->DscCapable = IsDscEnabled;
+
+    for (LinkIndex = 0; LinkIndex < NumLinkCfgs; LinkIndex++)
+    {
+        DP_CHANNEL_CODING_TYPE DpChannelCodingType = GET_DP_CHANNEL_CODING(pLinkCfgs[LinkIndex].LinkRateMbps);
+
+        pDpLinkData->LinkBwData.LinkRateMbps = pLinkCfgs[LinkIndex].LinkRateMbps;
+        pDpLinkData->LinkBwData.DpLaneWidthSelection = (DD_LANE_WIDTH)pLinkCfgs[LinkIndex].LaneCount;
+        pDpLinkData->LinkBwData.DpChannelCodingType = DpChannelCodingType;
+
+        for (FecIndex = 0; FecIndex < 2; FecIndex++)
+        {
+            DD_BOOL EnableFec = (1 == FecIndex);
+
+            if (EnableFec ? ((FALSE == pSinkCaps->IsFecSupported) || (CH_CODING_8B_10B != DpChannelCodingType))
+                          : (IsDscEnabled && (CH_CODING_8B_10B == DpChannelCodingType) && !IS_EDP_SINK_TYPE(pSinkCaps->SinkType)))
+            {
+                continue;
+            }
+
+            for (SscIndex = 0; SscIndex < 2; SscIndex++)
+            {
+                DD_BOOL EnableSpread = (0 == SscIndex);
+
+                if (EnableSpread && (FALSE == pSinkCaps->IsSscSupported))
+                {
+                    continue;
+                }
+
+                pDpLinkData->LinkBwData.EnableFec = EnableFec;
+                pDpLinkData->LinkBwData.EnableSpread = EnableSpread;
+                DD_ZERO_MEM(&pDpLinkData->LinkBwData.MNTUData, sizeof(DD_M_N_CONFIG));
+                pDpLinkData->MstBwData.ActualPBN = 0;
+                pDpLinkData->MstBwData.AllocatedPBN = 0;
+                pDpLinkData->MstBwData.VcPayloadTableNumSlots = 0;
+                pResult->NumEvaluated++;
+
+                if (IS_DDSTATUS_SUCCESS(DpProtocolComputeLinkPlanMNTu(pPlanArgs->MntuMethod, pDpLinkData)))
+                {
+                    pResult->IsFeasible = TRUE;
+                    pResult->LinkRateMbps = pLinkCfgs[LinkIndex].LinkRateMbps;
+                    pResult->LaneCount = pLinkCfgs[LinkIndex].LaneCount;
+                    pResult->IsDscEnabled = IsDscEnabled;
+                    pResult->EnableFec = EnableFec;
+                    pResult->EnableSpread = EnableSpread;
+                    pResult->BitsPerPixel.Bppx16 = (DDU16)Bppx16;
+                    pResult->MNTUData = pDpLinkData->LinkBwData.MNTUData;
+                    pResult->ActualPBN = pDpLinkData->MstBwData.ActualPBN;
+                    pResult->AllocatedPBN = pDpLinkData->MstBwData.AllocatedPBN;
+                    return TRUE;
+                }
+            }
+        }
+    }
+
+    return FALSE;
+}
+
+/***************************************************************
+ * @brief Plans the DP link config of a range of modes of the mode table.
+ *
+ * For every mode, bpps are tried in order of preference: the uncompressed ones as listed, then DSC ones from the
+ * highest down. The first bpp that fits at all is planned on the least link bandwidth that carries it, as found by
+ * DpProtocolPlanLinkCfgForBpp(). Each link config is checked with the MNTU routine of pPlanArgs->MntuMethod on its
+ * own, so the planned config and its MNTU/PBN values are the ones that routine computes for it.
+ * Link configs are listed once per call and modes share nothing else, so callers can plan ranges of modes in parallel.
+ * @param pPlanArgs:
+ * @param FirstMode: index in the mode table
+ * @param NumModes:
+ * @param pResults: [out] one per mode
+ * @return DDU32 number of modes that fit
+ ***************************************************************/
+DDU32 DpProtocolPlanLinkCfgs(const DP_LINK_PLAN_ARGS* pPlanArgs, DDU32 FirstMode, DDU32 NumModes, DP_LINK_PLAN_RESULT* pResults)
+{
+    DP_LINK_PLAN_LINK_CFG LinkCfgs[DP_LINK_PLAN_MAX_LINK_RATES * 3];
+    const DP_LINK_PLAN_SINK_CAPS* pSinkCaps;
+    DP_LINK_DATA DpLinkData;
+    DDU32 NumLinkCfgs, ModeIndex, BppIndex, Bppx16;
+    DDU32 NumFeasible = 0;
+    DDU32 MaxDscBppx16 = 0;
+
+    DDASSERT(pPlanArgs && pPlanArgs->pModeTable && pPlanArgs->pSinkCaps && pResults);
+    DDASSERT((FirstMode + NumModes) <= pPlanArgs->pModeTable->NumEntries);
+
+    pSinkCaps = pPlanArgs->pSinkCaps;
+    DDASSERT((DP_LINK_PLAN_MNTU_MST != pPlanArgs->MntuMethod) || pSinkCaps->IsMstEnabled);
+
+    NumLinkCfgs = DpProtocolGetLinkPlanLinkCfgs(pPlanArgs, LinkCfgs);
+
+    // DSC bpps are MinDscBppx16 + n * DscBppStepx16, 0 if none is to be tried
+    if (pSinkCaps->IsDscSupported && (0 != pSinkCaps->DscSlicesPerScanline) && (0 != pPlanArgs->MinDscBppx16) && (0 != pPlanArgs->DscBppStepx16) &&
+        (pPlanArgs->MaxDscBppx16 >= pPlanArgs->MinDscBppx16))
+    {
+        MaxDscBppx16 = pPlanArgs->MinDscBppx16 + ((pPlanArgs->MaxDscBppx16 - pPlanArgs->MinDscBppx16) / pPlanArgs->DscBppStepx16) * pPlanArgs->DscBppStepx16;
+    }
+
+    for (ModeIndex = 0; ModeIndex < NumModes; ModeIndex++)
+    {
+        const DD_TIMING_INFO* pMode = (const DD_TIMING_INFO*)pPlanArgs->pModeTable->pEntry + FirstMode + ModeIndex;
+        DP_LINK_PLAN_RESULT* pResult = &pResults[ModeIndex];
+        DD_BOOL IsFeasible = FALSE;
+
+        DD_ZERO_MEM(pResult, sizeof(DP_LINK_PLAN_RESULT));
+        DpProtocolInitLinkPlanData(pPlanArgs, pMode, &DpLinkData);
+
+        for (BppIndex = 0; !IsFeasible && (BppIndex < pPlanArgs->NumBpps); BppIndex++)
+        {
+            IsFeasible = DpProtocolPlanLinkCfgForBpp(pPlanArgs, LinkCfgs, NumLinkCfgs, pPlanArgs->pBppx16s[BppIndex], FALSE, &DpLinkData, pResult);
+        }
+        for (Bppx16 = MaxDscBppx16; !IsFeasible && (0 != Bppx16);
+             Bppx16 = (Bppx16 >= (pPlanArgs->MinDscBppx16 + pPlanArgs->DscBppStepx16)) ? (Bppx16 - pPlanArgs->DscBppStepx16) : 0)
+        {
+            IsFeasible = DpProtocolPlanLinkCfgForBpp(pPlanArgs, LinkCfgs, NumLinkCfgs, Bppx16, TRUE, &DpLinkData, pResult);
+        }
+
+        NumFeasible += IsFeasible;
+    }
+
+    return NumFeasible;
+}
+
+// Streams whose slot and PBN totals are tabled for every subset, the others are summed once per block of stream sets
+#define DP_MST_ALLOC_LOW_STREAMS 8
+
+/***************************************************************
+ * @brief Returns the VC payload time slots and PBN an MST link has for all its streams.
+ *
+ * 8b/10b links use time slot 0 of the MTP for the MTP header, so 63 of the 64 time slots are left for streams.
+ * @param LaneCount:
+ * @param LinkRateMbps:
+ * @param pNumSlots: [out]
+ * @param pPbn: [out] as from DpProtocolMstGetAvailableLinkPbn()
+ * @return void
+ ***************************************************************/
+void DpProtocolMstGetLinkBudget(DDU32 LaneCount, DDU32 LinkRateMbps, DDU32* pNumSlots, DDU32* pPbn)
+{
+    DDASSERT(pNumSlots && pPbn);
+
+    *pNumSlots = (CH_CODING_128B_132B == GET_DP_CHANNEL_CODING(LinkRateMbps)) ? AVAILABLE_MTP_TIMESLOTS_128B_132B : AVAILABLE_MTP_TIMESLOTS_8B_10B;
+    *pPbn = DpProtocolMstGetAvailableLinkPbn(LaneCount, LinkRateMbps);
+}
+
+/***************************************************************
+ * @brief Computes the VC payload time slots and PBN of each requested stream on the MST link.
+ *
+ * Every stream is run through the MNTU routine of pAllocArgs->MntuMethod on its own with MST mode enabled, so its
+ * time slots and PBN are what that routine computes when the stream is enabled on the link.
+ * @param pAllocArgs:
+ * @param pAllocs: [out] one per stream
+ * @return DDU32 number of streams the MNTU routine succeeded for
+ ***************************************************************/
+DDU32 DpProtocolMstAllocStreams(const DP_MST_ALLOC_ARGS* pAllocArgs, DP_MST_STREAM_ALLOC* pAllocs)
+{
+    DP_LINK_DATA DpLinkData;
+    DDU32 StreamIndex;
+    DDU32 NumAllocated = 0;
+
+    DDASSERT(pAllocArgs && pAllocArgs->pStreams && pAllocs);
+    DDASSERT(pAllocArgs->NumStreams <= DP_MST_ALLOC_MAX_STREAMS);
+    DDASSERT(DP_LINK_PLAN_MNTU_SST != pAllocArgs->MntuMethod);
+
+    for (StreamIndex = 0; StreamIndex < pAllocArgs->NumStreams; StreamIndex++)
+    {
+        const DP_MST_STREAM_REQUEST* pStream = &pAllocArgs->pStreams[StreamIndex];
+        DP_MST_STREAM_ALLOC* pAlloc = &pAllocs[StreamIndex];
+
+        DD_ZERO_MEM(&DpLinkData, sizeof(DP_LINK_DATA));
+        DpLinkData.SinkType = DD_VOT_DISPLAYPORT_EXTERNAL;
+        DpLinkData.LinkBwData.DotClockInHz = pStream->DotClockInHz;
+        DpLinkData.LinkBwData.BitsPerPixel = pStream->BitsPerPixel;
+        DpLinkData.LinkBwData.LinkRateMbps = pAllocArgs->LinkRateMbps;
+        DpLinkData.LinkBwData.DpLaneWidthSelection = (DD_LANE_WIDTH)pAllocArgs->LaneCount;
+        DpLinkData.LinkBwData.DpChannelCodingType = GET_DP_CHANNEL_CODING(pAllocArgs->LinkRateMbps);
+        DpLinkData.LinkBwData.EnableFec = pAllocArgs->EnableFec;
+        DpLinkData.LinkBwData.EnableSpread = pAllocArgs->EnableSpread;
+        DpLinkData.LinkBwData.DpSscOverheadx1e6 = pAllocArgs->DpSscOverheadx1e6;
+        DpLinkData.MstBwData.EnableMSTMode = TRUE;
+        DpLinkData.DscCapable = pStream->IsDscEnabled;
+        DpLinkData.DscSlicesPerScanline = pStream->DscSlicesPerScanline;
+        DpLinkData.HActive = pStream->HActive;
+        DpLinkData.HTotal = pStream->HTotal;
+        DpLinkData.HBlankIncLinkSymbolClocks = pAllocArgs->HBlankIncLinkSymbolClocks;
+
+        pAlloc->Status = DpProtocolComputeLinkPlanMNTu(pAllocArgs->MntuMethod, &DpLinkData);
+        pAlloc->NumSlots = DpLinkData.MstBwData.VcPayloadTableNumSlots;
+        pAlloc->ActualPBN = DpLinkData.MstBwData.ActualPBN;
+        pAlloc->AllocatedPBN = DpLinkData.MstBwData.AllocatedPBN;
+
+        NumAllocated += IS_DDSTATUS_SUCCESS(pAlloc->Status);
+    }
+
+    return NumAllocated;
+}
+
+/***************************************************************
+ * @brief Checks whether a set of streams fits on the MST link together.
+ *
+ * A stream set fits when the MNTU routine succeeded for all its streams, and their time slots and actual PBN add up
+ * to no more than the link has.
+ * @param pAllocArgs:
+ * @param pAllocs: from DpProtocolMstAllocStreams()
+ * @param StreamSet: bit N set for stream N
+ * @return DD_BOOL
+ ***************************************************************/
+DD_BOOL DpProtocolMstDoesStreamSetFit(const DP_MST_ALLOC_ARGS* pAllocArgs, const DP_MST_STREAM_ALLOC* pAllocs, DDU64 StreamSet)
+{
+    DDU32 LinkSlots, LinkPbn, StreamIndex;
+    DDU32 NumSlots = 0;
+    DDU32 Pbn = 0;
+
+    DDASSERT(pAllocArgs && pAllocs);
+
+    DpProtocolMstGetLinkBudget(pAllocArgs->LaneCount, pAllocArgs->LinkRateMbps, &LinkSlots, &LinkPbn);
+
+    for (StreamIndex = 0; StreamIndex < DP_MST_ALLOC_MAX_STREAMS; StreamIndex++)
+    {
+        if (0 == (StreamSet & (1ULL << StreamIndex)))
+        {
+            continue;
+        }
+        if ((StreamIndex >= pAllocArgs->NumStreams) || (FALSE == IS_DDSTATUS_SUCCESS(pAllocs[StreamIndex].Status)))
+        {
+            return FALSE;
+        }
+        NumSlots += pAllocs[StreamIndex].NumSlots;
+        Pbn += pAllocs[StreamIndex].ActualPBN;
+    }
+
+    return ((NumSlots <= LinkSlots) && (Pbn <= LinkPbn));
+}
+
+/***************************************************************
+ * @brief Goes through a range of stream sets, marking the ones that fit and keeping the best of them.
+ *
+ * Slot and PBN totals of every subset of the first DP_MST_ALLOC_LOW_STREAMS streams are tabled once, and the rest of
+ * the streams are summed once per block of 2^DP_MST_ALLOC_LOW_STREAMS consecutive stream sets, so checking a stream
+ * set is two table loads and two compares. Blocks whose upper streams alone overrun the link are skipped as a whole.
+ * A stream the MNTU routine failed for is tabled with more time slots than the link has.
+ * The best stream set has the most streams, then the most actual PBN, then the lowest mask.
+ * @param pAllocArgs:
+ * @param pAllocs:
+ * @param FirstSet:
+ * @param NumSets:
+ * @param pFitBitmap: [out] optional, DD_BLOCK_BITMAP_WORDS(NumSets) words, bit set for stream set FirstSet + N if it fits
+ * @param pBestSet: [out] optional, 0 if no stream set of the range fits
+ * @return DDU64 number of stream sets that fit
+ ***************************************************************/
+static DDU64 DpProtocolMstScanStreamSets(const DP_MST_ALLOC_ARGS* pAllocArgs, const DP_MST_STREAM_ALLOC* pAllocs, DDU64 FirstSet, DDU64 NumSets,
+                                         DDU64* pFitBitmap, DDU64* pBestSet)
+{
+    DDU32 LowSlots[1 << DP_MST_ALLOC_LOW_STREAMS];
+    DDU32 LowPbn[1 << DP_MST_ALLOC_LOW_STREAMS];
+    DDU8 LowCount[1 << DP_MST_ALLOC_LOW_STREAMS];
+    DDU32 StreamSlots[DP_MST_ALLOC_MAX_EXACT_STREAMS];
+    DDU32 LinkSlots, LinkPbn, NumLowStreams, StreamIndex, Low;
+    DDU64 StreamSet, EndSet;
+    DDU64 NumFit = 0;
+    DDU32 BestCount = 0;
+    DDU32 BestPbn = 0;
+    DD_BOOL IsBestFound = FALSE;
+
+    DDASSERT(pAllocArgs && pAllocs);
+    DDASSERT(pAllocArgs->NumStreams <= DP_MST_ALLOC_MAX_EXACT_STREAMS);
+    DDASSERT((FirstSet + NumSets) <= (1ULL << pAllocArgs->NumStreams));
+
+    DpProtocolMstGetLinkBudget(pAllocArgs->LaneCount, pAllocArgs->LinkRateMbps, &LinkSlots, &LinkPbn);
+
+    for (StreamIndex = 0; StreamIndex < pAllocArgs->NumStreams; StreamIndex++)
+    {
+        StreamSlots[StreamIndex] = IS_DDSTATUS_SUCCESS(pAllocs[StreamIndex].Status) ? DD_MIN(pAllocs[StreamIndex].NumSlots, LinkSlots + 1) : (LinkSlots + 1);
+    }
+
+    // Subset totals of the low streams, each stream doubling the table
+    NumLowStreams = DD_MIN(pAllocArgs->NumStreams, DP_MST_ALLOC_LOW_STREAMS);
+    LowSlots[0] = 0;
+    LowPbn[0] = 0;
+    LowCount[0] = 0;
+    for (StreamIndex = 0; StreamIndex < NumLowStreams; StreamIndex++)
+    {
+        DDU32 Bit = 1 << StreamIndex;
+
+        for (Low = 0; Low < Bit; Low++)
+        {
+            LowSlots[Bit | Low] = LowSlots[Low] + StreamSlots[StreamIndex];
+            LowPbn[Bit | Low] = LowPbn[Low] + pAllocs[StreamIndex].ActualPBN;
+            LowCount[Bit | Low] = LowCount[Low] + 1;
+        }
+    }
+
+    if (pFitBitmap)
+    {
+        DD_ZERO_MEM(pFitBitmap, DD_BLOCK_BITMAP_WORDS(NumSets) * sizeof(DDU64));
+    }
+    if (pBestSet)
+    {
+        *pBestSet = 0;
+    }
+
+    EndSet = FirstSet + NumSets;
+    for (StreamSet = FirstSet; StreamSet < EndSet;)
+    {
+        DDU64 High = StreamSet >> NumLowStreams;
+        DDU64 BlockEnd = DD_MIN(EndSet, (High + 1) << NumLowStreams);
+        DDU32 HighSlots = 0;
+        DDU32 HighPbn = 0;
+        DDU32 HighCount = 0;
+
+        for (StreamIndex = NumLowStreams; StreamIndex < pAllocArgs->NumStreams; StreamIndex++)
+        {
+            if (High & (1ULL << (StreamIndex - NumLowStreams)))
+            {
+                HighSlots += StreamSlots[StreamIndex];
+                HighPbn += pAllocs[StreamIndex].ActualPBN;
+                HighCount++;
+            }
+        }
+
+        if ((HighSlots <= LinkSlots) && (HighPbn <= LinkPbn))
+        {
+            DDU32 SlotsLeft = LinkSlots - HighSlots;
+            DDU32 PbnLeft = LinkPbn - HighPbn;
+
+            for (; StreamSet < BlockEnd; StreamSet++)
+            {
+                Low = (DDU32)(StreamSet & ((1ULL << NumLowStreams) - 1));
+                if ((LowSlots[Low] > SlotsLeft) || (LowPbn[Low] > PbnLeft))
+                {
+                    continue;
+                }
+
+                NumFit++;
+                if (pFitBitmap)
+                {
+                    pFitBitmap[(StreamSet - FirstSet) / 64] |= 1ULL << ((StreamSet - FirstSet) % 64);
+                }
+                if (pBestSet && ((FALSE == IsBestFound) || ((HighCount + LowCount[Low]) > BestCount) ||
+                                 (((HighCount + LowCount[Low]) == BestCount) && ((HighPbn + LowPbn[Low]) > BestPbn))))
+                {
+                    IsBestFound = TRUE;
+                    BestCount = HighCount + LowCount[Low];
+                    BestPbn = HighPbn + LowPbn[Low];
+                    *pBestSet = StreamSet;
+                }
+            }
+        }
+
+        StreamSet = BlockEnd;
+    }
+
+    return NumFit;
+}
+
+/***************************************************************
+ * @brief Marks which stream sets of a range fit on the MST link together.
+ *
+ * Each stream set is checked as by DpProtocolMstDoesStreamSetFit(). Ranges share nothing, so callers can split the
+ * 2^NumStreams stream sets across threads.
+ * @param pAllocArgs: up to DP_MST_ALLOC_MAX_EXACT_STREAMS streams
+ * @param pAllocs: from DpProtocolMstAllocStreams()
+ * @param FirstSet:
+ * @param NumSets: FirstSet + NumSets up to 2^NumStreams
+ * @param pFitBitmap: [out] DD_BLOCK_BITMAP_WORDS(NumSets) words, bit N set if stream set FirstSet + N fits
+ * @return DDU64 number of stream sets that fit
+ ***************************************************************/
+DDU64 DpProtocolMstGetFittingStreamSets(const DP_MST_ALLOC_ARGS* pAllocArgs, const DP_MST_STREAM_ALLOC* pAllocs, DDU64 FirstSet, DDU64 NumSets, DDU64* pFitBitmap)
+{
+    DDASSERT(pFitBitmap);
+
+    return DpProtocolMstScanStreamSets(pAllocArgs, pAllocs, FirstSet, NumSets, pFitBitmap, NULL);
+}
+
+/***************************************************************
+ * @brief Picks a set of the requested streams to enable together on the MST link.
+ *
+ * Greedy packing takes streams by fewest time slots first (lower stream first on a tie) and keeps each one that still
+ * fits with the ones kept so far. Exact packing goes through all stream sets and returns the one with the most
+ * streams, then the most actual PBN, then the lowest mask.
+ * @param pAllocArgs:
+ * @param pAllocs: from DpProtocolMstAllocStreams()
+ * @param Policy:
+ * @return DDU64 stream set, bit N set for stream N
+ ***************************************************************/
+DDU64 DpProtocolMstPackStreams(const DP_MST_ALLOC_ARGS* pAllocArgs, const DP_MST_STREAM_ALLOC* pAllocs, DP_MST_PACK_POLICY Policy)
+{
+    DDU8 Order[DP_MST_ALLOC_MAX_STREAMS];
+    DDU32 LinkSlots, LinkPbn, NumOrdered, StreamIndex, Index;
+    DDU32 NumSlots = 0;
+    DDU32 Pbn = 0;
+    DDU64 StreamSet = 0;
+
+    DDASSERT(pAllocArgs && pAllocs);
+    DDASSERT(pAllocArgs->NumStreams <= DP_MST_ALLOC_MAX_STREAMS);
+
+    if ((DP_MST_PACK_EXACT == Policy) && (pAllocArgs->NumStreams <= DP_MST_ALLOC_MAX_EXACT_STREAMS))
+    {
+        DpProtocolMstScanStreamSets(pAllocArgs, pAllocs, 0, 1ULL << pAllocArgs->NumStreams, NULL, &StreamSet);
+        return StreamSet;
+    }
+
+    DpProtocolMstGetLinkBudget(pAllocArgs->LaneCount, pAllocArgs->LinkRateMbps, &LinkSlots, &LinkPbn);
+
+    NumOrdered = 0;
+    for (StreamIndex = 0; StreamIndex < pAllocArgs->NumStreams; StreamIndex++)
+    {
+        if (FALSE == IS_DDSTATUS_SUCCESS(pAllocs[StreamIndex].Status))
+        {
+            continue;
+        }
+        for (Index = NumOrdered; (Index > 0) && (pAllocs[Order[Index - 1]].NumSlots > pAllocs[StreamIndex].NumSlots); Index--)
+        {
+            Order[Index] = Order[Index - 1];
+        }
+        Order[Index] = (DDU8)StreamIndex;
+        NumOrdered++;
+    }
+
+    for (Index = 0; Index < NumOrdered; Index++)
+    {
+        const DP_MST_STREAM_ALLOC* pAlloc = &pAllocs[Order[Index]];
+
+        if (((NumSlots + pAlloc->NumSlots) <= LinkSlots) && ((Pbn + pAlloc->ActualPBN) <= LinkPbn))
+        {
+            NumSlots += pAlloc->NumSlots;
+            Pbn += pAlloc->ActualPBN;
+            StreamSet |= 1ULL << Order[Index];
+        }
+    }
+
+    return StreamSet;
+}
+
+/***************************************************************
+ * @brief Populate the common Edid and Monitor data for Dp/Hdmi.
+ *
+ * @param SinkType
+ * @param ppEDID
+ * @param pTimingInfo
+ * @param DtdNum
+ * @return void
+ ***************************************************************/
+void DisplayInfoRoutinePopulateEdidAndMonitorData(DD_VIDEO_OUTPUT_TECHNOLOGY SinkType, EDID_BASE_BLOCK** ppEDID, DD_TIMING_INFO* pTimingInfo, DDU8 DtdNum)
+{
+    MONITOR_RANGE_LIMITS MonitorRangeLimits;
+    DDU8 Temp;
+    DDU8 Index;
+
+    DDASSERT(ppEDID);
+    DDASSERT(pTimingInfo);
+
+    DD_ZERO_MEM(&MonitorRangeLimits, sizeof(MonitorRangeLimits));
+    // Set header
+    DD_MEM_COPY_SAFE((*ppEDID)->Header, sizeof((*ppEDID)->Header), BaseEdidHeader, sizeof(BaseEdidHeader));
+
+    // Set vendor/product ID
+    DD_MEM_COPY_SAFE((*ppEDID)->PnpID.VendorProductID, sizeof((*ppEDID)->PnpID.VendorProductID), FakeEdidPNPId, sizeof(FakeEdidPNPId));
+    (*ppEDID)->Version = 1;
+
+    switch (SinkType)
+    {
+    case DD_VOT_DISPLAYPORT_EXTERNAL:
+        (*ppEDID)->Revision = 4;
+        (*ppEDID)->BasicDisplayParams.VideoInput = 0xA5;
+        // since Edid_14_MonitorInfo is shifted by 1 index, need to decrement 1 from DtdNum
+        (*ppEDID)->EdidTiming.Edid_14_MonitorInfo[DtdNum - 1].MonitorDescHeader.Flag0 = 0;
+        (*ppEDID)->EdidTiming.Edid_14_MonitorInfo[DtdNum - 1].MonitorDescHeader.DataTypeTag = 0xFD; // Monitor range limit, BASEEDID_MONITORRANGELIMIT_MDDATATYPE
+        (*ppEDID)->EdidTiming.Edid_14_MonitorInfo[DtdNum - 1].MonitorRangeLimits = MonitorRangeLimits;
+
+        break;
+    case DD_VOT_HDMI:
+        // Set EDID 1.3 version
+        (*ppEDID)->Revision = 3;
+        // set Video Input to 0x80, Bit 7 indicates its dvi (digital input)
+        (*ppEDID)->BasicDisplayParams.VideoInput = 0x80;
+        (*ppEDID)->EdidTiming.Edid_13_MonitorInfo[DtdNum].MonitorDescHeader.Flag0 = 0;
+        (*ppEDID)->EdidTiming.Edid_13_MonitorInfo[DtdNum].MonitorDescHeader.DataTypeTag = 0xFD; // Monitor range limit, BASEEDID_MONITORRANGELIMIT_MDDATATYPE
+        (*ppEDID)->EdidTiming.Edid_13_MonitorInfo[DtdNum].MonitorRangeLimits = MonitorRangeLimits;
+        break;
+    default:
+        DDRLSASSERT_UNEXPECTED(0, "Invalid SinkType Passed");
+
+        break;
+    }
+
+    // Set max H/V image size in cm. (Set 0x00 when unknown per EDID spec)
+    (*ppEDID)->BasicDisplayParams.MaxHImageSize = 0x00;
+    (*ppEDID)->BasicDisplayParams.MaxVImageSize = 0x00;
+
+    // Gamma
+    (*ppEDID)->BasicDisplayParams.Gamma = 0xFF; // source: Legacy
+
+    // Feature support (Legacy sets "11101010" -> 0xEA)
+    // Note: New code sets GTF support and color space as 1 where as old one doesn't. HCT monitor tests might check for 0's for both of these
     // which is not actually a real bug. There is an known erratum which some customers (like Lenova) use for getting waiver on this.
     (*ppEDID)->BasicDisplayParams.IsGTFSupported = 1;
     (*ppEDID)->BasicDisplayParams.IsPreferredTimingMode = 1; // DTD0 must have valid timings
@@ -4232,7 +6231,7 @@ void DisplayInfoRoutinePopulateEdidAndMonitorData(DD_VIDEO_OUTPUT_TECHNOLOGY Sin
  * @param pCreateCvtTimingArgs
  * @return DDSTATUS
  */
-DDSTATUS DisplayInfoRoutinesCreateCVT2Timing(CREATE_CVT_TIMING_ARGS* pCreateCvtTimingArgs)
+static DDSTATUS DisplayInfoRoutinesComputeCVT2Timing(CREATE_CVT_TIMING_ARGS* pCreateCvtTimingArgs)
 {
     float FlActHFreq;
 
@@ -4393,3 +6392,297 @@ DDSTATUS DisplayInfoRoutinesCreateCVT2Timing(CREATE_CVT_TIMING_ARGS* pCreateCvtT
     pCreateCvtTimingArgs->pTimingInfo->IsInterlaced = FALSE;
     return DDS_SUCCESS;
 }
+
+//
+// Formula timing cache
+//
+
+// 64 sets of 4 ways, a way of a full set is replaced round robin
+#define DD_TIMING_CACHE_SET_BITS 6
+#define DD_TIMING_CACHE_NUM_SETS (1 << DD_TIMING_CACHE_SET_BITS)
+#define DD_TIMING_CACHE_NUM_WAYS 4
+
+// Flags of DD_TIMING_CACHE_KEY
+#define DD_TIMING_CACHE_KEY_PROGRESSIVE (1 << 0)
+#define DD_TIMING_CACHE_KEY_INTERLACED (1 << 1)
+#define DD_TIMING_CACHE_KEY_RED_BLANK (1 << 2)
+#define DD_TIMING_CACHE_KEY_EARLY_VSYNC (1 << 3)
+#define DD_TIMING_CACHE_KEY_VIDEO_RR (1 << 4)
+
+// Generators fill DotClockInHz to VSyncPolarity only, rest of the caller's timing is left untouched
+#define DD_FORMULA_TIMING_SIZE offsetof(DD_TIMING_INFO, CeData)
+C_ASSERT(0 == offsetof(DD_TIMING_INFO, DotClockInHz));
+C_ASSERT(offsetof(DD_TIMING_INFO, VSyncPolarity) < DD_FORMULA_TIMING_SIZE);
+
+// Inputs read by the formula of a request. All DDU32 so keys can be compared as a block.
+typedef struct _DD_TIMING_CACHE_KEY
+{
+    DDU32 Formula; // DD_TIMING_FORMULA + 1, 0 for an unused way
+    DDU32 XRes;
+    DDU32 YRes;
+    DDU32 RRate;
+    DDU32 Flags; // DD_TIMING_CACHE_KEY_*
+    DDU32 ReqVblankTime;
+    DDU32 ReqHblankPixels;
+    DDU32 RedBlankVersion;
+} DD_TIMING_CACHE_KEY;
+
+typedef struct _DD_TIMING_CACHE_SET
+{
+    DD_TIMING_CACHE_KEY Key[DD_TIMING_CACHE_NUM_WAYS];
+    DD_TIMING_INFO Timing[DD_TIMING_CACHE_NUM_WAYS]; // Valid up to DD_FORMULA_TIMING_SIZE
+    DDU32 NextVictim;
+} DD_TIMING_CACHE_SET;
+
+static DD_TIMING_CACHE_SET TimingCache[DD_TIMING_CACHE_NUM_SETS];
+static DD_TIMING_CACHE_LOCK TimingCacheLock = DD_TIMING_CACHE_LOCK_INIT;
+
+/**
+ * @brief Builds the cache key of a timing request from the inputs its formula reads.
+ *
+ * @param pCreateTimingArgs
+ * @param pKey
+ * @return DD_TIMING_INFO* Output timing of the request
+ */
+static DD_TIMING_INFO* DisplayInfoRoutinesGetTimingCacheKey(const CREATE_TIMING_ARGS* pCreateTimingArgs, DD_TIMING_CACHE_KEY* pKey)
+{
+    const CREATE_CVT_TIMING_ARGS* pCvt = &pCreateTimingArgs->Cvt;
+
+    DD_ZERO_MEM(pKey, sizeof(DD_TIMING_CACHE_KEY));
+    pKey->Formula = (DDU32)pCreateTimingArgs->Formula + 1;
+
+    if (DD_TIMING_FORMULA_GTF == pCreateTimingArgs->Formula)
+    {
+        pKey->XRes = pCreateTimingArgs->Gtf.XRes;
+        pKey->YRes = pCreateTimingArgs->Gtf.YRes;
+        pKey->RRate = pCreateTimingArgs->Gtf.RRate;
+        pKey->Flags = pCreateTimingArgs->Gtf.IsProgressiveMode ? DD_TIMING_CACHE_KEY_PROGRESSIVE : 0;
+        return pCreateTimingArgs->Gtf.pTimingInfo;
+    }
+
+    pKey->XRes = pCvt->XRes;
+    pKey->YRes = pCvt->YRes;
+    pKey->RRate = pCvt->RRate;
+    if (DD_TIMING_FORMULA_CVT == pCreateTimingArgs->Formula)
+    {
+        pKey->Flags = (pCvt->IsInterLaced ? DD_TIMING_CACHE_KEY_INTERLACED : 0) | (pCvt->IsRed_Blank_Req ? DD_TIMING_CACHE_KEY_RED_BLANK : 0);
+    }
+    else
+    {
+        pKey->Flags = (pCvt->IsEarlyVsync ? DD_TIMING_CACHE_KEY_EARLY_VSYNC : 0) | (pCvt->IsVideoRrReq ? DD_TIMING_CACHE_KEY_VIDEO_RR : 0);
+        pKey->ReqVblankTime = pCvt->ReqVblankTime;
+        pKey->ReqHblankPixels = pCvt->ReqHblankPixels;
+        pKey->RedBlankVersion = (DDU32)pCvt->RedBlankVersion;
+    }
+
+    return pCvt->pTimingInfo;
+}
+
+/**
+ * @brief Returns the cache set a key maps to.
+ *
+ * @param pKey
+ * @return DD_TIMING_CACHE_SET*
+ */
+static DD_TIMING_CACHE_SET* DisplayInfoRoutinesGetTimingCacheSet(const DD_TIMING_CACHE_KEY* pKey)
+{
+    DDU32 Hash = pKey->Formula;
+
+    Hash = (Hash ^ pKey->XRes) * 0x9E3779B1u;
+    Hash = (Hash ^ pKey->YRes) * 0x9E3779B1u;
+    Hash = (Hash ^ pKey->RRate) * 0x9E3779B1u;
+    Hash = (Hash ^ pKey->Flags ^ (pKey->ReqVblankTime << 8) ^ (pKey->ReqHblankPixels << 16) ^ (pKey->RedBlankVersion << 24)) * 0x9E3779B1u;
+
+    return &TimingCache[Hash >> (32 - DD_TIMING_CACHE_SET_BITS)];
+}
+
+/**
+ * @brief Looks up a key in its set, caller holds TimingCacheLock.
+ *
+ * @param pSet
+ * @param pKey
+ * @return const DD_TIMING_INFO* NULL if not cached
+ */
+static const DD_TIMING_INFO* DisplayInfoRoutinesFindCachedTiming(const DD_TIMING_CACHE_SET* pSet, const DD_TIMING_CACHE_KEY* pKey)
+{
+    DDU32 Way;
+
+    for (Way = 0; Way < DD_TIMING_CACHE_NUM_WAYS; Way++)
+    {
+        if (0 == DD_MEM_CMP(&pSet->Key[Way], pKey, sizeof(DD_TIMING_CACHE_KEY)))
+        {
+            return &pSet->Timing[Way];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Runs the formula of a timing request.
+ *
+ * @param pCreateTimingArgs
+ * @return DDSTATUS
+ */
+static DDSTATUS DisplayInfoRoutinesComputeTiming(CREATE_TIMING_ARGS* pCreateTimingArgs)
+{
+    switch (pCreateTimingArgs->Formula)
+    {
+    case DD_TIMING_FORMULA_GTF:
+        return DisplayInfoRoutinesComputeGTFTiming(&pCreateTimingArgs->Gtf);
+    case DD_TIMING_FORMULA_CVT:
+        return DisplayInfoRoutinesComputeCVTTiming(&pCreateTimingArgs->Cvt);
+    case DD_TIMING_FORMULA_CVT2:
+        return DisplayInfoRoutinesComputeCVT2Timing(&pCreateTimingArgs->Cvt);
+    default:
+        DISP_FUNC_EXIT_W_STATUS(DDS_INVALID_PARAM);
+        return DDS_INVALID_PARAM;
+    }
+}
+
+/**
+ * @brief Creates a list of GTF/CVT timings, memoized in a bounded cache shared by all callers.
+ * Cache hits are resolved under one shared lock, misses are generated without holding the lock
+ * and published under one exclusive lock. Failed requests are not cached.
+ *
+ * @param pCreateTimingArgs NumTimings requests, Status of each is set
+ * @param NumTimings
+ * @return DDSTATUS DDS_SUCCESS if all timings were created
+ */
+DDSTATUS DisplayInfoRoutinesCreateTimings(CREATE_TIMING_ARGS* pCreateTimingArgs, DDU32 NumTimings)
+{
+    DD_TIMING_CACHE_KEY Key;
+    DD_TIMING_CACHE_SET* pSet;
+    const DD_TIMING_INFO* pCachedTiming;
+    DD_TIMING_INFO* pTimingInfo;
+    DDU32 Index;
+    DDU32 Way;
+    DDU32 NumGenerated = 0;
+    DDSTATUS Status = DDS_SUCCESS;
+
+    DDASSERT(pCreateTimingArgs || (0 == NumTimings));
+
+    DD_TIMING_CACHE_ACQUIRE_SHARED(&TimingCacheLock);
+    for (Index = 0; Index < NumTimings; Index++)
+    {
+        if (DD_TIMING_FORMULA_GTF != pCreateTimingArgs[Index].Formula)
+        {
+            pCreateTimingArgs[Index].Cvt.IsMargin_Req = FALSE; // Not supported by the CVT formulas, forced the same way as the generators do
+        }
+
+        pTimingInfo = DisplayInfoRoutinesGetTimingCacheKey(&pCreateTimingArgs[Index], &Key);
+        pCachedTiming = DisplayInfoRoutinesFindCachedTiming(DisplayInfoRoutinesGetTimingCacheSet(&Key), &Key);
+        if (pCachedTiming)
+        {
+            DD_MEM_COPY_SAFE(pTimingInfo, DD_FORMULA_TIMING_SIZE, pCachedTiming, DD_FORMULA_TIMING_SIZE);
+            pCreateTimingArgs[Index].Status = DDS_SUCCESS;
+        }
+        else
+        {
+            pCreateTimingArgs[Index].Status = DDS_UNSUCCESSFUL;
+        }
+    }
+    DD_TIMING_CACHE_RELEASE_SHARED(&TimingCacheLock);
+
+    for (Index = 0; Index < NumTimings; Index++)
+    {
+        if (IS_DDSTATUS_ERROR(pCreateTimingArgs[Index].Status))
+        {
+            pCreateTimingArgs[Index].Status = DisplayInfoRoutinesComputeTiming(&pCreateTimingArgs[Index]);
+            NumGenerated += IS_DDSTATUS_SUCCESS(pCreateTimingArgs[Index].Status) ? 1 : 0;
+        }
+    }
+
+    if (NumGenerated > 0)
+    {
+        DD_TIMING_CACHE_ACQUIRE_EXCLUSIVE(&TimingCacheLock);
+        for (Index = 0; Index < NumTimings; Index++)
+        {
+            if (IS_DDSTATUS_ERROR(pCreateTimingArgs[Index].Status))
+            {
+                continue;
+            }
+
+            // Timing may have been cached meanwhile by another thread or an earlier request of the list
+            pTimingInfo = DisplayInfoRoutinesGetTimingCacheKey(&pCreateTimingArgs[Index], &Key);
+            pSet = DisplayInfoRoutinesGetTimingCacheSet(&Key);
+            if (NULL == DisplayInfoRoutinesFindCachedTiming(pSet, &Key))
+            {
+                Way = pSet->NextVictim;
+                pSet->NextVictim = (Way + 1) % DD_TIMING_CACHE_NUM_WAYS;
+                pSet->Key[Way] = Key;
+                DD_MEM_COPY_SAFE(&pSet->Timing[Way], DD_FORMULA_TIMING_SIZE, pTimingInfo, DD_FORMULA_TIMING_SIZE);
+            }
+        }
+        DD_TIMING_CACHE_RELEASE_EXCLUSIVE(&TimingCacheLock);
+    }
+
+    for (Index = 0; Index < NumTimings; Index++)
+    {
+        if (IS_DDSTATUS_ERROR(pCreateTimingArgs[Index].Status))
+        {
+            Status = DDS_UNSUCCESSFUL;
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief Creates a GTF timing, see DisplayInfoRoutinesCreateTimings().
+ *
+ * @param pCreateGTFTimingArgs
+ * @return DDSTATUS
+ */
+DDSTATUS DisplayInfoRoutinesCreateGTFTiming(CREATE_GTF_TIMING_ARGS* pCreateGTFTimingArgs)
+{
+    CREATE_TIMING_ARGS CreateTimingArgs;
+
+    DDASSERT(pCreateGTFTimingArgs);
+
+    CreateTimingArgs.Formula = DD_TIMING_FORMULA_GTF;
+    CreateTimingArgs.Gtf = *pCreateGTFTimingArgs;
+    DisplayInfoRoutinesCreateTimings(&CreateTimingArgs, 1);
+
+    return CreateTimingArgs.Status;
+}
+
+/**
+ * @brief Creates a CVT 1.x timing, see DisplayInfoRoutinesCreateTimings().
+ *
+ * @param pCreateCvtTimingArgs
+ * @return DDSTATUS
+ */
+DDSTATUS DisplayInfoRoutinesCreateCVTTiming(CREATE_CVT_TIMING_ARGS* pCreateCvtTimingArgs)
+{
+    CREATE_TIMING_ARGS CreateTimingArgs;
+
+    DDASSERT(pCreateCvtTimingArgs);
+
+    CreateTimingArgs.Formula = DD_TIMING_FORMULA_CVT;
+    CreateTimingArgs.Cvt = *pCreateCvtTimingArgs;
+    DisplayInfoRoutinesCreateTimings(&CreateTimingArgs, 1);
+    *pCreateCvtTimingArgs = CreateTimingArgs.Cvt;
+
+    return CreateTimingArgs.Status;
+}
+
+/**
+ * @brief Creates a CVT 2.x (RB2/RB3) timing, see DisplayInfoRoutinesCreateTimings().
+ *
+ * @param pCreateCvtTimingArgs
+ * @return DDSTATUS
+ */
+DDSTATUS DisplayInfoRoutinesCreateCVT2Timing(CREATE_CVT_TIMING_ARGS* pCreateCvtTimingArgs)
+{
+    CREATE_TIMING_ARGS CreateTimingArgs;
+
+    DDASSERT(pCreateCvtTimingArgs);
+
+    CreateTimingArgs.Formula = DD_TIMING_FORMULA_CVT2;
+    CreateTimingArgs.Cvt = *pCreateCvtTimingArgs;
+    DisplayInfoRoutinesCreateTimings(&CreateTimingArgs, 1);
+    *pCreateCvtTimingArgs = CreateTimingArgs.Cvt;
+
+    return CreateTimingArgs.Status;
+}
@@ -66,6 +66,27 @@ typedef struct _CREATE_CVT_TIMING_ARGS
     OUT DD_TIMING_INFO* pTimingInfo;
 } CREATE_CVT_TIMING_ARGS;
 
+// VESA formula used to generate a timing from its resolution and refresh rate
+typedef enum _DD_TIMING_FORMULA
+{
+    DD_TIMING_FORMULA_GTF = 0,
+    DD_TIMING_FORMULA_CVT,  // CVT 1.x, standard or reduced blanking
+    DD_TIMING_FORMULA_CVT2, // CVT 2.x, reduced blanking v2/v3
+    DD_TIMING_FORMULA_MAX
+} DD_TIMING_FORMULA;
+
+// One request of DisplayInfoRoutinesCreateTimings(), Gtf or Cvt args are used based on Formula
+typedef struct _CREATE_TIMING_ARGS
+{
+    IN DD_TIMING_FORMULA Formula;
+    union
+    {
+        DD_IN_OUT CREATE_GTF_TIMING_ARGS Gtf;
+        DD_IN_OUT CREATE_CVT_TIMING_ARGS Cvt;
+    };
+    OUT DDSTATUS Status;
+} CREATE_TIMING_ARGS;
+
 typedef struct _GET_ASPECTRATIO_ARGS
 {
     IN DDU32 XRes;
@@ -107,11 +128,210 @@ typedef struct _GENERIC_DISPLAY_TIMING_DATA
     DDU8 UNIQUENAME(Reserved); // Byte 27: Reserved
 } GENERIC_DISPLAY_TIMING_DATA;
 
+// Instruction set used by bulk routines, ordered so a level implies all lower ones
+typedef enum _DD_SIMD_LEVEL
+{
+    DD_SIMD_LEVEL_SCALAR = 0,
+    DD_SIMD_LEVEL_SSE2,
+    DD_SIMD_LEVEL_AVX2,
+    DD_SIMD_LEVEL_MAX
+} DD_SIMD_LEVEL;
+
+// Per block bitmaps of bulk routines, bit (N % 64) of word (N / 64) is for block N
+#define DD_BLOCK_BITMAP_WORDS(NumBlocks) (((NumBlocks) + 63) / 64)
+#define DD_IS_BLOCK_BIT_SET(pBitmap, Block) (0 != ((pBitmap)[(Block) / 64] & (1ULL << ((Block) % 64))))
+
+// Grid of DisplayInfoRoutinesSweepDscCfgs()
+typedef struct _DSC_CFG_SWEEP_ARGS
+{
+    IN const DD_RX_DSC_CAPS* pSinkDscDecoderCaps; // Sink caps as for DisplayInfoRoutinesCreateDscCfg(), SupportedSlices and CompressionBpc give the slice counts and bpcs swept
+    IN DDU32 PicWidth;
+    IN DDU32 PicHeight;
+    IN DDU32 MinSliceHeight; // Slice heights swept are the divisors of PicHeight from here up
+    IN DDU32 MinBppx16;      // Compressed bpp swept in U6.4, from MinBppx16 to MaxBppx16 in steps of BppStepx16
+    IN DDU32 MaxBppx16;
+    IN DDU32 BppStepx16;
+    IN DD_SIMD_LEVEL SimdLevel; // Lowered to DisplayInfoRoutinesGetSimdLevel(), RC parameters of 8 slice heights at once with AVX2
+} DSC_CFG_SWEEP_ARGS;
+
+// Valid DSC configuration found by DisplayInfoRoutinesSweepDscCfgs()
+typedef struct _DSC_CFG_SWEEP_POINT
+{
+    DDU32 BitsPerComponent;
+    DDU32 Bppx16; // Target compressed bpp in U6.4, not doubled for Native 4:2:2/4:2:0
+    DDU32 SliceCount;
+    DDU32 SliceWidth;
+    DDU32 SliceHeight;
+    DDU32 ChunkSize;
+    DDU32 InitialXmitDelay;
+    DDU32 InitialDecDelay;
+    DDU32 RcbBits;
+} DSC_CFG_SWEEP_POINT;
+
+#define DP_LINK_PLAN_MAX_LINK_RATES 16
+
+// MNTU routine DpProtocolPlanLinkCfgs() checks each link config with
+typedef enum _DP_LINK_PLAN_MNTU_METHOD
+{
+    DP_LINK_PLAN_MNTU_SST = 0,         // DpProtocolSstComputeMNTu(), 8b/10b link rates only
+    DP_LINK_PLAN_MNTU_MST,             // DpProtocolMstComputeMNTuPbn()
+    DP_LINK_PLAN_MNTU_EOC,             // DpProtocolComputeMNTuPbnConsideringEoc()
+    DP_LINK_PLAN_MNTU_LL_SYMBOL_COUNT, // DpProtocolComputeMNTuPbnLinkLayerSymbolCount()
+    DP_LINK_PLAN_MNTU_MAX
+} DP_LINK_PLAN_MNTU_METHOD;
+
+// DP sink and branch caps a link plan is made for
+typedef struct _DP_LINK_PLAN_SINK_CAPS
+{
+    DD_VIDEO_OUTPUT_TECHNOLOGY SinkType; // DSC on an 8b/10b link needs FEC except for eDP
+    DDU8 MaxLaneCount;                   // Lane counts 1, 2 and 4 up to this are planned
+    DDU8 NumLinkRates;
+    DDU32 LinkRatesMbps[DP_LINK_PLAN_MAX_LINK_RATES]; // RBR to UHBR20, in any order
+    DD_BOOL IsMstEnabled;                             // EnableMSTMode, must be set for DP_LINK_PLAN_MNTU_MST
+    DD_BOOL IsSsSbmSupported;
+    DD_BOOL IsFecSupported;
+    DD_BOOL IsSscSupported;
+    DDU32 DpSscOverheadx1e6;
+    DD_BOOL IsDscSupported;
+    DDU8 DscSlicesPerScanline;
+    DDU32 HBlankIncLinkSymbolClocks; // As for DpProtocolComputeMNTuPbnConsideringEoc()
+} DP_LINK_PLAN_SINK_CAPS;
+
+// Modes and candidate configs of DpProtocolPlanLinkCfgs()
+typedef struct _DP_LINK_PLAN_ARGS
+{
+    IN const DD_TABLE* pModeTable; // DD_TIMING_INFO entries, as filled by the EDID parse
+    IN const DP_LINK_PLAN_SINK_CAPS* pSinkCaps;
+    IN DP_LINK_PLAN_MNTU_METHOD MntuMethod;
+    IN const DDU32* pBppx16s; // Uncompressed bpps in U6.4, most preferred first
+    IN DDU32 NumBpps;
+    IN DDU32 MinDscBppx16; // DSC bpps tried after the uncompressed ones, from MaxDscBppx16 down in steps of DscBppStepx16
+    IN DDU32 MaxDscBppx16;
+    IN DDU32 DscBppStepx16;
+} DP_LINK_PLAN_ARGS;
+
+// Link config planned for a mode: the least link bandwidth (lanes x link rate) that carries the first bpp that fits at all
+typedef struct _DP_LINK_PLAN_RESULT
+{
+    DD_BOOL IsFeasible;
+    DDU32 LinkRateMbps;
+    DDU32 LaneCount;
+    DD_BOOL IsDscEnabled;
+    DD_BOOL EnableFec;
+    DD_BOOL EnableSpread;
+    DD_BITS_PER_PIXEL BitsPerPixel;
+    DD_M_N_CONFIG MNTUData; // As computed by the MNTU routine for the planned config
+    DDU32 ActualPBN;        // MST and single stream sideband message only
+    DDU32 AllocatedPBN;
+    DDU32 NumEvaluated; // Configs checked before this one fit
+} DP_LINK_PLAN_RESULT;
+
+#define DP_MST_ALLOC_MAX_STREAMS 64       // Stream sets are DDU64 masks, bit N for stream N
+#define DP_MST_ALLOC_MAX_EXACT_STREAMS 24 // Exact packing and the stream set bitmap go through all 2^N stream sets
+
+// Stream requested on an MST link
+typedef struct _DP_MST_STREAM_REQUEST
+{
+    DDU64 DotClockInHz;
+    DDU32 HActive;
+    DDU32 HTotal;
+    DD_BITS_PER_PIXEL BitsPerPixel; // Compressed bpp when DSC is enabled
+    DD_BOOL IsDscEnabled;
+    DDU8 DscSlicesPerScanline;
+} DP_MST_STREAM_REQUEST;
+
+// MST link config and the streams DpProtocolMstAllocStreams() allocates on it
+typedef struct _DP_MST_ALLOC_ARGS
+{
+    IN DDU32 LinkRateMbps;
+    IN DDU32 LaneCount;
+    IN DD_BOOL EnableFec;
+    IN DD_BOOL EnableSpread;
+    IN DDU32 DpSscOverheadx1e6;
+    IN DP_LINK_PLAN_MNTU_METHOD MntuMethod; // Any but DP_LINK_PLAN_MNTU_SST, which computes no PBN
+    IN DDU32 HBlankIncLinkSymbolClocks;     // As for DpProtocolComputeMNTuPbnConsideringEoc()
+    IN const DP_MST_STREAM_REQUEST* pStreams;
+    IN DDU32 NumStreams; // Up to DP_MST_ALLOC_MAX_STREAMS
+} DP_MST_ALLOC_ARGS;
+
+// VC payload of one stream on the link
+typedef struct _DP_MST_STREAM_ALLOC
+{
+    DDSTATUS Status; // Of the MNTU routine, a stream it fails for is in no stream set that fits
+    DDU32 NumSlots;  // VcPayloadTableNumSlots
+    DDU32 ActualPBN;
+    DDU32 AllocatedPBN;
+} DP_MST_STREAM_ALLOC;
+
+// How DpProtocolMstPackStreams() picks the stream set
+typedef enum _DP_MST_PACK_POLICY
+{
+    DP_MST_PACK_GREEDY = 0, // Streams by fewest time slots first, each one kept if it still fits
+    DP_MST_PACK_EXACT,      // Best of all stream sets, greedy above DP_MST_ALLOC_MAX_EXACT_STREAMS streams
+    DP_MST_PACK_MAX
+} DP_MST_PACK_POLICY;
+
+// Modes and pixel formats of DisplayInfoRoutinesComputeHdmiLinkBudgets()
+typedef struct _HDMI_LINK_BUDGET_ARGS
+{
+    IN const DD_TABLE* pModeTable;   // DD_TIMING_INFO entries, as filled by the EDID parse
+    IN const DD_HDMI_CAPS* pHdmiCaps; // TMDS, FRL, FVA and DSC limits of the HF-VSDB, Max TMDS clock of the HDMI VSDB
+    IN const DDU32* pBpcs;            // Uncompressed bpcs, most preferred first
+    IN DDU32 NumBpcs;
+    IN DDU32 DscBpc;       // Bpc DSC compresses from, 0 for no DSC
+    IN DDU32 MinDscBppx16; // DSC bpps tried after the uncompressed ones, from MaxDscBppx16 down in steps of DscBppStepx16
+    IN DDU32 MaxDscBppx16;
+    IN DDU32 DscBppStepx16;     // Whole bpps only unless the sink supports all DSC bpps
+    IN DDU32 AudioSampleRateHz; // 0 for no audio
+    IN DDU32 AudioChannels;
+} HDMI_LINK_BUDGET_ARGS;
+
+#define HDMI_FRL_HBLANK_AUDIO_MIN_TB 64 // Plus 32 tribytes per audio packet of the line
+#define HDMI_DSC_MAX_SLICE_WIDTH 2720
+
+// Modes DisplayInfoRoutinesComputeHdmiLinkBudgets() computes together, kept as one array per field
+#define HDMI_LINK_BUDGET_BLOCK_MODES 16
+#define HDMI_LINK_BUDGET_NO_LINK 0xFF
+
+// TMDS (FrlRateIndex 0) or FRL link DisplayInfoRoutinesComputeHdmiLinkBudgets() tries modes on
+typedef struct _HDMI_LINK_BUDGET_LINK
+{
+    DDU8 FrlRateIndex;
+    DDU8 LaneCount;
+    DDU32 LinkRateMbps;
+    DDU32 CapCharsPerMs; // FRL characters per ms over all lanes, less tolerance and overheads
+} HDMI_LINK_BUDGET_LINK;
+
+// Link config budgeted for a mode: TMDS, else the lowest FRL rate, that carries the first pixel format that fits at all
+typedef struct _HDMI_LINK_BUDGET_RESULT
+{
+    DDU32 ModeIndex;     // Entry of HDMI_LINK_BUDGET_ARGS::pModeTable the budget is for
+    DDSTATUS Status;     // DDS_SUCCESS if a link fits, else why the most preferred format does not fit on the fastest link
+    DD_BOOL IsFrl;       // FALSE for TMDS
+    DDU8 FrlRateIndex;   // Max_FRL_Rate of the HF-VSDB, 0 for TMDS
+    DDU32 LinkRateMbps;  // Per lane, FRL only
+    DDU8 LaneCount;
+    DDU32 Bpc;
+    DD_BOOL IsDscEnabled;
+    DDU32 DscBppx16;
+    DDU8 DscSlices;
+    DDU64 PixelClockHz;   // Link pixel clock, DotClockInHz times the FVA factor
+    DDU64 TmdsCharRateHz; // TMDS only
+    DDU32 TbBorrowed;     // FRL only, tribytes of active video sent in horizontal blanking
+} HDMI_LINK_BUDGET_RESULT;
+
 //
 // Add other class methods here
 //
 // Other generic methods
 DDU32 DisplayInfoRoutinesGetHdmiLinkBwInMbps(DDU8 MaxFrlRateIndex);
+DDU32 DisplayInfoRoutinesComputeHdmiLinkBudgets(const HDMI_LINK_BUDGET_ARGS* pBudgetArgs, DDU32 FirstMode, DDU32 NumModes, HDMI_LINK_BUDGET_RESULT* pResults);
+DDU8 DisplayInfoRoutinesGetMaxHdmiFrlRateIndex(DDU32 MaxFrlInMbps, DDU8 MaxFrlLaneCount);
+DDU32 DisplayInfoRoutinesGetHdmiBudgetLinks(DDU8 MaxFrlRateIndex, HDMI_LINK_BUDGET_LINK* pLinks);
+DDSTATUS DisplayInfoRoutinesCheckHdmiFrlLine(DDU32 ActiveTb, DDU32 BlankTb, DDU32 AudioMinTb, DDU32 CapCharsPerMs, DDU32 PixelClockKHz, DDU32 HActive,
+                                             DDU32 HBlank);
+DDSTATUS DisplayInfoRoutinesCheckHdmiDscLine(const DD_HF_VSDB_INFO* pHfVsdbInfo, DDU32 Bppx16, DDU32 Slices, DDU32 AudioMinTb, DDU32 CapCharsPerMs,
+                                             DDU32 PixelClockKHz, DDU32 HActive, DDU32 HBlank);
 DDSTATUS DisplayInfoRoutinesGetTimingFromDTD(EDID_DTD_TIMING* pDTD, DD_TIMING_INFO* pTimingInfo);
 DDSTATUS DisplayInfoRoutinesGetTimingFromGenericDTD(GENERIC_DISPLAY_TIMING_DATA* pGenericDisplayTimingData, DD_TIMING_INFO* pTimingInfo);
 DDSTATUS DisplayInfoRoutinesGetDTDFromTimingInfo(DD_TIMING_INFO* pTimingInfo, EDID_DTD_TIMING* pDTD);
@@ -119,11 +339,18 @@ DD_BOOL DisplayInfoRoutinesCanTimingBeFitInEdid(DD_TIMING_INFO* pTimingInfo);
 void DisplayInfoRoutinesUpdateTimingforCustomAlignment(DD_TIMING_INFO* pTimingInfo, DDU32 VDelta, DDU32 HDelta);
 DDSTATUS DisplayInfoRoutinesCreateGTFTiming(CREATE_GTF_TIMING_ARGS* pCreateGTFTimingArgs);
 DDSTATUS DisplayInfoRoutinesCreateCVTTiming(CREATE_CVT_TIMING_ARGS* pCreateCVTTimingArgs);
+DDSTATUS DisplayInfoRoutinesCreateTimings(CREATE_TIMING_ARGS* pCreateTimingArgs, DDU32 NumTimings);
 DD_BOOL DisplayInfoRoutinesIsSamePixelClock(PIXELCLK_COMPARE_ARGS* pPixelClkCompareArgs);
+DD_MEDIA_RR_TYPE DisplayInfoRoutinesGetMediaRrType(const DD_TIMING_INFO* pTimingInfo);
 DDSTATUS DisplayInfoRoutinesGetTimingFromPRTimingForPRMask(DD_TIMING_INFO* pPRTimingInfo, DD_TIMING_INFO* pOutputTimingInfo, DDU8 PRMask);
-DD_BOOL DisplayInfoRoutinesIsSameTiming(DD_TIMING_INFO* pSourceTimings, DD_TIMING_INFO* pTargetTimings);
+DD_BOOL DisplayInfoRoutinesIsSameTiming(const DD_TIMING_INFO* pSourceTimings, const DD_TIMING_INFO* pTargetTimings);
 DDU8 DisplayInfoRoutinesCalcChksum(DDU8* pBuffer, DDU32 BufferLen);
+DD_SIMD_LEVEL DisplayInfoRoutinesGetSimdLevel(void);
+void DisplayInfoRoutinesCheckBlockChksums(const DDU8* pBlocks, DDU32 NumBlocks, DD_SIMD_LEVEL SimdLevel, DDU64* pChksumOkBitmap);
 DD_BOOL DisplayInfoRoutinesCreateDscCfg(DD_RX_DSC_CAPS* pSinkDscDecoderCaps, DD_IN_OUT DSC_CFG* pDscCfg, DD_BOOL OptimizeSliceHeight);
+void DisplayInfoRoutinesGetDscSweepSize(const DSC_CFG_SWEEP_ARGS* pSweepArgs, DDU32* pNumRatePoints, DDU32* pNumSlicePoints);
+DDU32 DisplayInfoRoutinesSweepDscCfgs(const DSC_CFG_SWEEP_ARGS* pSweepArgs, DDU32 FirstRatePoint, DDU32 NumRatePoints, DSC_CFG_SWEEP_POINT* pPoints, DDU32 MaxPoints);
+DD_BOOL DisplayInfoRoutinesCreateDscSweepCfg(const DSC_CFG_SWEEP_ARGS* pSweepArgs, const DSC_CFG_SWEEP_POINT* pPoint, DSC_CFG* pDscCfg);
 
 // DP MNTu methods
 DDSTATUS DpProtocolSstComputeMNTu(DD_IN_OUT DP_LINK_DATA* pDpLinkData);
@@ -132,6 +359,14 @@ DDSTATUS DpProtocolMstComputeMNTuPbn(DD_IN_OUT DP_LINK_DATA* pDpLinkData);
 DDSTATUS DpProtocolComputeMNTuPbnConsideringEoc(DD_IN_OUT DP_LINK_DATA* pDpLinkData);
 DDSTATUS DpProtocolComputeMNTuPbnLinkLayerSymbolCount(DD_IN_OUT DP_LINK_DATA* pDpLinkData);
 DDU64 DpProtocolComputePixelDataBwMbps(DDU64 DotClockInHz, DD_BITS_PER_PIXEL BitsPerPixel);
+void DpProtocolInitLinkPlanData(const DP_LINK_PLAN_ARGS* pPlanArgs, const DD_TIMING_INFO* pMode, DP_LINK_DATA* pDpLinkData);
+DDSTATUS DpProtocolComputeLinkPlanMNTu(DP_LINK_PLAN_MNTU_METHOD MntuMethod, DD_IN_OUT DP_LINK_DATA* pDpLinkData);
+DDU32 DpProtocolPlanLinkCfgs(const DP_LINK_PLAN_ARGS* pPlanArgs, DDU32 FirstMode, DDU32 NumModes, DP_LINK_PLAN_RESULT* pResults);
+void DpProtocolMstGetLinkBudget(DDU32 LaneCount, DDU32 LinkRateMbps, DDU32* pNumSlots, DDU32* pPbn);
+DDU32 DpProtocolMstAllocStreams(const DP_MST_ALLOC_ARGS* pAllocArgs, DP_MST_STREAM_ALLOC* pAllocs);
+DD_BOOL DpProtocolMstDoesStreamSetFit(const DP_MST_ALLOC_ARGS* pAllocArgs, const DP_MST_STREAM_ALLOC* pAllocs, DDU64 StreamSet);
+DDU64 DpProtocolMstGetFittingStreamSets(const DP_MST_ALLOC_ARGS* pAllocArgs, const DP_MST_STREAM_ALLOC* pAllocs, DDU64 FirstSet, DDU64 NumSets, DDU64* pFitBitmap);
+DDU64 DpProtocolMstPackStreams(const DP_MST_ALLOC_ARGS* pAllocArgs, const DP_MST_STREAM_ALLOC* pAllocs, DP_MST_PACK_POLICY Policy);
 DDSTATUS DisplayInfoRoutinesCreateCVT2Timing(CREATE_CVT_TIMING_ARGS* pCreateCvtTimingArgs);
 
 // Populatin Common Edid data for DP/Hdmi
@@ -22,7 +22,7 @@ typedef struct _DD_ALLOCATE_MEM_ARGS
  * @param  size
  * @return void*
  */
-void* Utf_Malloc(uint32_t size)
+DD_INLINE void* Utf_Malloc(uint32_t size)
 {
     void* pMem = NULL;
     pMem = malloc(size);
@@ -41,7 +41,7 @@ void* Utf_Malloc(uint32_t size)
  * @param  pMem
  * @return void
  */
-void Utf_Free(void** pMem)
+DD_INLINE void Utf_Free(void** pMem)
 {
     if (pMem && *pMem)
     {
@@ -62,7 +62,7 @@ void Utf_Free(void** pMem)
  * @param  DD_ALLOCATE_MEM_ARGS
  * @return void
  */
-void ExtAllocateMem(DD_ALLOCATE_MEM_ARGS* pArg)
+DD_INLINE void ExtAllocateMem(DD_ALLOCATE_MEM_ARGS* pArg)
 {
     // arg validation
     if (NULL == pArg)
@@ -82,7 +82,7 @@ void ExtAllocateMem(DD_ALLOCATE_MEM_ARGS* pArg)
  * @param  pArg
  * @return void
  */
-void ExtFreeMem(void* pArg)
+DD_INLINE void ExtFreeMem(void* pArg)
 {
     // arg validation
     if (NULL == pArg)
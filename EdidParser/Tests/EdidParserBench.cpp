@@ -0,0 +1,542 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include "EdidParserBench.h"
+#include "../EdidBatch.h"
+#include "../EdidInputFiles.h"
+#include "../EdidOutputWriters.h"
+
+/**
+ * @brief Measures XML serialization cost per EDID.
+ *
+ *  EdidParserTests --bench-xml <edid file> [iterations]
+ *  Parses the EDID once, then serializes it the given number of times (10000 by default) into a reused buffer
+ *  and reports the average serialization time and output size per EDID. No output file is written.
+ *
+ * @param  argc
+ * @param  argv
+ * @return int
+ */
+int runXmlBenchmark(int argc, char* argv[])
+{
+    EDID_PARSE_SESSION* pSession = nullptr;
+    EDID_MAPPED_FILE MappedFile = { 0 };
+    OUTPUT_WRITER Writer;
+    uint32_t NumIterations = 10000;
+    size_t NumBytes = 0;
+
+    if (argc < 3)
+    {
+        std::cerr << "Usage: EdidParserTests --bench-xml <edid file> [iterations]" << std::endl;
+        return 1;
+    }
+    if ((argc > 3) && (0 == (NumIterations = static_cast<uint32_t>(strtoul(argv[3], nullptr, 10)))))
+    {
+        NumIterations = 1;
+    }
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        return 1;
+    }
+
+    if (!mapEdidFile(argv[2], &MappedFile) || IS_DDSTATUS_ERROR(parseEdid(pSession, MappedFile.pData, MappedFile.SizeInBytes)))
+    {
+        std::cerr << "Invalid EDID " << argv[2] << std::endl;
+        unmapEdidFile(&MappedFile);
+        parseSessionFree(pSession);
+        DD_SAFE_FREE(pSession);
+        return 1;
+    }
+    unmapEdidFile(&MappedFile);
+
+    Writer.Buffer.reserve(OUTPUT_WRITER_RESERVE_SIZE);
+    auto StartTime = std::chrono::steady_clock::now();
+
+    for (uint32_t Iteration = 0; Iteration < NumIterations; Iteration++)
+    {
+        Writer.Buffer.clear();
+        writeXmlEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, nullptr, 0, nullptr, &Writer);
+        NumBytes += Writer.Buffer.size();
+    }
+
+    double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+    std::cout << "Serialized " << pSession->ModeTable.Table.NumEntries << " modes, " << (NumBytes / NumIterations)
+              << " bytes per EDID in " << (Seconds * 1e6 / NumIterations) << " us per EDID (" << NumIterations
+              << " iterations)" << std::endl;
+
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pSession);
+    return 0;
+}
+
+/**
+ * @brief Measures bulk EDID block validation.
+ *
+ *  EdidParserTests --bench-validate <edid file|directory|glob> [blocks]
+ *  Whole 128 byte blocks of the inputs are repeated up to the given number of blocks (1000000 by default), then
+ *  validated with DisplayInfoParserValidateEdidBlocks() at every SIMD level the CPU supports. Reports time per
+ *  block and throughput per level, with the checksum pass timed on its own, and fails if any level's bitmap
+ *  differs from the scalar one.
+ *
+ * @param  argc
+ * @param  argv
+ * @return int
+ */
+int runValidateBenchmark(int argc, char* argv[])
+{
+    std::vector<std::string> Files;
+    std::vector<DDU8> Input;
+    std::vector<DDU8> Blocks;
+    std::vector<DDU64> ScalarBitmap;
+    std::vector<DDU64> Bitmap;
+    uint32_t NumBlocks = 1000000;
+    uint32_t NumInputBlocks;
+    uint32_t NumValid = 0;
+    bool IsMismatch = false;
+    static const char* const SimdLevelNames[DD_SIMD_LEVEL_MAX] = { "scalar", "sse2", "avx2" };
+
+    if (argc < 3)
+    {
+        std::cerr << "Usage: EdidParserTests --bench-validate <edid file|directory|glob> [blocks]" << std::endl;
+        return 1;
+    }
+    if ((argc > 3) && (0 == (NumBlocks = static_cast<uint32_t>(strtoul(argv[3], nullptr, 10)))))
+    {
+        NumBlocks = 1;
+    }
+
+    std::error_code Error;
+    if (std::filesystem::is_regular_file(argv[2], Error))
+    {
+        Files.push_back(argv[2]);
+    }
+    else if (!collectBatchInputs(argv[2], Files))
+    {
+        std::cerr << "Can't read input " << argv[2] << std::endl;
+        return 1;
+    }
+
+    for (const std::string& File : Files)
+    {
+        EDID_MAPPED_FILE MappedFile = { 0 };
+
+        if (mapEdidFile(File, &MappedFile))
+        {
+            Input.insert(Input.end(), MappedFile.pData, MappedFile.pData + (MappedFile.SizeInBytes - (MappedFile.SizeInBytes % EDID_BLOCK_SIZE)));
+            unmapEdidFile(&MappedFile);
+        }
+    }
+
+    NumInputBlocks = static_cast<uint32_t>(Input.size() / EDID_BLOCK_SIZE);
+    if (0 == NumInputBlocks)
+    {
+        std::cerr << "No EDID blocks in " << argv[2] << std::endl;
+        return 1;
+    }
+
+    // Repeat whole inputs only, so an EDID is never split at the end of one repetition
+    Blocks.resize(static_cast<size_t>(NumBlocks) * EDID_BLOCK_SIZE);
+    for (size_t Offset = 0; Offset < Blocks.size(); Offset += Input.size())
+    {
+        memcpy(Blocks.data() + Offset, Input.data(), std::min(Input.size(), Blocks.size() - Offset));
+    }
+
+    ScalarBitmap.resize(DD_BLOCK_BITMAP_WORDS(NumBlocks));
+    Bitmap.resize(DD_BLOCK_BITMAP_WORDS(NumBlocks));
+
+    for (uint32_t Level = DD_SIMD_LEVEL_SCALAR; Level <= static_cast<uint32_t>(DisplayInfoRoutinesGetSimdLevel()); Level++)
+    {
+        std::vector<DDU64>& LevelBitmap = (DD_SIMD_LEVEL_SCALAR == Level) ? ScalarBitmap : Bitmap;
+
+        // Untimed pass to fault in the bitmap and warm caches
+        DisplayInfoParserValidateEdidBlocks(Blocks.data(), NumBlocks, static_cast<DD_SIMD_LEVEL>(Level), LevelBitmap.data());
+
+        auto StartTime = std::chrono::steady_clock::now();
+        DisplayInfoRoutinesCheckBlockChksums(Blocks.data(), NumBlocks, static_cast<DD_SIMD_LEVEL>(Level), LevelBitmap.data());
+        double ChksumSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+        StartTime = std::chrono::steady_clock::now();
+        DisplayInfoParserValidateEdidBlocks(Blocks.data(), NumBlocks, static_cast<DD_SIMD_LEVEL>(Level), LevelBitmap.data());
+        double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+        if ((DD_SIMD_LEVEL_SCALAR != Level) && (Bitmap != ScalarBitmap))
+        {
+            std::cerr << SimdLevelNames[Level] << " bitmap differs from scalar" << std::endl;
+            IsMismatch = true;
+        }
+
+        std::cout << SimdLevelNames[Level] << ": " << (Seconds * 1e9 / NumBlocks) << " ns per block, "
+                  << (static_cast<double>(Blocks.size()) / Seconds / 1e9) << " GB/s (checksums only "
+                  << (ChksumSeconds * 1e9 / NumBlocks) << " ns per block)" << std::endl;
+    }
+
+    for (uint32_t Block = 0; Block < NumBlocks; Block++)
+    {
+        NumValid += DD_IS_BLOCK_BIT_SET(ScalarBitmap.data(), Block) ? 1 : 0;
+    }
+    std::cout << NumValid << " of " << NumBlocks << " blocks valid (" << NumInputBlocks << " input blocks)" << std::endl;
+
+    return IsMismatch ? 1 : 0;
+}
+
+#define BENCH_DEFAULT_TIMINGS 10000
+
+/**
+ * @brief Fills timings with a repeatable mix of sizes, refresh rates, interlace and sampling modes.
+ *
+ *  About one in eight timings repeats an earlier one with a different dot clock or preferred flag, so both the
+ *  replace and the skip paths of commitEntry() get taken.
+ * @param  NumTimings
+ * @param  NumSizes 0 for any size, otherwise sizes are limited to this many so that timings differ mostly in refresh
+ *         rate and sampling mode, like the variants the parser adds for one resolution
+ * @param  Timings
+ * @return void
+ */
+void makeSyntheticTimings(uint32_t NumTimings, uint32_t NumSizes, std::vector<DD_TIMING_INFO>& Timings)
+{
+    static const DDU32 RefreshRates[] = { 24, 25, 30, 48, 50, 60, 72, 75, 100, 120, 144, 165, 240 };
+    uint64_t Seed = 0x9E3779B97F4A7C15ull;
+
+    Timings.resize(NumTimings);
+    for (uint32_t Index = 0; Index < NumTimings; Index++)
+    {
+        DD_TIMING_INFO* pTiming = &Timings[Index];
+
+        // xorshift64, same sequence on every run
+        Seed ^= Seed << 13;
+        Seed ^= Seed >> 7;
+        Seed ^= Seed << 17;
+
+        if ((Index > 0) && (0 == (Seed & 7)))
+        {
+            *pTiming = Timings[(Seed >> 8) % Index];
+            pTiming->DotClockInHz += 1000;
+            pTiming->Flags.PreferredMode = static_cast<DDU8>((Seed >> 40) & 1);
+        }
+        else
+        {
+            DD_ZERO_MEM(pTiming, sizeof(DD_TIMING_INFO));
+            pTiming->HActive = (0 != NumSizes) ? 640 + 160 * static_cast<DDU32>((Seed >> 8) % NumSizes) : 640 + 8 * static_cast<DDU32>((Seed >> 8) % 880);
+            pTiming->VActive = (0 != NumSizes) ? 480 + 90 * static_cast<DDU32>((Seed >> 8) % NumSizes) : 480 + 4 * static_cast<DDU32>((Seed >> 20) % 960);
+            pTiming->HTotal = pTiming->HActive + 160;
+            pTiming->VTotal = pTiming->VActive + 45;
+            pTiming->VRoundedRR = RefreshRates[(Seed >> 32) % (sizeof(RefreshRates) / sizeof(RefreshRates[0]))];
+            pTiming->DotClockInHz = static_cast<DDU64>(pTiming->HTotal) * pTiming->VTotal * pTiming->VRoundedRR;
+            if (0 == ((Seed >> 36) & 3))
+            {
+                // Fractional (1000/1001) media rate
+                pTiming->DotClockInHz = (pTiming->DotClockInHz * 1000) / 1001;
+            }
+            pTiming->IsInterlaced = (0 == ((Seed >> 38) & 15)) ? TRUE : FALSE;
+            pTiming->CeData.SamplingMode.Rgb = ((Seed >> 42) & 1) ? 0 : 1;
+            pTiming->CeData.SamplingMode.Yuv420 = pTiming->CeData.SamplingMode.Rgb ? 0 : 1;
+        }
+    }
+}
+
+/**
+ * @brief Measures mode table population with the linear and the hashed de-dup.
+ *
+ *  EdidParserTests --bench-mode-table [timings]
+ *  Adds the given number of synthetic timings (10000 by default, see makeSyntheticTimings()) to a plain DD_TABLE
+ *  through addEntry(), which matches against every entry, and to a DD_INDEXED_TABLE through addEntryIndexed().
+ *  Reports the time of both and fails if the resulting tables differ.
+ *
+ * @param  argc
+ * @param  argv
+ * @return int
+ */
+int runModeTableBenchmark(int argc, char* argv[])
+{
+    std::vector<DD_TIMING_INFO> Timings;
+    std::vector<DD_TIMING_INFO> LinearEntries;
+    DD_TABLE LinearTable;
+    DD_INDEXED_TABLE IndexedTable;
+    uint32_t NumTimings = BENCH_DEFAULT_TIMINGS;
+    bool IsMismatch = false;
+
+    if ((argc > 2) && (0 == (NumTimings = static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)))))
+    {
+        std::cerr << "Usage: EdidParserTests --bench-mode-table [timings]" << std::endl;
+        return 1;
+    }
+
+    makeSyntheticTimings(NumTimings, 0, Timings);
+
+    // Before: table sized for every timing, linear match
+    LinearEntries.resize(NumTimings);
+    DD_ZERO_MEM(&LinearTable, sizeof(LinearTable));
+    LinearTable.EntrySizeInBytes = sizeof(DD_TIMING_INFO);
+    LinearTable.TableSize = NumTimings;
+    LinearTable.pEntry = LinearEntries.data();
+    LinearTable.pfnAddEntry = addEntry;
+    LinearTable.pfnMatchEntry = matchTargetMode;
+    LinearTable.pfnReplaceEntry = replaceTargetMode;
+
+    auto StartTime = std::chrono::steady_clock::now();
+    for (const DD_TIMING_INFO& Timing : Timings)
+    {
+        LinearTable.pfnAddEntry(&LinearTable, &Timing, FALSE);
+    }
+    double LinearSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+    // After: hashed index, table grows from the session's initial size
+    DD_ZERO_MEM(&IndexedTable, sizeof(IndexedTable));
+    IndexedTable.Table.EntrySizeInBytes = sizeof(DD_TIMING_INFO);
+    IndexedTable.Table.pfnAddEntry = addEntryIndexed;
+    IndexedTable.Table.pfnMatchEntry = matchTargetMode;
+    IndexedTable.Table.pfnReplaceEntry = replaceTargetMode;
+    if (IS_DDSTATUS_ERROR(modeIndexInit(&IndexedTable)) || IS_DDSTATUS_ERROR(modeTableReserve(&IndexedTable, MIN_MODE_TABLE_ENTRIES)))
+    {
+        modeIndexFree(&IndexedTable);
+        return 1;
+    }
+
+    StartTime = std::chrono::steady_clock::now();
+    for (const DD_TIMING_INFO& Timing : Timings)
+    {
+        IndexedTable.Table.pfnAddEntry(&IndexedTable, &Timing, FALSE);
+    }
+    double IndexedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+    IsMismatch = (LinearTable.NumEntries != IndexedTable.Table.NumEntries) ||
+                 (0 != DD_MEM_CMP(LinearTable.pEntry, IndexedTable.Table.pEntry, LinearTable.NumEntries * sizeof(DD_TIMING_INFO)));
+
+    std::cout << NumTimings << " timings, " << LinearTable.NumEntries << " modes" << std::endl;
+    std::cout << "linear (addEntry): " << (LinearSeconds * 1e3) << " ms, " << (LinearSeconds * 1e9 / NumTimings) << " ns per timing" << std::endl;
+    std::cout << "indexed (addEntryIndexed): " << (IndexedSeconds * 1e3) << " ms, " << (IndexedSeconds * 1e9 / NumTimings) << " ns per timing, "
+              << (LinearSeconds / IndexedSeconds) << "x, " << (IsMismatch ? "tables differ" : "same table") << std::endl;
+
+    modeIndexFree(&IndexedTable);
+    return IsMismatch ? 1 : 0;
+}
+
+#define BENCH_ADD_ENTRY_TIMINGS 3000
+#define BENCH_ADD_ENTRY_SIZES 16
+#define BENCH_ADD_ENTRY_ITERATIONS 20
+
+/**
+ * @brief Measures addEntry() throughput with the media RR type classified on every match and with it cached in the key.
+ *
+ *  EdidParserTests --bench-add-entry [timings]
+ *  Adds the given number of synthetic timings (3000 by default) of 16 sizes through addEntry(), so both passes do the
+ *  same linear search. Before: a DD_TABLE of timings matched with matchTargetMode(), which classifies both timings on
+ *  every compare that gets to the media RR type. After: a DD_TABLE of DD_MODE_KEY matched with matchModeKey(), each
+ *  timing classified once by getModeKey() as it is added, as addEntryIndexed() does. Each is repeated 20 times,
+ *  reports adds per second of both and fails if the resulting tables differ.
+ *
+ * @param  argc
+ * @param  argv
+ * @return int
+ */
+int runAddEntryBenchmark(int argc, char* argv[])
+{
+    std::vector<DD_TIMING_INFO> Timings;
+    std::vector<DD_TIMING_INFO> TimingEntries;
+    std::vector<DD_MODE_KEY> KeyEntries;
+    DD_TABLE TimingTable;
+    DD_TABLE KeyTable;
+    DD_MODE_KEY Key;
+    DD_MODE_KEY TimingKey;
+    uint32_t NumTimings = BENCH_ADD_ENTRY_TIMINGS;
+    bool IsMismatch = false;
+
+    if ((argc > 2) && (0 == (NumTimings = static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)))))
+    {
+        std::cerr << "Usage: EdidParserTests --bench-add-entry [timings]" << std::endl;
+        return 1;
+    }
+
+    makeSyntheticTimings(NumTimings, BENCH_ADD_ENTRY_SIZES, Timings);
+
+    // Before: media RR type classified on every match
+    TimingEntries.resize(NumTimings);
+    DD_ZERO_MEM(&TimingTable, sizeof(TimingTable));
+    TimingTable.EntrySizeInBytes = sizeof(DD_TIMING_INFO);
+    TimingTable.TableSize = NumTimings;
+    TimingTable.pEntry = TimingEntries.data();
+    TimingTable.pfnAddEntry = addEntry;
+    TimingTable.pfnMatchEntry = matchTargetMode;
+    TimingTable.pfnReplaceEntry = replaceTargetMode;
+
+    auto StartTime = std::chrono::steady_clock::now();
+    for (uint32_t Iteration = 0; Iteration < BENCH_ADD_ENTRY_ITERATIONS; Iteration++)
+    {
+        TimingTable.NumEntries = 0;
+        for (const DD_TIMING_INFO& Timing : Timings)
+        {
+            TimingTable.pfnAddEntry(&TimingTable, &Timing, FALSE);
+        }
+    }
+    double TimingSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+    // After: media RR type classified once per timing, matches compare cached keys
+    KeyEntries.resize(NumTimings);
+    DD_ZERO_MEM(&KeyTable, sizeof(KeyTable));
+    KeyTable.EntrySizeInBytes = sizeof(DD_MODE_KEY);
+    KeyTable.TableSize = NumTimings;
+    KeyTable.pEntry = KeyEntries.data();
+    KeyTable.pfnAddEntry = addEntry;
+    KeyTable.pfnMatchEntry = matchModeKey;
+
+    StartTime = std::chrono::steady_clock::now();
+    for (uint32_t Iteration = 0; Iteration < BENCH_ADD_ENTRY_ITERATIONS; Iteration++)
+    {
+        KeyTable.NumEntries = 0;
+        for (const DD_TIMING_INFO& Timing : Timings)
+        {
+            DD_ZERO_MEM(&Key, sizeof(Key));
+            getModeKey(&Timing, &Key);
+            KeyTable.pfnAddEntry(&KeyTable, &Key, FALSE);
+        }
+    }
+    double KeySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+    IsMismatch = (TimingTable.NumEntries != KeyTable.NumEntries);
+    for (DDU32 Entry = 0; !IsMismatch && (Entry < TimingTable.NumEntries); Entry++)
+    {
+        getModeKey(&TimingEntries[Entry], &TimingKey);
+        IsMismatch = (FALSE == matchModeKey(&TimingKey, &KeyEntries[Entry], FALSE));
+    }
+
+    std::cout << NumTimings << " timings of " << BENCH_ADD_ENTRY_SIZES << " sizes, " << TimingTable.NumEntries << " modes, " << BENCH_ADD_ENTRY_ITERATIONS
+              << " iterations" << std::endl;
+    std::cout << "classified on match (matchTargetMode): " << (TimingSeconds * 1e3 / BENCH_ADD_ENTRY_ITERATIONS) << " ms, "
+              << (static_cast<double>(NumTimings) * BENCH_ADD_ENTRY_ITERATIONS / TimingSeconds / 1e3) << "k adds/s" << std::endl;
+    std::cout << "cached in key (matchModeKey): " << (KeySeconds * 1e3 / BENCH_ADD_ENTRY_ITERATIONS) << " ms, "
+              << (static_cast<double>(NumTimings) * BENCH_ADD_ENTRY_ITERATIONS / KeySeconds / 1e3) << "k adds/s, " << (TimingSeconds / KeySeconds) << "x, "
+              << (IsMismatch ? "tables differ" : "same table") << std::endl;
+
+    return IsMismatch ? 1 : 0;
+}
+
+#define BENCH_SCALING_EDIDS 1000000
+#define BENCH_SCALING_MAX_THREADS 64
+
+/**
+ * @brief Measures how batch parsing scales with the number of worker threads.
+ *
+ *  EdidParserTests --bench-batch-scaling <dir|glob|manifest> [edids] [max threads]
+ *  Builds a corpus of the given number of EDIDs (1M by default) by repeating the inputs, which are read into memory
+ *  once so that file I/O is not measured. The corpus is then parsed as by --batch --concat, output going to the null
+ *  device, with 1, 2, 4, ... up to max threads (64 by default). Reports throughput, speedup and efficiency
+ *  (speedup / threads) against 1 thread. Thread counts above the number of cores only show the threading overhead.
+ *
+ * @param  argc
+ * @param  argv
+ * @return int 0 if every run parsed all EDIDs
+ */
+int runBatchScalingBenchmark(int argc, char* argv[])
+{
+    BATCH_RUN Run;
+    std::vector<std::string> Files;
+    std::vector<std::string> Inputs;
+    std::vector<uint32_t> ThreadCounts;
+    std::ofstream NullFile;
+    uint32_t NumEdids = BENCH_SCALING_EDIDS;
+    uint32_t MaxThreads = BENCH_SCALING_MAX_THREADS;
+    double BaseSeconds = 0;
+    bool IsFailed = false;
+
+    if ((argc < 3) || !collectBatchInputs(argv[2], Inputs) || ((argc > 3) && (0 == (NumEdids = static_cast<uint32_t>(strtoul(argv[3], nullptr, 10))))) ||
+        ((argc > 4) && (0 == (MaxThreads = static_cast<uint32_t>(strtoul(argv[4], nullptr, 10))))))
+    {
+        std::cerr << "Usage: EdidParserTests --bench-batch-scaling <dir|glob|manifest> [edids] [max threads]" << std::endl;
+        return 1;
+    }
+
+    for (const std::string& Input : Inputs)
+    {
+        EDID_MAPPED_FILE MappedFile = { 0 };
+
+        if (mapEdidFile(Input, &MappedFile))
+        {
+            Files.push_back(Input);
+            Run.MappedFiles.push_back(MappedFile);
+        }
+    }
+    if (Files.empty())
+    {
+        std::cerr << "No EDIDs in " << argv[2] << std::endl;
+        return 1;
+    }
+
+    // Every record is a whole input, repeated round robin
+    Run.Records.reserve(NumEdids);
+    for (uint32_t Index = 0; Index < NumEdids; Index++)
+    {
+        uint32_t FileIndex = static_cast<uint32_t>(Index % Files.size());
+
+        Run.Records.push_back({ FileIndex, static_cast<uint32_t>(Index / Files.size()), 0, Run.MappedFiles[FileIndex].SizeInBytes });
+    }
+
+#ifdef _WIN32
+    NullFile.open("NUL", std::ios::binary);
+#else
+    NullFile.open("/dev/null", std::ios::binary);
+#endif
+    Run.pFiles = &Files;
+    Run.Format = OUTPUT_FORMAT_XML;
+    Run.IsHdmiBudget = false;
+    Run.pCache = nullptr;
+    Run.pConcatFile = &NullFile;
+
+    for (uint32_t NumThreads = 1; NumThreads < MaxThreads; NumThreads *= 2)
+    {
+        ThreadCounts.push_back(NumThreads);
+    }
+    ThreadCounts.push_back(MaxThreads);
+
+    std::cout << NumEdids << " EDIDs from " << Files.size() << " inputs, " << std::thread::hardware_concurrency() << " cores" << std::endl;
+    std::cout << "threads, seconds, EDIDs/s, speedup, efficiency, chunks stolen" << std::endl;
+    for (uint32_t NumThreads : ThreadCounts)
+    {
+        double Seconds = runBatchWorkers(&Run, NumThreads);
+        uint32_t NumParsed = static_cast<uint32_t>(std::count(Run.IsParsed.begin(), Run.IsParsed.end(), TRUE));
+
+        if (1 == NumThreads)
+        {
+            BaseSeconds = Seconds;
+        }
+        std::cout << Run.NumWorkers << ", " << Seconds << ", " << (NumParsed / Seconds) << ", " << (BaseSeconds / Seconds) << ", "
+                  << (100.0 * BaseSeconds / Seconds / Run.NumWorkers) << "%, " << Run.NumSteals << std::endl;
+        if (NumParsed != NumEdids)
+        {
+            std::cerr << (NumEdids - NumParsed) << " EDIDs failed to parse with " << Run.NumWorkers << " threads" << std::endl;
+            IsFailed = true;
+        }
+    }
+
+    if (MaxThreads > std::thread::hardware_concurrency())
+    {
+        std::cout << "Thread counts above " << std::thread::hardware_concurrency() << " cores only show threading overhead, not scaling" << std::endl;
+    }
+
+    for (EDID_MAPPED_FILE& MappedFile : Run.MappedFiles)
+    {
+        unmapEdidFile(&MappedFile);
+    }
+
+    return IsFailed ? 1 : 0;
+}
@@ -0,0 +1,31 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidParserBench.h
+ * @brief Benchmarks of the EdidParser modules, run by EdidParserTests --bench-*.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include "../EdidParseSession.h"
+
+void makeSyntheticTimings(uint32_t NumTimings, uint32_t NumSizes, std::vector<DD_TIMING_INFO>& Timings);
+int runXmlBenchmark(int argc, char* argv[]);
+int runValidateBenchmark(int argc, char* argv[]);
+int runModeTableBenchmark(int argc, char* argv[]);
+int runAddEntryBenchmark(int argc, char* argv[]);
+int runBatchScalingBenchmark(int argc, char* argv[]);
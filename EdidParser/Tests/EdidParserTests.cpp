@@ -0,0 +1,827 @@
+//-----------------------------------------------------------------------------------------------------------
+//
+// INTEL CONFIDENTIAL
+// Copyright (C) 2024 Intel Corporation
+// This software and the related documents are Intel copyrighted materials,
+// and your use of them is governed by the express license under which they were provided to you ("License").
+// Unless the License provides otherwise, you may not use, modify, copy, publish,
+// distribute, disclose or transmit this software or the related documents without
+// Intel's prior written permission. This software and the related documents are provided
+// as is, with no express or implied warranties, other than those that are expressly stated in the License.
+//
+//-----------------------------------------------------------------------------------------------------------
+
+/**
+ *
+ * @file  EdidParserTests.cpp
+ * @brief Checks of the EdidParser modules, run after every build of EdidParserTests.
+ *
+ *  EdidParserTests [assets dir]
+ *  Runs every check on the sample EDIDs of the assets dir (wwwroot/assets by default) and fails if any check fails.
+ *  EdidParserTests --bench-* runs a benchmark instead, see EdidParserBench.h.
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "EdidParserBench.h"
+#include "../EdidBatch.h"
+#include "../EdidBinaryFormat.h"
+#include "../EdidInputFiles.h"
+#include "../EdidLinkPlanners.h"
+#include "../EdidOutputWriters.h"
+
+#define TEST_DEFAULT_ASSETS_DIR "wwwroot/assets"
+#define TEST_BATCH_RECORDS 200
+
+/**
+ * @brief Runs a command line entry point with the given arguments, argv[0] being the test executable.
+ *
+ * @param  pfnRun
+ * @param  Args
+ * @return int exit code of the entry point
+ */
+static int runCommand(int (*pfnRun)(int, char*[]), const std::vector<std::string>& Args)
+{
+    std::vector<std::string> Storage(1, "EdidParserTests");
+    std::vector<char*> Argv;
+
+    Storage.insert(Storage.end(), Args.begin(), Args.end());
+    for (std::string& Arg : Storage)
+    {
+        Argv.push_back(&Arg[0]);
+    }
+    Argv.push_back(nullptr);
+
+    return pfnRun(static_cast<int>(Storage.size()), Argv.data());
+}
+
+/**
+ * @brief Sample EDIDs of the assets dir, other files in it are skipped.
+ *
+ * @param  AssetsDir
+ * @param  Files
+ * @return bool false if there are none
+ */
+static bool collectSampleEdids(const std::string& AssetsDir, std::vector<std::string>& Files)
+{
+    std::vector<std::string> Inputs;
+
+    Files.clear();
+    if (!collectBatchInputs(AssetsDir, Inputs))
+    {
+        return false;
+    }
+    for (const std::string& Input : Inputs)
+    {
+        if (std::filesystem::path(Input).extension() == ".bin")
+        {
+            Files.push_back(Input);
+        }
+    }
+
+    return !Files.empty();
+}
+
+/**
+ * @brief XML written from the parsed caps and modes must be the same as XML written from the binary record of that
+ *        EDID read back in place with EdidBinReadNextRecord.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testBinaryRoundTrip(const std::string& AssetsDir)
+{
+    EDID_PARSE_SESSION* pSession = nullptr;
+    std::vector<std::string> Files;
+    OUTPUT_WRITER Expected;
+    OUTPUT_WRITER Actual;
+    std::string Record;
+    uint32_t NumFailed = 0;
+
+    if (!collectSampleEdids(AssetsDir, Files))
+    {
+        return false;
+    }
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        return false;
+    }
+
+    for (const std::string& File : Files)
+    {
+        EDID_MAPPED_FILE MappedFile = { 0 };
+        EDID_BIN_VIEW View = { 0 };
+        DD_TABLE ModeTable = { 0 };
+        size_t Offset = 0;
+        DDSTATUS Status;
+
+        if (!mapEdidFile(File, &MappedFile) || IS_DDSTATUS_ERROR(parseEdid(pSession, MappedFile.pData, MappedFile.SizeInBytes)))
+        {
+            std::cerr << "Unable to parse " << File << std::endl;
+            unmapEdidFile(&MappedFile);
+            NumFailed++;
+            continue;
+        }
+        unmapEdidFile(&MappedFile);
+
+        Expected.Buffer.clear();
+        writeXmlEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, nullptr, 0, File.c_str(), &Expected);
+        Record.clear();
+        writeBinEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, &Record);
+
+        Actual.Buffer.clear();
+        Status = EdidBinReadNextRecord(reinterpret_cast<const DDU8*>(Record.data()), Record.size(), &Offset, &View);
+        if (IS_DDSTATUS_SUCCESS(Status) && (Offset == Record.size()))
+        {
+            ModeTable.TableSize = View.NumTimings;
+            ModeTable.NumEntries = View.NumTimings;
+            ModeTable.EntrySizeInBytes = sizeof(DD_TIMING_INFO);
+            ModeTable.pEntry = const_cast<DD_TIMING_INFO*>(View.pTimings);
+            writeXmlEdid(View.pCaps, &ModeTable, nullptr, 0, File.c_str(), &Actual);
+        }
+
+        if (Actual.Buffer != Expected.Buffer)
+        {
+            std::cerr << "Round trip mismatch for " << File << " (status 0x" << std::hex << Status << std::dec << ")" << std::endl;
+            NumFailed++;
+        }
+    }
+
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pSession);
+    return 0 == NumFailed;
+}
+
+/**
+ * @brief Runs a batch over the sample EDIDs repeated TEST_BATCH_RECORDS times, concat output going to a string.
+ *
+ * @param  Files
+ * @param  MappedFiles
+ * @param  Format
+ * @param  NumThreads
+ * @param  pCache NULL to parse every EDID
+ * @param  Output
+ * @return bool false if any EDID failed to parse
+ */
+static bool runSampleBatch(const std::vector<std::string>& Files, const std::vector<EDID_MAPPED_FILE>& MappedFiles, OUTPUT_FORMAT Format,
+                           uint32_t NumThreads, PARSE_CACHE* pCache, std::string& Output)
+{
+    BATCH_RUN Run;
+    std::ostringstream ConcatStream;
+
+    Run.pFiles = &Files;
+    Run.MappedFiles = MappedFiles;
+    Run.Format = Format;
+    Run.IsHdmiBudget = false;
+    Run.pCache = pCache;
+    Run.pConcatFile = &ConcatStream;
+    for (uint32_t Index = 0; Index < TEST_BATCH_RECORDS; Index++)
+    {
+        // Runs of the same EDID, so that a small cache both hits and evicts
+        uint32_t FileIndex = static_cast<uint32_t>(Index * Files.size() / TEST_BATCH_RECORDS);
+
+        Run.Records.push_back({ FileIndex, Index, 0, MappedFiles[FileIndex].SizeInBytes });
+    }
+
+    runBatchWorkers(&Run, NumThreads);
+    Output = ConcatStream.str();
+
+    return std::count(Run.IsParsed.begin(), Run.IsParsed.end(), TRUE) == TEST_BATCH_RECORDS;
+}
+
+/**
+ * @brief Concat output of a batch must not depend on the number of workers, work stealing or the parse cache.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testBatchWorkers(const std::string& AssetsDir)
+{
+    static const OUTPUT_FORMAT Formats[] = { OUTPUT_FORMAT_XML, OUTPUT_FORMAT_BIN, OUTPUT_FORMAT_NDJSON };
+    std::vector<std::string> Files;
+    std::vector<EDID_MAPPED_FILE> MappedFiles;
+    bool IsSame = true;
+
+    if (!collectSampleEdids(AssetsDir, Files))
+    {
+        return false;
+    }
+    for (const std::string& File : Files)
+    {
+        MappedFiles.emplace_back();
+        if (!mapEdidFile(File, &MappedFiles.back()))
+        {
+            return false;
+        }
+    }
+
+    for (OUTPUT_FORMAT Format : Formats)
+    {
+        PARSE_CACHE Cache;
+        std::string Expected;
+        std::string Actual;
+
+        Cache.MaxEntries = 2;
+        Cache.NumHits = 0;
+        Cache.NumDiskHits = 0;
+        Cache.NumMisses = 0;
+        Cache.NumEvictions = 0;
+
+        IsSame = IsSame && runSampleBatch(Files, MappedFiles, Format, 1, nullptr, Expected);
+        IsSame = IsSame && runSampleBatch(Files, MappedFiles, Format, 4, nullptr, Actual) && (Actual == Expected);
+        IsSame = IsSame && runSampleBatch(Files, MappedFiles, Format, 4, &Cache, Actual) && (Actual == Expected) && (Cache.NumHits > 0);
+    }
+
+    for (EDID_MAPPED_FILE& MappedFile : MappedFiles)
+    {
+        unmapEdidFile(&MappedFile);
+    }
+
+    return IsSame;
+}
+
+/**
+ * @brief Parses a buffer exactly the size of the input, so that a read past it is caught by heap checkers.
+ *
+ * @param  pSession
+ * @param  Edid
+ * @param  Modes Mode table of the parse
+ * @return bool false if parse failed
+ */
+static bool parseExactBuffer(EDID_PARSE_SESSION* pSession, const std::vector<DDU8>& Edid, std::vector<DD_TIMING_INFO>& Modes)
+{
+    DDU8* pEdid = static_cast<DDU8*>(DD_ALLOC_MEM(static_cast<DDU32>(Edid.size())));
+    DDSTATUS Status;
+
+    if (NULL == pEdid)
+    {
+        return false;
+    }
+    memcpy(pEdid, Edid.data(), Edid.size());
+    Status = parseEdid(pSession, pEdid, Edid.size());
+    DD_SAFE_FREE(pEdid);
+
+    Modes.assign(static_cast<DD_TIMING_INFO*>(pSession->ModeTable.Table.pEntry),
+                 static_cast<DD_TIMING_INFO*>(pSession->ModeTable.Table.pEntry) + pSession->ModeTable.Table.NumEntries);
+    return IS_DDSTATUS_SUCCESS(Status);
+}
+
+/**
+ * @brief Display ID sections and data blocks that run past the buffer, or past their section, are dropped instead
+ *        of being read.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testMalformedDisplayId(const std::string& AssetsDir)
+{
+    // Display ID 1.2 section holding a single type I timing of 1920x1080 at 148.5 MHz
+    static const DDU8 Section[] = {
+        0x12, 23, 0, 0,
+        DID_DATA_BLOCK_DETAILED_TIMING_1, 0, 20,
+        0x01, 0x3A, 0x00, 0x80, 0x7F, 0x07, 0x17, 0x01, 0x57, 0x00, 0x2B, 0x00, 0x37, 0x04, 0x2C, 0x00, 0x03, 0x00, 0x04, 0x00,
+        0x00,
+    };
+    EDID_PARSE_SESSION* pSession = nullptr;
+    std::vector<DD_TIMING_INFO> Expected;
+    std::vector<DD_TIMING_INFO> Actual;
+    std::vector<DDU8> Edid;
+    bool IsPassed = true;
+
+    (void)AssetsDir;
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        return false;
+    }
+
+    // Well formed section, padded to the smallest buffer parseEdid takes
+    Edid.assign(Section, Section + sizeof(Section));
+    Edid.resize(EDID_BLOCK_SIZE - 1, 0);
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Expected) && !Expected.empty();
+
+    // Section claims 255 extension sections, none of which are in the buffer
+    Edid[3] = 255;
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Actual) && (Actual.size() == Expected.size()) &&
+               (0 == memcmp(Actual.data(), Expected.data(), Actual.size() * sizeof(DD_TIMING_INFO)));
+
+    // Base section larger than the buffer
+    Edid.assign(EDID_BLOCK_SIZE - 1, 0);
+    Edid[0] = 0x12;
+    Edid[1] = MAX_SECTION_DATA_SIZE;
+    Edid[3] = 255;
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Actual) && Actual.empty();
+
+    // Timing block runs past its section
+    Edid.assign(Section, Section + sizeof(Section));
+    Edid.resize(EDID_BLOCK_SIZE - 1, 0);
+    Edid[1] = 20;
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Actual) && Actual.empty();
+
+    // Type III timing with a reserved aspect ratio, past the end of the Display ID aspect ratio table
+    Edid.assign(EDID_BLOCK_SIZE - 1, 0);
+    Edid[0] = 0x12;
+    Edid[1] = 6;
+    Edid[4] = DID_DATA_BLOCK_SHORT_TIMING_3;
+    Edid[6] = 3;
+    Edid[7] = 0x0F;
+    Edid[8] = 0xEF;
+    Edid[9] = 59;
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Actual) && Actual.empty();
+
+    // Type IV timing of CTA VIC 219 (4096x2160 at 120 Hz), past the SVD byte range that indexes the CE table directly
+    Edid.assign(EDID_BLOCK_SIZE - 1, 0);
+    Edid[0] = 0x12;
+    Edid[1] = 4;
+    Edid[4] = DID_DATA_BLOCK_DMTID_CODE_TIMING_4;
+    Edid[5] = TIMING_CODE_CEA_VIC << 6;
+    Edid[6] = 1;
+    Edid[7] = 219;
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Actual) && (1 == Actual.size()) && (4096 == Actual[0].HActive);
+
+    // EDID header in a buffer short of a base block
+    Edid.assign(EDID_BLOCK_SIZE - 1, 0xFF);
+    memcpy(Edid.data(), BaseEdidHeader, EDID_HEADER_SIZE);
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Actual) && Actual.empty();
+
+    // Display ID extension of an EDID whose section runs past the extension block, last in the buffer
+    Edid.assign(2 * EDID_BLOCK_SIZE, 0);
+    memcpy(Edid.data(), BaseEdidHeader, EDID_HEADER_SIZE);
+    Edid[126] = 1;
+    Edid[EDID_BLOCK_SIZE] = DID_EXT_TAG;
+    memcpy(&Edid[EDID_BLOCK_SIZE + 1], Section, sizeof(Section));
+    Edid[EDID_BLOCK_SIZE + 2] = MAX_SECTION_DATA_SIZE;
+    Edid[EDID_BLOCK_SIZE + 1 + sizeof(DISPLAYID_HEADER) + 2] = 255;
+    IsPassed = IsPassed && parseExactBuffer(pSession, Edid, Actual);
+
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pSession);
+    return IsPassed;
+}
+
+/**
+ * @brief Caps and modes parsed in one walk match those of separate caps and modes calls, on all samples.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testCapsAndModesWalk(const std::string& AssetsDir)
+{
+    std::vector<std::string> Files;
+    EDID_PARSE_SESSION* pSession = nullptr;
+    EDID_PARSE_SESSION* pTwoPassSession = nullptr;
+    DD_GET_EDID_CAPS GetEdidCaps = { 0 };
+    DD_GET_EDID_MODES GetEdidModes = { 0 };
+    bool IsPassed = collectSampleEdids(AssetsDir, Files);
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    pTwoPassSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || (NULL == pTwoPassSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        DD_SAFE_FREE(pTwoPassSession);
+        return false;
+    }
+    if (IS_DDSTATUS_ERROR(parseSessionInit(pTwoPassSession)))
+    {
+        parseSessionFree(pSession);
+        DD_SAFE_FREE(pSession);
+        DD_SAFE_FREE(pTwoPassSession);
+        return false;
+    }
+
+    for (size_t Index = 0; IsPassed && (Index < Files.size()); Index++)
+    {
+        EDID_MAPPED_FILE MappedFile = { 0 };
+
+        if (!mapEdidFile(Files[Index], &MappedFile))
+        {
+            IsPassed = false;
+            break;
+        }
+
+        IsPassed = IS_DDSTATUS_SUCCESS(parseEdid(pSession, MappedFile.pData, MappedFile.SizeInBytes));
+
+        modeIndexReset(&pTwoPassSession->ModeTable);
+        memset(&pTwoPassSession->EdidCaps, 0, sizeof(DD_DISPLAY_CAPS));
+        DisplayInfoParserContextReset(&pTwoPassSession->ParserContext);
+
+        GetEdidCaps.BufSizeInBytes = static_cast<DDU32>(MappedFile.SizeInBytes);
+        GetEdidCaps.pEdidOrDisplayIDBuf = MappedFile.pData;
+        GetEdidCaps.NumEdidExtensionsParsed = MappedFile.pData[126];
+        GetEdidCaps.pData = &pTwoPassSession->EdidCaps;
+        GetEdidCaps.pParserContext = &pTwoPassSession->ParserContext;
+        DisplayInfoParserGetEdidCaps(&GetEdidCaps);
+
+        GetEdidModes.BufSizeInBytes = GetEdidCaps.BufSizeInBytes;
+        GetEdidModes.pEdidOrDisplayIDBuf = GetEdidCaps.pEdidOrDisplayIDBuf;
+        GetEdidModes.NumEdidExtensionsParsed = GetEdidCaps.NumEdidExtensionsParsed;
+        GetEdidModes.pModeTable = &pTwoPassSession->ModeTable.Table;
+        GetEdidModes.pParserContext = &pTwoPassSession->ParserContext;
+        DisplayInfoParserGetEdidModes(&GetEdidModes);
+
+        IsPassed = IsPassed && (0 == memcmp(&pSession->EdidCaps, &pTwoPassSession->EdidCaps, sizeof(DD_DISPLAY_CAPS))) &&
+                   (pSession->ModeTable.Table.NumEntries == pTwoPassSession->ModeTable.Table.NumEntries) &&
+                   (0 == memcmp(pSession->ModeTable.Table.pEntry, pTwoPassSession->ModeTable.Table.pEntry,
+                                pSession->ModeTable.Table.NumEntries * sizeof(DD_TIMING_INFO)));
+        if (!IsPassed)
+        {
+            std::cerr << "Caps or modes differ from separate calls for " << Files[Index] << std::endl;
+        }
+        unmapEdidFile(&MappedFile);
+    }
+
+    parseSessionFree(pTwoPassSession);
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pTwoPassSession);
+    DD_SAFE_FREE(pSession);
+    return IsPassed;
+}
+
+/**
+ * @brief Packed dumps split on base blocks, non EDID blocks and a record cut short of its extensions are skipped.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testSplitEdidRecords(const std::string& AssetsDir)
+{
+    std::vector<EDID_RECORD> Records;
+    std::vector<DDU8> Dump(6 * EDID_BLOCK_SIZE, 0);
+    size_t Skipped;
+
+    (void)AssetsDir;
+
+    // Base block with 1 extension, a block of garbage, base block without extensions, base block asking for 2
+    // extensions with only 1 left in the dump
+    for (size_t Offset : { size_t(0), size_t(3), size_t(4) })
+    {
+        memcpy(&Dump[Offset * EDID_BLOCK_SIZE], BaseEdidHeader, EDID_HEADER_SIZE);
+    }
+    Dump[126] = 1;
+    Dump[4 * EDID_BLOCK_SIZE + 126] = 2;
+
+    Skipped = splitEdidRecords(Dump.data(), Dump.size(), 7, Records);
+
+    return (2 == Records.size()) && (0 == Records[0].Offset) && ((2 * EDID_BLOCK_SIZE) == Records[0].SizeInBytes) &&
+           ((3 * EDID_BLOCK_SIZE) == Records[1].Offset) && (EDID_BLOCK_SIZE == Records[1].SizeInBytes) && (1 == Records[1].RecordInFile) &&
+           (7 == Records[1].FileIndex) && ((3 * EDID_BLOCK_SIZE) == Skipped);
+}
+
+/**
+ * @brief Inputs sharing a file name, ignoring case, get their input index appended.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testBatchOutputNames(const std::string& AssetsDir)
+{
+    std::vector<std::string> OutNames;
+
+    (void)AssetsDir;
+    makeBatchOutputNames({ "a/edid.bin", "b/EDID.bin", "c/other.bin" }, OutNames);
+
+    return OutNames == std::vector<std::string>({ "edid.bin.0", "EDID.bin.1", "other.bin" });
+}
+
+/**
+ * @brief Mode table built with the hashed index must be the one built by the linear de-dup.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testModeTableIndex(const std::string& AssetsDir)
+{
+    (void)AssetsDir;
+    return 0 == runCommand(runModeTableBenchmark, { "--bench-mode-table", "2000" });
+}
+
+/**
+ * @brief Matching cached mode keys must build the table that matching timings does.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testModeKeyMatch(const std::string& AssetsDir)
+{
+    (void)AssetsDir;
+    return 0 == runCommand(runAddEntryBenchmark, { "--bench-add-entry", "1000" });
+}
+
+/**
+ * @brief Block validation must give the scalar bitmap at every SIMD level the CPU supports.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testValidateSimdLevels(const std::string& AssetsDir)
+{
+    return 0 == runCommand(runValidateBenchmark, { "--bench-validate", AssetsDir, "4099" });
+}
+
+/**
+ * @brief Each descriptor of a Type III block adds its own CVT timing.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testType3Timings(const std::string& AssetsDir)
+{
+    EDID_PARSE_SESSION* pSession = nullptr;
+    std::vector<DD_TIMING_INFO> Modes;
+    std::vector<DDU8> Edid(EDID_BLOCK_SIZE - 1, 0);
+    bool IsPassed = false;
+
+    (void)AssetsDir;
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        return false;
+    }
+
+    // Display ID 1.2 section with a Type III block of 1920x1080 at 60 Hz and 1280x720 at 50 Hz, both 16:9
+    Edid[0] = 0x12;
+    Edid[1] = 9;
+    Edid[4] = DID_DATA_BLOCK_SHORT_TIMING_3;
+    Edid[6] = 6;
+    Edid[7] = 0x04;
+    Edid[8] = 239;
+    Edid[9] = 59;
+    Edid[10] = 0x04;
+    Edid[11] = 159;
+    Edid[12] = 49;
+    if (parseExactBuffer(pSession, Edid, Modes) && (2 == Modes.size()))
+    {
+        std::sort(Modes.begin(), Modes.end(), [](const DD_TIMING_INFO& A, const DD_TIMING_INFO& B) { return A.HActive < B.HActive; });
+        IsPassed = (1280 == Modes[0].HActive) && (720 == Modes[0].VActive) && (1920 == Modes[1].HActive) && (1080 == Modes[1].VActive);
+    }
+
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pSession);
+    return IsPassed;
+}
+
+/**
+ * @brief DSC sweep at every SIMD level must match the per point configurations.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testDscSweep(const std::string& AssetsDir)
+{
+    (void)AssetsDir;
+    return (0 == runCommand(runDscSweep, { "--dsc-sweep", "1920x1080", "--threads", "2", "--verify" })) &&
+           (0 == runCommand(runDscSweep, { "--dsc-sweep", "3840x2160", "--sampling", "native420", "--bpp", "6-12", "--verify" }));
+}
+
+/**
+ * @brief DSC sweep must not report a bpp past the last column of its QP table: 2 x bpc for native 4:2:2, 1.5 x bpc
+ *        for native 4:2:0 and 3 x bpc otherwise, each plus the 7/16 bpp the last column covers.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testDscQpTableBounds(const std::string& AssetsDir)
+{
+    static const struct
+    {
+        const char* pSampling;
+        uint32_t MaxBppx2PerBpc; // Last QP table column, in bpp x 2 per bpc
+    } Samplings[] = { { "rgb", 6 }, { "native422", 4 }, { "native420", 3 } };
+    std::string CsvPath = (std::filesystem::temp_directory_path() / "EdidParserTestsDscQp.csv").string();
+    uint32_t NumFailed = 0;
+
+    (void)AssetsDir;
+    for (const auto& Sampling : Samplings)
+    {
+        for (uint32_t Bpc : { 8u, 10u, 12u })
+        {
+            std::ifstream Csv;
+            std::string Line;
+            double MaxBpp = static_cast<double>(Bpc * Sampling.MaxBppx2PerBpc) / 2 + 7.0 / 16;
+            bool IsFound = false;
+            bool IsBounded = (0 == runCommand(runDscSweep, { "--dsc-sweep", "1920x1080", "--sampling", Sampling.pSampling, "--bpc", std::to_string(Bpc),
+                                                             "--bpp", "8-40/0.5", "--slices", "2", "--threads", "1", "--out", CsvPath }));
+
+            Csv.open(CsvPath);
+            std::getline(Csv, Line);
+            while (IsBounded && std::getline(Csv, Line))
+            {
+                double Bpp = atof(Line.c_str() + Line.find(',') + 1);
+
+                IsFound = IsFound || (Bpp + 1 > MaxBpp);
+                IsBounded = (Bpp <= MaxBpp);
+            }
+            if (!IsBounded || !IsFound)
+            {
+                std::cerr << Sampling.pSampling << " " << Bpc << " bpc: " << (IsBounded ? "no point up to the last QP table column" : Line) << std::endl;
+                NumFailed++;
+            }
+        }
+    }
+    std::filesystem::remove(CsvPath);
+
+    return 0 == NumFailed;
+}
+
+/**
+ * @brief DP link plan of every sample EDID must match every link config computed on its own.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testDpLinkPlan(const std::string& AssetsDir)
+{
+    std::vector<std::string> Files;
+    bool IsSame = collectSampleEdids(AssetsDir, Files);
+
+    for (const std::string& File : Files)
+    {
+        IsSame = IsSame && (0 == runCommand(runDpLinkPlan, { "--dp-plan", File, "--verify" })) &&
+                 (0 == runCommand(runDpLinkPlan, { "--dp-plan", File, "--mst", "--mntu", "llsc", "--verify" }));
+    }
+
+    return IsSame;
+}
+
+/**
+ * @brief MST stream allocation must match every stream set checked on its own.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testMstAlloc(const std::string& AssetsDir)
+{
+    (void)AssetsDir;
+    return 0 == runCommand(runMstAlloc, { "--mst-alloc", "4x8100", "3840x2160@60", "1920x1080@60", "2560x1440@144:dsc2", "1920x1080@240", "--verify" });
+}
+
+/**
+ * @brief HDMI link budget of every sample EDID must match every (format, link) checked on its own.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testHdmiLinkBudget(const std::string& AssetsDir)
+{
+    std::vector<std::string> Files;
+    bool IsSame = collectSampleEdids(AssetsDir, Files);
+
+    for (const std::string& File : Files)
+    {
+        IsSame = IsSame && (0 == runCommand(runHdmiLinkBudget, { "--hdmi-budget", File, "--verify" }));
+    }
+
+    return IsSame;
+}
+
+/**
+ * @brief Every mode must get one HDMI link budget in XML and NDJSON outputs, naming the mode it is for.
+ *
+ * @param  AssetsDir
+ * @return bool
+ */
+static bool testHdmiLinkBudgetOutputs(const std::string& AssetsDir)
+{
+    EDID_PARSE_SESSION* pSession = nullptr;
+    std::vector<HDMI_LINK_BUDGET_RESULT> HdmiBudgets;
+    std::vector<std::string> Files;
+    OUTPUT_WRITER Xml;
+    OUTPUT_WRITER Json;
+    uint32_t NumFailed = 0;
+
+    if (!collectSampleEdids(AssetsDir, Files))
+    {
+        return false;
+    }
+
+    pSession = static_cast<EDID_PARSE_SESSION*>(DD_ALLOC_MEM(sizeof(EDID_PARSE_SESSION)));
+    if ((NULL == pSession) || IS_DDSTATUS_ERROR(parseSessionInit(pSession)))
+    {
+        DD_SAFE_FREE(pSession);
+        return false;
+    }
+
+    for (const std::string& File : Files)
+    {
+        EDID_MAPPED_FILE MappedFile = { 0 };
+        size_t XmlOffset = 0;
+        size_t JsonOffset = 0;
+        bool IsSame;
+
+        if (!mapEdidFile(File, &MappedFile) || IS_DDSTATUS_ERROR(parseEdid(pSession, MappedFile.pData, MappedFile.SizeInBytes)))
+        {
+            std::cerr << "Unable to parse " << File << std::endl;
+            unmapEdidFile(&MappedFile);
+            NumFailed++;
+            continue;
+        }
+        unmapEdidFile(&MappedFile);
+
+        computeHdmiLinkBudgets(pSession, HdmiBudgets);
+        Xml.Buffer.clear();
+        writeXmlEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, HdmiBudgets.data(), static_cast<DDU32>(HdmiBudgets.size()), nullptr, &Xml);
+        Json.Buffer.clear();
+        writeJsonEdid(&pSession->EdidCaps, &pSession->ModeTable.Table, HdmiBudgets.data(), static_cast<DDU32>(HdmiBudgets.size()), nullptr, &Json);
+
+        IsSame = (HdmiBudgets.size() == pSession->ModeTable.Table.NumEntries);
+        for (DDU32 Mode = 0; IsSame && (Mode < HdmiBudgets.size()); Mode++)
+        {
+            std::string XmlBudget = "<Budget NumAdded = \"" + std::to_string(Mode + 1) + "\"";
+            std::string JsonBudget = "{\"ModeIndex\":" + std::to_string(Mode) + ",";
+
+            XmlOffset = Xml.Buffer.find(XmlBudget, XmlOffset);
+            JsonOffset = Json.Buffer.find(JsonBudget, JsonOffset);
+            IsSame = (HdmiBudgets[Mode].ModeIndex == Mode) && (std::string::npos != XmlOffset) && (std::string::npos != JsonOffset);
+        }
+        if (!IsSame)
+        {
+            std::cerr << "HDMI link budget outputs mismatch for " << File << std::endl;
+            NumFailed++;
+        }
+    }
+
+    parseSessionFree(pSession);
+    DD_SAFE_FREE(pSession);
+
+    return 0 == NumFailed;
+}
+
+/**
+ * @brief A check, passed the assets dir.
+ */
+typedef struct _EDID_PARSER_TEST
+{
+    const char* pName;
+    bool (*pfnTest)(const std::string& AssetsDir);
+} EDID_PARSER_TEST;
+
+static const EDID_PARSER_TEST Tests[] = {
+    { "binary round trip", testBinaryRoundTrip },
+    { "batch workers", testBatchWorkers },
+    { "malformed Display ID", testMalformedDisplayId },
+    { "caps and modes walk", testCapsAndModesWalk },
+    { "split packed records", testSplitEdidRecords },
+    { "batch output names", testBatchOutputNames },
+    { "mode table index", testModeTableIndex },
+    { "mode key match", testModeKeyMatch },
+    { "validate SIMD levels", testValidateSimdLevels },
+    { "Type III timings", testType3Timings },
+    { "DSC sweep", testDscSweep },
+    { "DSC QP table bounds", testDscQpTableBounds },
+    { "DP link plan", testDpLinkPlan },
+    { "MST allocation", testMstAlloc },
+    { "HDMI link budget", testHdmiLinkBudget },
+    { "HDMI link budget outputs", testHdmiLinkBudgetOutputs },
+};
+
+int main(int argc, char* argv[])
+{
+    std::string AssetsDir = TEST_DEFAULT_ASSETS_DIR;
+    uint32_t NumFailed = 0;
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "--bench-xml")))
+        return runXmlBenchmark(argc, argv);
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "--bench-validate")))
+        return runValidateBenchmark(argc, argv);
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "--bench-mode-table")))
+        return runModeTableBenchmark(argc, argv);
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "--bench-add-entry")))
+        return runAddEntryBenchmark(argc, argv);
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "--bench-batch-scaling")))
+        return runBatchScalingBenchmark(argc, argv);
+
+    if (argc > 1)
+    {
+        AssetsDir = argv[1];
+    }
+
+    for (const EDID_PARSER_TEST& Test : Tests)
+    {
+        bool IsPassed = Test.pfnTest(AssetsDir);
+
+        std::cout << (IsPassed ? "[  OK  ] " : "[ FAIL ] ") << Test.pName << std::endl;
+        NumFailed += IsPassed ? 0 : 1;
+    }
+    std::cout << (sizeof(Tests) / sizeof(Tests[0]) - NumFailed) << " of " << (sizeof(Tests) / sizeof(Tests[0])) << " checks passed" << std::endl;
+
+    return (0 == NumFailed) ? 0 : 1;
+}